@@ -199,6 +199,7 @@ void enableAutoLnaBypass(sl_cli_command_arg_t *arguments);
 void getSyncWords(sl_cli_command_arg_t *arguments);
 void printRxErrors(sl_cli_command_arg_t *arguments);
 void printRxFreqOffsets(sl_cli_command_arg_t *arguments);
+void printRxPayloadFormat(sl_cli_command_arg_t *arguments);
 void printDataRates(sl_cli_command_arg_t *arguments);
 void stopInfinitePreambleTx(sl_cli_command_arg_t *arguments);
 void cliSeparatorHack(sl_cli_command_arg_t *arguments);
@@ -360,6 +361,8 @@ void configPrintEvents(sl_cli_command_arg_t *arguments);
 void printChipFeatures(sl_cli_command_arg_t *arguments);
 void getMemWord(sl_cli_command_arg_t *arguments);
 void setMemWord(sl_cli_command_arg_t *arguments);
+void getNvm3Stats(sl_cli_command_arg_t *arguments);
+void getHeapProfile(sl_cli_command_arg_t *arguments);
 void throughput(sl_cli_command_arg_t *arguments);
 void setRssiOffset(sl_cli_command_arg_t *arguments);
 void getRssiOffset(sl_cli_command_arg_t *arguments);
@@ -369,6 +372,7 @@ void txAtTime(sl_cli_command_arg_t *arguments);
 void txAtTimeN(sl_cli_command_arg_t *arguments);
 void setFreqOffset(sl_cli_command_arg_t *arguments);
 void holdRx(sl_cli_command_arg_t *arguments);
+void zeroCopyRx(sl_cli_command_arg_t *arguments);
 void wait(sl_cli_command_arg_t *arguments);
 void clearScript(sl_cli_command_arg_t *arguments);
 void printScript(sl_cli_command_arg_t *arguments);
@@ -852,6 +856,12 @@ static const sl_cli_command_info_t cli_cmd__printRxFreqOffsets = \
                   "[0=Disable] 1=Enable" SL_CLI_UNIT_SEPARATOR,
                  {SL_CLI_ARG_UINT8, SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd__printRxPayloadFormat = \
+  SL_CLI_COMMAND(printRxPayloadFormat,
+                 "Get/Set the format used to print RX packet payloads.",
+                  "[0=Bytes] 1=Hex 2=Base64" SL_CLI_UNIT_SEPARATOR,
+                 {SL_CLI_ARG_UINT8OPT, SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd__printDataRates = \
   SL_CLI_COMMAND(printDataRates,
                  "Print the data rates of the current PHY.",
@@ -1818,6 +1828,18 @@ static const sl_cli_command_info_t cli_cmd__setmemw = \
                   "address" SL_CLI_UNIT_SEPARATOR "value0 value1 ..." SL_CLI_UNIT_SEPARATOR,
                  {SL_CLI_ARG_UINT32, SL_CLI_ARG_UINT32OPT, SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd__getNvm3Stats = \
+  SL_CLI_COMMAND(getNvm3Stats,
+                 "Print NVM3 wear statistics and the erase count of each page.",
+                  "[0=Keep] 1=Clear statistics after printing" SL_CLI_UNIT_SEPARATOR,
+                 {SL_CLI_ARG_UINT8OPT, SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd__getHeapProfile = \
+  SL_CLI_COMMAND(getHeapProfile,
+                 "Print the heap usage of each allocation call site.",
+                  "[0=Keep] 1=Clear statistics after printing" SL_CLI_UNIT_SEPARATOR,
+                 {SL_CLI_ARG_UINT8OPT, SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd__throughput = \
   SL_CLI_COMMAND(throughput,
                  "Throughput test.",
@@ -1872,6 +1894,12 @@ static const sl_cli_command_info_t cli_cmd__holdRx = \
                   "[0=Process packets immediately] 1=Hold packets" SL_CLI_UNIT_SEPARATOR,
                  {SL_CLI_ARG_UINT8, SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd__zeroCopyRx = \
+  SL_CLI_COMMAND(zeroCopyRx,
+                 "Get/Set referencing received packets in the RX FIFO instead of copying them.",
+                  "[0=Copy packets] 1=Reference packets in place" SL_CLI_UNIT_SEPARATOR,
+                 {SL_CLI_ARG_UINT8OPT, SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd__wait = \
   SL_CLI_COMMAND(wait,
                  "Suspend processing of CLI input for a while.",
@@ -2066,6 +2094,7 @@ const sl_cli_command_entry_t sl_cli_default_command_table[] = {
   { "getSyncWords", &cli_cmd__getSyncWords, false },
   { "printRxErrors", &cli_cmd__printRxErrors, false },
   { "printRxFreqOffsets", &cli_cmd__printRxFreqOffsets, false },
+  { "printRxPayloadFormat", &cli_cmd__printRxPayloadFormat, false },
   { "printDataRates", &cli_cmd__printDataRates, false },
   { "stopInfinitePream", &cli_cmd__stopInfinitePream, false },
   { "stopInfinitePreambleTx", &cli_cmd__stopInfinitePream, true },
@@ -2233,6 +2262,8 @@ const sl_cli_command_entry_t sl_cli_default_command_table[] = {
   { "printChipFeatures", &cli_cmd__printChipFeatures, false },
   { "getmemw", &cli_cmd__getmemw, false },
   { "setmemw", &cli_cmd__setmemw, false },
+  { "getNvm3Stats", &cli_cmd__getNvm3Stats, false },
+  { "getHeapProfile", &cli_cmd__getHeapProfile, false },
   { "throughput", &cli_cmd__throughput, false },
   { "setRssiOffset", &cli_cmd__setRssiOffset, false },
   { "getRssiOffset", &cli_cmd__getRssiOffset, false },
@@ -2242,6 +2273,7 @@ const sl_cli_command_entry_t sl_cli_default_command_table[] = {
   { "txAtN", &cli_cmd__txAtN, false },
   { "setFreqOffset", &cli_cmd__setFreqOffset, false },
   { "holdRx", &cli_cmd__holdRx, false },
+  { "zeroCopyRx", &cli_cmd__zeroCopyRx, false },
   { "wait", &cli_cmd__wait, false },
   { "clearScript", &cli_cmd__clearScript, false },
   { "printScript", &cli_cmd__printScript, false },
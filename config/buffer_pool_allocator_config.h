@@ -20,6 +20,20 @@
 // <i> Default: 256
 #define BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX  256
 
+// <o BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE> Number of Small Buffers
+// <0-256:1>
+// <i> Default: 8
+// <i> Small buffers are used first for requests that fit in them, so that
+// <i> small allocations do not use up the full size buffers. Set to 0 to
+// <i> only use full size buffers.
+#define BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE  8
+
+// <o BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE> Length of Each Small Buffer
+// <0-1024:1>
+// <i> Default: 64
+// <i> Must be smaller than the length of each buffer pool.
+#define BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE  64
+
 // <q BUFFER_POOL_ALLOCATOR_CLEAR_ON_INIT> Clear Each Newly Allocated Buffer
 #define BUFFER_POOL_ALLOCATOR_CLEAR_ON_INIT  0
 
@@ -12,9 +12,9 @@
 
 // <o CIRCULAR_QUEUE_LEN_MAX> Max Queue Length
 // <0-256:1>
-// <i> Default: 5
+// <i> Default: 16
 #ifndef CIRCULAR_QUEUE_LEN_MAX
-#define CIRCULAR_QUEUE_LEN_MAX  5
+#define CIRCULAR_QUEUE_LEN_MAX  16
 #endif
 
 // </h>
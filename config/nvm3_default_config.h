@@ -14,6 +14,17 @@
 #define NVM3_DEFAULT_CACHE_SIZE  200
 #endif
 
+#ifndef NVM3_DEFAULT_CACHE_TYPE
+// <o NVM3_DEFAULT_CACHE_TYPE> NVM3 Default Instance Cache Type
+// <NVM3_CACHE_TYPE_DEFAULT=> Default
+// <NVM3_CACHE_TYPE_HASH=> Hash index
+// <i> Organization of the cache. The hash index gives constant-time object
+// <i> lookup, and should be sized at least 25% larger than the number of
+// <i> NVM3 objects.
+// <i> Default: NVM3_CACHE_TYPE_DEFAULT
+#define NVM3_DEFAULT_CACHE_TYPE  NVM3_CACHE_TYPE_DEFAULT
+#endif
+
 #ifndef NVM3_DEFAULT_MAX_OBJECT_SIZE
 // <o NVM3_DEFAULT_MAX_OBJECT_SIZE> NVM3 Default Instance Max Object Size
 // <i> Max NVM3 object size that can be stored.
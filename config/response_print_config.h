@@ -15,6 +15,21 @@
 // <i> Default: 256
 #define RESPONSE_PRINT_FORMAT_STR_SIZE_MAX  256
 
+// <o RESPONSE_PRINT_OUTPUT_BUFFER_SIZE> Response Output Staging Buffer Length
+// <0-1024:1>
+// <i> Responses are assembled in this buffer and written to the output
+// <i> stream in one call. Output that does not fit is printed directly.
+// <i> Set to 0 to print every fragment directly.
+// <i> Default: 256
+#define RESPONSE_PRINT_OUTPUT_BUFFER_SIZE  256
+
+// <q RESPONSE_PRINT_FAST_FORMAT> Format Simple Responses Directly
+// <i> Responses that only use d, i, u, x, X, c and s conversions are
+// <i> formatted straight into the staging buffer instead of going through
+// <i> vprintf. Requires the staging buffer.
+// <i> Default: 1
+#define RESPONSE_PRINT_FAST_FORMAT  1
+
 // </h>
 // <<< end of configuration section >>>
 
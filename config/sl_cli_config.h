@@ -117,6 +117,40 @@
 // <i> If enabled, the CLI will ignore the case for commands.
 #define SL_CLI_IGNORE_COMMAND_CASE     1
 
+// <o SL_CLI_COMMAND_INDEX_POOL_SIZE> Number of indexed commands <0-4096>
+// <i> Default: 320
+// <i> Define the number of command table entries, summed over all command
+// <i> groups, that get a sorted lookup index. The index is built when a
+// <i> group is added and takes 2 bytes per entry. Groups that do not fit
+// <i> are searched by scanning the command table. 0 disables the index.
+#define SL_CLI_COMMAND_INDEX_POOL_SIZE     320
+
+// <h>Binary Framing Configuration
+
+// <q SL_CLI_BINARY_FRAMING_ENABLED> Enable binary framed commands
+// <i> Default: 0
+// <i> If enabled, a CLI instance can be switched at runtime to take
+// <i> commands as binary frames with typed arguments, and to answer with
+// <i> binary response frames. See sl_cli_binary.h for the frame format.
+#define SL_CLI_BINARY_FRAMING_ENABLED      0
+
+// <o SL_CLI_BINARY_RESPONSE_BUFFER_SIZE> Size of binary response buffer <32-1024>
+// <i> Default: 256
+// <i> Define the maximum payload size of a binary response frame, including
+// <i> the response header. Output that does not fit is dropped and the
+// <i> response is flagged as truncated.
+#define SL_CLI_BINARY_RESPONSE_BUFFER_SIZE 256
+
+// <o SL_CLI_BINARY_CMD_ID_POOL_SIZE> Number of commands indexed by binary command ID <0-4096>
+// <i> Default: 320
+// <i> Define the number of commands, summed over all command groups and
+// <i> their sub groups, whose binary command ID is computed once when the
+// <i> group is added. Frames are then dispatched by binary search, at 8
+// <i> bytes per entry. Groups that do not fit are walked, hashing every
+// <i> command path for each frame. 0 disables the index.
+#define SL_CLI_BINARY_CMD_ID_POOL_SIZE     320
+// </h>
+
 #endif // SL_CLI_CONFIG_H
 
 // <<< end of configuration section >>>
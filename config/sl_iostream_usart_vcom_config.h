@@ -67,6 +67,11 @@
 // <i> Default: 32
 #define SL_IOSTREAM_USART_VCOM_RX_BUFFER_SIZE    32
 
+// <o SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE> Transmit buffer size
+// <i> Default: 256
+// <i> Size of the buffer drained by the DMA in the background, given to the stream with sl_iostream_uart_set_tx_buffer(). Writes return as soon as the data is buffered. 0 transmits synchronously.
+#define SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE    256
+
 // <q SL_IOSTREAM_USART_VCOM_CONVERT_BY_DEFAULT_LF_TO_CRLF> Convert \n to \r\n
 // <i> It can be changed at runtime using the C API.
 // <i> Default: 0
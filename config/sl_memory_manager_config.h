@@ -42,6 +42,28 @@
 // <i> Default: 32
 #define SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE   (32)
 
+// <q SL_MEMORY_MANAGER_TLSF_ENABLE> Segregated-fit (TLSF) allocation
+// <i> When enabled, free blocks are kept in two-level segregated free lists indexed by size class.
+// <i> Allocation, free and reservation look-ups take a constant time instead of walking the heap blocks.
+// <i> Long-term blocks are carved from the start of the selected free block and short-term blocks from its end.
+// <i> Costs about 250 bytes of RAM for the free list heads.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_TLSF_ENABLE   0
+
+// <e SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE> Allocation site profiler
+// <i> When enabled, live bytes, allocation counts and a size histogram are recorded per allocation call site (return address).
+// <i> The statistics can be read with sl_memory_get_site_stats() at runtime, without a debugger attached.
+// <i> Costs 36 bytes of RAM per site and a linear site look-up on each allocation.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE   0
+
+// <o SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT> Number of allocation sites
+// <4-63:1>
+// <i> Size of the site table. Entry 0 accounts for the allocations of all the call sites that do not fit in the table.
+// <i> Default: 32
+#define SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT   32
+// </e>
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -77,6 +77,34 @@
 // <i> Default: 0
 #define SL_SLEEPTIMER_DEBUGRUN  0
 
+// <e SL_SLEEPTIMER_TIMER_HEAP_ENABLE> Keep running timers in a min-heap
+// <i> When enabled, running timers are kept in a binary min-heap ordered by expiration instead of a delta list.
+// <i> Starting and stopping a timer take O(log n) instead of O(n) in the number of running timers, and the
+// <i> interrupt handler no longer walks the list. Useful when many timers run concurrently.
+// <i> Timers expiring on the same tick with the same priority may not fire in start order.
+// <i> Default: 0
+#define SL_SLEEPTIMER_TIMER_HEAP_ENABLE  0
+
+// <o SL_SLEEPTIMER_TIMER_HEAP_SIZE> Maximum number of running timers <4-1024>
+// <i> Size of the timer heap. Must account for the timers of all the components and stacks.
+// <i> Starting a timer returns SL_STATUS_FULL when the heap is full. Costs 8 bytes of RAM per timer.
+// <i> Default: 32
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE  32
+// </e>
+
+// <e SL_SLEEPTIMER_COALESCING_ENABLE> Timer coalescing
+// <i> When enabled, a slack can be set on timers with sl_sleeptimer_set_timer_slack(). A timer can then expire
+// <i> up to its slack late, so that timers expiring within each other's slack share a single wakeup.
+// <i> Statistics on the wakeups saved are available with sl_sleeptimer_get_coalescing_stats().
+// <i> Default: 0
+#define SL_SLEEPTIMER_COALESCING_ENABLE  0
+
+// <o SL_SLEEPTIMER_COALESCING_TIMER_COUNT> Maximum number of running timers with a slack <1-64>
+// <i> Costs 8 bytes of RAM per timer.
+// <i> Default: 8
+#define SL_SLEEPTIMER_COALESCING_TIMER_COUNT  8
+// </e>
+
 #endif /* SLEEPTIMER_CONFIG_H */
 
 // <<< end of configuration section >>>
@@ -56,6 +56,32 @@
 
 #define NVM3_ASSERT_ON_ERROR               false
 
+/*** Mount checkpoint options, used when NVM3_CHECKPOINT is defined as 1.
+     The checkpoint is stored as data objects using a key reserved for the
+     driver. The chunk size is the largest checkpoint object written, it is
+     also the size of the static buffer used for reading and writing.
+ */
+#ifndef NVM3_CHECKPOINT_KEY
+#define NVM3_CHECKPOINT_KEY                0xFFFFFU        // Key reserved for checkpoint objects
+#endif
+
+#ifndef NVM3_CHECKPOINT_CHUNK_SIZE
+#define NVM3_CHECKPOINT_CHUNK_SIZE         256U            // Maximum checkpoint object size in bytes
+#endif
+
+/*** Transaction options, used when NVM3_TRANSACTION is defined as 1.
+     The transaction markers are stored as data objects using a key reserved
+     for the driver. The maximum number of objects in a transaction sets the
+     size of the static buffers used when scanning the FIFO.
+ */
+#ifndef NVM3_TRANSACTION_KEY
+#define NVM3_TRANSACTION_KEY               0xFFFFEU        // Key reserved for transaction markers
+#endif
+
+#ifndef NVM3_TRANSACTION_MAX_OBJECTS
+#define NVM3_TRANSACTION_MAX_OBJECTS       16U             // Maximum number of objects in a transaction
+#endif
+
 /** @} (end addtogroup nvm3) */
 
 #endif /* NVM3_CONFIG_H */
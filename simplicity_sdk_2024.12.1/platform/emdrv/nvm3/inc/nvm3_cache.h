@@ -49,11 +49,13 @@ typedef bool (*nvm3_CacheScanCallback_t)(nvm3_Cache_t *h, nvm3_ObjectKey_t key,
  ***************************   PROTOTYPES   ************************************
  ******************************************************************************/
 
-void nvm3_cacheOpen(nvm3_Cache_t *h, nvm3_CacheEntry_t *ptr, size_t count);
+void nvm3_cacheOpen(nvm3_Cache_t *h, nvm3_CacheEntry_t *ptr, size_t count, nvm3_CacheType_t type);
 void nvm3_cacheClear(nvm3_Cache_t *h);
 void nvm3_cacheDelete(nvm3_Cache_t *h, nvm3_ObjectKey_t key);
 nvm3_ObjPtr_t nvm3_cacheGet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjGroup_t *group);
 void nvm3_cacheSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm3_ObjGroup_t group);
+bool nvm3_cacheGetVerified(nvm3_Cache_t *h, nvm3_ObjectKey_t key);
+void nvm3_cacheSetVerified(nvm3_Cache_t *h, nvm3_ObjectKey_t key);
 
 void nvm3_cacheScan(nvm3_Cache_t *h, nvm3_CacheScanCallback_t cacheScanCallback, void *user);
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
@@ -169,15 +169,59 @@ typedef struct nvm3_CacheEntry {
   void             *ptr;          ///< pointer
 } nvm3_CacheEntry_t;
 
+/// @brief The cache organization, selected by the cacheType in @ref nvm3_Init_t.
+typedef enum {
+  NVM3_CACHE_TYPE_DEFAULT = 0,    ///< List searched linearly, or sorted list when built with NVM3_OPTIMIZATION
+  NVM3_CACHE_TYPE_HASH = 1,       ///< Hash index with constant-time lookup, one entry is always kept free
+} nvm3_CacheType_t;
+
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+/// @brief An object write or delete in a transaction, see @ref nvm3_writeTransaction().
+typedef struct {
+  nvm3_ObjectKey_t key;           ///< A 20-bit object identifier
+  const void *value;              ///< The object data, NULL deletes the object
+  size_t len;                     ///< The data length in bytes
+} nvm3_TransactionObject_t;
+#endif
+
+/// @brief A function that fills in object data for @ref nvm3_writeDataStream().
+/// The function must place @p len bytes of object data, starting at offset
+/// @p ofs in the object, in @p buf. Returning anything but @ref SL_STATUS_OK
+/// aborts the write, and the status is returned by the write.
+typedef sl_status_t (*nvm3_WriteStreamFn_t)(void *user, size_t ofs, void *buf, size_t len);
+
+/// @brief A function that receives object data from @ref nvm3_readDataStream().
+/// The @p buf holds @p len bytes of object data, starting at offset @p ofs in
+/// the object. Returning false stops the read.
+typedef bool (*nvm3_ReadStreamFn_t)(void *user, size_t ofs, const void *buf, size_t len);
+
+/// @brief Cache lookup statistics, see @ref nvm3_getCacheStats().
+typedef struct {
+  uint32_t hitCount;              ///< Object lookups found in cache
+  uint32_t verifiedHitCount;      ///< Cache hits where the object was already validated
+  uint32_t missCount;             ///< Object lookups not found in cache
+  uint32_t overflowCount;         ///< Objects that could not be added to the cache
+} nvm3_CacheStats_t;
+
+/// @brief Wear and write statistics, see @ref nvm3_getWearStats().
+typedef struct {
+  uint32_t userBytesWritten;      ///< NVM bytes used by objects and counter updates written by the application
+  uint32_t repackBytesCopied;     ///< NVM bytes used by objects copied by repack
+  uint32_t counterBaseRewrites;   ///< New base values written to existing counter objects
+  uint32_t counterObjectRewrites; ///< Counter objects written again because all increment fields were used
+  uint32_t pageEraseCount;        ///< Pages erased
+} nvm3_WearStats_t;
+
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 
 typedef struct nvm3_Cache {
   nvm3_CacheEntry_t *entryPtr;    // Pointer to cache entry structure
   size_t            entryCount;   // Total cache size
   bool              overflow;     // Cache overflow status
-#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
-  size_t            usedCount;    // Number of objects in cache
-#endif
+  nvm3_CacheType_t  type;         // Cache organization
+  size_t            usedCount;    // Number of objects in cache, sorted and hash index only
+  size_t            hitIdx;       // Entry index of the last cache hit
+  nvm3_CacheStats_t stats;        // Lookup statistics
 } nvm3_Cache_t;
 
 typedef struct nvm3_ObjFragDetail {
@@ -209,12 +253,16 @@ typedef struct {
   size_t unusedNvmSize;                           // The size of the unused NVM
   bool hasBeenOpened;                             // Open status
   size_t minUnused;                               // The minimum value of the unusedNvmSize
+  nvm3_WearStats_t wearStats;                     // Wear and write statistics
   const nvm3_HalHandle_t *halHandle;              // HAL handle
   nvm3_HalInfo_t halInfo;                         // HAL information
 #if defined(NVM3_SECURITY)
   const nvm3_HalCryptoHandle_t *halCryptoHandle;  // HAL crypto handle
   nvm3_SecurityType_t secType;                    // Security type
 #endif
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+  void *checkpointNextObj;                        // The next free object location after the last checkpoint
+#endif
 } nvm3_Handle_t;
 
 /// @endcond
@@ -232,6 +280,7 @@ typedef struct {
   const nvm3_HalCryptoHandle_t *halCryptoHandle;  ///< HAL crypto handle
   nvm3_SecurityType_t secType;                    ///< Security type
 #endif
+  nvm3_CacheType_t cacheType;                     ///< Cache organization, zero selects the default
 } nvm3_Init_t;
 
 /***************************************************************************//**
@@ -264,6 +313,9 @@ sl_status_t nvm3_open(nvm3_Handle_t *h, const nvm3_Init_t *i);
  * @brief
  *  Close the NVM3 driver instance.
  *
+ * @note When NVM3_CHECKPOINT is defined as 1, a mount checkpoint is written
+ *  before closing, unless nothing has been written since the last checkpoint.
+ *
  * @param[in] h
  *   A pointer to the NVM3 driver handle.
  *
@@ -344,6 +396,103 @@ sl_status_t nvm3_readData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, void *value, s
  ******************************************************************************/
 sl_status_t nvm3_readPartialData(nvm3_Handle_t* h, nvm3_ObjectKey_t key, void* value, size_t ofs, size_t len);
 
+/***************************************************************************//**
+ * @brief
+ *  Write a data object to NVM, getting the data in chunks from a callback.
+ *
+ * @details
+ *  Large objects can be written without having the whole object in RAM. The
+ *  object is written the same way as with @ref nvm3_writeData(), but the
+ *  payload of all object fragments is filled in one chunk at a time by
+ *  @p fillFn, using @p buf as the staging buffer. The fragment headers are
+ *  written after the whole payload, so the new object is only valid when
+ *  all the data is written.
+ *
+ * @details
+ *  If @p fillFn returns an error, the write is aborted before any object
+ *  header is written. The old object, if any, is kept, and the space used
+ *  by the partial payload is reclaimed by the next repack.
+ *
+ * @note
+ *  The @p fillFn is called with the NVM3 lock taken, and must not call any
+ *  NVM3 functions. The same data may be requested more than once if the
+ *  object is rewritten after a write failure. Unlike @ref nvm3_writeData(),
+ *  the object is always written, even if the data is unchanged.
+ *
+ * @note
+ *  This function is not supported when NVM3_SECURITY is defined, as the
+ *  object data is encrypted as a whole.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[in] key
+ *   A 20-bit object identifier.
+ *
+ * @param[in] len
+ *   The size of the object data in number of bytes.
+ *
+ * @param[in] buf
+ *   A word-aligned buffer used for the data chunks.
+ *
+ * @param[in] bufSize
+ *   The size of the chunk buffer in bytes, must be a multiple of 4.
+ *
+ * @param[in] fillFn
+ *   A function that fills in the object data.
+ *
+ * @param[in] user
+ *   A user pointer passed to @p fillFn.
+ *
+ * @return
+ *   @ref SL_STATUS_OK on success, the status returned by @p fillFn if it
+ *   aborted the write, or a NVM3 @ref sl_status_t on failure.
+ ******************************************************************************/
+sl_status_t nvm3_writeDataStream(nvm3_Handle_t *h, nvm3_ObjectKey_t key, size_t len,
+                                 void *buf, size_t bufSize,
+                                 nvm3_WriteStreamFn_t fillFn, void *user);
+
+/***************************************************************************//**
+ * @brief
+ *  Read a data object from NVM, passing the data in chunks to a callback.
+ *
+ * @details
+ *  The object fragments are read in order, each fragment in one or more
+ *  chunks of at most @p bufSize bytes. A chunk never spans two fragments.
+ *
+ * @note
+ *  The @p readFn is called with the NVM3 lock taken, and must not call any
+ *  NVM3 functions.
+ *
+ * @note
+ *  This function is not supported when NVM3_SECURITY is defined.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[in] key
+ *   A 20-bit object identifier.
+ *
+ * @param[in] buf
+ *   A word-aligned buffer used for the data chunks.
+ *
+ * @param[in] bufSize
+ *   The size of the chunk buffer in bytes, must be a multiple of 4.
+ *
+ * @param[in] readFn
+ *   A function that receives the object data.
+ *
+ * @param[in] user
+ *   A user pointer passed to @p readFn.
+ *
+ * @return
+ *   @ref SL_STATUS_OK on success, SL_STATUS_ABORT if @p readFn stopped the
+ *   read, or a NVM3 @ref sl_status_t on failure.
+ ******************************************************************************/
+sl_status_t nvm3_readDataStream(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
+                                void *buf, size_t bufSize,
+                                nvm3_ReadStreamFn_t readFn, void *user);
+
 /***************************************************************************//**
  * @brief
  *  Find the type and size of an object in NVM.
@@ -450,6 +599,41 @@ size_t  nvm3_enumDeletedObjects(nvm3_Handle_t *h,
  ******************************************************************************/
 sl_status_t nvm3_deleteObject(nvm3_Handle_t *h, nvm3_ObjectKey_t key);
 
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+/***************************************************************************//**
+ * @brief
+ *  Write and delete several data objects as one atomic operation.
+ *
+ * @details
+ *  The objects are written together with a begin and a commit marker. If the
+ *  write is interrupted by a reset or power loss, all the objects keep the
+ *  values they had before the call, and the objects are restored on the next
+ *  @ref nvm3_open(). If the objects can not be restored, @ref nvm3_open()
+ *  fails with the write error, and the restore is tried again by the next
+ *  @ref nvm3_open(). No repack is done while the objects are written, so
+ *  there must be room for the objects, the markers, and a copy of the
+ *  current objects used for restoring. Deleting an object that does not
+ *  exist is ignored.
+ *
+ * @note This function is available when NVM3_TRANSACTION is defined as 1.
+ *   The key NVM3_TRANSACTION_KEY is used for the markers, and cannot be used
+ *   by the application.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[in] objects
+ *   The objects to write or delete. Each key can only be used once.
+ *
+ * @param[in] count
+ *   The number of objects, up to NVM3_TRANSACTION_MAX_OBJECTS.
+ *
+ * @return
+ *   @ref SL_STATUS_OK on success or a NVM3 @ref sl_status_t on failure.
+ ******************************************************************************/
+sl_status_t nvm3_writeTransaction(nvm3_Handle_t *h, const nvm3_TransactionObject_t *objects, size_t count);
+#endif
+
 /***************************************************************************//**
  * @brief
  *  Store a counter in NVM.
@@ -589,6 +773,40 @@ void nvm3_setEraseCount(uint32_t eraseCnt);
  ******************************************************************************/
 sl_status_t nvm3_repack(nvm3_Handle_t *h);
 
+/***************************************************************************//**
+ * @brief
+ *  Execute a repack step limited by a copy budget. Each call either erases one
+ *  page or copies objects until the next object would make the number of
+ *  copied bytes exceed copyBudget. At least one object is copied, so the
+ *  work done in a call is bounded by one page erase or by copyBudget plus
+ *  one object.
+ *
+ * @details
+ *  The function is intended to be called from the main loop or an idle hook,
+ *  the next call resumes the repack where the previous call stopped. A repack
+ *  step is only done when @ref nvm3_repackNeeded() returns true. Use the
+ *  repackHeadroom member of @ref nvm3_Init_t to start the repack steps before
+ *  the forced threshold is reached, then the write functions will rarely have
+ *  to repack. The driver has no time base, a time budget can be implemented
+ *  by calling the function until moreWork is false or the time is up.
+ *
+ *  When NVM3_CHECKPOINT is defined as 1, a checkpoint is written by the step
+ *  that completes the repack.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[in] copyBudget
+ *   The maximum number of bytes to copy, object headers included.
+ *
+ * @param[out] moreWork
+ *   Set to true if more repack steps are needed.
+ *
+ * @return
+ *   @ref SL_STATUS_OK on success or a NVM3 @ref sl_status_t on failure.
+ ******************************************************************************/
+sl_status_t nvm3_repackStep(nvm3_Handle_t *h, size_t copyBudget, bool *moreWork);
+
 /***************************************************************************//**
  * @brief
  *   Check the internal status of NVM3 and return true if a repack
@@ -636,6 +854,76 @@ bool    nvm3_repackNeeded(nvm3_Handle_t *h);
  ******************************************************************************/
 sl_status_t nvm3_resize(nvm3_Handle_t *h, nvm3_HalPtr_t newAddr, size_t newSize);
 
+/***************************************************************************//**
+ * @brief
+ *  Get the cache lookup statistics.
+ *
+ * @details
+ *  Objects found in cache are validated on the first read after a write or
+ *  repack, later reads of the same unfragmented object skip the validation.
+ *  The number of validations done on cache hits is hitCount minus
+ *  verifiedHitCount. The statistics are cleared by @ref nvm3_open().
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[out] stats
+ *   A pointer to the location where the statistics will be placed.
+ *
+ * @param[in] reset
+ *   Clear the statistics after they are read.
+ ******************************************************************************/
+void nvm3_getCacheStats(nvm3_Handle_t *h, nvm3_CacheStats_t *stats, bool reset);
+
+/***************************************************************************//**
+ * @brief
+ *  Get the wear and write statistics.
+ *
+ * @details
+ *  The write amplification caused by repacks is
+ *  (userBytesWritten + repackBytesCopied) / userBytesWritten. The objects
+ *  of a transaction are application writes. Checkpoints, transaction markers
+ *  and the objects restored by a transaction rollback are written by the
+ *  driver, and are not included in the byte counts. The statistics are kept
+ *  in RAM and cleared by @ref nvm3_open(), use @ref nvm3_getPageEraseCounts()
+ *  for the erase counts stored in NVM.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[out] stats
+ *   A pointer to the location where the statistics will be placed.
+ *
+ * @param[in] reset
+ *   Clear the statistics after they are read.
+ ******************************************************************************/
+void nvm3_getWearStats(nvm3_Handle_t *h, nvm3_WearStats_t *stats, bool reset);
+
+/***************************************************************************//**
+ * @brief
+ *  Get the erase count of each NVM page.
+ *
+ * @details
+ *  The erase counts are read from the page headers, in page address order.
+ *  A page with a header that is not valid reports 0xFFFFFFFF.
+ *
+ * @param[in] h
+ *   A pointer to an NVM3 driver handle.
+ *
+ * @param[out] eraseCnt
+ *   A pointer to an array where the erase counts will be placed.
+ *
+ * @param[in,out] pageCnt
+ *   On input, the number of elements in the eraseCnt array. On output, the
+ *   number of pages in NVM.
+ *
+ * @return
+ *   @ref SL_STATUS_OK on success, @ref SL_STATUS_WOULD_OVERFLOW if the array
+ *   is too small for all pages, in that case the array is filled with the
+ *   first pages. Otherwise a NVM3 @ref sl_status_t on failure.
+ ******************************************************************************/
+sl_status_t nvm3_getPageEraseCounts(nvm3_Handle_t *h, uint32_t *eraseCnt, size_t *pageCnt);
+
 /***************************************************************************//**
  * @brief
  *  Count valid objects.
@@ -773,6 +1061,14 @@ __STATIC_INLINE size_t nvm3_countDeletedObjects(nvm3_Handle_t *h)
    cache element is two uint32_t and one pointer giving a total of 12 bytes (3 words)
    per entry.
 
+   Setting the cacheType in @ref nvm3_Init_t to @ref NVM3_CACHE_TYPE_HASH
+   organizes the same cache array as a hash index. Lookup, insert, and delete
+   take constant time on average, no sorting or temporary memory is needed,
+   and the entry size is unchanged. One entry is always kept free, so the cache
+   must have one entry more than the number of objects to avoid overflow.
+   Lookups stay fast when the cache is at least 25% larger than the number of
+   objects.
+
    @note The cache is fully initialized by @ref nvm3_open() and automatically
    updated by any subsequent write, read, or delete function call.
 
@@ -832,6 +1128,9 @@ __STATIC_INLINE size_t nvm3_countDeletedObjects(nvm3_Handle_t *h)
    @ref nvm3_writeData() and @ref nvm3_readData()
    @n Write and read data objects.
 
+   @ref nvm3_writeDataStream() and @ref nvm3_readDataStream()
+   @n Write and read large data objects in chunks, using a small buffer.
+
    @ref nvm3_writeCounter(), @ref nvm3_readCounter() and @ref nvm3_incrementCounter()
    @n Write, read, and increment 32-bit counter objects.
 
@@ -841,7 +1140,10 @@ __STATIC_INLINE size_t nvm3_countDeletedObjects(nvm3_Handle_t *h)
    @ref nvm3_getEraseCount()
    @n Return the erasure count for the most erased page in NVM.
 
-   @ref nvm3_repack() and @ref nvm3_repackNeeded()
+   @ref nvm3_getPageEraseCounts(), @ref nvm3_getWearStats() and @ref nvm3_getCacheStats()
+   @n Return the erase count of each page, and wear, write and cache statistics.
+
+   @ref nvm3_repack(), @ref nvm3_repackStep() and @ref nvm3_repackNeeded()
    @n Manage NVM3 repacking operations.
 
    @ref nvm3_resize()
@@ -1057,10 +1359,29 @@ __STATIC_INLINE size_t nvm3_countDeletedObjects(nvm3_Handle_t *h)
    the NVM3_MAX_OBJECT_SIZE number of bytes have been copied. The copy operation
    will resume on the next call to repack, and the application may have to call
    the repack function several times to complete a full repack operation.
+   @ref nvm3_repackStep() takes the copy size as a parameter, a small copy
+   budget gives short steps that can be run from the main loop or an idle hook.
+   Combined with a repackHeadroom that covers the writes done between the
+   steps, the write functions will rarely have to do a repack.
 
    @note Performing the @ref nvm3_repack()/@ref nvm3_repackNeeded() loop is
    highly recommended before any timing-sensitive procedure.
 
+   The time spent in @ref nvm3_open() grows with the number of objects in
+   NVM, as all objects are validated to build the cache. When NVM3_CHECKPOINT
+   is defined as 1, a checkpoint holding the cache and the FIFO state is
+   written by @ref nvm3_repack() and @ref nvm3_close(). On the next
+   @ref nvm3_open(), the cache is loaded from the checkpoint and only the
+   objects written after it are validated. A checkpoint is only written when
+   it does not make a repack needed, and it is ignored when a page has been
+   erased since it was written. The checkpoint uses the key NVM3_CHECKPOINT_KEY,
+   which cannot be used by the application.
+
+   When NVM3_TRANSACTION is defined as 1, @ref nvm3_writeTransaction() writes
+   a set of related objects so that either all or none of the new values are
+   seen after a reset. Objects from an interrupted transaction are restored to
+   their previous values by the next @ref nvm3_open().
+
    # Examples {#nvm3_example}
 
    Example 1 shows initialization, usage of data objects, and repacking.
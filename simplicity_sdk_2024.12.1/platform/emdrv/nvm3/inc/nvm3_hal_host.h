@@ -0,0 +1,52 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 driver HAL definitions for host builds
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef NVM3_HAL_HOST_H
+#define NVM3_HAL_HOST_H
+
+#include <assert.h>
+
+// Definitions normally provided by em_device.h and sl_common.h
+// when NVM3 is built for a device. Used with NVM3_HOST_BUILD, together with
+// the RAM HAL (nvm3_hal_ram.h).
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE   static inline
+#endif
+
+#ifndef SL_MIN
+#define SL_MIN(a, b)      (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef FLASH_PAGE_SIZE
+#define FLASH_PAGE_SIZE   8192U
+#endif
+
+#endif /* NVM3_HAL_HOST_H */
@@ -0,0 +1,175 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 driver HAL for RAM emulated FLASH
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef NVM3_HAL_RAM_H
+#define NVM3_HAL_RAM_H
+
+#include "nvm3_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup nvm3
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup nvm3hal
+ * @{
+ * @details
+ * This module provides the NVM3 interface to a RAM area emulating FLASH.
+ * It follows the FLASH rules: a page is erased to all ones, and a write can
+ * only clear bits that are set. Each page erase and word access is counted,
+ * and a busy time is estimated from the FLASH timings, so NVM3 can be sized
+ * and profiled without programming the device FLASH.
+ *
+ * The NVM area passed to @ref nvm3_open is plain RAM. Its content survives a
+ * @ref nvm3_close followed by a new @ref nvm3_open, which emulates a reset.
+ * A power cut can be injected after a given number of word writes and page
+ * erases, see @ref nvm3_halRamSetPowerCut, to test what NVM3 finds on the
+ * next @ref nvm3_open.
+ *
+ * @note The features available through the handle are used by the NVM3 and
+ * should not be used directly by any applications.
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************    MACROS    **********************************
+ *****************************************************************************/
+
+#ifndef NVM3_HAL_RAM_PAGE_SIZE
+#if defined(FLASH_PAGE_SIZE)
+#define NVM3_HAL_RAM_PAGE_SIZE          FLASH_PAGE_SIZE         ///< Emulated page size
+#else
+#define NVM3_HAL_RAM_PAGE_SIZE          8192U                   ///< Emulated page size
+#endif
+#endif
+
+#ifndef NVM3_HAL_RAM_WRITE_SIZE
+#define NVM3_HAL_RAM_WRITE_SIZE         NVM3_HAL_WRITE_SIZE_32  ///< Emulated write size
+#endif
+
+#ifndef NVM3_HAL_RAM_MAX_PAGE_COUNT
+#define NVM3_HAL_RAM_MAX_PAGE_COUNT     64U                     ///< Number of pages with an erase counter
+#endif
+
+#ifndef NVM3_HAL_RAM_WORD_WRITE_TIME_US
+#define NVM3_HAL_RAM_WORD_WRITE_TIME_US 20U                     ///< Emulated word write time
+#endif
+
+#ifndef NVM3_HAL_RAM_PAGE_ERASE_TIME_US
+#define NVM3_HAL_RAM_PAGE_ERASE_TIME_US 20000U                  ///< Emulated page erase time
+#endif
+
+/******************************************************************************
+ ******************************   TYPEDEFS   **********************************
+ *****************************************************************************/
+
+/// @brief RAM HAL access statistics.
+typedef struct {
+  uint32_t pageEraseCnt;      ///< The number of pages erased
+  uint32_t maxPageEraseCnt;   ///< The highest erase count of a single page
+  uint32_t wordReadCnt;       ///< The number of words read
+  uint32_t wordWriteCnt;      ///< The number of words written
+  uint32_t wordRewriteCnt;    ///< The number of words written while not erased
+  uint32_t writeFailCnt;      ///< The number of writes trying to set a cleared bit
+  uint64_t busyTimeUs;        ///< The estimated FLASH busy time, in microseconds
+} nvm3_HalRamStats_t;
+
+/// @brief A function called when the power is cut, see @ref nvm3_halRamSetPowerCut.
+typedef void (*nvm3_HalRamPowerCutFn_t)(void);
+
+/*******************************************************************************
+ ***************************   GLOBAL VARIABLES   ******************************
+ ******************************************************************************/
+
+extern const nvm3_HalHandle_t nvm3_halRamHandle;        ///< The HAL RAM handle.
+
+/*******************************************************************************
+ *****************************   PROTOTYPES   **********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @brief
+ *   Get the RAM HAL access statistics.
+ *
+ * @param[out] stats
+ *   A pointer to a structure that will receive the statistics.
+ ******************************************************************************/
+void nvm3_halRamGetStats(nvm3_HalRamStats_t *stats);
+
+/***************************************************************************//**
+ * @brief
+ *   Clear the RAM HAL access statistics, except the page erase counts.
+ ******************************************************************************/
+void nvm3_halRamResetStats(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the number of times a page was erased.
+ *
+ * @param[in] pageIdx
+ *   The index of the page, from the start of the NVM area.
+ *
+ * @return
+ *   The page erase count, or 0 when the page has no erase counter.
+ ******************************************************************************/
+uint32_t nvm3_halRamGetPageEraseCount(size_t pageIdx);
+
+/***************************************************************************//**
+ * @brief
+ *   Cut the power after a number of word writes and page erases.
+ *
+ * @details
+ *   When the count is reached, the last word write or page erase is done, and
+ *   powerCutFn is called. It is expected not to return, for example by a
+ *   longjmp() back to the test, as the CPU stops on a power loss. The NVM area
+ *   is then left as the power cut found it. If powerCutFn is NULL or returns,
+ *   the write or erase in progress reports a failure instead, and the
+ *   remaining words of the write are not written.
+ *
+ * @param[in] writeCnt
+ *   The number of word writes and page erases done before the power is cut,
+ *   or 0 to disable the cut.
+ * @param[in] powerCutFn
+ *   The function called when the power is cut, or NULL.
+ ******************************************************************************/
+void nvm3_halRamSetPowerCut(uint32_t writeCnt, nvm3_HalRamPowerCutFn_t powerCutFn);
+
+/** @} (end addtogroup nvm3hal) */
+/** @} (end addtogroup nvm3) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NVM3_HAL_RAM_H */
@@ -32,6 +32,7 @@
 #define NVM3_UTILS_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,6 +60,29 @@ extern "C" {
  ******************************************************************************/
 void nvm3_utilsComputeBergerCode(uint8_t *pResult, void *pInput, uint8_t numberOfBits);
 
+/***************************************************************************//**
+ * @brief
+ *  This function calculates the Berger Code of each word in an array in one
+ *  pass. Unlike @ref nvm3_utilsComputeBergerCode(), the codes are not
+ *  accumulated, each result is the number of binary zeros in the
+ *  corresponding input word.
+ *
+ * @param[out] pResult
+ *   A pointer to an array where the count Berger codes will be placed.
+ *
+ * @param[in] pInput
+ *   A pointer to the array of input words.
+ *
+ * @param[in] count
+ *   The number of words in the input array.
+ *
+ * @param[in] numberOfBits
+ *   The number of bits in each input word used in the calculation.
+ *   The calculation is starting from the least significant bit in the input
+ *   word.
+ ******************************************************************************/
+void nvm3_utilsComputeBergerCodes(uint8_t *pResult, const uint32_t *pInput, size_t count, uint8_t numberOfBits);
+
 /// @endcond
 
 #ifdef __cplusplus
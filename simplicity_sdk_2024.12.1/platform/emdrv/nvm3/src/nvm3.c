@@ -68,6 +68,7 @@
 #define COUNTER_MAX_NO_INC_32                       ((COUNTER_SIZE - sizeof(uint32_t)) / sizeof(uint32_t))
 #define COUNTER_NO_INC_PER_NEW_MEM_LOC_16           2U
 #define COUNTER_NO_INC_PER_NEW_MEM_LOC_32           1U
+#define COUNTER_WSIZE                               (COUNTER_SIZE / sizeof(uint32_t))
 
 // Define special Key to use for searching FIFO last valid location.
 #define SEARCH_KEY                                  (0xFFFFFFFEU)
@@ -80,6 +81,23 @@
 
 #define COUNTER_SIZE_BASE                           (4U)
 
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+// Mount checkpoint format identifier, "CKP1".
+#define CHECKPOINT_MAGIC                            (0x31504B43U)
+#if defined(NVM3_SECURITY)
+#define CHECKPOINT_OBJ_OVERHEAD                     (NVM3_GCM_SIZE_OVERHEAD)
+#else
+#define CHECKPOINT_OBJ_OVERHEAD                     (0U)
+#endif
+#endif
+
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+// Transaction marker identifiers, "TXB1", "TXC1" and "TXA1".
+#define TRANSACTION_MAGIC_BEGIN                     (0x31425854U)
+#define TRANSACTION_MAGIC_COMMIT                    (0x31435854U)
+#define TRANSACTION_MAGIC_ABORT                     (0x31415854U)
+#endif
+
 #if defined(NVM3_SECURITY)
 #define NVM3_NONCE_OFFSET                           (0U)
 #define NVM3_DATA_OFFSET                            (4U)
@@ -167,6 +185,7 @@ typedef struct {
   nvm3_Handle_t *h;
   sl_status_t status;
   repackCopyMode_t copyMode;
+  size_t copyLimit;
   size_t copyAccumulated;
   bool copyAllDone;
 } repackFirstPageParameters;
@@ -185,11 +204,92 @@ typedef struct WriteFailure {
   nvm3_HalPtr_t addrError;        // Address of the error
 } WriteFailure_t;
 
+#if !defined(NVM3_SECURITY)
+// The data source of an object written with nvm3_writeDataStream().
+typedef struct {
+  nvm3_WriteStreamFn_t fillFn;
+  void *user;
+  uint32_t *buf;                  // Chunk buffer
+  size_t bufSize;                 // Chunk buffer size in bytes
+  sl_status_t fillSta;            // Status of the last fillFn call
+} WriteStream_t;
+#endif
+
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+// The header placed first in every checkpoint object (chunk).
+typedef struct {
+  uint32_t magic;                 // Checkpoint format identifier
+  uint32_t headOfs;               // Offset of the first chunk from the NVM base
+  uint16_t chunkIdx;              // Index of this chunk
+  uint16_t chunkCnt;              // The number of chunks in the checkpoint
+  uint32_t entryCnt;              // The number of entries in this chunk
+} CheckpointHdr_t;
+
+// The FIFO state placed after the header in the first chunk.
+typedef struct {
+  uint32_t nvmSize;               // The NVM size
+  uint32_t validPageCnt;          // The number of valid NVM pages
+  uint32_t firstObjOfs;           // Offset of the FIFO first object from the NVM base
+  uint32_t firstEraseCnt;         // The erase count of the FIFO first page
+} CheckpointState_t;
+
+// A cache entry, the key holds the object group above the key bits.
+typedef struct {
+  uint32_t key;                   // Key and group
+  uint32_t objOfs;                // Offset of the object from the NVM base
+} CheckpointEntry_t;
+
+typedef struct {
+  nvm3_Handle_t *h;
+  sl_status_t status;
+  size_t chunkSize;
+  uint32_t headOfs;
+  uint16_t chunkIdx;
+  uint16_t chunkCnt;
+  size_t entryCnt;
+  size_t entryMax;
+} CheckpointWriteParameters_t;
+#endif
+
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+// Transaction marker payload.
+typedef struct {
+  uint32_t magic;
+  uint32_t count;                 // The number of objects in the transaction
+} TransactionMarker_t;
+
+typedef struct {
+  nvm3_ObjectKey_t key;
+  nvm3_ObjPtr_t objAdr;
+  nvm3_ObjGroup_t group;
+} TransactionEntry_t;
+
+// Transaction state while scanning the FIFO.
+typedef struct {
+  bool isOpen;                                                // A begin marker is found, but no commit or abort marker
+  size_t pendingCnt;
+  TransactionEntry_t pending[NVM3_TRANSACTION_MAX_OBJECTS];   // Objects held back until the commit marker
+  size_t abortedCnt;
+  TransactionEntry_t aborted[NVM3_TRANSACTION_MAX_OBJECTS];   // Keys where the newest object is from an aborted transaction
+} TransactionScan_t;
+#endif
+
 //****************************************************************************
 // Static variables
 
 static uint32_t cfgEraseCnt = 0;
 static uint32_t instanceCnt = 0;
+static uint32_t counterBuf[COUNTER_WSIZE];                     // Counter base and increment fields
+static uint8_t counterCodes[COUNTER_MAX_NO_INC_32];            // Berger codes of the 32-bit increment fields
+#if !defined(NVM3_SECURITY)
+static WriteStream_t *writeStream = NULL;                      // Set while writing an object from a stream
+#endif
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+static uint32_t checkpointBuf[NVM3_CHECKPOINT_CHUNK_SIZE / sizeof(uint32_t)];
+#endif
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+static TransactionScan_t transactionScan;
+#endif
 
 //****************************************************************************
 // Function prototypes
@@ -622,9 +722,36 @@ __STATIC_INLINE bool keyIsSearchKey(nvm3_ObjectKey_t key)
   return (key == SEARCH_KEY);
 }
 
+__STATIC_INLINE bool keyIsCheckpoint(nvm3_ObjectKey_t key)
+{
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+  return (key == NVM3_CHECKPOINT_KEY);
+#else
+  (void)key;
+  return false;
+#endif
+}
+
+__STATIC_INLINE bool keyIsTransaction(nvm3_ObjectKey_t key)
+{
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+  return (key == NVM3_TRANSACTION_KEY);
+#else
+  (void)key;
+  return false;
+#endif
+}
+
+// Keys used by the driver for objects that are never cached.
+__STATIC_INLINE bool keyIsReserved(nvm3_ObjectKey_t key)
+{
+  return keyIsCheckpoint(key) || keyIsTransaction(key);
+}
+
+// The reserved keys are not valid for the user.
 __STATIC_INLINE bool keyIsValid(nvm3_ObjectKey_t key)
 {
-  return ((key & NVM3_KEY_MASK) == key);
+  return ((key & NVM3_KEY_MASK) == key) && !keyIsReserved(key);
 }
 
 __STATIC_INLINE size_t counterMaxIncVal(nvm3_Handle_t *h)
@@ -925,6 +1052,72 @@ static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *ds
   return sta;
 }
 #else
+/* Write a fragment payload from the write stream, one chunk at a time.
+   The chunk buffer size is a multiple of the word size, only the last chunk
+   of an object can end with a partial word. An error from the fill function
+   stops the write before the chunk is programmed. */
+static sl_status_t writeStreamFrag(nvm3_Handle_t *h, nvm3_HalPtr_t dstAdr, size_t ofs, size_t len)
+{
+  sl_status_t sta = SL_STATUS_OK;
+  size_t chunkLen;
+  size_t wordCnt;
+
+  while ((len > 0U) && (sta == SL_STATUS_OK)) {
+    chunkLen = SL_MIN(len, writeStream->bufSize);
+    wordCnt = (chunkLen + (NVM3_WORD_SIZE - 1U)) / NVM3_WORD_SIZE;
+    // Keep the unused bytes of a partial word erased.
+    writeStream->buf[wordCnt - 1U] = 0xffffffffUL;
+    writeStream->fillSta = writeStream->fillFn(writeStream->user, ofs, writeStream->buf, chunkLen);
+    if (writeStream->fillSta != SL_STATUS_OK) {
+      sta = writeStream->fillSta;
+      break;
+    }
+    sta = nvm3_halWriteWords(HAL, dstAdr, writeStream->buf, wordCnt);
+    dstAdr = calcAdr(dstAdr, wordCnt * NVM3_WORD_SIZE);
+    ofs += chunkLen;
+    len -= chunkLen;
+  }
+
+  return sta;
+}
+
+/* Write the fragment headers of a streamed object, after the whole payload
+   is written. The first fragment header is written last, so an object with
+   missing fragments is never found by a scan. */
+static sl_status_t writeStreamHdrs(nvm3_Handle_t *h, const nvm3_Obj_t *obj,
+                                   bool hdrIsLarge, WriteFailure_t *wrFailure)
+{
+  sl_status_t sta = SL_STATUS_OK;
+  nvm3_ObjHdrLarge_t objHdrLarge;
+  size_t hdrLen = hdrIsLarge ? NVM3_OBJ_HEADER_SIZE_LARGE : NVM3_OBJ_HEADER_SIZE_SMALL;
+  size_t idx = obj->isFragmented ? obj->frag.idx : 1U;
+  nvm3_ObjPtr_t fragAdr;
+  size_t fragLen;
+  nvm3_ObjFragType_t fragTyp;
+
+  while ((idx > 0U) && (sta == SL_STATUS_OK)) {
+    idx--;
+    if (obj->isFragmented) {
+      fragAdr = obj->frag.detail[idx].adr;
+      fragLen = obj->frag.detail[idx].len;
+      fragTyp = (nvm3_ObjFragType_t)obj->frag.detail[idx].typ;
+    } else {
+      fragAdr = obj->objAdr;
+      fragLen = obj->totalLen;
+      fragTyp = fragTypeNone;
+    }
+    nvm3_tracePrint(TRACE_LEVEL_WRITE, "    write stream header: adr=%p, hdrLen=%u, fragType=%u.\n", fragAdr, hdrLen, fragTyp);
+    (void)nvm3_objHdrInit(&objHdrLarge, obj->key, (nvm3_ObjType_t)obj->objType, fragLen, hdrIsLarge, fragTyp);
+    sta = nvm3_halWriteWords(HAL, fragAdr, &objHdrLarge, hdrLen / sizeof(uint32_t));
+    if (sta != SL_STATUS_OK) {
+      nvm3_tracePrint(NVM3_TRACE_LEVEL_WARNING, "    write stream header: ERROR in header.\n");
+      wrFailure->addrError = fragAdr;
+    }
+  }
+
+  return sta;
+}
+
 static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *dstObj,
                             nvm3_HalPtr_t dstAdr, bool copyObj,
                             nvm3_ObjGroup_t objGroup,
@@ -949,6 +1142,7 @@ static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *ds
   size_t offset = 0;
   uint32_t baseVal;
   bool baseWr = false;
+  bool streamObj = !copyObj && (writeStream != NULL);
 
 #if NVM3_TRACE_ENABLED
   size_t tmpIdx = pageIdxFromAdr(h, dstAdr);
@@ -1060,7 +1254,10 @@ static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *ds
           }
         } else {
           nvm3_tracePrint(TRACE_LEVEL_WRITE, "      cntWr: adr=%p, len=%u, copy=%s.\n", dstAdr, fragLen, copyObj ? "true" : "false");
-          if (!copyObj) {
+          if (streamObj) {
+            // Source is a stream, the data is fetched in chunks.
+            sta = writeStreamFrag(h, dstAdr, offset, fragLen);
+          } else if (!copyObj) {
             // Source is a continous memory.
             uint32_t *pSrc = (uint32_t *)ptrSrc;
             uint32_t *pDst = dstAdr;
@@ -1094,13 +1291,15 @@ static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *ds
           }
         }
       }
-      if (sta != SL_STATUS_OK) {
+      if (streamObj && (writeStream->fillSta != SL_STATUS_OK)) {
+        nvm3_tracePrint(NVM3_TRACE_LEVEL_WARNING, "    write object body: stream aborted, sta=0x%x.\n", sta);
+      } else if (sta != SL_STATUS_OK) {
         nvm3_tracePrint(NVM3_TRACE_LEVEL_WARNING, "    write object body: ERROR in payload.\n");
         wrFailure->addrError = dstAdr;
       }
 
-      // Write header.
-      if (sta == SL_STATUS_OK) {
+      // Write header, the headers of a streamed object are written last.
+      if ((sta == SL_STATUS_OK) && !streamObj) {
         nvm3_tracePrint(TRACE_LEVEL_WRITE, "    write object header: adr=%p, hdrLen=%u, fragType=%u.\n", fragAdr, dstHdrLen, fragTyp);
         (void)nvm3_objHdrInit(&objHdrLarge, srcObj->key, (nvm3_ObjType_t)dstObj->objType, fragLen, dstHdrIsLarge, fragTyp);
         sta = nvm3_halWriteWords(HAL, fragAdr, &objHdrLarge, dstHdrLen / sizeof(uint32_t));
@@ -1127,6 +1326,10 @@ static sl_status_t writeObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, nvm3_Obj_t *ds
     dstAdr = getFirstObjAdrInNextGoodPage(h, dstAdr);
   } while (srcLen > 0U);
 
+  if ((sta == SL_STATUS_OK) && streamObj) {
+    sta = writeStreamHdrs(h, dstObj, dstHdrIsLarge, wrFailure);
+  }
+
   return sta;
 }
 #endif
@@ -1244,8 +1447,8 @@ static sl_status_t fifoWriteObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, bool copyO
     }
   } while ((sta != SL_STATUS_OK) && (writeFullAllowed(h, srcObj->totalLen)));
 
-  // Update cache according to operation result.
-  if (sta == SL_STATUS_OK) {
+  // Update cache according to operation result, reserved objects are not cached.
+  if ((sta == SL_STATUS_OK) && !keyIsReserved(srcObj->key)) {
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
     // Check and update existing cache entry else add new entry
     if (!(nvm3_cacheUpdateEntry(&h->cache, srcObj->key, pObjC->objAdr, objGroup))) {
@@ -1284,6 +1487,20 @@ static sl_status_t fifoWriteObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, bool copyO
     sta = writeObj(h, srcObj, pObjC, dstAdr, copyObj, objGroup, &wrFailure);
     if (sta == SL_STATUS_OK) {
       h->fifoNextObj = pObjC->nextObjAdr;
+    } else if (!copyObj && (writeStream != NULL) && (writeStream->fillSta != SL_STATUS_OK)) {
+      // The stream aborted the write before any header was written.
+      // A scan stops at the missing header, so skip the rest of the page
+      // holding the partial payload, like after an aborted write at open.
+      nextObj = pObjC->nextObjAdr;
+      if (nextObj != nvm3_pageGetFirstObj(pageAdrFromIdx(h, pageIdxFromAdr(h, nextObj)))) {
+        nvm3_ObjPtr_t pageObj = getFirstObjAdrInNextGoodPage(h, nextObj);
+        if (pageObj != h->fifoFirstObj) {
+          h->unusedNvmSize -= pageFreeSize(h, nextObj);
+          nextObj = pageObj;
+        }
+      }
+      h->fifoNextObj = nextObj;
+      break;
     } else {
       size_t curIdx;
       nvm3_HalPtr_t curAdr;
@@ -1329,8 +1546,8 @@ static sl_status_t fifoWriteObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, bool copyO
     }
   } while ((sta != SL_STATUS_OK) && (writeFullAllowed(h, srcObj->totalLen)));
 
-  // Update cache according to operation result.
-  if (sta == SL_STATUS_OK) {
+  // Update cache according to operation result, reserved objects are not cached.
+  if ((sta == SL_STATUS_OK) && !keyIsReserved(srcObj->key)) {
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
     // Check and update existing cache entry else add new entry
     if (!(nvm3_cacheUpdateEntry(&h->cache, srcObj->key, pObjC->objAdr, objGroup))) {
@@ -1347,32 +1564,14 @@ static sl_status_t fifoWriteObj(nvm3_Handle_t *h, nvm3_Obj_t *srcObj, bool copyO
 }
 #endif
 
-/* Write object to NVM (wrapper function). */
-static sl_status_t fifoWriteWrapper(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
-                                    const void *srcPtr, size_t srcLen,
-                                    nvm3_ObjGroup_t objGroup)
+/* Write a new object at the FIFO end, without repack or threshold checks. */
+static sl_status_t fifoWriteNewObj(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
+                                   const void *srcPtr, size_t srcLen,
+                                   nvm3_ObjGroup_t objGroup)
 {
   sl_status_t sta;
-  bool wrAllowed;
   NVM3_OBJ_T_ALLOCATION(ObjB);
 
-  nvm3_tracePrint(TRACE_LEVEL_LOW, "  fifoWriteWrapper.\n");
-
-  // Check the size of the new object.
-  if (srcLen > h->maxObjectSize) {
-    return SL_STATUS_NVM3_WRITE_DATA_SIZE;
-  }
-
-  (void)repackUntilGood(h);
-
-  // Always allow writing of delete objects.
-  wrAllowed = (objGroup == objGroupDeleted) ? true : writeHardAllowed(h, srcLen);
-  if (!wrAllowed) {
-    nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - fifoWriteWrapper: storage full, unusedNvmSize=%u, srcLen=%d.\n", h->unusedNvmSize, srcLen);
-    NVM3_ERROR_ASSERT();
-    return SL_STATUS_FULL;
-  }
-
   objBegin(pObjB);
   /* Initialize the object structure. */
   nvm3_objInit(pObjB, NVM3_OBJ_PTR_INVALID);
@@ -1397,6 +1596,50 @@ static sl_status_t fifoWriteWrapper(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
   return sta;
 }
 
+/* Write a new object for the application, counted in the wear statistics.
+   Objects written by the driver itself, like rollbacks, are not counted. */
+static sl_status_t fifoWriteUserObj(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
+                                    const void *srcPtr, size_t srcLen,
+                                    nvm3_ObjGroup_t objGroup)
+{
+  sl_status_t sta;
+  size_t unusedPre = h->unusedNvmSize;
+
+  sta = fifoWriteNewObj(h, key, srcPtr, srcLen, objGroup);
+  if ((sta == SL_STATUS_OK) && !keyIsReserved(key)) {
+    h->wearStats.userBytesWritten += (uint32_t)(unusedPre - h->unusedNvmSize);
+  }
+
+  return sta;
+}
+
+/* Write object to NVM (wrapper function). */
+static sl_status_t fifoWriteWrapper(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
+                                    const void *srcPtr, size_t srcLen,
+                                    nvm3_ObjGroup_t objGroup)
+{
+  bool wrAllowed;
+
+  nvm3_tracePrint(TRACE_LEVEL_LOW, "  fifoWriteWrapper.\n");
+
+  // Check the size of the new object.
+  if (srcLen > h->maxObjectSize) {
+    return SL_STATUS_NVM3_WRITE_DATA_SIZE;
+  }
+
+  (void)repackUntilGood(h);
+
+  // Always allow writing of delete objects.
+  wrAllowed = (objGroup == objGroupDeleted) ? true : writeHardAllowed(h, srcLen);
+  if (!wrAllowed) {
+    nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - fifoWriteWrapper: storage full, unusedNvmSize=%u, srcLen=%d.\n", h->unusedNvmSize, srcLen);
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_FULL;
+  }
+
+  return fifoWriteUserObj(h, key, srcPtr, srcLen, objGroup);
+}
+
 /* Read object from NVM. */
 #if defined(NVM3_SECURITY)
 static sl_status_t fifoReadObj(nvm3_Handle_t *h, void *dstPtr,
@@ -1642,6 +1885,59 @@ static sl_status_t fifoReadObj(nvm3_Handle_t *h, void *dstPtr,
 
   return SL_STATUS_OK;
 }
+
+/* Read object from NVM, one fragment chunk at a time. */
+static sl_status_t fifoReadObjStream(nvm3_Handle_t *h, nvm3_ObjPtr_t obj,
+                                     uint32_t *buf, size_t bufSize,
+                                     nvm3_ReadStreamFn_t readFn, void *user)
+{
+  nvm3_ObjPtr_t fragAdr = obj->objAdr;
+  nvm3_HalPtr_t srcAdr;
+  size_t hdrLen;
+  size_t fragLen;
+  size_t chunkLen;
+  size_t wordCnt;
+  size_t ofs = 0;
+  nvm3_ObjHdrLarge_t fraHdrLarge;
+
+  nvm3_tracePrint(TRACE_LEVEL_LOW, "  fifoReadObjStream: len=%u, bufSize=%u.\n", obj->totalLen, bufSize);
+
+  while (ofs < obj->totalLen) {
+    // Read small object header, and the large header if needed.
+    nvm3_halReadWords(HAL, fragAdr, &fraHdrLarge, NVM3_OBJ_HEADER_SIZE_WSMALL);
+
+    nvm3_ObjectKey_t keyAct = nvm3_objHdrGetKey((nvm3_ObjHdrSmallPtr_t)&fraHdrLarge);
+    if (keyAct != obj->key) {
+      nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - fifoReadObjStream: fragment has wrong key, exp=%u, act=%u.\n", obj->key, keyAct);
+      NVM3_ERROR_ASSERT();
+      return SL_STATUS_NVM3_KEY_MISMATCH;
+    }
+
+    hdrLen = nvm3_objHdrGetHdrLen((nvm3_ObjHdrSmallPtr_t)&fraHdrLarge);
+    if (hdrLen != NVM3_OBJ_HEADER_SIZE_SMALL) {
+      nvm3_halReadWords(HAL, fragAdr, &fraHdrLarge, NVM3_OBJ_HEADER_SIZE_WLARGE);
+    }
+    fragLen = SL_MIN(nvm3_objHdrGetDatLen(&fraHdrLarge), obj->totalLen - ofs);
+
+    // Pass the fragment payload in chunks.
+    srcAdr = calcAdr(fragAdr, hdrLen);
+    while (fragLen > 0U) {
+      chunkLen = SL_MIN(fragLen, bufSize);
+      wordCnt = (chunkLen + (NVM3_WORD_SIZE - 1U)) / NVM3_WORD_SIZE;
+      nvm3_halReadWords(HAL, srcAdr, buf, wordCnt);
+      if (!readFn(user, ofs, buf, chunkLen)) {
+        return SL_STATUS_ABORT;
+      }
+      srcAdr = calcAdr(srcAdr, wordCnt * NVM3_WORD_SIZE);
+      ofs += chunkLen;
+      fragLen -= chunkLen;
+    }
+
+    fragAdr = getFirstObjAdrInNextGoodPage(h, fragAdr);
+  }
+
+  return SL_STATUS_OK;
+}
 #endif
 
 // Validate the object located at the given address.
@@ -1658,10 +1954,15 @@ static bool validateObjFragments(nvm3_Handle_t *h, nvm3_ObjPtr_t fragAdr, nvm3_O
   nvm3_ObjFragType_t fragTyp;
   nvm3_ObjHdrSmall_t objHdrSmall;
   nvm3_ObjHdrSmall_t fraHdrSmall;
+  nvm3_ObjHdrLarge_t fraHdrLarge;
 
-  // Read small object header
-  nvm3_halReadWords(HAL, obj->objAdr, &objHdrSmall, NVM3_OBJ_HEADER_SIZE_WSMALL);
+  // Read small object header, the first fragment header is only read once.
   nvm3_halReadWords(HAL, fragAdr, &fraHdrSmall, NVM3_OBJ_HEADER_SIZE_WSMALL);
+  if (fragAdr == obj->objAdr) {
+    objHdrSmall = fraHdrSmall;
+  } else {
+    nvm3_halReadWords(HAL, obj->objAdr, &objHdrSmall, NVM3_OBJ_HEADER_SIZE_WSMALL);
+  }
 
   // Check for erased
   if (nvm3_objHdrGetErased(&objHdrSmall)) {
@@ -1709,8 +2010,8 @@ static bool validateObjFragments(nvm3_Handle_t *h, nvm3_ObjPtr_t fragAdr, nvm3_O
     return false;
   }
 
+  // The large header is read once, and used for both length and validation.
   if (nvm3_objHdrGetHdrIsLarge(&fraHdrSmall)) {
-    nvm3_ObjHdrLarge_t fraHdrLarge;
     nvm3_halReadWords(HAL, fragAdr, &fraHdrLarge, NVM3_OBJ_HEADER_SIZE_WLARGE);
     fragLen = nvm3_objHdrGetDatLen(&fraHdrLarge);
   } else {
@@ -1746,9 +2047,6 @@ static bool validateObjFragments(nvm3_Handle_t *h, nvm3_ObjPtr_t fragAdr, nvm3_O
   hdrLen = nvm3_objHdrGetHdrLen(&fraHdrSmall);
 
   if (hdrIsLarge) {
-    nvm3_ObjHdrLarge_t fraHdrLarge;
-
-    nvm3_halReadWords(HAL, fragAdr, &fraHdrLarge, NVM3_OBJ_HEADER_SIZE_WLARGE);
     obj->isHdrValid = nvm3_objHdrValidateLarge(&fraHdrLarge);
   } else {
     obj->isHdrValid = nvm3_objHdrValidateSmall(&fraHdrSmall);
@@ -1860,10 +2158,52 @@ static bool validateObj(nvm3_Handle_t *h, nvm3_Obj_t *obj, bool checkAllFrag, nv
   return obj->isValid;
 }
 
+/* Load an unfragmented object that has been validated since it was written.
+   Only the header is read to get the type and length, the header check,
+   the page bounds check, and the fragment checks were done by validateObj()
+   and the object has not moved since. */
+static void loadVerifiedObj(nvm3_Handle_t *h, nvm3_ObjPtr_t objAdr, nvm3_Obj_t *obj, nvm3_ObjGroup_t *pObjGroup)
+{
+  nvm3_ObjHdrLarge_t objHdr;
+  nvm3_ObjHdrSmallPtr_t objHdrSmall = (nvm3_ObjHdrSmallPtr_t)&objHdr;
+  nvm3_ObjType_t objType;
+  size_t hdrLen;
+  size_t len;
+
+  nvm3_objInit(obj, objAdr);
+  nvm3_halReadWords(HAL, objAdr, &objHdr, NVM3_OBJ_HEADER_SIZE_WSMALL);
+  if (nvm3_objHdrGetHdrIsLarge(objHdrSmall)) {
+    nvm3_halReadWords(HAL, objAdr, &objHdr, NVM3_OBJ_HEADER_SIZE_WLARGE);
+  }
+  objType = nvm3_objHdrGetType(objHdrSmall);
+  hdrLen = nvm3_objHdrGetHdrLen(objHdrSmall);
+  if (objType == objTypeCounterSmall) {
+    len = COUNTER_SIZE;
+  } else if (objType == objTypeDeleted) {
+    len = 0;
+  } else {
+    len = nvm3_objHdrGetDatLen(&objHdr);
+  }
+
+  obj->key = nvm3_objHdrGetKey(objHdrSmall);
+  obj->objType = (uint8_t)objType;
+  obj->isValid = true;
+  obj->isHdrValid = true;
+  obj->totalLen = len;
+  obj->nextObjAdr = getNextObj(h, objAdr, hdrLen, len);
+  obj->frag.detail[0].adr = objAdr;
+  obj->frag.detail[0].len = (uint16_t)len;
+  obj->frag.detail[0].typ = (uint8_t)fragTypeNone;
+  obj->frag.idx = 1;
+  *pObjGroup = nvm3_objTypeToGroup(objType);
+}
+
 /* Find the object in the NVM:
      1. First check the cache for a possible match. Even when the object is
         found in cache, it still needs to be validated to retrieve
-        all the fragment locations.
+        all the fragment locations. Objects that are not fragmented are
+        marked as verified in cache after the first validation, and are
+        loaded without validation until they are written or moved.
      2. If the object is not in cache, start searching the NVM from
         the last page.
      3. In is a special case where the key is a special search
@@ -1891,18 +2231,30 @@ static sl_status_t findObj(nvm3_Handle_t *h, nvm3_ObjectKey_t key, nvm3_Obj_t *o
   if (keyIsValid(key)) {
     nvm3_ObjGroup_t group;
     objAdr = nvm3_cacheGet(&h->cache, key, &group);
+    if (objAdr != NVM3_OBJ_PTR_INVALID) {
+      h->cache.stats.hitCount++;
+    } else {
+      h->cache.stats.missCount++;
+    }
   }
 
   nvm3_tracePrint(TRACE_LEVEL_LOW, "  findObj: cache adr=%p.\n", objAdr);
 
   /* If Object is in the cache, make sure it is valid, this
      is required to populate all fragment position. */
-  if (objAdr != NVM3_OBJ_PTR_INVALID) {
+  if ((objAdr != NVM3_OBJ_PTR_INVALID) && nvm3_cacheGetVerified(&h->cache, key)) {
+    h->cache.stats.verifiedHitCount++;
+    loadVerifiedObj(h, objAdr, obj, pObjGroup);
+    found = true;
+  } else if (objAdr != NVM3_OBJ_PTR_INVALID) {
     nvm3_objInit(obj, objAdr);
     isValid = validateObj(h, obj, true, &objGroup);
     if (isValid) {
       found = true;
       *pObjGroup = objGroup;
+      if (!obj->isFragmented) {
+        nvm3_cacheSetVerified(&h->cache, key);
+      }
     } else {
       nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - findObj: cache hit, but the object is NOT valid, key=%u, adr=%p.\n", key, objAdr);
       NVM3_ERROR_ASSERT();
@@ -2178,15 +2530,14 @@ static void findNextObj(nvm3_Handle_t *h)
   }
 }
 
-static void fifoScan(nvm3_Handle_t *h, FifoScanArea_t fifoScanArea, FifoScanCallback_t fifoScanCallback, void *user)
+// Scan the FIFO from the object at objAdr to the FIFO end.
+static void fifoScanFrom(nvm3_Handle_t *h, nvm3_ObjPtr_t objAdr, FifoScanArea_t fifoScanArea, FifoScanCallback_t fifoScanCallback, void *user)
 {
-  nvm3_ObjPtr_t objAdr;
   nvm3_ObjGroup_t objGroup;
   bool isValid;
   bool keepGoing;
   NVM3_OBJ_T_ALLOCATION(ObjD);
 
-  objAdr = h->fifoFirstObj;
   // Scan all objects from oldest to newest.
   while ((objAdr != h->fifoNextObj) && (objAdr != NVM3_OBJ_PTR_INVALID)) {
     // Get the current object.
@@ -2214,6 +2565,11 @@ static void fifoScan(nvm3_Handle_t *h, FifoScanArea_t fifoScanArea, FifoScanCall
   }
 }
 
+static void fifoScan(nvm3_Handle_t *h, FifoScanArea_t fifoScanArea, FifoScanCallback_t fifoScanCallback, void *user)
+{
+  fifoScanFrom(h, h->fifoFirstObj, fifoScanArea, fifoScanCallback, user);
+}
+
 /***************************************************************************//**
  * The callback when scanning the cache for unique objects in the first page.
  ******************************************************************************/
@@ -2230,7 +2586,7 @@ static bool repackFirstPageScanCacheCallback(nvm3_Cache_t* cache_h, nvm3_ObjectK
     objBegin(pObjB);
     parameters->status = findObj(parameters->h, key, pObjB, &objFindGroup);
     if ((parameters->status == SL_STATUS_OK) && samePage(parameters->h, pObjB->objAdr, parameters->h->fifoFirstObj)) {
-      if ((parameters->copyMode == repackCopySome) && ((pObjB->totalLen + parameters->copyAccumulated) > h->maxObjectSize)) {
+      if ((parameters->copyMode == repackCopySome) && (parameters->copyAccumulated > 0U) && ((pObjB->totalLen + parameters->copyAccumulated) > parameters->copyLimit)) {
         parameters->copyAllDone = false;
       } else {
         if (pageIdxFromAdr(parameters->h, parameters->h->fifoFirstObj) == pageIdxFromAdr(parameters->h, parameters->h->fifoNextObj)) {
@@ -2265,12 +2621,13 @@ static bool repackFirstPageCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t obj, nvm3_Ob
   repackFirstPageParameters *parameters = user;
   NVM3_OBJ_T_ALLOCATION(ObjB);
 
-  if (group != objGroupDeleted) {
+  // Checkpoint and transaction markers are never copied, they are outdated by the repack.
+  if ((group != objGroupDeleted) && !keyIsReserved(obj->key)) {
     objBegin(pObjB);
     parameters->status = findObj(h, obj->key, pObjB, &objFindGroup);
     if ((parameters->status == SL_STATUS_OK) && (objFindGroup != objGroupDeleted) && (pObjB->objAdr == obj->objAdr)) {
       objEnd(pObjB);
-      if ((parameters->copyMode == repackCopySome) && ((obj->totalLen + parameters->copyAccumulated) > h->maxObjectSize)) {
+      if ((parameters->copyMode == repackCopySome) && (parameters->copyAccumulated > 0U) && ((obj->totalLen + parameters->copyAccumulated) > parameters->copyLimit)) {
         parameters->copyAllDone = false;
       } else {
         parameters->copyAccumulated += (obj->totalLen + NVM3_OBJ_HEADER_SIZE_LARGE);
@@ -2294,7 +2651,9 @@ static bool repackFirstPageCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t obj, nvm3_Ob
 }
 
 // Repack the FIFO first page. Copy objects if a newer object does not exist.
-static sl_status_t repackFirstPage(nvm3_Handle_t *h, repackCopyMode_t copyMode)
+// When only some objects are copied, at least one object is copied and the
+// copy stops before the copied size exceeds the copy limit.
+static sl_status_t repackFirstPage(nvm3_Handle_t *h, repackCopyMode_t copyMode, size_t copyLimit)
 {
   nvm3_HalPtr_t pageAdr;
   nvm3_PageHdr_t pageHdr;
@@ -2313,6 +2672,7 @@ static sl_status_t repackFirstPage(nvm3_Handle_t *h, repackCopyMode_t copyMode)
   parameters.h = h;
   parameters.status = SL_STATUS_OK;
   parameters.copyMode = copyMode;
+  parameters.copyLimit = copyLimit;
   parameters.copyAccumulated = 0;
   parameters.copyAllDone = true;
   if (h->fifoFirstObj == h->fifoNextObj) {
@@ -2321,11 +2681,13 @@ static sl_status_t repackFirstPage(nvm3_Handle_t *h, repackCopyMode_t copyMode)
     h->unusedNvmSize -= (h->halInfo.pageSize - NVM3_PAGE_HEADER_SIZE);
   } else {
     // Copy unique data
+    size_t unusedPre = h->unusedNvmSize;
     if (!h->cache.overflow) {
       nvm3_cacheScan(&h->cache, repackFirstPageScanCacheCallback, &parameters);
     } else {
       fifoScan(h, fifoScanFirst, repackFirstPageCallback, &parameters);
     }
+    h->wearStats.repackBytesCopied += (uint32_t)(unusedPre - h->unusedNvmSize);
   }
   if ((parameters.status == SL_STATUS_OK) && (parameters.copyAllDone)) {
     // Mark page as ready to be erased.
@@ -2394,7 +2756,13 @@ static sl_status_t erasePage(nvm3_Handle_t *h, size_t idx, uint32_t eraseCnt)
 #else
   sta = nvm3_pageErase(HAL, pageAdr, eraseCnt, &h->halInfo);
 #endif
-  if (sta != SL_STATUS_OK) {
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+  // Erasing a page changes the FIFO state, any checkpoint is now outdated.
+  h->checkpointNextObj = NVM3_OBJ_PTR_INVALID;
+#endif
+  if (sta == SL_STATUS_OK) {
+    h->wearStats.pageEraseCount++;
+  } else {
     nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - erasePage: idx=%u, Erase error.\n", idx);
     NVM3_ERROR_ASSERT();
   }
@@ -2525,7 +2893,7 @@ static void eraseEipAndInvalidPages(nvm3_Handle_t *h)
 }
 
 // Repack the first page according to the page state.
-static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, repackCopyMode_t copyMode)
+static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, repackCopyMode_t copyMode, size_t copyLimit)
 {
   sl_status_t sta;
   nvm3_HalPtr_t pageAdr;
@@ -2539,7 +2907,7 @@ static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, r
   nvm3_halReadWords(HAL, pageAdr, &pageHdr, NVM3_PAGE_HEADER_WSIZE);
   *pageState = nvm3_pageGetState(&pageHdr);
   if (*pageState != nvm3_PageStateGoodEip) {
-    sta = repackFirstPage(h, copyMode);
+    sta = repackFirstPage(h, copyMode, copyLimit);
   } else {
     sta = eraseFirstPage(h);
     size_t freeB = getFreeSize(h);
@@ -2558,14 +2926,14 @@ static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, r
   return sta;
 }
 
-// Run repack just a single time
-static sl_status_t repackOnce(nvm3_Handle_t *h)
+// Run repack just a single time, copy at most copyLimit bytes or erase one page.
+static sl_status_t repackOnce(nvm3_Handle_t *h, size_t copyLimit)
 {
   nvm3_PageState_t pageState;
   sl_status_t sta;
 
-  nvm3_tracePrint(TRACE_LEVEL_REPACK, "  repackOnce: Begin, unusedNvmSize=%u.\n", h->unusedNvmSize);
-  sta = repackWorker(h, &pageState, repackCopySome);
+  nvm3_tracePrint(TRACE_LEVEL_REPACK, "  repackOnce: Begin, unusedNvmSize=%u, copyLimit=%u.\n", h->unusedNvmSize, copyLimit);
+  sta = repackWorker(h, &pageState, repackCopySome, copyLimit);
   (void)pageState;
   nvm3_tracePrint(TRACE_LEVEL_REPACK, "  repackOnce: End,   unusedNvmSize=%u, nextObj=%p.\n", h->unusedNvmSize, h->fifoNextObj);
 
@@ -2588,7 +2956,7 @@ static sl_status_t repackUntilGood(nvm3_Handle_t *h)
 #if NVM3_TRACE_ENABLED
     freePre = h->unusedNvmSize;
 #endif
-    sta = repackWorker(h, &pageState, repackCopyAll);
+    sta = repackWorker(h, &pageState, repackCopyAll, 0U);
     if (sta != SL_STATUS_OK) {
       break;
     }
@@ -2597,7 +2965,7 @@ static sl_status_t repackUntilGood(nvm3_Handle_t *h)
   }
   if (pageState == nvm3_PageStateGoodEip) {
     nvm3_tracePrint(TRACE_LEVEL_REPACK, "  repackUntilGood: One extra Work round is needed.\n");
-    sta = repackWorker(h, &pageState, repackCopyAll);
+    sta = repackWorker(h, &pageState, repackCopyAll, 0U);
     (void)pageState;
   }
   nvm3_tracePrint(TRACE_LEVEL_REPACK, "  repackUntilGood: End,   unusedNvmSize=%u, nextObj=%p.\n", h->unusedNvmSize, h->fifoNextObj);
@@ -2641,23 +3009,43 @@ static nvm3_HalPtr_t counterIdxToAdr(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t i
   return incAddr;
 }
 
-static void counterIncFldGet(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx, uint32_t *inc)
+/* Read the counter base and all increment fields to the counter buffer.
+   An unfragmented counter is read with a single HAL read. */
+static void counterLoad(nvm3_Handle_t *h, nvm3_Obj_t *obj)
 {
-  nvm3_HalPtr_t incAddr;
+  nvm3_HalPtr_t adr;
   bool high;
 
-  incAddr = counterIdxToAdr(h, obj, idx, &high);
-  if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
-    uint32_t data;
+  adr = calcAdr(obj->objAdr, NVM3_OBJ_HEADER_SIZE_COUNTER);
+  if (!obj->isFragmented) {
+    nvm3_halReadWords(HAL, adr, counterBuf, COUNTER_WSIZE);
+  } else {
+    nvm3_halReadWords(HAL, adr, &counterBuf[0], 1);
+    for (size_t i = 1; i < COUNTER_WSIZE; i++) {
+      // The first increment field in each word
+      size_t idx = (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) ? ((i - 1U) * 2U) : (i - 1U);
+      adr = counterIdxToAdr(h, obj, idx, &high);
+      nvm3_halReadWords(HAL, adr, &counterBuf[i], 1);
+    }
+  }
+}
 
-    nvm3_halReadWords(HAL, incAddr, &data, 1);
-    if (high) {
+/* Get an increment field from the counter buffer. */
+static uint32_t counterBufFldGet(nvm3_Handle_t *h, size_t idx)
+{
+  uint32_t data;
+
+  if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
+    data = counterBuf[1U + (idx / 2U)];
+    if ((idx & 1U) != 0U) {
       data >>= 16;
     }
-    *inc = data & 0xffffU;
+    data &= 0xffffU;
   } else {
-    nvm3_halReadWords(HAL, incAddr, inc, 1);
+    data = counterBuf[1U + idx];
   }
+
+  return data;
 }
 
 static sl_status_t counterIncFldSet(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx, uint32_t inc)
@@ -2684,21 +3072,21 @@ static sl_status_t counterIncFldSet(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t id
   return sta;
 }
 
-static bool counterHasNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx)
+static bool counterHasNewBase(nvm3_Handle_t *h, size_t idx)
 {
   bool res = false;
   uint32_t incField0;
 
   if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
     if (idx < (counterMaxNumberOfInc(h) - 2U)) {
-      counterIncFldGet(h, obj, idx, &incField0);
+      incField0 = counterBufFldGet(h, idx);
       if ((incField0 & 0xFFU) == 0U) {
         res = true;
       }
     }
   } else {
     if (idx < (counterMaxNumberOfInc(h) - 1U)) {
-      counterIncFldGet(h, obj, idx, &incField0);
+      incField0 = counterBufFldGet(h, idx);
       if ((incField0 & 0xFFFFU) == 0U) {
         res = true;
       }
@@ -2708,7 +3096,7 @@ static bool counterHasNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx)
   return res;
 }
 
-static bool counterIsValidNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx, uint32_t *base)
+static bool counterIsValidNewBase(nvm3_Handle_t *h, size_t idx, uint32_t *base)
 {
   uint8_t BCCB;
   bool res = false;
@@ -2719,9 +3107,9 @@ static bool counterIsValidNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx,
 
   if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
     if (idx < (counterMaxNumberOfInc(h) - 2U)) {
-      counterIncFldGet(h, obj, idx, &incField0);
-      counterIncFldGet(h, obj, idx + 1U, &incField1);
-      counterIncFldGet(h, obj, idx + 2U, &incField2);
+      incField0 = counterBufFldGet(h, idx);
+      incField1 = counterBufFldGet(h, idx + 1U);
+      incField2 = counterBufFldGet(h, idx + 2U);
       BCCB = 8;
       nvm3_utilsComputeBergerCode(&BCCB, &incField1, 16);
       nvm3_utilsComputeBergerCode(&BCCB, &incField2, 16);
@@ -2732,8 +3120,8 @@ static bool counterIsValidNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx,
     }
   } else {
     if (idx < (counterMaxNumberOfInc(h) - 1U)) {
-      counterIncFldGet(h, obj, idx, &incField0);
-      counterIncFldGet(h, obj, idx + 1U, &incField1);
+      incField0 = counterBufFldGet(h, idx);
+      incField1 = counterBufFldGet(h, idx + 1U);
       BCCB = 16;
       nvm3_utilsComputeBergerCode(&BCCB, &incField1, 32);
       if (((incField0 & 0xFFFFU) == 0U) && ((incField0 >> 16) == BCCB)) {
@@ -2746,14 +3134,16 @@ static bool counterIsValidNewBase(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx,
   return res;
 }
 
-static bool counterIsValidNewInc(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx, uint32_t *inc)
+/* For 32-bit write size, the Berger codes of the increments are taken from
+   counterCodes, computed for all increment fields by readCounter(). */
+static bool counterIsValidNewInc(nvm3_Handle_t *h, size_t idx, uint32_t *inc)
 {
   uint8_t BCCB = 0;
   bool sta;
   uint32_t incField0;
 
   *inc = 0;
-  counterIncFldGet(h, obj, idx, &incField0);
+  incField0 = counterBufFldGet(h, idx);
 
   if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
     if (incField0 == 0xFFFFU) {
@@ -2769,7 +3159,7 @@ static bool counterIsValidNewInc(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx,
     if (incField0 == 0xFFFFFFFFU) {
       sta = false;
     } else {
-      nvm3_utilsComputeBergerCode(&BCCB, &incField0, 16);
+      BCCB = counterCodes[idx];
       sta = BCCB == (uint8_t)(incField0 >> 16);
       if (sta) {
         *inc = (incField0 & 0xFFFFU);
@@ -2783,16 +3173,17 @@ static bool counterIsValidNewInc(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t idx,
 /* Reconstruct the counter value from the base and increments. */
 static uint32_t readCounter(nvm3_Handle_t *h, nvm3_Obj_t *obj)
 {
-  uint32_t counterBase = 0;
+  uint32_t counterBase;
   size_t idx;
-  // Get counter base.
-  size_t hdrLen;
-  nvm3_HalPtr_t adr;
 
-  hdrLen = NVM3_OBJ_HEADER_SIZE_COUNTER;
-  adr = calcAdr(obj->objAdr, hdrLen);
-  nvm3_halReadWords(HAL, adr, &counterBase, 1);
-  nvm3_tracePrint(TRACE_LEVEL_COUNTER, "      cntRd: oAdr=%p, bAdr=%p, base=%u.\n", obj->objAdr, adr, counterBase);
+  // Get counter base and increments.
+  counterLoad(h, obj);
+  counterBase = counterBuf[0];
+  nvm3_tracePrint(TRACE_LEVEL_COUNTER, "      cntRd: oAdr=%p, base=%u.\n", obj->objAdr, counterBase);
+  if (h->halInfo.writeSize != NVM3_HAL_WRITE_SIZE_16) {
+    // Compute the Berger codes of all increments in one pass.
+    nvm3_utilsComputeBergerCodes(counterCodes, &counterBuf[1], COUNTER_MAX_NO_INC_32, 16);
+  }
 
   // Look for info in the counter increments.
   // It can be either increments or new base values.
@@ -2800,12 +3191,12 @@ static uint32_t readCounter(nvm3_Handle_t *h, nvm3_Obj_t *obj)
   while (idx < counterMaxNumberOfInc(h)) {
     bool isANewBase;
 
-    isANewBase = counterHasNewBase(h, obj, idx);
+    isANewBase = counterHasNewBase(h, idx);
     if (isANewBase) {
       // Index is pointing to a base value
       bool isAValidNewBase;
 
-      isAValidNewBase = counterIsValidNewBase(h, obj, idx, &counterBase);
+      isAValidNewBase = counterIsValidNewBase(h, idx, &counterBase);
       if (isAValidNewBase) {
         // Index is pointing to a valid new base
         nvm3_tracePrint(TRACE_LEVEL_COUNTER, "      cntRd: idx=%2u, base=%u.\n", idx, counterBase);
@@ -2820,7 +3211,7 @@ static uint32_t readCounter(nvm3_Handle_t *h, nvm3_Obj_t *obj)
       bool isAValidNewInc;
       uint32_t incField;
 
-      isAValidNewInc = counterIsValidNewInc(h, obj, idx, &incField);
+      isAValidNewInc = counterIsValidNewInc(h, idx, &incField);
       if (isAValidNewInc) {
         // Handle only valid increments
         counterBase += incField;
@@ -2843,8 +3234,9 @@ static uint8_t getCounterFreeIncrementIdx(nvm3_Handle_t *h, nvm3_Obj_t *obj)
   uint32_t incField;
   size_t idx = 0;
 
+  counterLoad(h, obj);
   while (idx < counterMaxNumberOfInc(h)) {
-    counterIncFldGet(h, obj, idx, &incField);
+    incField = counterBufFldGet(h, idx);
     if (h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) {
       if (incField == 0xFFFFU) {
         freeIncIdx = (uint8_t)idx;
@@ -2971,52 +3363,611 @@ static sl_status_t fifoUpdateCounter(nvm3_Handle_t *h, nvm3_Obj_t *obj,
     } else {
       nvm3_tracePrint(TRACE_LEVEL_COUNTER, "      cntUpd: base - idx=%u, cntNew=%u.\n", idx, cntNew);
       sta = counterUpdateBase(h, obj, idx, cntNew);
+      if (sta == SL_STATUS_OK) {
+        h->wearStats.counterBaseRewrites++;
+      }
     }
     hasBeenUpdated = (sta == SL_STATUS_OK);
+    if (hasBeenUpdated) {
+      // Each increment field is one write unit.
+      h->wearStats.userBytesWritten += (uint32_t)incNeeded * ((h->halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) ? sizeof(uint16_t) : sizeof(uint32_t));
+    }
   }
 
   if (!hasBeenUpdated) {
     sta = fifoWriteWrapper(h, obj->key, &cntNew, COUNTER_SIZE, objGroupCounter);
+    if (sta == SL_STATUS_OK) {
+      h->wearStats.counterObjectRewrites++;
+    }
   }
 
   return sta;
 }
 
-static bool cacheUpdateCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t objPtr, nvm3_ObjGroup_t objGroup, void *user)
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+/* Atomic transactions.
+   A transaction is written as a begin marker, the objects, and a commit
+   marker, using the reserved transaction key for the markers. No repack is
+   done while a transaction is written, so the objects are contiguous in the
+   FIFO. When scanning the FIFO, the objects following a begin marker are held
+   back, and are only added to the cache when the matching commit marker is
+   found. An interrupted transaction is completed by an abort marker, and is
+   rolled back by writing a copy of the object that was valid before the
+   transaction, or a delete object. After the rollback, the newest object of
+   every key is valid, also if the markers are later removed by a repack. */
+
+// The space needed for an object of the given data size.
+static size_t transactionObjLen(nvm3_Handle_t *h, size_t len)
 {
-  // By scanning the FIFO from the oldest to the newest object, information
-  // from newer objects will replace information from the older. This will
-  // ensure that the cache contains valid information.
-  nvm3_cacheSet(&h->cache, objPtr->key, objPtr->objAdr, objGroup);
-  (void)user;
-
-  return true;
+#if defined(NVM3_SECURITY)
+  if (len > 0U) {
+    len += NVM3_GCM_SIZE_OVERHEAD;
+  }
+#endif
+  return OBJ_LEN_REQ(h->halInfo.pageSize, len);
 }
 
-static void cacheUpdate(nvm3_Handle_t *h)
+static sl_status_t transactionWriteMarker(nvm3_Handle_t *h, uint32_t magic, size_t count)
 {
-  nvm3_cacheClear(&h->cache);
-  fifoScan(h, fifoScanAll, cacheUpdateCallback, NULL);
+  TransactionMarker_t marker;
+
+  marker.magic = magic;
+  marker.count = (uint32_t)count;
+
+  return fifoWriteNewObj(h, NVM3_TRANSACTION_KEY, &marker, sizeof(marker), objGroupData);
 }
 
-static sl_status_t initialize(nvm3_Handle_t *h, uint32_t newCfgEraseCnt)
+static bool transactionReadMarker(nvm3_Handle_t *h, nvm3_Obj_t *obj, nvm3_ObjGroup_t objGroup, TransactionMarker_t *marker)
 {
-  size_t validCnt;
-  size_t unusedCnt;
+  size_t datLen = obj->totalLen;
   sl_status_t sta;
-  nvm3_HalPtr_t pageAdr;
-  nvm3_PageHdr_t pageHdr;
-  uint32_t eraseCnt;
 
-  nvm3_tracePrint(TRACE_LEVEL_INIT, "  initialize: begin\n");
+#if defined(NVM3_SECURITY)
+  datLen -= SL_MIN(datLen, NVM3_GCM_SIZE_OVERHEAD);
+#endif
+  if ((objGroup != objGroupData) || (datLen != sizeof(TransactionMarker_t))) {
+    return false;
+  }
+  sta = fifoReadObj(h, marker, 0, obj->totalLen, obj, read_data);
+#if defined(NVM3_SECURITY)
+  // Clear decrypted data in global buffer
+  memset(nvm3_decBuf, 0, datLen);
+#endif
 
-  h->fifoFirstIdx = NVM3_PAGE_INDEX_INVALID;
-  h->fifoFirstObj = NVM3_OBJ_PTR_INVALID;
-  h->fifoNextObj = NVM3_OBJ_PTR_INVALID;
-  h->validNvmPageCnt = 0;
-  h->unusedNvmSize = 0;
+  return (sta == SL_STATUS_OK);
+}
 
-  nvm3_cacheClear(&h->cache);
+static void transactionScanInit(void)
+{
+  transactionScan.isOpen = false;
+  transactionScan.pendingCnt = 0U;
+  transactionScan.abortedCnt = 0U;
+}
+
+static void transactionAbortedRemove(nvm3_ObjectKey_t key)
+{
+  TransactionScan_t *scan = &transactionScan;
+
+  for (size_t i = 0; i < scan->abortedCnt; i++) {
+    if (scan->aborted[i].key == key) {
+      scan->abortedCnt--;
+      scan->aborted[i] = scan->aborted[scan->abortedCnt];
+      return;
+    }
+  }
+}
+
+static void transactionAbortedAdd(nvm3_ObjectKey_t key)
+{
+  TransactionScan_t *scan = &transactionScan;
+
+  transactionAbortedRemove(key);
+  if (scan->abortedCnt < NVM3_TRANSACTION_MAX_OBJECTS) {
+    scan->aborted[scan->abortedCnt].key = key;
+    scan->aborted[scan->abortedCnt].objAdr = NVM3_OBJ_PTR_INVALID;
+    scan->aborted[scan->abortedCnt].group = objGroupUnknown;
+    scan->abortedCnt++;
+  } else {
+    nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - transactionAbortedAdd: too many aborted objects, key=%u.\n", key);
+    NVM3_ERROR_ASSERT();
+  }
+}
+
+// Discard the objects held back for the open transaction.
+static void transactionScanAbort(void)
+{
+  TransactionScan_t *scan = &transactionScan;
+
+  nvm3_tracePrint(TRACE_LEVEL_INIT, "  transactionScanAbort: pendingCnt=%u.\n", scan->pendingCnt);
+  for (size_t i = 0; i < scan->pendingCnt; i++) {
+    transactionAbortedAdd(scan->pending[i].key);
+  }
+  scan->isOpen = false;
+  scan->pendingCnt = 0U;
+}
+
+// Handle transactions while scanning the FIFO, return true if the object must not be cached now.
+static bool transactionScanObj(nvm3_Handle_t *h, nvm3_Obj_t *obj, nvm3_ObjGroup_t objGroup)
+{
+  TransactionScan_t *scan = &transactionScan;
+  TransactionMarker_t marker;
+
+  if (keyIsTransaction(obj->key)) {
+    if (transactionReadMarker(h, obj, objGroup, &marker)) {
+      if ((marker.magic == TRANSACTION_MAGIC_COMMIT) && scan->isOpen && (marker.count == scan->pendingCnt)) {
+        for (size_t i = 0; i < scan->pendingCnt; i++) {
+          nvm3_cacheSet(&h->cache, scan->pending[i].key, scan->pending[i].objAdr, scan->pending[i].group);
+          transactionAbortedRemove(scan->pending[i].key);
+        }
+        scan->isOpen = false;
+        scan->pendingCnt = 0U;
+      } else {
+        if (scan->isOpen) {
+          transactionScanAbort();
+        }
+        scan->isOpen = (marker.magic == TRANSACTION_MAGIC_BEGIN);
+      }
+    }
+    return true;
+  }
+
+  if (scan->isOpen) {
+    if (scan->pendingCnt < NVM3_TRANSACTION_MAX_OBJECTS) {
+      scan->pending[scan->pendingCnt].key = obj->key;
+      scan->pending[scan->pendingCnt].objAdr = obj->objAdr;
+      scan->pending[scan->pendingCnt].group = objGroup;
+      scan->pendingCnt++;
+      return true;
+    }
+    // Not a valid transaction, it can not hold this many objects.
+    transactionScanAbort();
+  }
+  transactionAbortedRemove(obj->key);
+
+  return false;
+}
+
+/* Find the newest object of each aborted key written before the last begin
+   marker. The pending list holds the newest object found so far, and is
+   copied to the aborted list at each begin marker. */
+static bool transactionRollbackScanCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t objPtr, nvm3_ObjGroup_t objGroup, void *user)
+{
+  TransactionScan_t *scan = &transactionScan;
+  TransactionMarker_t marker;
+
+  (void)user;
+  if (keyIsTransaction(objPtr->key)) {
+    if (transactionReadMarker(h, objPtr, objGroup, &marker) && (marker.magic == TRANSACTION_MAGIC_BEGIN)) {
+      for (size_t i = 0; i < scan->abortedCnt; i++) {
+        scan->aborted[i].objAdr = scan->pending[i].objAdr;
+        scan->aborted[i].group = scan->pending[i].group;
+      }
+    }
+  } else {
+    for (size_t i = 0; i < scan->abortedCnt; i++) {
+      if (scan->aborted[i].key == objPtr->key) {
+        scan->pending[i].objAdr = objPtr->objAdr;
+        scan->pending[i].group = objGroup;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Roll back the aborted objects, optionally closing the open transaction with an abort marker.
+static sl_status_t transactionRollback(nvm3_Handle_t *h, bool writeAbort)
+{
+  TransactionScan_t *scan = &transactionScan;
+  TransactionEntry_t *entry;
+  nvm3_ObjGroup_t objGroup;
+  sl_status_t sta = SL_STATUS_OK;
+  NVM3_OBJ_T_ALLOCATION(ObjA);
+
+  nvm3_tracePrint(TRACE_LEVEL_INIT, "  transactionRollback: abortedCnt=%u, writeAbort=%u.\n", scan->abortedCnt, writeAbort);
+
+  if (writeAbort) {
+    sta = transactionWriteMarker(h, TRANSACTION_MAGIC_ABORT, 0U);
+  }
+
+  for (size_t i = 0; i < scan->abortedCnt; i++) {
+    scan->pending[i].objAdr = NVM3_OBJ_PTR_INVALID;
+    scan->pending[i].group = objGroupUnknown;
+  }
+  scan->pendingCnt = 0U;
+  fifoScan(h, fifoScanAll, transactionRollbackScanCallback, NULL);
+
+  objBegin(pObjA);
+  for (size_t i = 0; (i < scan->abortedCnt) && (sta == SL_STATUS_OK); i++) {
+    entry = &scan->aborted[i];
+    if ((entry->objAdr != NVM3_OBJ_PTR_INVALID) && (entry->group != objGroupDeleted)) {
+      nvm3_objInit(pObjA, entry->objAdr);
+      if (validateObj(h, pObjA, true, &objGroup)) {
+        sta = fifoWriteObj(h, pObjA, COPY_OBJ_TRUE, objGroup);
+        continue;
+      }
+    }
+    sta = fifoWriteNewObj(h, entry->key, NULL, 0U, objGroupDeleted);
+  }
+  objEnd(pObjA);
+
+  if (sta == SL_STATUS_OK) {
+    scan->abortedCnt = 0U;
+  } else {
+    nvm3_tracePrint(NVM3_TRACE_LEVEL_WARNING, "NVM3 WARNING - transactionRollback: incomplete, sta=0x%x.\n", sta);
+  }
+
+  return sta;
+}
+
+// Complete the FIFO scan, and roll back an interrupted transaction.
+static sl_status_t transactionScanEnd(nvm3_Handle_t *h)
+{
+  bool isOpen = transactionScan.isOpen;
+
+  if (isOpen) {
+    transactionScanAbort();
+  }
+  if (transactionScan.abortedCnt == 0U) {
+    return SL_STATUS_OK;
+  }
+
+  return transactionRollback(h, isOpen);
+}
+#endif
+
+static bool cacheUpdateCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t objPtr, nvm3_ObjGroup_t objGroup, void *user)
+{
+  // By scanning the FIFO from the oldest to the newest object, information
+  // from newer objects will replace information from the older. This will
+  // ensure that the cache contains valid information.
+  if (keyIsCheckpoint(objPtr->key)) {
+    return true;
+  }
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+  if (transactionScanObj(h, objPtr, objGroup)) {
+    return true;
+  }
+#endif
+  nvm3_cacheSet(&h->cache, objPtr->key, objPtr->objAdr, objGroup);
+  (void)user;
+
+  return true;
+}
+
+static void cacheUpdate(nvm3_Handle_t *h)
+{
+  nvm3_cacheClear(&h->cache);
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+  transactionScanInit();
+#endif
+  fifoScan(h, fifoScanAll, cacheUpdateCallback, NULL);
+}
+
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+/* Mount checkpoint.
+   A checkpoint is a copy of the cache together with the FIFO state, stored
+   as a chain of chunk objects using the reserved checkpoint key. It is
+   written at the FIFO end by nvm3_repack() and nvm3_close(). During the next
+   initialization, the cache is loaded from the checkpoint, and only the
+   objects written after the checkpoint are scanned. The checkpoint is
+   discarded if a page has been erased since it was written, and a full
+   scan is used instead. */
+
+// The usable chunk size, a multiple of the entry size.
+static size_t checkpointChunkSize(nvm3_Handle_t *h)
+{
+  size_t chunkSize = SL_MIN(sizeof(checkpointBuf), h->maxObjectSize);
+
+  return chunkSize - (chunkSize % sizeof(CheckpointEntry_t));
+}
+
+// The size of the chunk header, the first chunk includes the FIFO state.
+static size_t checkpointHdrSize(size_t chunkIdx)
+{
+  return (chunkIdx == 0U) ? (sizeof(CheckpointHdr_t) + sizeof(CheckpointState_t)) : sizeof(CheckpointHdr_t);
+}
+
+static uint32_t checkpointFirstEraseCnt(nvm3_Handle_t *h)
+{
+  nvm3_PageHdr_t pageHdr;
+
+  nvm3_halReadWords(HAL, pageAdrFromIdx(h, h->fifoFirstIdx), &pageHdr, NVM3_PAGE_HEADER_WSIZE);
+
+  return nvm3_pageGetEraseCnt(&pageHdr);
+}
+
+// Start a new chunk in the checkpoint buffer.
+static void checkpointChunkBegin(CheckpointWriteParameters_t *parameters)
+{
+  nvm3_Handle_t *h = parameters->h;
+  CheckpointHdr_t *hdr = (CheckpointHdr_t *)checkpointBuf;
+
+  hdr->magic = CHECKPOINT_MAGIC;
+  hdr->headOfs = parameters->headOfs;
+  hdr->chunkIdx = parameters->chunkIdx;
+  hdr->chunkCnt = parameters->chunkCnt;
+  hdr->entryCnt = 0U;
+  if (parameters->chunkIdx == 0U) {
+    CheckpointState_t *state = (CheckpointState_t *)&hdr[1];
+    state->nvmSize = (uint32_t)h->nvmSize;
+    state->validPageCnt = (uint32_t)h->validNvmPageCnt;
+    state->firstObjOfs = (uint32_t)((size_t)h->fifoFirstObj - (size_t)h->nvmAdr);
+    state->firstEraseCnt = checkpointFirstEraseCnt(h);
+  }
+  parameters->entryCnt = 0U;
+  parameters->entryMax = (parameters->chunkSize - checkpointHdrSize(parameters->chunkIdx)) / sizeof(CheckpointEntry_t);
+}
+
+// Write the chunk in the checkpoint buffer to the FIFO.
+static sl_status_t checkpointChunkEnd(CheckpointWriteParameters_t *parameters)
+{
+  CheckpointHdr_t *hdr = (CheckpointHdr_t *)checkpointBuf;
+  size_t len = checkpointHdrSize(parameters->chunkIdx) + (parameters->entryCnt * sizeof(CheckpointEntry_t));
+
+  hdr->entryCnt = (uint32_t)parameters->entryCnt;
+  parameters->chunkIdx++;
+
+  return fifoWriteWrapper(parameters->h, NVM3_CHECKPOINT_KEY, checkpointBuf, len, objGroupData);
+}
+
+static bool checkpointCountCallback(nvm3_Cache_t *cache_h, nvm3_ObjectKey_t key, nvm3_ObjGroup_t group, nvm3_ObjPtr_t obj, void *user)
+{
+  size_t *entryCnt = user;
+  (void)cache_h;
+  (void)key;
+  (void)group;
+  (void)obj;
+
+  (*entryCnt)++;
+
+  return true;
+}
+
+static bool checkpointWriteCallback(nvm3_Cache_t *cache_h, nvm3_ObjectKey_t key, nvm3_ObjGroup_t group, nvm3_ObjPtr_t obj, void *user)
+{
+  CheckpointWriteParameters_t *parameters = user;
+  nvm3_Handle_t *h = parameters->h;
+  CheckpointEntry_t *entry;
+  (void)cache_h;
+
+  if (parameters->entryCnt == parameters->entryMax) {
+    parameters->status = checkpointChunkEnd(parameters);
+    if (parameters->status != SL_STATUS_OK) {
+      return false;
+    }
+    checkpointChunkBegin(parameters);
+  }
+  entry = (CheckpointEntry_t *)calcAdr(checkpointBuf, checkpointHdrSize(parameters->chunkIdx));
+  entry[parameters->entryCnt].key = key | ((uint32_t)group << NVM3_KEY_SIZE);
+  entry[parameters->entryCnt].objOfs = (uint32_t)((size_t)obj - (size_t)h->nvmAdr);
+  parameters->entryCnt++;
+
+  return true;
+}
+
+// Write a checkpoint at the FIFO end, unless nothing has changed since the last one.
+static void checkpointWrite(nvm3_Handle_t *h)
+{
+  CheckpointWriteParameters_t parameters;
+  size_t entryCnt = 0U;
+  size_t firstMax;
+  size_t nextMax;
+  size_t chunkCnt;
+  size_t checkpointLen;
+
+  if ((h->fifoNextObj == h->checkpointNextObj) || h->cache.overflow) {
+    return;
+  }
+
+  nvm3_cacheScan(&h->cache, checkpointCountCallback, &entryCnt);
+  parameters.chunkSize = checkpointChunkSize(h);
+  firstMax = (parameters.chunkSize - checkpointHdrSize(0U)) / sizeof(CheckpointEntry_t);
+  nextMax = (parameters.chunkSize - checkpointHdrSize(1U)) / sizeof(CheckpointEntry_t);
+  chunkCnt = 1U;
+  if (entryCnt > firstMax) {
+    chunkCnt += ((entryCnt - firstMax) + (nextMax - 1U)) / nextMax;
+  }
+
+  // The checkpoint must not make a repack needed, that would outdate it right away.
+  checkpointLen = chunkCnt * OBJ_LEN_REQ(h->halInfo.pageSize, parameters.chunkSize + CHECKPOINT_OBJ_OVERHEAD);
+  if ((chunkCnt > UINT16_MAX) || (h->unusedNvmSize < (thrSoftUser(h) + checkpointLen))) {
+    nvm3_tracePrint(TRACE_LEVEL_INFO, "  checkpointWrite: skipped, entryCnt=%u, len=%u, unusedNvmSize=%u.\n", entryCnt, checkpointLen, h->unusedNvmSize);
+    return;
+  }
+
+  parameters.h = h;
+  parameters.status = SL_STATUS_OK;
+  parameters.headOfs = (uint32_t)((size_t)h->fifoNextObj - (size_t)h->nvmAdr);
+  parameters.chunkIdx = 0U;
+  parameters.chunkCnt = (uint16_t)chunkCnt;
+  checkpointChunkBegin(&parameters);
+  nvm3_cacheScan(&h->cache, checkpointWriteCallback, &parameters);
+  if (parameters.status == SL_STATUS_OK) {
+    parameters.status = checkpointChunkEnd(&parameters);
+  }
+  if ((parameters.status == SL_STATUS_OK) && (parameters.chunkIdx == chunkCnt)) {
+    h->checkpointNextObj = h->fifoNextObj;
+  }
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "  checkpointWrite: entryCnt=%u, chunkCnt=%u, sta=0x%x.\n", entryCnt, chunkCnt, parameters.status);
+}
+
+// Read a validated checkpoint chunk into the checkpoint buffer.
+static bool checkpointReadChunk(nvm3_Handle_t *h, nvm3_Obj_t *obj, size_t *len)
+{
+  size_t datLen = obj->totalLen;
+  sl_status_t sta;
+
+#if defined(NVM3_SECURITY)
+  if (datLen < (obj->frag.idx * NVM3_GCM_SIZE_OVERHEAD)) {
+    return false;
+  }
+  datLen -= (obj->frag.idx * NVM3_GCM_SIZE_OVERHEAD);
+#endif
+  if ((datLen < sizeof(CheckpointHdr_t)) || (datLen > sizeof(checkpointBuf))) {
+    return false;
+  }
+  sta = fifoReadObj(h, checkpointBuf, 0, obj->totalLen, obj, read_data);
+#if defined(NVM3_SECURITY)
+  // Clear decrypted data in global buffer
+  memset(nvm3_decBuf, 0, datLen);
+#endif
+  *len = datLen;
+
+  return (sta == SL_STATUS_OK) && (((CheckpointHdr_t *)checkpointBuf)->magic == CHECKPOINT_MAGIC);
+}
+
+/* Find the newest checkpoint chunk in the page holding the last object,
+   and return the location of the first chunk in that checkpoint. */
+static nvm3_ObjPtr_t checkpointFind(nvm3_Handle_t *h)
+{
+  nvm3_ObjPtr_t objFirstLoc;
+  nvm3_ObjPtr_t objAdr;
+  nvm3_ObjPtr_t headAdr = NVM3_OBJ_PTR_INVALID;
+  nvm3_ObjGroup_t objGroup;
+  size_t len;
+  NVM3_OBJ_T_ALLOCATION(ObjB);
+
+  if (h->fifoNextObj == h->fifoFirstObj) {
+    return NVM3_OBJ_PTR_INVALID;
+  }
+  objFirstLoc = nvm3_pageGetFirstObj(pageAdrFromIdx(h, pageIdxFromAdr(h, h->fifoNextObj)));
+  if (objFirstLoc == h->fifoNextObj) {
+    // The page is empty, the last object is in the previous page.
+    objFirstLoc = nvm3_pageGetFirstObj(pageAdrFromIdx(h, getPreviousGoodPage(h, pageIdxFromAdr(h, h->fifoNextObj))));
+  }
+
+  objAdr = objFirstLoc;
+  while ((objAdr != NVM3_OBJ_PTR_INVALID) && (objAdr != h->fifoNextObj) && samePage(h, objAdr, objFirstLoc)) {
+    objBegin(pObjB);
+    nvm3_objInit(pObjB, objAdr);
+    if (validateObj(h, pObjB, true, &objGroup) && keyIsCheckpoint(pObjB->key) && (objGroup == objGroupData)) {
+      if (checkpointReadChunk(h, pObjB, &len)) {
+        headAdr = calcAdr(h->nvmAdr, ((CheckpointHdr_t *)checkpointBuf)->headOfs);
+      }
+    }
+    objAdr = pObjB->nextObjAdr;
+    objEnd(pObjB);
+  }
+
+  return headAdr;
+}
+
+// Load a checkpoint chunk into the cache, and return the location after the chunk.
+static nvm3_ObjPtr_t checkpointLoadChunk(nvm3_Handle_t *h, nvm3_ObjPtr_t objAdr, uint32_t headOfs, size_t chunkIdx, size_t *chunkCnt)
+{
+  CheckpointHdr_t *hdr = (CheckpointHdr_t *)checkpointBuf;
+  CheckpointEntry_t *entry;
+  nvm3_ObjPtr_t nextAdr = NVM3_OBJ_PTR_INVALID;
+  nvm3_ObjGroup_t objGroup;
+  size_t len;
+  NVM3_OBJ_T_ALLOCATION(ObjB);
+
+  objBegin(pObjB);
+  nvm3_objInit(pObjB, objAdr);
+  if (!validateObj(h, pObjB, true, &objGroup) || !keyIsCheckpoint(pObjB->key) || (objGroup != objGroupData)
+      || !checkpointReadChunk(h, pObjB, &len)) {
+    objEnd(pObjB);
+    return NVM3_OBJ_PTR_INVALID;
+  }
+  if (chunkIdx == 0U) {
+    *chunkCnt = hdr->chunkCnt;
+  }
+  if ((hdr->headOfs != headOfs) || (hdr->chunkIdx != chunkIdx) || (hdr->chunkCnt != *chunkCnt)
+      || (len != (checkpointHdrSize(chunkIdx) + (hdr->entryCnt * sizeof(CheckpointEntry_t))))) {
+    objEnd(pObjB);
+    return NVM3_OBJ_PTR_INVALID;
+  }
+  if (chunkIdx == 0U) {
+    // The FIFO must be unchanged except for objects added at the end.
+    CheckpointState_t *state = (CheckpointState_t *)&hdr[1];
+    if ((state->nvmSize != h->nvmSize)
+        || (state->validPageCnt != h->validNvmPageCnt)
+        || (state->firstObjOfs != ((size_t)h->fifoFirstObj - (size_t)h->nvmAdr))
+        || (state->firstEraseCnt != checkpointFirstEraseCnt(h))) {
+      objEnd(pObjB);
+      return NVM3_OBJ_PTR_INVALID;
+    }
+  }
+
+  entry = (CheckpointEntry_t *)calcAdr(checkpointBuf, checkpointHdrSize(chunkIdx));
+  for (size_t i = 0; i < hdr->entryCnt; i++) {
+    nvm3_cacheSet(&h->cache, entry[i].key & NVM3_KEY_MASK, calcAdr(h->nvmAdr, entry[i].objOfs), (nvm3_ObjGroup_t)(entry[i].key >> NVM3_KEY_SIZE));
+  }
+
+  if (pObjB->nextObjAdr != NVM3_OBJ_PTR_INVALID) {
+    nextAdr = pObjB->nextObjAdr;
+  } else {
+    nextAdr = getFirstObjAdrInNextGoodPage(h, pObjB->objAdr);
+  }
+  objEnd(pObjB);
+
+  return nextAdr;
+}
+
+// Update the cache from a checkpoint, return false if no usable checkpoint is found.
+static bool checkpointLoad(nvm3_Handle_t *h)
+{
+  nvm3_ObjPtr_t objAdr;
+  uint32_t headOfs;
+  size_t chunkCnt = 1U;
+
+  nvm3_cacheClear(&h->cache);
+
+  objAdr = checkpointFind(h);
+  if (objAdr == NVM3_OBJ_PTR_INVALID) {
+    return false;
+  }
+  headOfs = (uint32_t)((size_t)objAdr - (size_t)h->nvmAdr);
+  if ((headOfs % sizeof(uint32_t)) != 0U) {
+    return false;
+  }
+  for (size_t chunkIdx = 0; chunkIdx < chunkCnt; chunkIdx++) {
+    if ((objAdr == NVM3_OBJ_PTR_INVALID) || (objAdr == h->fifoNextObj) || (pageIdxFromAdr(h, objAdr) >= h->totalNvmPageCnt)) {
+      objAdr = NVM3_OBJ_PTR_INVALID;
+      break;
+    }
+    objAdr = checkpointLoadChunk(h, objAdr, headOfs, chunkIdx, &chunkCnt);
+  }
+  if ((objAdr == NVM3_OBJ_PTR_INVALID) || h->cache.overflow) {
+    nvm3_tracePrint(TRACE_LEVEL_INIT, "  checkpointLoad: no valid checkpoint at ofs=%u.\n", headOfs);
+    nvm3_cacheClear(&h->cache);
+    return false;
+  }
+
+  // Add the objects written after the checkpoint.
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+  transactionScanInit();
+#endif
+  fifoScanFrom(h, objAdr, fifoScanAll, cacheUpdateCallback, NULL);
+  h->checkpointNextObj = objAdr;
+  nvm3_tracePrint(TRACE_LEVEL_INIT, "  checkpointLoad: chunkCnt=%u, scan from=%p.\n", chunkCnt, objAdr);
+
+  return true;
+}
+#endif
+
+static sl_status_t initialize(nvm3_Handle_t *h, uint32_t newCfgEraseCnt)
+{
+  size_t validCnt;
+  size_t unusedCnt;
+  sl_status_t sta;
+  nvm3_HalPtr_t pageAdr;
+  nvm3_PageHdr_t pageHdr;
+  uint32_t eraseCnt;
+
+  nvm3_tracePrint(TRACE_LEVEL_INIT, "  initialize: begin\n");
+
+  h->fifoFirstIdx = NVM3_PAGE_INDEX_INVALID;
+  h->fifoFirstObj = NVM3_OBJ_PTR_INVALID;
+  h->fifoNextObj = NVM3_OBJ_PTR_INVALID;
+  h->validNvmPageCnt = 0;
+  h->unusedNvmSize = 0;
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+  h->checkpointNextObj = NVM3_OBJ_PTR_INVALID;
+#endif
+
+  nvm3_cacheClear(&h->cache);
 
   // Search for valid pages.
   validCnt = findValidPageCnt(h);
@@ -3104,11 +4055,24 @@ static sl_status_t initialize(nvm3_Handle_t *h, uint32_t newCfgEraseCnt)
   }
 
   if (sta == SL_STATUS_OK) {
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+    if (!checkpointLoad(h)) {
+      cacheUpdate(h);
+    }
+#else
     cacheUpdate(h);
+#endif
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
     if (h->cache.usedCount > 1U) {
       sta = nvm3_cacheSort(&h->cache);
     }
+#endif
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+    // A failed rollback fails the open, so that no write or repack can hide
+    // the interrupted transaction before the next initialization retries it.
+    if (sta == SL_STATUS_OK) {
+      sta = transactionScanEnd(h);
+    }
 #endif
   }
 
@@ -3155,6 +4119,7 @@ sl_status_t nvm3_open(nvm3_Handle_t *h, const nvm3_Init_t *i)
         && (i->nvmSize == h->nvmSize)
         && (i->cachePtr == h->cache.entryPtr)
         && (i->cacheEntryCount == h->cache.entryCount)
+        && (i->cacheType == h->cache.type)
         && (i->maxObjectSize == h->maxObjectSize)
         && (i->halHandle == h->halHandle)
 #if defined(NVM3_SECURITY)
@@ -3176,7 +4141,7 @@ sl_status_t nvm3_open(nvm3_Handle_t *h, const nvm3_Init_t *i)
   h->nvmSize        = i->nvmSize;
   h->maxObjectSize  = i->maxObjectSize;
   h->repackHeadroom = i->repackHeadroom;
-  nvm3_cacheOpen(&h->cache, i->cachePtr, i->cacheEntryCount);
+  nvm3_cacheOpen(&h->cache, i->cachePtr, i->cacheEntryCount, i->cacheType);
   h->halHandle       = i->halHandle;
   sta = nvm3_halGetInfo(i->halHandle, &h->halInfo);
   if ((sta == SL_STATUS_OK) && (h->halInfo.pageSize > 0)) {
@@ -3317,6 +4282,12 @@ sl_status_t nvm3_close(nvm3_Handle_t *h)
   }
 
   nvm3_tracePrint(TRACE_LEVEL_INIT, "nvm3_close.\n");
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+  // Store a checkpoint to shorten the next nvm3_open().
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RDWR);
+  checkpointWrite(h);
+  workEnd(h);
+#endif
   h->hasBeenOpened = false;
   instanceCnt--;
   // only close the device if there are no remaining open instances
@@ -3507,6 +4478,94 @@ sl_status_t nvm3_readPartialData(nvm3_Handle_t* h, nvm3_ObjectKey_t key, void* v
   return sta;
 }
 
+sl_status_t nvm3_writeDataStream(nvm3_Handle_t *h, nvm3_ObjectKey_t key, size_t len,
+                                 void *buf, size_t bufSize,
+                                 nvm3_WriteStreamFn_t fillFn, void *user)
+{
+  if (h == NULL) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  if (!keyIsValid(key)) {
+    return SL_STATUS_INVALID_KEY;
+  }
+  if ((buf == NULL) || (fillFn == NULL) || (bufSize < NVM3_WORD_SIZE) || ((bufSize % NVM3_WORD_SIZE) != 0U)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+#if defined(NVM3_SECURITY)
+  (void)len;
+  (void)user;
+  return SL_STATUS_NOT_SUPPORTED;
+#else
+  sl_status_t sta;
+  WriteStream_t stream = { fillFn, user, (uint32_t *)buf, bufSize, SL_STATUS_OK };
+
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RDWR);
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_writeDataStream: key=%u, len=%u, bufSize=%u.\n", key, len, bufSize);
+
+  writeStream = &stream;
+  sta = fifoWriteWrapper(h, key, NULL, len, objGroupData);
+  writeStream = NULL;
+
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_writeDataStream: free=%u, nextAdr=%p.\n", h->unusedNvmSize, h->fifoNextObj);
+  workEnd(h);
+
+  return sta;
+#endif
+}
+
+sl_status_t nvm3_readDataStream(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
+                                void *buf, size_t bufSize,
+                                nvm3_ReadStreamFn_t readFn, void *user)
+{
+  if (h == NULL) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  if (!keyIsValid(key)) {
+    return SL_STATUS_INVALID_KEY;
+  }
+  if ((buf == NULL) || (readFn == NULL) || (bufSize < NVM3_WORD_SIZE) || ((bufSize % NVM3_WORD_SIZE) != 0U)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+#if defined(NVM3_SECURITY)
+  (void)user;
+  return SL_STATUS_NOT_SUPPORTED;
+#else
+  sl_status_t sta;
+  nvm3_ObjGroup_t objGroup;
+  NVM3_OBJ_T_ALLOCATION(ObjA);
+
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RD);
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_readDataStream: key=%u, bufSize=%u.\n", key, bufSize);
+
+  sta = findObj(h, key, pObjA, &objGroup);
+  if (sta == SL_STATUS_OK) {
+    if (objGroup == objGroupData) {
+      sta = fifoReadObjStream(h, pObjA, (uint32_t *)buf, bufSize, readFn, user);
+    } else if (objGroup == objGroupCounter) {
+      sta = SL_STATUS_NVM3_OBJECT_IS_NOT_DATA;
+    } else {
+      sta = SL_STATUS_NOT_FOUND;
+    }
+  }
+
+  workEnd(h);
+
+  return sta;
+#endif
+}
+
 sl_status_t nvm3_writeCounter(nvm3_Handle_t *h, nvm3_ObjectKey_t key, uint32_t value)
 {
   sl_status_t sta;
@@ -3725,7 +4784,8 @@ static bool enumScanFifoCallback(nvm3_Handle_t *h, nvm3_ObjPtr_t obj, nvm3_ObjGr
   sl_status_t sta;
   NVM3_OBJ_T_ALLOCATION(ObjB);
 
-  if (((bool)(group == objGroupDeleted) == scanEnum->lookForDeleted) && (obj->key >= scanEnum->keyMin) && (obj->key <= scanEnum->keyMax)) {
+  if (((bool)(group == objGroupDeleted) == scanEnum->lookForDeleted) && (obj->key >= scanEnum->keyMin) && (obj->key <= scanEnum->keyMax)
+      && !keyIsReserved(obj->key)) {
     objBegin(pObjB);
     sta = findObj(h, obj->key, pObjB, &objFindGroup);
     if ((sta == SL_STATUS_OK) && (pObjB->objAdr == obj->objAdr)) {
@@ -3836,6 +4896,100 @@ sl_status_t nvm3_deleteObject(nvm3_Handle_t *h, nvm3_ObjectKey_t key)
   return sta;
 }
 
+#if defined(NVM3_TRANSACTION) && (NVM3_TRANSACTION == 1)
+sl_status_t nvm3_writeTransaction(nvm3_Handle_t *h, const nvm3_TransactionObject_t *objects, size_t count)
+{
+  sl_status_t sta = SL_STATUS_OK;
+  nvm3_ObjGroup_t objGroup;
+  bool isStored;
+  bool skip[NVM3_TRANSACTION_MAX_OBJECTS];
+  size_t writeCnt = 0U;
+  size_t reqLen;
+  NVM3_OBJ_T_ALLOCATION(ObjA);
+
+  if ((h == NULL) || (objects == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  if ((count == 0U) || (count > NVM3_TRANSACTION_MAX_OBJECTS)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (!keyIsValid(objects[i].key)) {
+      return SL_STATUS_INVALID_KEY;
+    }
+    if ((objects[i].value != NULL) && (objects[i].len > h->maxObjectSize)) {
+      return SL_STATUS_NVM3_WRITE_DATA_SIZE;
+    }
+    for (size_t j = 0; j < i; j++) {
+      if (objects[j].key == objects[i].key) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+    }
+  }
+
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RDWR);
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_writeTransaction: count=%u.\n", count);
+
+  (void)repackUntilGood(h);
+
+  // Room is needed for the markers, the objects, and a rollback of the objects.
+  reqLen = 3U * transactionObjLen(h, sizeof(TransactionMarker_t));
+  objBegin(pObjA);
+  for (size_t i = 0; i < count; i++) {
+    isStored = (findObj(h, objects[i].key, pObjA, &objGroup) == SL_STATUS_OK) && (objGroup != objGroupDeleted);
+    // Deleting an object that is not stored is a no-operation.
+    skip[i] = (objects[i].value == NULL) && !isStored;
+    if (!skip[i]) {
+      writeCnt++;
+      reqLen += transactionObjLen(h, (objects[i].value != NULL) ? objects[i].len : 0U);
+      reqLen += OBJ_LEN_REQ(h->halInfo.pageSize, isStored ? pObjA->totalLen : 0U);
+    }
+  }
+  objEnd(pObjA);
+
+  if ((writeCnt > 0U) && (h->unusedNvmSize < (thrRepack(h) + reqLen))) {
+    nvm3_tracePrint(NVM3_TRACE_LEVEL_ERROR, "NVM3 ERROR - nvm3_writeTransaction: storage full, unusedNvmSize=%u, reqLen=%u.\n", h->unusedNvmSize, reqLen);
+    sta = SL_STATUS_FULL;
+  } else if (writeCnt > 0U) {
+    sta = transactionWriteMarker(h, TRANSACTION_MAGIC_BEGIN, writeCnt);
+    if (sta == SL_STATUS_OK) {
+      for (size_t i = 0; (i < count) && (sta == SL_STATUS_OK); i++) {
+        if (!skip[i]) {
+          if (objects[i].value != NULL) {
+            sta = fifoWriteUserObj(h, objects[i].key, objects[i].value, objects[i].len, objGroupData);
+          } else {
+            sta = fifoWriteUserObj(h, objects[i].key, NULL, 0U, objGroupDeleted);
+          }
+        }
+      }
+      if (sta == SL_STATUS_OK) {
+        sta = transactionWriteMarker(h, TRANSACTION_MAGIC_COMMIT, writeCnt);
+      }
+      if (sta != SL_STATUS_OK) {
+        // Restore the objects that were valid before the transaction.
+        transactionScanInit();
+        for (size_t i = 0; i < count; i++) {
+          if (!skip[i]) {
+            transactionAbortedAdd(objects[i].key);
+          }
+        }
+        (void)transactionRollback(h, true);
+      }
+    }
+  }
+
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_writeTransaction: writeCnt=%u, sta=0x%x, free=%u.\n", writeCnt, sta, h->unusedNvmSize);
+  workEnd(h);
+
+  return sta;
+}
+#endif
+
 sl_status_t nvm3_eraseAll(nvm3_Handle_t *h)
 {
   sl_status_t sta;
@@ -3887,6 +5041,37 @@ sl_status_t nvm3_getEraseCount(nvm3_Handle_t *h, uint32_t *eraseCnt)
   return SL_STATUS_OK;
 }
 
+sl_status_t nvm3_getPageEraseCounts(nvm3_Handle_t *h, uint32_t *eraseCnt, size_t *pageCnt)
+{
+  nvm3_HalPtr_t pageAdr;
+  nvm3_PageHdr_t pageHdr;
+  size_t cnt;
+
+  if ((h == NULL) || (eraseCnt == NULL) || (pageCnt == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RD);
+
+  cnt = SL_MIN(*pageCnt, h->totalNvmPageCnt);
+  for (size_t idx = 0; idx < cnt; idx++) {
+    pageAdr = pageAdrFromIdx(h, idx);
+    nvm3_halReadWords(HAL, pageAdr, &pageHdr, NVM3_PAGE_HEADER_WSIZE);
+    eraseCnt[idx] = nvm3_pageGetEraseCnt(&pageHdr);
+  }
+  *pageCnt = h->totalNvmPageCnt;
+
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_getPageEraseCounts: pageCnt=%u, read=%u.\n", h->totalNvmPageCnt, cnt);
+  workEnd(h);
+
+  return (cnt < h->totalNvmPageCnt) ? SL_STATUS_WOULD_OVERFLOW : SL_STATUS_OK;
+}
+
 void nvm3_setEraseCount(uint32_t eraseCnt)
 {
   cfgEraseCnt = eraseCnt;
@@ -3911,7 +5096,11 @@ sl_status_t nvm3_repack(nvm3_Handle_t *h)
 
   repackNeeded = !softUserAvailable(h);
   if (repackNeeded) {
-    repackOnce(h);
+    repackOnce(h, h->maxObjectSize);
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+    // The repack outdated any previous checkpoint, store a new one.
+    checkpointWrite(h);
+#endif
   }
 
   nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_repack: End,   unusedNvmSize=%u, nextObj=%p.\n", h->unusedNvmSize, h->fifoNextObj);
@@ -3920,6 +5109,42 @@ sl_status_t nvm3_repack(nvm3_Handle_t *h)
   return sta;
 }
 
+sl_status_t nvm3_repackStep(nvm3_Handle_t *h, size_t copyBudget, bool *moreWork)
+{
+  sl_status_t sta = SL_STATUS_OK;
+  bool repackNeeded;
+
+  if ((h == NULL) || (moreWork == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RDWR);
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_repackStep: Begin, unusedNvmSize=%u, copyBudget=%u.\n", h->unusedNvmSize, copyBudget);
+
+  repackNeeded = !softUserAvailable(h);
+  if (repackNeeded) {
+    sta = repackOnce(h, copyBudget);
+    repackNeeded = !softUserAvailable(h);
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+    // Store a new checkpoint when the repack is complete, not after every step.
+    if ((sta == SL_STATUS_OK) && !repackNeeded) {
+      checkpointWrite(h);
+    }
+#endif
+  }
+  *moreWork = repackNeeded && (sta == SL_STATUS_OK);
+
+  nvm3_tracePrint(TRACE_LEVEL_INFO, "nvm3_repackStep: End,   unusedNvmSize=%u, status=%x, moreWork=%s.\n", h->unusedNvmSize, sta, *moreWork ? "true" : "false");
+  workEnd(h);
+
+  return sta;
+}
+
 bool nvm3_repackNeeded(nvm3_Handle_t *h)
 {
   bool repackNeeded;
@@ -4015,7 +5240,7 @@ sl_status_t nvm3_resize(nvm3_Handle_t *h, nvm3_HalPtr_t newAddr, size_t newSize)
       if ((h->fifoFirstObj > h->fifoNextObj) || (needSpaceAtLow > lowToFirst) || (needSpaceAtHigh > nextToHigh)) {
         nvm3_PageState_t pageState;
 
-        sta = repackWorker(h, &pageState, repackCopyAll);
+        sta = repackWorker(h, &pageState, repackCopyAll, 0U);
         nvm3_tracePrint(TRACE_LEVEL_RESIZE, "nvm3_resize: repackWorker, sta=0x%x, state=%d\n", sta, pageState);
         if (sta != SL_STATUS_OK) {
           break;
@@ -4073,6 +5298,7 @@ sl_status_t nvm3_resize(nvm3_Handle_t *h, nvm3_HalPtr_t newAddr, size_t newSize)
   }
   init.cachePtr = h->cache.entryPtr;
   init.cacheEntryCount = h->cache.entryCount;
+  init.cacheType = h->cache.type;
   init.maxObjectSize = h->maxObjectSize;
   init.repackHeadroom = h->repackHeadroom;
   init.halHandle = h->halHandle;
@@ -4086,4 +5312,34 @@ sl_status_t nvm3_resize(nvm3_Handle_t *h, nvm3_HalPtr_t newAddr, size_t newSize)
   return sta;
 }
 
+void nvm3_getCacheStats(nvm3_Handle_t *h, nvm3_CacheStats_t *stats, bool reset)
+{
+  if ((h == NULL) || (stats == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return;
+  }
+
+  nvm3_lockBegin();
+  *stats = h->cache.stats;
+  if (reset) {
+    (void)memset(&h->cache.stats, 0, sizeof(h->cache.stats));
+  }
+  nvm3_lockEnd();
+}
+
+void nvm3_getWearStats(nvm3_Handle_t *h, nvm3_WearStats_t *stats, bool reset)
+{
+  if ((h == NULL) || (stats == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return;
+  }
+
+  nvm3_lockBegin();
+  *stats = h->wearStats;
+  if (reset) {
+    (void)memset(&h->wearStats, 0, sizeof(h->wearStats));
+  }
+  nvm3_lockEnd();
+}
+
 /// @endcond
@@ -28,6 +28,8 @@
  *
  ******************************************************************************/
 
+#include <stdint.h>
+#include <string.h>
 #include "nvm3_cache.h"
 #include "nvm3_trace.h"
 
@@ -51,6 +53,12 @@
 // speed when using compiler settings that do not inline these functions.
 #define isValid(h, idx) (h->entryPtr[idx].key != NVM3_KEY_INVALID)
 
+// The group is stored above the key, the top bit marks an entry where the
+// object has been validated since it was written or moved.
+#define ENTRY_GROUP_MASK            0x7FFU
+#define ENTRY_VERIFIED              0x80000000U
+#define HIT_IDX_INVALID             SIZE_MAX
+
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
 uint32_t *L;
 uint32_t *H;
@@ -69,7 +77,7 @@ static inline nvm3_ObjectKey_t entryGetKey(nvm3_Cache_t *h, size_t idx)
 static inline nvm3_ObjGroup_t entryGetGroup(nvm3_Cache_t *h, size_t idx)
 {
   uint32_t tmp = (uint32_t)h->entryPtr[idx].key;
-  return (nvm3_ObjGroup_t)(tmp >> NVM3_KEY_SIZE);
+  return (nvm3_ObjGroup_t)((tmp >> NVM3_KEY_SIZE) & ENTRY_GROUP_MASK);
 }
 
 static inline nvm3_ObjPtr_t entryGetPtr(nvm3_Cache_t *h, size_t idx)
@@ -93,6 +101,20 @@ static inline void entrySetGroup(nvm3_Cache_t *h, size_t idx, nvm3_ObjGroup_t gr
   h->entryPtr[idx].key = (nvm3_ObjectKey_t)tmp;
 }
 
+static inline bool entryGetVerified(nvm3_Cache_t *h, size_t idx)
+{
+  uint32_t tmp = (uint32_t)h->entryPtr[idx].key;
+  return (tmp & ENTRY_VERIFIED) != 0U;
+}
+
+// Setting the group also clears the verified flag.
+static inline void entrySetVerified(nvm3_Cache_t *h, size_t idx)
+{
+  uint32_t tmp = (uint32_t)h->entryPtr[idx].key;
+  tmp |= ENTRY_VERIFIED;
+  h->entryPtr[idx].key = (nvm3_ObjectKey_t)tmp;
+}
+
 static inline void entrySetPtr(nvm3_Cache_t *h, size_t idx, nvm3_ObjPtr_t obj)
 {
   h->entryPtr[idx].ptr = obj;
@@ -105,11 +127,194 @@ static inline void setInvalid(nvm3_Cache_t *h, size_t idx)
 }
 
 //****************************************************************************
+// Hash index
+
+// The hash index uses open addressing with linear probing. The home index of
+// a key is a multiplicative hash scaled to the cache size, so any cache size
+// can be used. One entry is always kept free, so a probe sequence always ends
+// at a free entry. Deleted entries are removed by moving later entries of the
+// probe sequence back, so no tombstones are needed.
+
+#define HASH_MULTIPLIER 0x9E3779B1U
+
+static inline bool isHashed(nvm3_Cache_t *h)
+{
+  return (h->type == NVM3_CACHE_TYPE_HASH);
+}
+
+static inline size_t hashHome(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
+{
+  uint32_t hash = (uint32_t)key * HASH_MULTIPLIER;
+  return (size_t)(((uint64_t)hash * h->entryCount) >> 32);
+}
+
+static inline size_t hashNext(nvm3_Cache_t *h, size_t idx)
+{
+  idx++;
+  return (idx < h->entryCount) ? idx : 0U;
+}
+
+// Find the index holding the key, or the free index ending its probe sequence.
+SPEED_OPT
+static size_t hashFind(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
+{
+  size_t idx = hashHome(h, key);
+
+  while (isValid(h, idx) && (entryGetKey(h, idx) != key)) {
+    idx = hashNext(h, idx);
+  }
+
+  return idx;
+}
+
+// Remove the entry at idx, and move back entries that would no longer be found.
+static void hashRemove(nvm3_Cache_t *h, size_t idx)
+{
+  size_t nextIdx = idx;
+  size_t home;
+
+  setInvalid(h, idx);
+  h->usedCount--;
+  for (;; ) {
+    nextIdx = hashNext(h, nextIdx);
+    if (!isValid(h, nextIdx)) {
+      break;
+    }
+    // The entry stays if its home is cyclically in (idx, nextIdx].
+    home = hashHome(h, entryGetKey(h, nextIdx));
+    if ((idx <= nextIdx) ? ((idx < home) && (home <= nextIdx)) : ((idx < home) || (home <= nextIdx))) {
+      continue;
+    }
+    h->entryPtr[idx] = h->entryPtr[nextIdx];
+    setInvalid(h, nextIdx);
+    idx = nextIdx;
+  }
+}
+
+static void hashDelete(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
+{
+  size_t idx;
+  bool found = false;
+
+  if (h->usedCount > 0U) {
+    idx = hashFind(h, key);
+    if (isValid(h, idx)) {
+      hashRemove(h, idx);
+      found = true;
+    }
+  }
+
+  nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheDelete(hash), key=%u, found=%d.\n", key, found ? 1 : 0);
+  (void)found;
+}
+
+static nvm3_ObjPtr_t hashGet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjGroup_t *group)
+{
+  nvm3_ObjPtr_t obj = NVM3_OBJ_PTR_INVALID;
+  size_t idx;
+
+  if (h->usedCount > 0U) {
+    idx = hashFind(h, key);
+    if (isValid(h, idx)) {
+      *group = entryGetGroup(h, idx);
+      obj = entryGetPtr(h, idx);
+      h->hitIdx = idx;
+    }
+  }
+
+  nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheGet(hash), key=%5u, obj=%p.\n", key, obj);
+
+  return obj;
+}
 
-void nvm3_cacheOpen(nvm3_Cache_t *h, nvm3_CacheEntry_t *ptr, size_t count)
+static bool hashUpdate(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm3_ObjGroup_t group)
+{
+  size_t idx;
+
+  if (h->usedCount > 0U) {
+    idx = hashFind(h, key);
+    if (isValid(h, idx)) {
+      entrySetGroup(h, idx, group);
+      entrySetPtr(h, idx, obj);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+SPEED_OPT
+static void hashSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm3_ObjGroup_t group)
+{
+  bool bSet = false;
+  size_t idx;
+
+  // Update existing entry
+  if (hashUpdate(h, key, obj, group)) {
+    return;
+  }
+
+  // Full, prioritize data over deleted objects, remove a deleted object if possible
+  if (((h->usedCount + 1U) >= h->entryCount) && (group != objGroupDeleted)) {
+    for (idx = 0; idx < h->entryCount; idx++) {
+      if (isValid(h, idx) && (entryGetGroup(h, idx) == objGroupDeleted)) {
+        nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheSet(hash), cache overflow for key=%u, replacing key=%u.\n", key, entryGetKey(h, idx));
+        hashRemove(h, idx);
+        break;
+      }
+    }
+  }
+
+  // Add new entry
+  if ((h->usedCount + 1U) < h->entryCount) {
+    idx = hashFind(h, key);
+    entrySetKey(h, idx, key);
+    entrySetGroup(h, idx, group);
+    entrySetPtr(h, idx, obj);
+    h->usedCount++;
+    bSet = true;
+  }
+
+  if (!bSet) {
+    h->overflow = true;
+    h->stats.overflowCount++;
+    nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheSet(hash), cache overflow for key=%u, grp=%u, obj=%p.\n", key, group, obj);
+  }
+}
+
+/* Scan downwards, starting below a free entry. A delete from the callback
+   only moves entries that are already visited, so no entry is skipped or
+   visited twice. */
+static void hashScan(nvm3_Cache_t *h, nvm3_CacheScanCallback_t cacheScanCallback, void *user)
+{
+  size_t idx = 0;
+  bool keepGoing;
+
+  if (h->usedCount == 0U) {
+    return;
+  }
+  while (isValid(h, idx)) {
+    idx++;
+  }
+  for (size_t cnt = 0; cnt < h->entryCount; cnt++) {
+    idx = (idx > 0U) ? (idx - 1U) : (h->entryCount - 1U);
+    if (isValid(h, idx)) {
+      keepGoing = cacheScanCallback(h, entryGetKey(h, idx), entryGetGroup(h, idx), entryGetPtr(h, idx), user);
+      if (!keepGoing) {
+        return;
+      }
+    }
+  }
+}
+
+//****************************************************************************
+
+void nvm3_cacheOpen(nvm3_Cache_t *h, nvm3_CacheEntry_t *ptr, size_t count, nvm3_CacheType_t type)
 {
   h->entryPtr = ptr;
   h->entryCount = count;
+  h->type = type;
+  (void)memset(&h->stats, 0, sizeof(h->stats));
   nvm3_cacheClear(h);
 }
 
@@ -121,9 +326,8 @@ void nvm3_cacheClear(nvm3_Cache_t *h)
     setInvalid(h, idx);
   }
   h->overflow = false;
-#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
   h->usedCount = 0U;
-#endif
+  h->hitIdx = HIT_IDX_INVALID;
 }
 
 #if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
@@ -259,6 +463,11 @@ sl_status_t nvm3_cacheSort(nvm3_Cache_t *h)
   uint32_t currSize;                  // current size of subarray
   uint32_t leftStart;                 // starting index of left subarray
 
+  // The hash index is never sorted.
+  if (isHashed(h)) {
+    return SL_STATUS_OK;
+  }
+
   // Allocate memory for cache subarrays
   L = sl_malloc(cacheSize * sizeof(uint32_t));
   H = sl_malloc(cacheSize * sizeof(uint32_t));
@@ -307,6 +516,10 @@ bool nvm3_cacheUpdateEntry(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t
   size_t idx = 0;
   bool res = false;
 
+  if (isHashed(h)) {
+    return hashUpdate(h, key, obj, group);
+  }
+
   if ((h->usedCount > 0U) && (h->usedCount <= h->entryCount)) {
     if (cacheSearch(h, key, &idx) == SL_STATUS_OK) {
       if (isValid(h, idx)) {
@@ -338,6 +551,11 @@ sl_status_t nvm3_cacheAddEntry(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPt
   sl_status_t status = SL_STATUS_OK;
   bool cacheSet = false;
 
+  if (isHashed(h)) {
+    hashSet(h, key, obj, group);
+    return status;
+  }
+
   if (h->usedCount < h->entryCount) {
     size_t idx = 0;
     if (h->usedCount > 0U) {
@@ -374,6 +592,7 @@ sl_status_t nvm3_cacheAddEntry(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPt
 
   if (!cacheSet) {
     h->overflow = true;
+    h->stats.overflowCount++;
     nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheAddEntry(3), cache overflow for key=%u, grp=%u, obj=%p.\n", key, group, obj);
   }
 
@@ -451,6 +670,11 @@ void nvm3_cacheOrganize(nvm3_Cache_t *h, size_t idx)
 void nvm3_cacheDelete(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
 {
   bool found = false;
+
+  if (isHashed(h)) {
+    hashDelete(h, key);
+    return;
+  }
   size_t idx = 0;
 
   if ((h->usedCount > 0U) && (h->usedCount <= h->entryCount)) {
@@ -465,6 +689,8 @@ void nvm3_cacheDelete(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
             h->entryPtr[idx].key = h->entryPtr[idx + 1].key;
             h->entryPtr[idx].ptr = h->entryPtr[idx + 1].ptr;
           }
+          // The last entry moved down, a scan must not find it twice
+          setInvalid(h, lastIdx);
           if (h->usedCount > 0) {
             h->usedCount--;
           }
@@ -481,6 +707,11 @@ void nvm3_cacheDelete(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
 {
   bool found = false;
 
+  if (isHashed(h)) {
+    hashDelete(h, key);
+    return;
+  }
+
   for (size_t idx = 0; idx < h->entryCount; idx++) {
     if (isValid(h, idx)) {
       if (entryGetKey(h, idx) == key) {
@@ -504,12 +735,18 @@ nvm3_ObjPtr_t nvm3_cacheGet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjGroup
   int tmp = -1;
 #endif
 
+  h->hitIdx = HIT_IDX_INVALID;
+  if (isHashed(h)) {
+    return hashGet(h, key, group);
+  }
+
   size_t idx = 0;
   if ((h->usedCount > 0U) && (h->usedCount <= h->entryCount)) {
     if (cacheSearch(h, key, &idx) == SL_STATUS_OK) {
       if (isValid(h, idx)) {
         *group = entryGetGroup(h, idx);
         obj = entryGetPtr(h, idx);
+        h->hitIdx = idx;
 #if NVM3_TRACE_PORT
         tmp = (int)idx;
 #endif
@@ -529,11 +766,17 @@ nvm3_ObjPtr_t nvm3_cacheGet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjGroup
   int tmp = -1;
 #endif
 
+  h->hitIdx = HIT_IDX_INVALID;
+  if (isHashed(h)) {
+    return hashGet(h, key, group);
+  }
+
   for (size_t idx = 0; idx < h->entryCount; idx++) {
     if (isValid(h, idx)) {
       if (entryGetKey(h, idx) == key) {
         *group = entryGetGroup(h, idx);
         obj = entryGetPtr(h, idx);
+        h->hitIdx = idx;
 #if NVM3_TRACE_PORT
         tmp = (int)idx;
 #endif
@@ -554,6 +797,11 @@ void nvm3_cacheSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm
 {
   bool bSet = false;
 
+  if (isHashed(h)) {
+    hashSet(h, key, obj, group);
+    return;
+  }
+
   // Update existing entry
   size_t idx = 0;
   if ((h->usedCount > 0U) && (h->usedCount <= h->entryCount)) {
@@ -599,6 +847,7 @@ void nvm3_cacheSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm
 
   if (!bSet) {
     h->overflow = true;
+    h->stats.overflowCount++;
     nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheSet(4), cache overflow for key=%u, grp=%u, obj=%p.\n", key, group, obj);
   }
 }
@@ -608,6 +857,11 @@ void nvm3_cacheSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm
 {
   bool bSet = false;
 
+  if (isHashed(h)) {
+    hashSet(h, key, obj, group);
+    return;
+  }
+
   // Update existing entry
   for (size_t idx = 0; idx < h->entryCount; idx++) {
     if (isValid(h, idx)) {
@@ -649,14 +903,54 @@ void nvm3_cacheSet(nvm3_Cache_t *h, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj, nvm
 
   if (!bSet) {
     h->overflow = true;
+    h->stats.overflowCount++;
     nvm3_tracePrint(TRACE_LEVEL, "      nvm3_cacheSet(4), cache overflow for key=%u, grp=%u, obj=%p.\n", key, group, obj);
   }
 }
 #endif
 
+// The verified flag is accessed through the entry found by the last
+// nvm3_cacheGet(), any other cache operation may move entries.
+bool nvm3_cacheGetVerified(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
+{
+  size_t idx = h->hitIdx;
+
+  if ((idx < h->entryCount) && isValid(h, idx) && (entryGetKey(h, idx) == key)) {
+    return entryGetVerified(h, idx);
+  }
+  return false;
+}
+
+void nvm3_cacheSetVerified(nvm3_Cache_t *h, nvm3_ObjectKey_t key)
+{
+  size_t idx = h->hitIdx;
+
+  if ((idx < h->entryCount) && isValid(h, idx) && (entryGetKey(h, idx) == key)) {
+    entrySetVerified(h, idx);
+  }
+}
+
 void nvm3_cacheScan(nvm3_Cache_t *h, nvm3_CacheScanCallback_t cacheScanCallback, void *user)
 {
   bool keepGoing;
+
+  if (isHashed(h)) {
+    hashScan(h, cacheScanCallback, user);
+    return;
+  }
+#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
+  /* Scan downwards. A delete from the callback moves the entries above it
+     down, and those are already visited. */
+  for (size_t cnt = h->usedCount; cnt > 0U; cnt--) {
+    size_t idx = cnt - 1U;
+    if (isValid(h, idx)) {
+      keepGoing = cacheScanCallback(h, entryGetKey(h, idx), entryGetGroup(h, idx), entryGetPtr(h, idx), user);
+      if (!keepGoing) {
+        return;
+      }
+    }
+  }
+#else
   for (size_t idx = 0; idx < h->entryCount; idx++) {
     if (isValid(h, idx)) {
       // Found an object.
@@ -669,4 +963,5 @@ void nvm3_cacheScan(nvm3_Cache_t *h, nvm3_CacheScanCallback_t cacheScanCallback,
       }
     }
   }
+#endif
 }
@@ -61,6 +61,10 @@ nvm3_Handle_t *nvm3_defaultHandle = &nvm3_defaultHandleData;
 static nvm3_CacheEntry_t defaultCache[NVM3_DEFAULT_CACHE_SIZE];
 #endif
 
+#if !defined(NVM3_DEFAULT_CACHE_TYPE)
+#define NVM3_DEFAULT_CACHE_TYPE NVM3_CACHE_TYPE_DEFAULT
+#endif
+
 // Compile time checks for NVM3 max object size macros
 #if NVM3_DEFAULT_MAX_OBJECT_SIZE > NVM3_MAX_OBJECT_SIZE_HIGH_LIMIT
 #error "NVM3_DEFAULT_MAX_OBJECT_SIZE is greater than max value supported"
@@ -85,6 +89,7 @@ nvm3_Init_t nvm3_defaultInitData =
   &nvm3_halCryptoHandle,
   NVM3_DEFAULT_SECURITY_TYPE,
 #endif
+  NVM3_DEFAULT_CACHE_TYPE,
 };
 
 nvm3_Init_t *nvm3_defaultInit = &nvm3_defaultInitData;
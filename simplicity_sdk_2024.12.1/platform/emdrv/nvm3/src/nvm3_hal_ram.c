@@ -0,0 +1,262 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 driver HAL for RAM emulated FLASH
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+#include "nvm3.h"
+#include "nvm3_hal_ram.h"
+
+/***************************************************************************//**
+ * @addtogroup nvm3
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup nvm3hal
+ * @{
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************    MACROS    **********************************
+ *****************************************************************************/
+
+#define ERASED_WORD   0xFFFFFFFFUL  ///< The value of an erased word
+
+/******************************************************************************
+ ***************************   LOCAL VARIABLES   ******************************
+ *****************************************************************************/
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+static uint8_t  *ramBase;
+static size_t   ramSize;
+static uint32_t pageEraseCnt[NVM3_HAL_RAM_MAX_PAGE_COUNT];
+static nvm3_HalRamStats_t ramStats;
+static uint32_t powerCutCnt;                  // Writes and erases left before the cut, 0 if none
+static nvm3_HalRamPowerCutFn_t powerCutCallback;
+
+/******************************************************************************
+ ***************************   LOCAL FUNCTIONS   ******************************
+ *****************************************************************************/
+
+// Check if the address range is inside the opened NVM area.
+static bool isInside(const void *adr, size_t len)
+{
+  const uint8_t *pAdr = adr;
+
+  return (ramBase != NULL)
+         && (pAdr >= ramBase)
+         && (len <= ramSize)
+         && ((size_t)(pAdr - ramBase) <= (ramSize - len));
+}
+
+// Count a word write or a page erase, return true if the power is cut after it.
+static bool powerCutNow(void)
+{
+  if (powerCutCnt == 0U) {
+    return false;
+  }
+  powerCutCnt--;
+  return (powerCutCnt == 0U);
+}
+
+// Cut the power. If the function returns, the access in progress fails.
+static void powerCut(void)
+{
+  nvm3_HalRamPowerCutFn_t fn = powerCutCallback;
+
+  powerCutCallback = NULL;
+  if (fn != NULL) {
+    fn();
+  }
+}
+
+/** @endcond */
+
+static sl_status_t nvm3_halRamOpen(nvm3_HalPtr_t nvmAdr, size_t nvmSize)
+{
+  if ((((size_t)nvmAdr % sizeof(uint32_t)) != 0U)
+      || ((nvmSize % NVM3_HAL_RAM_PAGE_SIZE) != 0U)) {
+    return SL_STATUS_NVM3_INVALID_ADDR;
+  }
+  // The erase counters are kept when reopening the same area, as a reset would.
+  if ((nvm3_HalPtr_t)ramBase != nvmAdr) {
+    memset(pageEraseCnt, 0, sizeof(pageEraseCnt));
+  }
+  ramBase = nvmAdr;
+  ramSize = nvmSize;
+
+  return SL_STATUS_OK;
+}
+
+static void nvm3_halRamClose(void)
+{
+}
+
+static sl_status_t nvm3_halRamGetInfo(nvm3_HalInfo_t *halInfo)
+{
+  halInfo->deviceFamilyPartNumber = 0U;
+  halInfo->memoryMapped = 1;
+  halInfo->writeSize = NVM3_HAL_RAM_WRITE_SIZE;
+  halInfo->pageSize = NVM3_HAL_RAM_PAGE_SIZE;
+
+  return SL_STATUS_OK;
+}
+
+static void nvm3_halRamAccess(nvm3_HalNvmAccessCode_t access)
+{
+  (void)access;
+}
+
+static sl_status_t nvm3_halRamReadWords(nvm3_HalPtr_t nvmAdr, void *dst, size_t wordCnt)
+{
+  if (!isInside(nvmAdr, wordCnt * sizeof(uint32_t))) {
+    return SL_STATUS_NVM3_INVALID_ADDR;
+  }
+
+  (void)memcpy(dst, nvmAdr, wordCnt * sizeof(uint32_t));
+  ramStats.wordReadCnt += wordCnt;
+
+  return SL_STATUS_OK;
+}
+
+static sl_status_t nvm3_halRamWriteWords(nvm3_HalPtr_t nvmAdr, void const *src, size_t wordCnt)
+{
+  const uint8_t *pSrc = src;
+  uint8_t *pDst = nvmAdr;
+  uint32_t srcWord;
+  uint32_t dstWord;
+  sl_status_t halSta = SL_STATUS_OK;
+
+  if ((((size_t)nvmAdr % sizeof(uint32_t)) != 0U)
+      || !isInside(nvmAdr, wordCnt * sizeof(uint32_t))) {
+    return SL_STATUS_NVM3_INVALID_ADDR;
+  }
+
+  while (wordCnt > 0U) {
+    (void)memcpy(&srcWord, pSrc, sizeof(uint32_t));
+    (void)memcpy(&dstWord, pDst, sizeof(uint32_t));
+    if (dstWord != ERASED_WORD) {
+      ramStats.wordRewriteCnt++;
+    }
+    // Programming can only clear bits, as on FLASH.
+    if ((dstWord & srcWord) != srcWord) {
+      ramStats.writeFailCnt++;
+      halSta = SL_STATUS_FLASH_PROGRAM_FAILED;
+    }
+    dstWord &= srcWord;
+    (void)memcpy(pDst, &dstWord, sizeof(uint32_t));
+    ramStats.wordWriteCnt++;
+    ramStats.busyTimeUs += NVM3_HAL_RAM_WORD_WRITE_TIME_US;
+    pSrc += sizeof(uint32_t);
+    pDst += sizeof(uint32_t);
+    wordCnt--;
+    if (powerCutNow()) {
+      powerCut();
+      return SL_STATUS_FLASH_PROGRAM_FAILED;
+    }
+  }
+
+  return halSta;
+}
+
+static sl_status_t nvm3_halRamPageErase(nvm3_HalPtr_t nvmAdr)
+{
+  size_t pageIdx;
+
+  if ((((size_t)((uint8_t *)nvmAdr - ramBase) % NVM3_HAL_RAM_PAGE_SIZE) != 0U)
+      || !isInside(nvmAdr, NVM3_HAL_RAM_PAGE_SIZE)) {
+    return SL_STATUS_NVM3_INVALID_ADDR;
+  }
+
+  (void)memset(nvmAdr, 0xFF, NVM3_HAL_RAM_PAGE_SIZE);
+
+  pageIdx = (size_t)((uint8_t *)nvmAdr - ramBase) / NVM3_HAL_RAM_PAGE_SIZE;
+  if (pageIdx < NVM3_HAL_RAM_MAX_PAGE_COUNT) {
+    pageEraseCnt[pageIdx]++;
+    if (pageEraseCnt[pageIdx] > ramStats.maxPageEraseCnt) {
+      ramStats.maxPageEraseCnt = pageEraseCnt[pageIdx];
+    }
+  }
+  ramStats.pageEraseCnt++;
+  ramStats.busyTimeUs += NVM3_HAL_RAM_PAGE_ERASE_TIME_US;
+  if (powerCutNow()) {
+    powerCut();
+    return SL_STATUS_FLASH_ERASE_FAILED;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ ***************************   GLOBAL FUNCTIONS   ******************************
+ ******************************************************************************/
+
+void nvm3_halRamGetStats(nvm3_HalRamStats_t *stats)
+{
+  *stats = ramStats;
+}
+
+void nvm3_halRamResetStats(void)
+{
+  memset(&ramStats, 0, sizeof(ramStats));
+}
+
+uint32_t nvm3_halRamGetPageEraseCount(size_t pageIdx)
+{
+  if (pageIdx >= NVM3_HAL_RAM_MAX_PAGE_COUNT) {
+    return 0U;
+  }
+
+  return pageEraseCnt[pageIdx];
+}
+
+void nvm3_halRamSetPowerCut(uint32_t writeCnt, nvm3_HalRamPowerCutFn_t powerCutFn)
+{
+  powerCutCnt = writeCnt;
+  powerCutCallback = powerCutFn;
+}
+
+/*******************************************************************************
+ ***************************   GLOBAL VARIABLES   ******************************
+ ******************************************************************************/
+
+const nvm3_HalHandle_t nvm3_halRamHandle = {
+  .open = nvm3_halRamOpen,                      ///< Set the open function
+  .close = nvm3_halRamClose,                    ///< Set the close function
+  .getInfo = nvm3_halRamGetInfo,                ///< Set the get-info function
+  .access = nvm3_halRamAccess,                  ///< Set the access function
+  .pageErase = nvm3_halRamPageErase,            ///< Set the page-erase function
+  .readWords = nvm3_halRamReadWords,            ///< Set the read-words function
+  .writeWords = nvm3_halRamWriteWords,          ///< Set the write-words function
+};
+
+/** @} (end addtogroup nvm3hal) */
+/** @} (end addtogroup nvm3) */
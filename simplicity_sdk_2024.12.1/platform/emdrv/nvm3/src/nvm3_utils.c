@@ -29,9 +29,24 @@
  ******************************************************************************/
 
 #include "nvm3_utils.h"
+#include "sl_common.h"
 
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 
+// Count the bits set in a word.
+__STATIC_INLINE uint8_t utilsCountBitsSet(uint32_t word)
+{
+#if defined(__GNUC__) && defined(__POPCNT__)
+  // The CPU has a population count instruction.
+  return (uint8_t)__builtin_popcount(word);
+#else
+  // From http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+  word = word - ((word >> 1) & 0x55555555U);
+  word = (word & 0x33333333U) + ((word >> 2) & 0x33333333U);
+  return (uint8_t)((((word + (word >> 4)) & 0xF0F0F0FU) * 0x1010101U) >> 24U);
+#endif
+}
+
 void nvm3_utilsComputeBergerCode(uint8_t *pResult, void *pInput, uint8_t numberOfBits)
 {
   uint8_t sum;
@@ -44,14 +59,37 @@ void nvm3_utilsComputeBergerCode(uint8_t *pResult, void *pInput, uint8_t numberO
     word = word & mask;
   }
 
-  // Count bits set:
-  // From http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetNaive
-  word = word - ((word >> 1) & 0x55555555U);
-  word = (word & 0x33333333U) + ((word >> 2) & 0x33333333U);
-  sum = (uint8_t)((((word + (word >> 4)) & 0xF0F0F0FU) * 0x1010101U) >> 24U);
+  // Count bits set
+  sum = utilsCountBitsSet(word);
 
   // Count bit cleared and accumulate
   *pResult = *pResult + (numberOfBits - sum);
 }
 
+void nvm3_utilsComputeBergerCodes(uint8_t *pResult, const uint32_t *pInput, size_t count, uint8_t numberOfBits)
+{
+  uint32_t mask = (numberOfBits < 32U) ? ((1UL << numberOfBits) - 1U) : 0xFFFFFFFFU;
+  size_t i = 0;
+
+#if !(defined(__GNUC__) && defined(__POPCNT__))
+  // For codes of 16 bits or less, the bit counts of two words are done in
+  // parallel by packing them in the low and high half of one word.
+  if (numberOfBits <= 16U) {
+    for (; (i + 1U) < count; i += 2U) {
+      uint32_t word = (pInput[i] & mask) | ((pInput[i + 1U] & mask) << 16);
+      word = word - ((word >> 1) & 0x55555555U);
+      word = (word & 0x33333333U) + ((word >> 2) & 0x33333333U);
+      word = (word + (word >> 4)) & 0x0F0F0F0FU;
+      word = word + (word >> 8);
+      pResult[i] = (uint8_t)(numberOfBits - (word & 0x1FU));
+      pResult[i + 1U] = (uint8_t)(numberOfBits - ((word >> 16) & 0x1FU));
+    }
+  }
+#endif
+
+  for (; i < count; i++) {
+    pResult[i] = (uint8_t)(numberOfBits - utilsCountBitsSet(pInput[i] & mask));
+  }
+}
+
 /// @endcond
@@ -55,6 +55,14 @@
   #include "rail_config.h"
 #endif // SL_RAIL_UTIL_INIT_RADIO_CONFIG_SUPPORT_INST0_ENABLE
 
+#if defined(SL_CATALOG_NVM3_PRESENT)
+  #include "nvm3_default.h"
+#endif // SL_CATALOG_NVM3_PRESENT
+
+#if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT)
+  #include "sl_memory_manager.h"
+#endif // SL_CATALOG_MEMORY_MANAGER_PRESENT
+
 uint32_t rxOverflowDelay = 10 * 1000000; // 10 seconds
 uint32_t thermistorResistance = 0;
 
@@ -218,6 +226,112 @@ void setMemWord(sl_cli_command_arg_t *args)
   getMemWord(args);
 }
 
+#if defined(SL_CATALOG_NVM3_PRESENT)
+#define MAX_NVM3_STATS_PAGES (32)
+#endif // SL_CATALOG_NVM3_PRESENT
+
+void getNvm3Stats(sl_cli_command_arg_t *args)
+{
+#if defined(SL_CATALOG_NVM3_PRESENT)
+  static uint32_t eraseCounts[MAX_NVM3_STATS_PAGES];
+  size_t pageCount = MAX_NVM3_STATS_PAGES;
+  nvm3_WearStats_t wearStats;
+  nvm3_CacheStats_t cacheStats;
+  bool reset = false;
+  sl_status_t status;
+
+  // Clear the statistics after printing them if requested
+  if (sl_cli_get_argument_count(args) >= 1) {
+    reset = !!sl_cli_get_argument_uint8(args, 0);
+  }
+
+  status = nvm3_getPageEraseCounts(nvm3_defaultHandle, eraseCounts, &pageCount);
+  if ((status != SL_STATUS_OK) && (status != SL_STATUS_WOULD_OVERFLOW)) {
+    responsePrintError(sl_cli_get_command_string(args, 0), 0x10, "Error reading NVM3 erase counts, status 0x%x", status);
+    return;
+  }
+  nvm3_getWearStats(nvm3_defaultHandle, &wearStats, reset);
+  nvm3_getCacheStats(nvm3_defaultHandle, &cacheStats, reset);
+
+  responsePrint(sl_cli_get_command_string(args, 0),
+                "UserBytesWritten:%u,RepackBytesCopied:%u,"
+                "CounterBaseRewrites:%u,CounterObjectRewrites:%u,"
+                "PageErases:%u,CacheOverflows:%u,PageCount:%u",
+                wearStats.userBytesWritten,
+                wearStats.repackBytesCopied,
+                wearStats.counterBaseRewrites,
+                wearStats.counterObjectRewrites,
+                wearStats.pageEraseCount,
+                cacheStats.overflowCount,
+                (uint32_t)pageCount);
+
+  responsePrintHeader(sl_cli_get_command_string(args, 0), "page:%u,eraseCount:%u");
+  for (size_t i = 0; (i < pageCount) && (i < MAX_NVM3_STATS_PAGES); i++) {
+    responsePrintMulti("page:%u,eraseCount:%u", (uint32_t)i, eraseCounts[i]);
+  }
+#else
+  responsePrintError(sl_cli_get_command_string(args, 0), 0xFF, "Feature not supported in this target.");
+#endif // SL_CATALOG_NVM3_PRESENT
+}
+
+void getHeapProfile(sl_cli_command_arg_t *args)
+{
+#if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT)
+  sl_memory_site_stats_t stats;
+  bool reset = false;
+  sl_status_t status;
+
+  // Clear the statistics after printing them if requested
+  if (sl_cli_get_argument_count(args) >= 1) {
+    reset = !!sl_cli_get_argument_uint8(args, 0);
+  }
+
+  status = sl_memory_get_site_stats(0U, &stats);
+  if ((status != SL_STATUS_OK) && (status != SL_STATUS_EMPTY)) {
+    responsePrintError(sl_cli_get_command_string(args, 0), 0x10, "Error reading heap profile, status 0x%x", status);
+    return;
+  }
+
+  responsePrint(sl_cli_get_command_string(args, 0),
+                "HeapSize:%u,UsedSize:%u,HighWatermark:%u",
+                (uint32_t)sl_memory_get_total_heap_size(),
+                (uint32_t)sl_memory_get_used_heap_size(),
+                (uint32_t)sl_memory_get_heap_high_watermark());
+
+  // Site 0 accounts for the call sites that did not fit in the site table.
+  // Histogram buckets count the allocations of up to 16, 32, ..., 1024 bytes and above.
+  responsePrintHeader(sl_cli_get_command_string(args, 0),
+                      "site:%u,returnAddress:0x%08x,liveBytes:%u,peakLiveBytes:%u,"
+                      "allocCount:%u,freeCount:%u,sizeHistogram:%s");
+  for (uint32_t i = 0U; status != SL_STATUS_INVALID_INDEX; i++) {
+    status = sl_memory_get_site_stats(i, &stats);
+    if (status != SL_STATUS_OK) {
+      continue;
+    }
+    snprintf(debugPrintBuffer, sizeof(debugPrintBuffer), "%u/%u/%u/%u/%u/%u/%u/%u",
+             stats.size_histogram[0], stats.size_histogram[1],
+             stats.size_histogram[2], stats.size_histogram[3],
+             stats.size_histogram[4], stats.size_histogram[5],
+             stats.size_histogram[6], stats.size_histogram[7]);
+    responsePrintMulti("site:%u,returnAddress:0x%08x,liveBytes:%u,peakLiveBytes:%u,"
+                       "allocCount:%u,freeCount:%u,sizeHistogram:%s",
+                       i,
+                       (uint32_t)(uintptr_t)stats.return_address,
+                       (uint32_t)stats.live_size,
+                       (uint32_t)stats.live_size_peak,
+                       stats.alloc_count,
+                       stats.free_count,
+                       debugPrintBuffer);
+  }
+
+  if (reset) {
+    sl_memory_reset_site_stats();
+  }
+#else
+  responsePrintError(sl_cli_get_command_string(args, 0), 0xFF, "Feature not supported in this target.");
+#endif // SL_CATALOG_MEMORY_MANAGER_PRESENT
+}
+
 void setTxUnderflow(sl_cli_command_arg_t *args)
 {
   bool enable = !!sl_cli_get_argument_uint8(args, 0);
@@ -1394,6 +1508,27 @@ void printRxFreqOffsets(sl_cli_command_arg_t * args)
                 printRxFreqOffsetData ? "True" : "False");
 }
 
+void printRxPayloadFormat(sl_cli_command_arg_t * args)
+{
+  static const char *formatNames[PAYLOAD_FORMAT_COUNT] = {
+    "Bytes", "Hex", "Base64",
+  };
+
+  if (sl_cli_get_argument_count(args) >= 1) {
+    uint8_t format = sl_cli_get_argument_uint8(args, 0);
+    if (format >= PAYLOAD_FORMAT_COUNT) {
+      responsePrintError(sl_cli_get_command_string(args, 0), 0x11,
+                         "Invalid payload format %u (valid 0-%u)",
+                         format, PAYLOAD_FORMAT_COUNT - 1);
+      return;
+    }
+    rxPayloadFormat = (RailPayloadFormat_t)format;
+  }
+
+  responsePrint(sl_cli_get_command_string(args, 0), "printRxPayloadFormat:%s",
+                formatNames[rxPayloadFormat]);
+}
+
 void setPrintingEnable(sl_cli_command_arg_t * args)
 {
   printingEnabled = !!sl_cli_get_argument_uint8(args, 0);
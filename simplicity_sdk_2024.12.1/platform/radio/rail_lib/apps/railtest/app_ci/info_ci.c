@@ -105,7 +105,8 @@ void getStatus(sl_cli_command_arg_t *args)
                         "SyncDetect:%u,"
                         "SyncDetect1:%u,"
                         "SyncDetect2:%u,"
-                        "NoRxBuffer:%u",
+                        "NoRxBuffer:%u,"
+                        "RxCopiesAvoided:%u",
                         counters.userTx,
                         counters.ackTx,
                         counters.userTxAborted,
@@ -119,7 +120,8 @@ void getStatus(sl_cli_command_arg_t *args)
                         counters.syncDetect,
                         counters.syncDetect1,
                         counters.syncDetect2,
-                        counters.noRxBuffer
+                        counters.noRxBuffer,
+                        counters.rxCopiesAvoided
                         );
   responsePrintContinue("TxRemainErrs:%u,"
                         "RfSensed:%u,"
@@ -178,6 +180,14 @@ void getStatus(sl_cli_command_arg_t *args)
                           subPhyId,
                           counters.subPhyCount[subPhyId]);
   }
+  ResponsePrintStats_t printStats;
+  responsePrintGetStats(&printStats);
+  responsePrintContinue("PrintFlushes:%u,"
+                        "PrintOverflows:%u,"
+                        "PrintFastFormats:%u",
+                        printStats.flushes,
+                        printStats.overflows,
+                        printStats.fastFormats);
   // Avoid use of %ll long-long formats due to iffy printf library support
   responsePrintEnd("rxRawSourceBytes:0x%x%08x",
                    (uint32_t)(counters.rxRawSourceBytes >> 32),
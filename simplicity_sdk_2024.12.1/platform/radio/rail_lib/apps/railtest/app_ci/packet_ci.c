@@ -433,6 +433,7 @@ void rxFifoManualRead(sl_cli_command_arg_t *args)
     packetData->rxPacket.dataLength = RAIL_ReadRxFifo(railHandle, packetData->rxPacket.dataPtr,
                                                       bytesToRead);
     packetData->rxPacket.freqOffset = getRxFreqOffset();
+    packetData->rxPacket.heldPacketHandle = RAIL_RX_PACKET_HANDLE_INVALID;
     if (readAppendedInfo) {
       RAIL_Status_t status = RAIL_STATUS_NO_ERROR;
       // Note the packet's status
@@ -1137,6 +1137,17 @@ void holdRx(sl_cli_command_arg_t *args)
                 rxHeld ? "Enabled" : "Disabled");
 }
 
+void zeroCopyRx(sl_cli_command_arg_t *args)
+{
+  if (sl_cli_get_argument_count(args) >= 1) {
+    rxZeroCopy = !!sl_cli_get_argument_uint8(args, 0);
+  }
+  responsePrint(sl_cli_get_command_string(args, 0),
+                "ZeroCopyRx:%s,RxCopiesAvoided:%u",
+                rxZeroCopy ? "Enabled" : "Disabled",
+                counters.rxCopiesAvoided);
+}
+
 void enableCacheSynthCal(sl_cli_command_arg_t *args)
 {
   uint8_t enable = sl_cli_get_argument_uint8(args, 0);
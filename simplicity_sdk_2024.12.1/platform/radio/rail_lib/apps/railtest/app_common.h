@@ -262,6 +262,13 @@ typedef enum RailAppEventType {
 #endif
 } RailAppEventType_t;
 
+typedef enum RailPayloadFormat {
+  PAYLOAD_FORMAT_BYTES,  // " 0x.." per byte, the historical format
+  PAYLOAD_FORMAT_HEX,    // Contiguous lowercase hex digits
+  PAYLOAD_FORMAT_BASE64, // Standard base64 with '=' padding
+  PAYLOAD_FORMAT_COUNT,
+} RailPayloadFormat_t;
+
 typedef enum RailRfSenseMode {
   RAIL_RFSENSE_MODE_OFF,
   RAIL_RFSENSE_MODE_ENERGY_DETECTION,
@@ -340,6 +347,12 @@ typedef struct RxPacketData {
    * has passed.
    */
   RAIL_AddrFilterMask_t filterMask;
+  /**
+   * The RAIL packet handle held on behalf of this event when dataPtr points
+   * directly into the receive FIFO, or RAIL_RX_PACKET_HANDLE_INVALID when
+   * dataPtr points to a private copy of the packet.
+   */
+  RAIL_RxPacketHandle_t heldPacketHandle;
 } RxPacketData_t;
 
 typedef struct RailEvent {
@@ -427,6 +440,7 @@ typedef struct Counters{
   uint32_t rxFail;
   uint32_t calibrations;
   uint32_t noRxBuffer;
+  uint32_t rxCopiesAvoided;
   uint32_t rfSensedEvent;
   uint32_t perTriggers;
   uint32_t ackTimeout;
@@ -488,6 +502,7 @@ extern volatile uint32_t failPackets;
 extern RAIL_Events_t enablePrintEvents;
 extern bool printRxErrorPackets;
 extern bool printRxFreqOffsetData;
+extern RailPayloadFormat_t rxPayloadFormat;
 extern RAIL_VerifyConfig_t configVerify;
 extern uint32_t internalTransmitCounter;
 extern const char buildDateTime[];
@@ -499,6 +514,7 @@ extern RAIL_StreamMode_t streamMode;
 extern bool rxHeld;
 extern volatile bool rxProcessHeld;
 extern volatile uint32_t packetsHeld;
+extern bool rxZeroCopy;
 extern bool reproFifoAlmostFullBug;
 extern bool txAckDirect;
 extern RAIL_Time_t txStartTime;
@@ -670,6 +686,7 @@ void changeChannel(uint32_t i);
 void pendPacketTx(void);
 RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
                                       RAIL_RxPacketHandle_t packetHandle);
+void freeRailAppEvent(void *eventHandle);
 void pendFinishTxSequence(void);
 void pendFinishTxAckSequence(void);
 void radioTransmit(uint32_t iterations, char *command);
@@ -51,6 +51,7 @@
 #if defined(SL_CATALOG_IOSTREAM_USART_PRESENT)
 #include "em_usart.h"
 #include "sl_iostream_usart_vcom_config.h"
+#include "sl_iostream_init_usart_instances.h"
 #endif
 
 #if defined(SL_CATALOG_IOSTREAM_EUSART_PRESENT)
@@ -62,6 +63,13 @@
 #include "sl_iostream_eusart_vcom_config.h"
 #endif
 
+#if defined(SL_CATALOG_IOSTREAM_USART_PRESENT) \
+  && defined(SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE) && (SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE > 0)
+// Lets responses be printed while the UART sends the previous ones
+static uint8_t vcomTxBuffer[SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE];
+#define VCOM_TX_BUFFER
+#endif
+
 volatile bool serEvent = false;
 // Used for wakeup from sleep
 volatile bool buttonWakeEvent = false;
@@ -87,6 +95,13 @@ static void gpioSerialWakeupCallback(uint8_t pin, void *context)
  *****************************************************************************/
 void appHalInit(void)
 {
+#ifdef VCOM_TX_BUFFER
+  // The instance initialization leaves the VCOM synchronous
+  (void)sl_iostream_uart_set_tx_buffer(sl_iostream_uart_vcom_handle,
+                                       vcomTxBuffer,
+                                       sizeof(vcomTxBuffer));
+#endif
+
 #if !defined(SL_RAIL_UTIL_IC_SIMULATION_BUILD)
 #if defined (SL_RAIL_TEST_PER_PORT) && defined(SL_RAIL_TEST_PER_PIN)
   // For PER test
@@ -149,6 +164,8 @@ void serialWaitForTxIdle(void)
   // Wait for the serial output to have completely cleared the UART
   // before sleeping.
 #ifdef SL_CATALOG_IOSTREAM_USART_PRESENT
+  // Drain the asynchronous TX buffer into the UART first
+  (void)sl_iostream_uart_flush_tx(sl_iostream_uart_vcom_handle);
   while ((USART_StatusGet(SL_IOSTREAM_USART_VCOM_PERIPHERAL)
           & USART_STATUS_TXIDLE) == 0) {
   }
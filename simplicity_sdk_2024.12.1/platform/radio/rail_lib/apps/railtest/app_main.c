@@ -45,6 +45,9 @@
   #include "sl_rail_util_ant_div.h"
 #endif
 #include "buffer_pool_allocator_config.h"
+#ifndef BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE
+#define BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE 0
+#endif
 
 #include "em_device.h"
 #include "sl_core.h"
@@ -148,6 +151,7 @@ const char buildDateTime[] = __DATE__ " " __TIME__;
 bool rxHeld = false;
 volatile bool rxProcessHeld = false;
 volatile uint32_t packetsHeld = 0U;
+bool rxZeroCopy = false;
 
 // Internal app state variables
 static uint32_t startTransmitCounter = 0;
@@ -197,6 +201,7 @@ static volatile uint32_t ackTimeoutDuration = 0;
 RAIL_Events_t enablePrintEvents = RAIL_EVENTS_NONE;
 bool printRxErrorPackets = false;
 bool printRxFreqOffsetData = false;
+RailPayloadFormat_t rxPayloadFormat = PAYLOAD_FORMAT_BYTES;
 bool printingEnabled = RAIL_PRINTING_DEFAULT_BOOL;
 
 // Names of RAIL_EVENT defines. This should align with rail_types.h
@@ -380,8 +385,10 @@ void sl_rail_test_internal_app_init(void)
 
   RAIL_ConfigRxOptions(railHandle, RAIL_RX_OPTIONS_ALL, rxOptions);
 
-  // Initialize the queue we use for tracking packets
-  if (!queueInit(&railAppEventQueue, BUFFER_POOL_ALLOCATOR_POOL_SIZE)) {
+  // Initialize the queue we use for tracking packets, with room for every
+  // buffer the allocator can hand out
+  if (!queueInit(&railAppEventQueue,
+                 BUFFER_POOL_ALLOCATOR_POOL_SIZE + BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE)) {
     while (1) ;
   }
   queueOverflow(&railAppEventQueue, &RAILCb_QueueOverflow);
@@ -516,7 +523,7 @@ static bool RAILCb_QueueOverflow(const Queue_t *queue, void *data)
   // The event queue is overflowing, and I want to overwrite the oldest event
   // pointer (in favor of the newer event information), so I need to free
   // the memory associated with that old, event pointer here.
-  memoryFree(data);
+  freeRailAppEvent(data);
   return true; // allow the overwrite
 }
 
@@ -1433,6 +1440,70 @@ void finishTxSequenceIfPending(void)
   }
 }
 
+// Size of the stack buffer payloads are encoded into before printing. Each
+// chunk is handed to the response printer in one call instead of one per byte.
+#define PAYLOAD_PRINT_CHUNK_SIZE 120U
+
+static const char hexDigits[] = "0123456789abcdef";
+static const char base64Digits[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void printPayload(const uint8_t *data, uint16_t dataLength)
+{
+  char buffer[PAYLOAD_PRINT_CHUNK_SIZE];
+  uint16_t used = 0U;
+  uint16_t i = 0U;
+
+  switch (rxPayloadFormat) {
+    case PAYLOAD_FORMAT_HEX:
+      responsePrintRaw("{payloadHex:");
+      for (; i < dataLength; i++) {
+        if (used + 2U > sizeof(buffer)) {
+          responsePrintRaw("%.*s", used, buffer);
+          used = 0U;
+        }
+        buffer[used++] = hexDigits[data[i] >> 4];
+        buffer[used++] = hexDigits[data[i] & 0xFU];
+      }
+      break;
+    case PAYLOAD_FORMAT_BASE64:
+      responsePrintRaw("{payloadBase64:");
+      for (; i < dataLength; i += 3U) {
+        if (used + 4U > sizeof(buffer)) {
+          responsePrintRaw("%.*s", used, buffer);
+          used = 0U;
+        }
+        uint16_t remaining = dataLength - i;
+        uint32_t triple = ((uint32_t)data[i] << 16)
+                          | ((remaining > 1U) ? ((uint32_t)data[i + 1U] << 8) : 0U)
+                          | ((remaining > 2U) ? (uint32_t)data[i + 2U] : 0U);
+        buffer[used++] = base64Digits[(triple >> 18) & 0x3FU];
+        buffer[used++] = base64Digits[(triple >> 12) & 0x3FU];
+        buffer[used++] = (remaining > 1U) ? base64Digits[(triple >> 6) & 0x3FU] : '=';
+        buffer[used++] = (remaining > 2U) ? base64Digits[triple & 0x3FU] : '=';
+      }
+      break;
+    default:
+      responsePrintRaw("{payload:");
+      for (; i < dataLength; i++) {
+        if (used + 5U > sizeof(buffer)) {
+          responsePrintRaw("%.*s", used, buffer);
+          used = 0U;
+        }
+        buffer[used++] = ' ';
+        buffer[used++] = '0';
+        buffer[used++] = 'x';
+        buffer[used++] = hexDigits[data[i] >> 4];
+        buffer[used++] = hexDigits[data[i] & 0xFU];
+      }
+      break;
+  }
+  if (used > 0U) {
+    responsePrintRaw("%.*s", used, buffer);
+  }
+  responsePrintRaw("}");
+}
+
 void printPacket(char *cmdName,
                  uint8_t *data,
                  uint16_t dataLength,
@@ -1484,13 +1555,9 @@ void printPacket(char *cmdName,
     responsePrintContinue("len:%d", dataLength);
   }
   if ((data != NULL) && (dataLength > 0U)) {
-    // Manually print out payload bytes iteratively, so that we don't need to
-    // reserve a RAM buffer. Finish the response here.
-    RAILTEST_PRINTF("{payload:");
-    for (int i = 0; i < dataLength; i++) {
-      RAILTEST_PRINTF(" 0x%.2x", data[i]);
-    }
-    RAILTEST_PRINTF("}");
+    // Encode the payload through a small stack buffer so that we don't need
+    // to reserve a RAM buffer for the whole packet. Finish the response here.
+    printPayload(data, dataLength);
   }
   responsePrintEnd("}");
 }
@@ -115,6 +115,7 @@ static void packetMode_RxPacketAborted(RAIL_Handle_t railHandle)
     rxPacket->rxPacket.dataLength = length;
     rxPacket->rxPacket.freqOffset = getRxFreqOffset();
     rxPacket->rxPacket.filterMask = packetInfo.filterMask;
+    rxPacket->rxPacket.heldPacketHandle = RAIL_RX_PACKET_HANDLE_INVALID;
     // Read what packet details are available into our packet structure
     if (RAIL_GetRxPacketDetailsAlt(railHandle, packetHandle,
                                    &rxPacket->rxPacket.appendedInfo)
@@ -164,6 +165,8 @@ RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
   RAIL_Status_t status;
   RAIL_RxPacketDetails_t details;
   RAIL_RxPacketInfo_t packetInfo;
+  // The sentinel is replaced by the actual handle, so note which was asked for
+  bool newestPacket = (packetHandle == RAIL_RX_PACKET_HANDLE_NEWEST);
   packetHandle = RAIL_GetRxPacketInfo(railHandle, packetHandle, &packetInfo);
   if (packetHandle == RAIL_RX_PACKET_HANDLE_INVALID) {
     return packetHandle;
@@ -172,9 +175,29 @@ RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
     counters.receiveCrcErrDrop++; // counters.receive still counts such too
   }
   uint16_t length = packetInfo.packetBytes;
-  void *rxPacketMemoryHandle = memoryAllocate(sizeof(RailAppEvent_t) + length);
+  bool queueEvent = ((logLevel & ASYNC_RESPONSE) != 0U);
+  // In zero-copy mode reference the packet where it sits in the receive FIFO
+  // rather than copying it out. This is only possible from the RX event
+  // callback (a packet can only be held from there) and when the packet has
+  // not wrapped around the end of the FIFO.
+  bool zeroCopy = rxZeroCopy
+                  && newestPacket
+                  && (length > 0U)
+                  && (packetInfo.firstPortionBytes == length);
+  RAIL_RxPacketHandle_t heldPacketHandle = RAIL_RX_PACKET_HANDLE_INVALID;
+  if (zeroCopy && queueEvent) {
+    // The FIFO data only has to outlive this callback if the event is
+    // queued. Hold the packet until freeRailAppEvent() releases it, or copy
+    // it after all if RAIL cannot hold it.
+    heldPacketHandle = RAIL_HoldRxPacket(railHandle);
+    zeroCopy = (heldPacketHandle != RAIL_RX_PACKET_HANDLE_INVALID);
+  }
+  void *rxPacketMemoryHandle
+    = memoryAllocate(sizeof(RailAppEvent_t) + (zeroCopy ? 0U : length));
   RailAppEvent_t *rxPacket = (RailAppEvent_t *)memoryPtrFromHandle(rxPacketMemoryHandle);
-  uint8_t *rxPacketData = (uint8_t *)&rxPacket[1];
+  uint8_t *rxPacketData = zeroCopy
+                          ? packetInfo.firstPortionData
+                          : (uint8_t *)&rxPacket[1];
 
   // Read the appended info into our packet structure
   status = RAIL_GetRxPacketDetailsAlt(railHandle, packetHandle, &details);
@@ -186,12 +209,21 @@ RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
   // Count packets that we received but had no memory to store
   if (rxPacket == NULL) {
     counters.noRxBuffer++;
+    if (heldPacketHandle != RAIL_RX_PACKET_HANDLE_INVALID) {
+      (void) RAIL_ReleaseRxPacket(railHandle, heldPacketHandle);
+    }
   } else {
     rxPacket->type = RX_PACKET;
+    rxPacket->rxPacket.railHandle = railHandle;
     rxPacket->rxPacket.dataPtr = rxPacketData;
     rxPacket->rxPacket.packetStatus = packetInfo.packetStatus;
-    // Read packet data into our packet structure
-    RAIL_CopyRxPacket(rxPacketData, &packetInfo);
+    rxPacket->rxPacket.heldPacketHandle = heldPacketHandle;
+    if (zeroCopy) {
+      counters.rxCopiesAvoided++;
+    } else {
+      // Read packet data into our packet structure
+      RAIL_CopyRxPacket(rxPacketData, &packetInfo);
+    }
     rxPacket->rxPacket.filterMask = packetInfo.filterMask;
     rxPacket->rxPacket.dataLength = length;
     rxPacket->rxPacket.freqOffset = getRxFreqOffset();
@@ -259,7 +291,7 @@ RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
       phySwitchToRx.iterations--;
     }
 
-    if (logLevel & ASYNC_RESPONSE) {
+    if (queueEvent) {
       updateGraphics();
 
       // Take an extra reference to this rx packet pointer so it's not released
@@ -291,6 +323,21 @@ RAIL_RxPacketHandle_t processRxPacket(RAIL_Handle_t railHandle,
   return packetHandle;
 }
 
+void freeRailAppEvent(void *eventHandle)
+{
+  RailAppEvent_t *event = (RailAppEvent_t *)memoryPtrFromHandle(eventHandle);
+  // Give a zero-copy packet's FIFO space back to RAIL before dropping the
+  // event that references it
+  if ((event != NULL)
+      && (event->type == RX_PACKET)
+      && (event->rxPacket.heldPacketHandle != RAIL_RX_PACKET_HANDLE_INVALID)) {
+    (void) RAIL_ReleaseRxPacket(event->rxPacket.railHandle,
+                                event->rxPacket.heldPacketHandle);
+    event->rxPacket.heldPacketHandle = RAIL_RX_PACKET_HANDLE_INVALID;
+  }
+  memoryFree(eventHandle);
+}
+
 // Only support fixed length
 static void fifoMode_RxPacketReceived(void)
 {
@@ -377,6 +424,7 @@ void rxFifoPrep(void)
       rxFifoPacketData->rxPacket.dataPtr = rxPacketData;
       rxFifoPacketData->rxPacket.freqOffset = getRxFreqOffset();
       rxFifoPacketData->rxPacket.filterMask = 0U;
+      rxFifoPacketData->rxPacket.heldPacketHandle = RAIL_RX_PACKET_HANDLE_INVALID;
       currentRxFifoPacketPtr = rxPacketData;
     }
   }
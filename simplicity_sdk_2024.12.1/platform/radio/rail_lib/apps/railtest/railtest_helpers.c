@@ -229,7 +229,7 @@ void printRailAppEvents(void)
                       railtestEvent->modeSwitchChangeChannel.channel);
       }
 #endif
-      memoryFree(railtestEventHandle);
+      freeRailAppEvent(railtestEventHandle);
     }
   }
   uint32_t eventsMissedCache = 0;
@@ -83,6 +83,29 @@ psa_status_t sli_psa_its_set_root_key(uint8_t *root_key, size_t root_key_size);
 #define SLI_PSA_ITS_SUPPORT_V1_FORMAT_INTERNAL
 #endif
 
+// Keep the UID and metadata of every ITS file in RAM, so that look-ups do not
+// read the headers of files with other UIDs from NVM3. The file found is still
+// read from NVM3 and, with encrypted ITS, authenticated on every look-up.
+// Uses 16 bytes of RAM per file (SL_PSA_ITS_MAX_FILES).
+#ifndef SL_PSA_ITS_UID_INDEX_ENABLE
+#define SL_PSA_ITS_UID_INDEX_ENABLE   0
+#endif
+
+// Trust the UID index for the file found as well: its metadata is taken from
+// RAM, and with encrypted ITS it is only authenticated on its first look-up
+// after boot, or not at all if it was written since boot. A file changed in
+// NVM3 behind the driver, for example by tampering with the flash, is then
+// only detected when psa_its_get() authenticates the data it returns, and not
+// by psa_its_get_info(), psa_its_set() or psa_its_remove().
+// Requires SL_PSA_ITS_UID_INDEX_ENABLE.
+#ifndef SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+#define SL_PSA_ITS_UID_INDEX_TRUST_ENABLE   0
+#endif
+
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE && !SL_PSA_ITS_UID_INDEX_ENABLE
+#error "SL_PSA_ITS_UID_INDEX_TRUST_ENABLE requires SL_PSA_ITS_UID_INDEX_ENABLE"
+#endif
+
 #if SL_PSA_ITS_SUPPORT_V2_DRIVER
 #define SLI_PSA_ITS_NVM3_RANGE_START_V2_DRIVER (0x83100UL)
 #define SLI_PSA_ITS_NVM3_RANGE_END_V2_DRIVER \
@@ -1631,6 +1631,24 @@ SLI_STATIC uint32_t nvm3_uid_tomb_cache[(SL_PSA_ITS_MAX_FILES + 31) / 32] = { 0
 SLI_STATIC uint32_t its_driver_version = SLI_PSA_ITS_NOT_CHECKED;
 #endif // SL_PSA_ITS_SUPPORT_V2_DRIVER
 
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+// States of an index entry
+#define SLI_PSA_ITS_INDEX_EMPTY          (0)  // Not known, the file header must be read
+#define SLI_PSA_ITS_INDEX_LOADED         (1)  // Metadata read from the file header
+#define SLI_PSA_ITS_INDEX_AUTHENTICATED  (2)  // Metadata also authenticated (SL_PSA_ITS_UID_INDEX_TRUST_ENABLE)
+
+// File metadata of one NVM3 ID in the ITS range
+typedef struct {
+  psa_storage_uid_t uid;
+  uint16_t size;     // ITS file size, excluding the metadata header
+  uint8_t offset;    // Size of the metadata header
+  uint8_t flags;     // Create flags
+  uint8_t state;
+} sli_its_index_entry_t;
+
+SLI_STATIC sli_its_index_entry_t nvm3_uid_index[SL_PSA_ITS_MAX_FILES] = { 0 };
+#endif // SL_PSA_ITS_UID_INDEX_ENABLE
+
 #if defined(SLI_PSA_ITS_ENCRYPTED)
 // The root key is an AES-256 key, and is therefore 32 bytes.
 #define ROOT_KEY_SIZE     (32)
@@ -1683,6 +1701,12 @@ static psa_status_t find_nvm3_id(psa_storage_uid_t uid,
                                  size_t* its_file_size,
                                  nvm3_ObjectKey_t * output_nvm3_id);
 static nvm3_ObjectKey_t derive_nvm3_id(psa_storage_uid_t uid);
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+static Ecode_t get_indexed_file_metadata(nvm3_ObjectKey_t key,
+                                         sli_its_file_meta_v2_t* metadata,
+                                         size_t* its_file_offset,
+                                         size_t* its_file_size);
+#endif
 
 #if defined(TFM_CONFIG_SL_SECURE_LIBRARY)
 static inline bool object_lives_in_s(const void *object, size_t object_size);
@@ -1737,6 +1761,10 @@ static inline void set_cache(nvm3_ObjectKey_t key)
 {
   nvm3_uid_set_cache[get_index(key)] |= (1 << get_offset(key));
   nvm3_uid_tomb_cache[get_index(key)] &= ~(1 << get_offset(key));
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+  // The file has been (re)written, its index entry is no longer known
+  nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START].state = SLI_PSA_ITS_INDEX_EMPTY;
+#endif
 }
 
 static inline void set_tomb(nvm3_ObjectKey_t key)
@@ -1790,6 +1818,9 @@ static inline bool object_lives_in_s(const void *object, size_t object_size)
 static inline void clear_cache(nvm3_ObjectKey_t key)
 {
   nvm3_uid_set_cache[get_index(key)] ^= (1 << get_offset(key));
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+  nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START].state = SLI_PSA_ITS_INDEX_EMPTY;
+#endif
 }
 
 static inline bool lookup_cache(nvm3_ObjectKey_t key)
@@ -1851,6 +1882,11 @@ static void init_cache(void)
 
     for (size_t i = 0; i < num_keys_referenced_by_nvm3; i++) {
       set_cache(keys_referenced_by_nvm3[i]);
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+      // Load the file header to the index, invalid headers are handled on look-up
+      sli_its_file_meta_v2_t its_file_meta;
+      (void)get_indexed_file_metadata(keys_referenced_by_nvm3[i], &its_file_meta, NULL, NULL);
+#endif
     }
     num_del_keys_from_nvm3 = nvm3_enumDeletedObjects(nvm3_defaultHandle,
                                                      deleted_keys_from_nvm3,
@@ -1940,6 +1976,110 @@ static Ecode_t get_file_metadata(nvm3_ObjectKey_t key,
   return status;
 }
 
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+// Store the metadata of an ITS file in the index
+static void index_store(nvm3_ObjectKey_t key,
+                        const sli_its_file_meta_v2_t* metadata,
+                        size_t its_file_offset,
+                        size_t its_file_size,
+                        uint8_t state)
+{
+  sli_its_index_entry_t *entry = &nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START];
+
+  if ((metadata->flags > UINT8_MAX)
+      || (its_file_offset > UINT8_MAX)
+      || (its_file_size > UINT16_MAX)) {
+    // Does not fit in the index, the file header is read on every look-up
+    entry->state = SLI_PSA_ITS_INDEX_EMPTY;
+    return;
+  }
+
+  entry->uid = metadata->uid;
+  entry->flags = (uint8_t)metadata->flags;
+  entry->offset = (uint8_t)its_file_offset;
+  entry->size = (uint16_t)its_file_size;
+  entry->state = state;
+}
+
+// Check if the index knows that an NVM3 ID holds a file with another UID
+static inline bool index_holds_other_uid(nvm3_ObjectKey_t key, psa_storage_uid_t uid)
+{
+  const sli_its_index_entry_t *entry = &nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START];
+
+  return (entry->state != SLI_PSA_ITS_INDEX_EMPTY) && (entry->uid != uid);
+}
+
+// Read the file metadata for a specific NVM3 ID, and keep it in the index.
+// With SL_PSA_ITS_UID_INDEX_TRUST_ENABLE, the metadata of an ID that is in the
+// index is taken from the index instead.
+static Ecode_t get_indexed_file_metadata(nvm3_ObjectKey_t key,
+                                         sli_its_file_meta_v2_t* metadata,
+                                         size_t* its_file_offset,
+                                         size_t* its_file_size)
+{
+  sli_its_index_entry_t *entry = &nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START];
+  Ecode_t status;
+  size_t offset = 0;
+  size_t size = 0;
+
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+  if (entry->state != SLI_PSA_ITS_INDEX_EMPTY) {
+    metadata->magic = SLI_PSA_ITS_META_MAGIC_V2;
+    metadata->uid = entry->uid;
+    metadata->flags = entry->flags;
+    offset = entry->offset;
+    size = entry->size;
+    status = ECODE_NVM3_OK;
+  } else
+#endif
+  {
+    status = get_file_metadata(key, metadata, &offset, &size);
+    if (status == ECODE_NVM3_OK
+        || status == SLI_PSA_ITS_ECODE_NEEDS_UPGRADE) {
+      index_store(key, metadata, offset, size, SLI_PSA_ITS_INDEX_LOADED);
+    } else {
+      entry->state = SLI_PSA_ITS_INDEX_EMPTY;
+    }
+  }
+
+  if (its_file_offset != NULL) {
+    *its_file_offset = offset;
+  }
+  if (its_file_size != NULL) {
+    *its_file_size = size;
+  }
+
+  return status;
+}
+#endif // SL_PSA_ITS_UID_INDEX_ENABLE
+
+#if defined(SLI_PSA_ITS_ENCRYPTED)
+// Check if an ITS file has been authenticated, or written, since boot. Only
+// trusted with SL_PSA_ITS_UID_INDEX_TRUST_ENABLE, files are authenticated on
+// every look-up otherwise.
+static inline bool index_is_authenticated(nvm3_ObjectKey_t key)
+{
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+  return nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START].state == SLI_PSA_ITS_INDEX_AUTHENTICATED;
+#else
+  (void)key;
+  return false;
+#endif
+}
+
+static inline void index_set_authenticated(nvm3_ObjectKey_t key)
+{
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+  sli_its_index_entry_t *entry = &nvm3_uid_index[key - SLI_PSA_ITS_NVM3_RANGE_START];
+  if (entry->state == SLI_PSA_ITS_INDEX_LOADED) {
+    entry->state = SLI_PSA_ITS_INDEX_AUTHENTICATED;
+  }
+#else
+  (void)key;
+#endif
+}
+#endif // defined(SLI_PSA_ITS_ENCRYPTED)
+
 #if SL_PSA_ITS_SUPPORT_V2_DRIVER
 static psa_status_t psa_its_get_legacy(nvm3_ObjectKey_t nvm3_object_id,
                                        sli_its_file_meta_v2_t* its_file_meta,
@@ -2370,8 +2510,18 @@ static psa_status_t find_nvm3_id(psa_storage_uid_t uid,
         }
       }
     }
+#if SL_PSA_ITS_UID_INDEX_ENABLE
+    // Files with other UIDs are skipped without reading their header
+    if (index_holds_other_uid(nvm3_object_id, uid)) {
+      nvm3_object_id = increment_obj_id(nvm3_object_id);
+      continue;
+    }
+    status = get_indexed_file_metadata(nvm3_object_id, its_file_meta, its_file_offset,
+                                       its_file_size);
+#else
     status = get_file_metadata(nvm3_object_id, its_file_meta, its_file_offset,
                                its_file_size);
+#endif
 
     if (status == SLI_PSA_ITS_ECODE_NO_VALID_HEADER
         || status == ECODE_NVM3_ERR_READ_DATA_SIZE) {
@@ -2404,15 +2554,19 @@ static psa_status_t find_nvm3_id(psa_storage_uid_t uid,
 #if defined(SLI_PSA_ITS_ENCRYPTED)
       // If the UID already exists, authenticate the existing value and make sure the stored UID is the same.
       // Note that this can potentially induce a significant performance hit.
-      psa_status_t psa_status = PSA_ERROR_CORRUPTION_DETECTED;
-      psa_storage_uid_t authenticated_uid = 0;
-      psa_status = authenticate_its_file(nvm3_object_id, &authenticated_uid);
-      if (psa_status != PSA_SUCCESS) {
-        return psa_status;
-      }
+      // With SL_PSA_ITS_UID_INDEX_TRUST_ENABLE, a file is only authenticated once after boot.
+      if (!index_is_authenticated(nvm3_object_id)) {
+        psa_status_t psa_status = PSA_ERROR_CORRUPTION_DETECTED;
+        psa_storage_uid_t authenticated_uid = 0;
+        psa_status = authenticate_its_file(nvm3_object_id, &authenticated_uid);
+        if (psa_status != PSA_SUCCESS) {
+          return psa_status;
+        }
 
-      if (authenticated_uid != uid) {
-        return PSA_ERROR_INVALID_SIGNATURE;
+        if (authenticated_uid != uid) {
+          return PSA_ERROR_INVALID_SIGNATURE;
+        }
+        index_set_authenticated(nvm3_object_id);
       }
 #endif
       *output_nvm3_id = nvm3_object_id;
@@ -2908,6 +3062,14 @@ psa_status_t psa_its_set(psa_storage_uid_t uid,
     // Power-loss might occur, however upon boot, the look-up table will be
     // re-filled as long as the data has been successfully written to NVM3.
     set_cache(nvm3_object_id);
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+    // The file was written by this driver, trust it on look-up.
+    index_store(nvm3_object_id, its_file_meta, sizeof(sli_its_file_meta_v2_t),
+                its_file_size, SLI_PSA_ITS_INDEX_AUTHENTICATED);
+#elif SL_PSA_ITS_UID_INDEX_ENABLE
+    index_store(nvm3_object_id, its_file_meta, sizeof(sli_its_file_meta_v2_t),
+                its_file_size, SLI_PSA_ITS_INDEX_LOADED);
+#endif
   } else {
     psa_status = PSA_ERROR_STORAGE_FAILURE;
   }
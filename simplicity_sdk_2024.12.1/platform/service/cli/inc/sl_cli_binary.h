@@ -0,0 +1,158 @@
+/***************************************************************************//**
+ * @file
+ * @brief Binary framed command interface for the CLI
+ * @version x.y.z
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_CLI_BINARY_H
+#define SL_CLI_BINARY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sl_cli_config.h"
+#include "sl_cli_types.h"
+#include "sl_cli_arguments.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup cli
+ * @{
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Binary framing
+ *
+ * When binary mode is enabled on a CLI instance, the input is taken as frames
+ * instead of text lines. Both directions use the same frame layout:
+ *
+ *   | SOF | LEN (2) | PAYLOAD (LEN) | CHK |
+ *
+ * SOF is SL_CLI_BINARY_SOF and LEN is the little endian payload length. CHK
+ * is chosen so that the 8-bit sum of LEN, PAYLOAD and CHK is zero. Frames
+ * with a bad checksum, or with a payload longer than the input buffer, are
+ * dropped and the receiver waits for the next SOF.
+ *
+ * A request payload is a command ID followed by the arguments as fields:
+ *
+ *   | CMD_ID (4) | TYPE | LEN | VALUE (LEN) | TYPE | LEN | VALUE (LEN) | ...
+ *
+ * CMD_ID is little endian and derived from the command path, the command
+ * names from the top level table down through the sub groups, separated by
+ * single spaces (see sl_cli_binary_get_command_id()). IDs do not change when
+ * commands are added or moved, and commands in sub groups can be reached.
+ * Shortcuts have no ID. A host can get the ID and path of every command with
+ * a SL_CLI_BINARY_CMD_ID_LIST request. TYPE is one of the mandatory
+ * SL_CLI_ARG_ types and is validated against the arg_type_list of the
+ * command. Integers are little endian, with LEN 1, 2 or 4 according to the
+ * type. STRING values are sent without a terminator and HEX values are the
+ * raw bytes. Command handlers see the arguments exactly as in text mode.
+ *
+ * A response payload is:
+ *
+ *   | CMD_ID (4) | STATUS (4) | FLAGS | TYPE | LEN | VALUE (LEN) | ...
+ *
+ * STATUS is the little endian sl_status_t of the command lookup and argument
+ * conversion. Text printed by the command handler is returned as
+ * SL_CLI_ARG_STRING fields; command responses are always text, as in text
+ * mode, and only the ID list response below carries typed fields.
+ *
+ * A SL_CLI_BINARY_CMD_ID_LIST request takes an optional UINT16 start index.
+ * The response holds a UINT32 ID and a STRING path field for each command
+ * from the start index, in command group list order, as many as fit in the
+ * response. Two UINT16 fields follow: the index to start the next request
+ * from, and the total number of commands. Two commands with the same ID can
+ * be told apart in this list; a request with that ID runs the first one.
+ *
+ * Sending SOF as the first character of a text line switches the instance to
+ * binary mode. A request with CMD_ID SL_CLI_BINARY_CMD_ID_EXIT switches back
+ * to text mode.
+ ******************************************************************************/
+
+#define SL_CLI_BINARY_SOF               (0xA5U)       ///< Start of frame
+#define SL_CLI_BINARY_CMD_ID_EXIT       (0xFFFFFFFFU) ///< Command ID that leaves binary mode
+#define SL_CLI_BINARY_CMD_ID_LIST       (0xFFFFFFFEU) ///< Command ID that lists the commands
+#define SL_CLI_BINARY_FLAG_TRUNCATED    (0x01U)       ///< Response flag, output was dropped
+#define SL_CLI_BINARY_RESPONSE_HEADER_SIZE  (9U)      ///< Size of CMD_ID, STATUS and FLAGS
+
+/***************************************************************************//**
+ * @brief
+ *   Select text or binary framed input for a CLI instance.
+ *
+ * @param[in, out] handle
+ *   A handle to a CLI instance.
+ *
+ * @param[in] enable
+ *   True to take input as binary frames, false for text input.
+ *
+ * @return
+ *   SL_STATUS_OK if successful, SL_STATUS_INVALID_STATE if called from a
+ *   command executed from a binary frame.
+ ******************************************************************************/
+sl_status_t sl_cli_binary_set_mode(sl_cli_handle_t handle, bool enable);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the binary command ID of a command.
+ *
+ * @details
+ *   The ID is the 32-bit FNV-1a hash of the command names separated by
+ *   single spaces, with bit 31 cleared. Hosts can compute it the same way.
+ *
+ * @param[in] path
+ *   The command path as typed in text mode, for example "rx" or
+ *   "group command". Leading, trailing and repeated spaces are ignored.
+ *
+ * @return
+ *   The command ID.
+ ******************************************************************************/
+uint32_t sl_cli_binary_get_command_id(const char *path);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the input mode of a CLI instance.
+ *
+ * @param[in] handle
+ *   A handle to a CLI instance.
+ *
+ * @return
+ *   True if the instance takes input as binary frames.
+ ******************************************************************************/
+bool sl_cli_binary_get_mode(sl_cli_handle_t handle);
+
+/** @} (end addtogroup cli) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_CLI_BINARY_H
@@ -104,7 +104,9 @@ extern "C" {
  * @param[in] command_group
  *   A pointer to a command group structure.
  *   Note that the structure must initially have NULL in all elements except
- *   the command_table.
+ *   the command_table. A sorted index of the command_table is built the
+ *   first time the group is added, if SL_CLI_COMMAND_INDEX_POOL_SIZE leaves
+ *   room for it. Otherwise the command_table is scanned.
  *
  * @return
  *   Returns true if the command_group could be added, false otherwise.
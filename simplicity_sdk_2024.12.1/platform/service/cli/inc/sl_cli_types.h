@@ -68,6 +68,19 @@ extern "C" {
 #define SL_CLI_ACTIVE_FLAG_EN   1
 #endif
 
+#ifndef SL_CLI_COMMAND_INDEX_POOL_SIZE
+#define SL_CLI_COMMAND_INDEX_POOL_SIZE      320
+#endif
+#ifndef SL_CLI_BINARY_FRAMING_ENABLED
+#define SL_CLI_BINARY_FRAMING_ENABLED       0
+#endif
+#ifndef SL_CLI_BINARY_RESPONSE_BUFFER_SIZE
+#define SL_CLI_BINARY_RESPONSE_BUFFER_SIZE  256
+#endif
+#ifndef SL_CLI_BINARY_CMD_ID_POOL_SIZE
+#define SL_CLI_BINARY_CMD_ID_POOL_SIZE      320
+#endif
+
 #define SL_CLI_NVM3_KEY_COUNT    (0x100)                                                             ///< sl cli nvm3 key count
 #define SL_CLI_NVM3_KEY_BEGIN    (0x3000)                                                            ///< sl cli nvm3 key begin
 #define SL_CLI_NVM3_KEY_END      (SL_CLI_NVM3_KEY_BEGIN + SL_CLI_NVM3_KEY_COUNT)                     ///< sl cli nvm3 key end
@@ -127,11 +140,42 @@ typedef struct {
   const bool                  is_shortcut;  ///< Indicating if the entry is a shortcut
 } sl_cli_command_entry_t;
 
+/// @brief Sorted lookup index for a command table.
+/// The entries are offsets into the command table, ordered by command name
+/// compared without case, and by offset for names that only differ by case.
+/// The index is built by sl_cli_command_add_command_group().
+typedef struct {
+  uint16_t *entries;                            ///< Command table offsets, sorted by name.
+                                                ///  NULL makes the lookup scan the table.
+  uint16_t count;                               ///< Number of entries.
+} sl_cli_command_index_t;
+
+#if SL_CLI_BINARY_FRAMING_ENABLED
+/// @brief Binary command ID of a command.
+typedef struct {
+  uint32_t cmd_id;                              ///< The binary command ID.
+  const sl_cli_command_entry_t *entry;          ///< The command table entry.
+} sl_cli_command_id_entry_t;
+
+/// @brief Binary command ID index for a command table and its sub groups.
+/// The entries are ordered by command ID, and in command walk order for
+/// equal IDs. The index is built by sl_cli_command_add_command_group().
+typedef struct {
+  sl_cli_command_id_entry_t *entries;           ///< Commands, sorted by ID.
+                                                ///  NULL makes the lookup walk the commands.
+  uint16_t count;                               ///< Number of entries.
+} sl_cli_command_id_index_t;
+#endif
+
 /// @brief Struct representing a command group.
 typedef struct {
   sl_slist_node_t node;                         ///< Command group list node.
   bool in_use;                                  ///< Node in use indicator.
   const sl_cli_command_entry_t *command_table;  ///< Command table pointer.
+  sl_cli_command_index_t command_index;         ///< Sorted index of the command table.
+#if SL_CLI_BINARY_FRAMING_ENABLED
+  sl_cli_command_id_index_t command_id_index;   ///< Binary command ID index.
+#endif
 } sl_cli_command_group_t;
 
 // Distinguishing different input types
@@ -156,6 +200,18 @@ typedef struct sl_cli {
   size_t history_pos;                          ///< Position in history, if enabled.
 #endif
   sl_iostream_t  *iostream_handle;             ///< The iostream used by the CLI.
+#if SL_CLI_BINARY_FRAMING_ENABLED
+  bool binary_mode;                            ///< True when input is taken as binary frames.
+  bool binary_executing;                       ///< True while a binary frame command executes.
+  bool binary_tx_truncated;                    ///< True when response output has been dropped.
+  uint8_t binary_rx_state;                     ///< Binary frame receive state.
+  uint8_t binary_rx_checksum;                  ///< Running checksum of the received frame.
+  uint16_t binary_rx_len;                      ///< Payload length of the received frame.
+  uint16_t binary_rx_pos;                      ///< Number of payload bytes received.
+  uint16_t binary_tx_len;                      ///< Length of the response payload.
+  uint16_t binary_tx_text_ofs;                 ///< Offset of the open text field, 0 if none.
+  uint8_t binary_tx_buffer[SL_CLI_BINARY_RESPONSE_BUFFER_SIZE]; ///< The response payload buffer.
+#endif
 #if defined(SL_CLI_ACTIVE_FLAG_EN)
   bool active;                                 ///< A boolean indicating that the CLI is processing input.
 #endif
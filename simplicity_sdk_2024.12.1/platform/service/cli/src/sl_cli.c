@@ -47,6 +47,9 @@
 #include "sli_cli_io.h"
 #include "sl_cli_input.h"
 #include "sli_cli_input.h"
+#if SL_CLI_BINARY_FRAMING_ENABLED
+#include "sli_cli_binary.h"
+#endif
 #include <string.h>
 
 #if !defined(__linux__)
@@ -213,6 +216,7 @@ __WEAK bool sli_cli_tick(sl_cli_handle_t handle)
 {
   int c;
   bool newline = false;
+  bool frame_ready = false;
   bool no_valid_input = false;
 
   if (handle->tick_in_progress) {
@@ -243,14 +247,28 @@ __WEAK bool sli_cli_tick(sl_cli_handle_t handle)
     {
       c = sli_cli_io_getchar();
     }
+#if SL_CLI_BINARY_FRAMING_ENABLED
+    // Binary frames may contain any character, including '\0'
+    if ((c != EOF) && sli_cli_binary_input_char(handle, c, &frame_ready)) {
+      sli_cli_session_activity_notification(handle);
+    } else
+#endif
     if ((c != EOF) && ((char)c != '\0')) {
       sli_cli_session_activity_notification(handle);
       newline = sl_cli_input_char(handle, (char)c);
     } else {
       no_valid_input = true;
     }
-  } while ((c != EOF) && (!newline));
+  } while ((c != EOF) && (!newline) && (!frame_ready));
 
+#if SL_CLI_BINARY_FRAMING_ENABLED
+  if (frame_ready) {
+    sli_cli_binary_handle_frame(handle);
+#if defined(SL_CLI_ACTIVE_FLAG_EN)
+    handle->active = true;
+#endif
+  } else
+#endif
   if (newline) {
     sli_cli_handle_input_and_history(handle);
 #if defined(SL_CLI_ACTIVE_FLAG_EN)
@@ -0,0 +1,882 @@
+/***************************************************************************//**
+ * @file
+ * @brief Binary framed command interface for the CLI.
+ * @version x.y.z
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_cli.h"
+#include "sl_cli_binary.h"
+#include "sl_cli_input.h"
+#include "sli_cli_binary.h"
+#include "sli_cli_command.h"
+#include "sl_iostream.h"
+#include <stdio.h>
+#include <string.h>
+
+#if SL_CLI_BINARY_FRAMING_ENABLED
+
+#if (SL_CLI_BINARY_RESPONSE_BUFFER_SIZE < SL_CLI_BINARY_RESPONSE_HEADER_SIZE) \
+  || (SL_CLI_BINARY_RESPONSE_BUFFER_SIZE > 0xFFFF)
+  #error "Invalid binary response buffer size"
+#endif
+
+// Frame receive states
+#define RX_STATE_IDLE       (0U)
+#define RX_STATE_LEN_LO     (1U)
+#define RX_STATE_LEN_HI     (2U)
+#define RX_STATE_PAYLOAD    (3U)
+#define RX_STATE_CHECKSUM   (4U)
+
+#define FIELD_HEADER_SIZE   (2U)
+#define FIELD_LENGTH_MAX    (0xFFU)
+
+#define CMD_ID_SIZE         (4U)
+#define CMD_ID_FNV_OFFSET   (2166136261UL)
+#define CMD_ID_FNV_PRIME    (16777619UL)
+#define CMD_ID_MASK         (0x7FFFFFFFUL)
+
+// Room kept at the end of a command list response for the next and total
+// count fields
+#define LIST_TRAILER_SIZE   (2U * (FIELD_HEADER_SIZE + 2U))
+
+/// State of a walk over the commands of a CLI instance
+typedef struct command_walk command_walk_t;
+struct command_walk {
+  // Called for each command. Returns true to stop the walk.
+  bool (*visit)(command_walk_t *walk, const sl_cli_command_entry_t *entry, uint32_t cmd_id);
+  char path[SL_CLI_INPUT_BUFFER_SIZE];  // Command path, names separated by spaces
+  size_t path_len;
+  uint32_t path_hash;
+  // Command lookup
+  uint32_t cmd_id;
+  const sl_cli_command_entry_t *entry;
+  // Command ID index
+  sl_cli_command_id_index_t *id_index;
+  // Command list
+  sl_cli_handle_t handle;
+  uint16_t index;
+  uint16_t start;
+  uint16_t next;
+  bool full;
+};
+
+#if SL_CLI_BINARY_CMD_ID_POOL_SIZE > 0
+// Storage for the command ID indexes. Indexes are kept for the lifetime of
+// the application, as are the command groups they are built for.
+static sl_cli_command_id_entry_t command_id_pool[SL_CLI_BINARY_CMD_ID_POOL_SIZE];
+static size_t command_id_pool_used;
+#endif
+
+// Arguments of the command list request: an optional start index
+static const sl_cli_argument_type_t list_arg_type_list[] = {
+  SL_CLI_ARG_UINT16OPT,
+  SL_CLI_ARG_END,
+};
+
+/*******************************************************************************
+ ****************************   LOCAL FUNCTIONS   ******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @brief
+ *   Get the value length of a field type.
+ *
+ * @param[in] type
+ *   The field type.
+ *
+ * @return
+ *   The value length for integer types, 0 for variable length types and -1
+ *   for types that can not be used as fields.
+ ******************************************************************************/
+static int field_length(sl_cli_argument_type_t type)
+{
+  switch (type) {
+    case SL_CLI_ARG_UINT8:
+    case SL_CLI_ARG_INT8:
+      return 1;
+    case SL_CLI_ARG_UINT16:
+    case SL_CLI_ARG_INT16:
+      return 2;
+    case SL_CLI_ARG_UINT32:
+    case SL_CLI_ARG_INT32:
+      return 4;
+    case SL_CLI_ARG_STRING:
+    case SL_CLI_ARG_HEX:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+static bool is_argument_optional(sl_cli_argument_type_t type)
+{
+  return (type >= SL_CLI_ARG_UINT8OPT) && (type <= SL_CLI_ARG_HEXOPT);
+}
+
+static uint32_t get_le(const uint8_t *data, int length)
+{
+  uint32_t value = 0;
+
+  while (length > 0) {
+    length--;
+    value = (value << 8) | data[length];
+  }
+  return value;
+}
+
+static void put_le(uint8_t *data, uint32_t value, int length)
+{
+  for (int i = 0; i < length; i++) {
+    data[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Continue a command ID hash with a string.
+ *
+ * @details
+ *   Command IDs are the 32-bit FNV-1a hash of the command path, with bit 31
+ *   cleared so that they never collide with the reserved IDs.
+ ******************************************************************************/
+static uint32_t hash_string(uint32_t hash, const char *string)
+{
+  while (*string != '\0') {
+    hash ^= (uint8_t)*string++;
+    hash *= CMD_ID_FNV_PRIME;
+  }
+  return hash;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Walk the commands of a command table and its sub groups.
+ *
+ * @param[in] table
+ *   The command table.
+ *
+ * @param[in, out] walk
+ *   The walk state. The path and its hash hold the group names leading to
+ *   the table.
+ *
+ * @return
+ *   True if the visit function stopped the walk.
+ ******************************************************************************/
+static bool walk_table(const sl_cli_command_entry_t *table, command_walk_t *walk)
+{
+  size_t path_len = walk->path_len;
+  uint32_t path_hash = walk->path_hash;
+
+  for (; table->name != NULL; table++) {
+    size_t name_len = strlen(table->name);
+    uint32_t hash = path_hash;
+
+    if (table->is_shortcut) {
+      continue;
+    }
+    // Names are separated by a single space, as typed in text mode
+    if (path_len > 0) {
+      hash = hash_string(hash, " ");
+    }
+    hash = hash_string(hash, table->name);
+    if ((path_len + 1 + name_len) >= sizeof(walk->path)) {
+      continue;
+    }
+    walk->path_len = path_len;
+    if (path_len > 0) {
+      walk->path[walk->path_len++] = ' ';
+    }
+    memcpy(&walk->path[walk->path_len], table->name, name_len + 1);
+    walk->path_len += name_len;
+    walk->path_hash = hash;
+
+    if (table->command->arg_type_list[0] == SL_CLI_ARG_GROUP) {
+      if (walk_table((const sl_cli_command_entry_t *)table->command->function, walk)) {
+        return true;
+      }
+    } else if (walk->visit(walk, table, hash & CMD_ID_MASK)) {
+      return true;
+    }
+  }
+  walk->path_len = path_len;
+  walk->path_hash = path_hash;
+  walk->path[path_len] = '\0';
+
+  return false;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Walk the commands of a command group.
+ *
+ * @return
+ *   True if the visit function stopped the walk.
+ ******************************************************************************/
+static bool walk_group(const sl_cli_command_group_t *cmd_group, command_walk_t *walk)
+{
+  if (cmd_group->command_table == NULL) {
+    return false;
+  }
+  walk->path_len = 0;
+  walk->path_hash = CMD_ID_FNV_OFFSET;
+  walk->path[0] = '\0';
+
+  return walk_table(cmd_group->command_table, walk);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Walk all commands of a CLI instance, in command group list order.
+ ******************************************************************************/
+static void walk_commands(sl_cli_handle_t handle, command_walk_t *walk)
+{
+  sl_cli_command_group_t *cmd_group;
+
+  SL_SLIST_FOR_EACH_ENTRY(handle->command_group, cmd_group, sl_cli_command_group_t, node) {
+    if (walk_group(cmd_group, walk)) {
+      return;
+    }
+  }
+}
+
+static bool visit_find(command_walk_t *walk, const sl_cli_command_entry_t *entry, uint32_t cmd_id)
+{
+  if (cmd_id == walk->cmd_id) {
+    walk->entry = entry;
+    return true;
+  }
+  return false;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Look up a command ID in a command ID index.
+ *
+ * @return
+ *   The first command with the ID in walk order, or NULL if not found.
+ ******************************************************************************/
+static const sl_cli_command_entry_t *index_lookup(const sl_cli_command_id_index_t *id_index,
+                                                  uint32_t cmd_id)
+{
+  uint16_t low = 0;
+  uint16_t high = id_index->count;
+
+  while (low < high) {
+    uint16_t mid = (uint16_t)(low + ((high - low) / 2U));
+    if (id_index->entries[mid].cmd_id < cmd_id) {
+      low = (uint16_t)(mid + 1U);
+    } else {
+      high = mid;
+    }
+  }
+  if ((low < id_index->count) && (id_index->entries[low].cmd_id == cmd_id)) {
+    return id_index->entries[low].entry;
+  }
+  return NULL;
+}
+
+#if SL_CLI_BINARY_CMD_ID_POOL_SIZE > 0
+/***************************************************************************//**
+ * @brief
+ *   Add a command to the index being built.
+ *
+ * @details
+ *   Commands are inserted after those with a lower or equal ID, which keeps
+ *   walk order among equal IDs. The walk stops when the pool is full.
+ ******************************************************************************/
+static bool visit_index(command_walk_t *walk, const sl_cli_command_entry_t *entry, uint32_t cmd_id)
+{
+  sl_cli_command_id_index_t *id_index = walk->id_index;
+  uint16_t low = 0;
+  uint16_t high = id_index->count;
+
+  if (id_index->count >= (SL_CLI_BINARY_CMD_ID_POOL_SIZE - command_id_pool_used)) {
+    walk->full = true;
+    return true;
+  }
+  while (low < high) {
+    uint16_t mid = (uint16_t)(low + ((high - low) / 2U));
+    if (id_index->entries[mid].cmd_id <= cmd_id) {
+      low = (uint16_t)(mid + 1U);
+    } else {
+      high = mid;
+    }
+  }
+  memmove(&id_index->entries[low + 1U],
+          &id_index->entries[low],
+          (id_index->count - low) * sizeof(id_index->entries[0]));
+  id_index->entries[low].cmd_id = cmd_id;
+  id_index->entries[low].entry = entry;
+  id_index->count++;
+
+  return false;
+}
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Find a command from its binary command ID.
+ *
+ * @param[in] handle
+ *   A handle to a CLI instance.
+ *
+ * @param[in] cmd_id
+ *   The command ID.
+ *
+ * @return
+ *   A pointer to the command table entry, or NULL if not found.
+ ******************************************************************************/
+static const sl_cli_command_entry_t *find_command(sl_cli_handle_t handle,
+                                                  uint32_t cmd_id)
+{
+  sl_cli_command_group_t *cmd_group;
+  command_walk_t walk;
+
+  walk.visit = visit_find;
+  walk.cmd_id = cmd_id;
+  walk.entry = NULL;
+  SL_SLIST_FOR_EACH_ENTRY(handle->command_group, cmd_group, sl_cli_command_group_t, node) {
+    const sl_cli_command_id_index_t *id_index = &cmd_group->command_id_index;
+
+    if (id_index->entries != NULL) {
+      walk.entry = index_lookup(id_index, cmd_id);
+    } else {
+      (void)walk_group(cmd_group, &walk);
+    }
+    if (walk.entry != NULL) {
+      break;
+    }
+  }
+
+  return walk.entry;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Convert the fields of a request to command arguments.
+ *
+ * @details
+ *   The fields are validated against the argument type list of the command,
+ *   following the same rules as text input. Values are converted in place in
+ *   the input buffer, so strings get a terminator and hex values get the
+ *   length prefix expected by sl_cli_get_argument_hex().
+ *
+ * @param[in] arg_type_list
+ *   The argument type list of the command.
+ *
+ * @param[in, out] fields
+ *   The fields of the request.
+ *
+ * @param[in] fields_len
+ *   The length of the fields.
+ *
+ * @param[in, out] argc
+ *   The number of entries in argv, incremented for each argument.
+ *
+ * @param[out] argv
+ *   Array where pointers to arguments are stored.
+ *
+ * @param[out] memory_array
+ *   Array where numerical arguments are stored.
+ *
+ * @return
+ *   SL_STATUS_OK if successful, SL_STATUS_INVALID_TYPE if a field does not
+ *   match the argument type, SL_STATUS_INVALID_COUNT if there is an incorrect
+ *   number of fields, SL_STATUS_HAS_OVERFLOWED if there are more fields than
+ *   SL_CLI_MAX_INPUT_ARGUMENTS and SL_STATUS_INVALID_PARAMETER if the fields
+ *   are malformed.
+ ******************************************************************************/
+static sl_status_t convert_fields(const sl_cli_argument_type_t *arg_type_list,
+                                  uint8_t *fields,
+                                  size_t fields_len,
+                                  int *argc,
+                                  void *argv[],
+                                  uint32_t *memory_array)
+{
+  sl_cli_argument_type_t expected = SL_CLI_ARG_END;
+  int type_o = 0;
+  int mem_index = 0;
+  size_t pos = 0;
+
+  while (pos < fields_len) {
+    if ((fields_len - pos) < FIELD_HEADER_SIZE) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    sl_cli_argument_type_t type = fields[pos];
+    uint8_t len = fields[pos + 1];
+    uint8_t *value = &fields[pos + FIELD_HEADER_SIZE];
+    if ((size_t)len > (fields_len - pos - FIELD_HEADER_SIZE)) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    if (*argc >= SL_CLI_MAX_INPUT_ARGUMENTS) {
+      return SL_STATUS_HAS_OVERFLOWED;
+    }
+
+    // Get the expected type the same way as for text input. Additional
+    // arguments repeat the previous type, and optional and wildcard types
+    // repeat until the end of the input.
+    if (arg_type_list[type_o] == SL_CLI_ARG_END) {
+      return SL_STATUS_INVALID_COUNT;
+    } else if (arg_type_list[type_o] == SL_CLI_ARG_ADDITIONAL) {
+      // Keep the previous type
+    } else if (arg_type_list[type_o] == SL_CLI_ARG_WILDCARD) {
+      expected = SL_CLI_ARG_STRING;
+    } else if (is_argument_optional(arg_type_list[type_o])) {
+      expected = arg_type_list[type_o] - 0x10;
+    } else {
+      expected = arg_type_list[type_o];
+      type_o++;
+    }
+    if ((expected == SL_CLI_ARG_END)
+        || (type != expected)
+        || ((field_length(type) > 0) && (len != field_length(type)))) {
+      return SL_STATUS_INVALID_TYPE;
+    }
+
+    switch (type) {
+      case SL_CLI_ARG_UINT8:
+      case SL_CLI_ARG_UINT16:
+      case SL_CLI_ARG_UINT32:
+        memory_array[mem_index] = get_le(value, len);
+        argv[*argc] = &memory_array[mem_index];
+        mem_index++;
+        break;
+      case SL_CLI_ARG_INT8:
+        memory_array[mem_index] = (uint32_t)(int32_t)(int8_t)get_le(value, len);
+        argv[*argc] = &memory_array[mem_index];
+        mem_index++;
+        break;
+      case SL_CLI_ARG_INT16:
+        memory_array[mem_index] = (uint32_t)(int32_t)(int16_t)get_le(value, len);
+        argv[*argc] = &memory_array[mem_index];
+        mem_index++;
+        break;
+      case SL_CLI_ARG_INT32:
+        memory_array[mem_index] = get_le(value, len);
+        argv[*argc] = &memory_array[mem_index];
+        mem_index++;
+        break;
+      case SL_CLI_ARG_STRING:
+        // Move the string over the length byte to make room for the terminator
+        memmove(&fields[pos + 1], value, len);
+        fields[pos + 1 + len] = '\0';
+        argv[*argc] = &fields[pos + 1];
+        break;
+      case SL_CLI_ARG_HEX:
+        // Byte 0 and 1 shall contain the length, while byte 2..n shall contain the data.
+        fields[pos] = len;
+        fields[pos + 1] = 0;
+        argv[*argc] = &fields[pos];
+        break;
+      default:
+        return SL_STATUS_INVALID_TYPE;
+    }
+    (*argc)++;
+    pos += FIELD_HEADER_SIZE + len;
+  }
+
+  // Remaining argument types must accept zero arguments
+  if ((arg_type_list[type_o] != SL_CLI_ARG_END)
+      && (arg_type_list[type_o] != SL_CLI_ARG_ADDITIONAL)
+      && (arg_type_list[type_o] != SL_CLI_ARG_WILDCARD)
+      && !is_argument_optional(arg_type_list[type_o])) {
+    return SL_STATUS_INVALID_COUNT;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Append a field to the response payload.
+ ******************************************************************************/
+static sl_status_t append_field(sl_cli_handle_t handle,
+                                sl_cli_argument_type_t type,
+                                const uint8_t *data,
+                                size_t length)
+{
+  if ((length > FIELD_LENGTH_MAX)
+      || ((FIELD_HEADER_SIZE + length) > (size_t)(SL_CLI_BINARY_RESPONSE_BUFFER_SIZE - handle->binary_tx_len))) {
+    handle->binary_tx_truncated = true;
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+
+  uint8_t *field = &handle->binary_tx_buffer[handle->binary_tx_len];
+  field[0] = type;
+  field[1] = (uint8_t)length;
+  if (length > 0) {
+    // Integers are copied as is, since the target is little endian
+    memcpy(&field[FIELD_HEADER_SIZE], data, length);
+  }
+  handle->binary_tx_len += (uint16_t)(FIELD_HEADER_SIZE + length);
+
+  return SL_STATUS_OK;
+}
+
+static bool visit_list(command_walk_t *walk, const sl_cli_command_entry_t *entry, uint32_t cmd_id)
+{
+  sl_cli_handle_t handle = walk->handle;
+  uint8_t value[CMD_ID_SIZE];
+
+  (void)entry;
+  if ((walk->index >= walk->start) && !walk->full) {
+    size_t needed = (2U * FIELD_HEADER_SIZE) + CMD_ID_SIZE + walk->path_len + LIST_TRAILER_SIZE;
+    if ((walk->path_len > FIELD_LENGTH_MAX)
+        || (needed > (size_t)(SL_CLI_BINARY_RESPONSE_BUFFER_SIZE - handle->binary_tx_len))) {
+      walk->full = true;
+      walk->next = walk->index;
+    } else {
+      put_le(value, cmd_id, CMD_ID_SIZE);
+      append_field(handle, SL_CLI_ARG_UINT32, value, CMD_ID_SIZE);
+      append_field(handle, SL_CLI_ARG_STRING, (const uint8_t *)walk->path, walk->path_len);
+    }
+  }
+  if (walk->index == UINT16_MAX) {
+    return true;
+  }
+  walk->index++;
+
+  return false;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Answer a command list request.
+ *
+ * @details
+ *   The response lists the ID and path of the commands from the requested
+ *   start index, as many as fit, followed by the index of the first command
+ *   not listed and the total number of commands.
+ ******************************************************************************/
+static sl_status_t list_commands(sl_cli_handle_t handle, uint8_t *fields, size_t fields_len)
+{
+  uint32_t memory_array[1];
+  void *argv[1];
+  int argc = 0;
+  command_walk_t walk;
+  uint8_t value[2];
+  sl_status_t status;
+
+  status = convert_fields(list_arg_type_list, fields, fields_len, &argc, argv, memory_array);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  walk.visit = visit_list;
+  walk.handle = handle;
+  walk.index = 0;
+  walk.start = (argc > 0) ? (uint16_t)memory_array[0] : 0U;
+  walk.full = false;
+  walk_commands(handle, &walk);
+  if (!walk.full) {
+    walk.next = (walk.start > walk.index) ? walk.start : walk.index;
+  }
+
+  put_le(value, walk.next, sizeof(value));
+  append_field(handle, SL_CLI_ARG_UINT16, value, sizeof(value));
+  put_le(value, walk.index, sizeof(value));
+  append_field(handle, SL_CLI_ARG_UINT16, value, sizeof(value));
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Capture stream write function. Text output from a command handler is
+ *   appended to the response as string fields, extending the last field as
+ *   long as nothing else has been added in between.
+ ******************************************************************************/
+static sl_status_t capture_write(void *context, const void *buffer, size_t buffer_length)
+{
+  sl_cli_handle_t handle = (sl_cli_handle_t)context;
+  const uint8_t *data = (const uint8_t *)buffer;
+
+  while (buffer_length > 0) {
+    if (handle->binary_tx_text_ofs != 0) {
+      uint8_t *field = &handle->binary_tx_buffer[handle->binary_tx_text_ofs];
+      size_t room = FIELD_LENGTH_MAX - field[1];
+      size_t space = (size_t)(SL_CLI_BINARY_RESPONSE_BUFFER_SIZE - handle->binary_tx_len);
+      size_t count = (buffer_length < room) ? buffer_length : room;
+      count = (count < space) ? count : space;
+      if (count > 0) {
+        memcpy(&handle->binary_tx_buffer[handle->binary_tx_len], data, count);
+        handle->binary_tx_len += (uint16_t)count;
+        field[1] += (uint8_t)count;
+        data += count;
+        buffer_length -= count;
+        continue;
+      }
+      if (space == 0) {
+        handle->binary_tx_truncated = true;
+        return SL_STATUS_OK;
+      }
+    }
+    // Open a new text field
+    uint16_t ofs = handle->binary_tx_len;
+    if (append_field(handle, SL_CLI_ARG_STRING, NULL, 0) != SL_STATUS_OK) {
+      return SL_STATUS_OK;
+    }
+    handle->binary_tx_text_ofs = ofs;
+  }
+
+  return SL_STATUS_OK;
+}
+
+static sl_status_t capture_read(void *context, void *buffer, size_t buffer_length, size_t *bytes_read)
+{
+  sl_cli_handle_t handle = (sl_cli_handle_t)context;
+
+  return sl_iostream_read(handle->iostream_handle, buffer, buffer_length, bytes_read);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Send the response payload as a frame on the instance iostream.
+ ******************************************************************************/
+static void send_response(sl_cli_handle_t handle)
+{
+  uint8_t header[3];
+  uint8_t checksum;
+  uint16_t len = handle->binary_tx_len;
+
+  if (handle->binary_tx_truncated) {
+    handle->binary_tx_buffer[SL_CLI_BINARY_RESPONSE_HEADER_SIZE - 1] |= SL_CLI_BINARY_FLAG_TRUNCATED;
+  }
+
+  header[0] = SL_CLI_BINARY_SOF;
+  header[1] = (uint8_t)len;
+  header[2] = (uint8_t)(len >> 8);
+  checksum = header[1] + header[2];
+  for (uint16_t i = 0; i < len; i++) {
+    checksum += handle->binary_tx_buffer[i];
+  }
+  checksum = (uint8_t)(0U - checksum);
+
+  sl_iostream_write(handle->iostream_handle, header, sizeof(header));
+  sl_iostream_write(handle->iostream_handle, handle->binary_tx_buffer, len);
+  sl_iostream_write(handle->iostream_handle, &checksum, sizeof(checksum));
+}
+
+/*******************************************************************************
+ ****************************   GLOBAL FUNCTIONS   *****************************
+ ******************************************************************************/
+bool sli_cli_binary_input_char(sl_cli_handle_t handle, int c, bool *frame_ready)
+{
+  uint8_t byte = (uint8_t)c;
+
+  *frame_ready = false;
+
+  if (!handle->binary_mode) {
+    if ((handle->input_len != 0) || (byte != SL_CLI_BINARY_SOF)) {
+      return false;
+    }
+    handle->binary_mode = true;
+    handle->req_prompt = false;
+    handle->binary_rx_state = RX_STATE_IDLE;
+  }
+
+  switch (handle->binary_rx_state) {
+    case RX_STATE_IDLE:
+      if (byte == SL_CLI_BINARY_SOF) {
+        handle->binary_rx_checksum = 0;
+        handle->binary_rx_state = RX_STATE_LEN_LO;
+      }
+      return true;
+    case RX_STATE_LEN_LO:
+      handle->binary_rx_len = byte;
+      handle->binary_rx_state = RX_STATE_LEN_HI;
+      break;
+    case RX_STATE_LEN_HI:
+      handle->binary_rx_len |= (uint16_t)byte << 8;
+      handle->binary_rx_pos = 0;
+      if (handle->binary_rx_len > (uint16_t)handle->input_size) {
+        // Does not fit, drop the frame and wait for the next SOF
+        handle->binary_rx_state = RX_STATE_IDLE;
+        return true;
+      }
+      handle->binary_rx_state = (handle->binary_rx_len == 0) ? RX_STATE_CHECKSUM : RX_STATE_PAYLOAD;
+      break;
+    case RX_STATE_PAYLOAD:
+      handle->input_buffer[handle->binary_rx_pos++] = (char)byte;
+      if (handle->binary_rx_pos == handle->binary_rx_len) {
+        handle->binary_rx_state = RX_STATE_CHECKSUM;
+      }
+      break;
+    case RX_STATE_CHECKSUM:
+    default:
+      handle->binary_rx_state = RX_STATE_IDLE;
+      *frame_ready = ((uint8_t)(handle->binary_rx_checksum + byte) == 0);
+      return true;
+  }
+  handle->binary_rx_checksum += byte;
+
+  return true;
+}
+
+void sli_cli_binary_handle_frame(sl_cli_handle_t handle)
+{
+  uint8_t *payload = (uint8_t *)handle->input_buffer;
+  uint16_t len = handle->binary_rx_len;
+  uint32_t memory_array[SL_CLI_MAX_INPUT_ARGUMENTS];
+  void *argv[SL_CLI_MAX_INPUT_ARGUMENTS];
+  const sl_cli_command_entry_t *cmd_entry = NULL;
+  sl_status_t status;
+  uint32_t cmd_id;
+  int argc = 0;
+
+  if (len < CMD_ID_SIZE) {
+    return;
+  }
+  cmd_id = get_le(payload, CMD_ID_SIZE);
+
+  handle->binary_tx_len = SL_CLI_BINARY_RESPONSE_HEADER_SIZE;
+  handle->binary_tx_text_ofs = 0;
+  handle->binary_tx_truncated = false;
+  memset(handle->binary_tx_buffer, 0, SL_CLI_BINARY_RESPONSE_HEADER_SIZE);
+  put_le(&handle->binary_tx_buffer[0], cmd_id, CMD_ID_SIZE);
+
+  if (cmd_id == SL_CLI_BINARY_CMD_ID_EXIT) {
+    status = SL_STATUS_OK;
+  } else if (cmd_id == SL_CLI_BINARY_CMD_ID_LIST) {
+    status = list_commands(handle, &payload[CMD_ID_SIZE], len - CMD_ID_SIZE);
+  } else {
+    cmd_entry = find_command(handle, cmd_id);
+    if (cmd_entry == NULL) {
+      status = SL_STATUS_NOT_FOUND;
+    } else {
+      // The command name is the first entry, as for text input
+      argv[argc++] = (void *)cmd_entry->name;
+      status = convert_fields(cmd_entry->command->arg_type_list,
+                              &payload[CMD_ID_SIZE],
+                              len - CMD_ID_SIZE,
+                              &argc,
+                              argv,
+                              memory_array);
+    }
+  }
+
+  if ((status == SL_STATUS_OK) && (cmd_entry != NULL)) {
+    sl_iostream_t capture_stream = {
+      .context = handle,
+      .write = capture_write,
+      .read = capture_read
+    };
+    sl_iostream_t *previous = sl_iostream_get_default();
+
+    // stdout is buffered. Flush it on both sides of the stream switch, so
+    // that earlier output goes to the previous stream and output of the
+    // handler goes into the response.
+    fflush(stdout);
+    handle->binary_executing = true;
+    sl_iostream_set_default(&capture_stream);
+    sli_cli_command_invoke(handle, cmd_entry->command, argc, argv, 1);
+    fflush(stdout);
+    sl_iostream_set_default(previous);
+    handle->binary_executing = false;
+  }
+
+  put_le(&handle->binary_tx_buffer[CMD_ID_SIZE], (uint32_t)status, 4);
+  send_response(handle);
+
+  if (cmd_id == SL_CLI_BINARY_CMD_ID_EXIT) {
+    sl_cli_binary_set_mode(handle, false);
+  }
+}
+
+void sli_cli_binary_index_build(sl_cli_command_group_t *command_group)
+{
+#if SL_CLI_BINARY_CMD_ID_POOL_SIZE > 0
+  sl_cli_command_id_index_t *id_index = &command_group->command_id_index;
+  command_walk_t walk;
+
+  if ((command_group->command_table == NULL) || (id_index->entries != NULL)) {
+    return;
+  }
+  id_index->entries = &command_id_pool[command_id_pool_used];
+  id_index->count = 0;
+  walk.visit = visit_index;
+  walk.id_index = id_index;
+  walk.full = false;
+  (void)walk_group(command_group, &walk);
+  if (walk.full) {
+    id_index->entries = NULL;
+    id_index->count = 0;
+  } else {
+    command_id_pool_used += id_index->count;
+  }
+#else
+  (void)command_group;
+#endif
+}
+
+sl_status_t sl_cli_binary_set_mode(sl_cli_handle_t handle, bool enable)
+{
+  if (handle->binary_executing) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  if (handle->binary_mode != enable) {
+    handle->binary_mode = enable;
+    handle->binary_rx_state = RX_STATE_IDLE;
+    // The prompt is only written in text mode, and the input buffer is
+    // shared with the frame receiver.
+    handle->req_prompt = !enable;
+    sl_cli_input_clear(handle);
+  }
+  return SL_STATUS_OK;
+}
+
+uint32_t sl_cli_binary_get_command_id(const char *path)
+{
+  uint32_t hash = CMD_ID_FNV_OFFSET;
+  bool started = false;
+  bool separator = false;
+
+  // Hash the names separated by a single space, whatever the spacing in path
+  while (*path != '\0') {
+    char c = *path++;
+    if (c == ' ') {
+      separator = started;
+      continue;
+    }
+    if (separator) {
+      hash = hash_string(hash, " ");
+      separator = false;
+    }
+    started = true;
+    hash ^= (uint8_t)c;
+    hash *= CMD_ID_FNV_PRIME;
+  }
+  return hash & CMD_ID_MASK;
+}
+
+bool sl_cli_binary_get_mode(sl_cli_handle_t handle)
+{
+  return handle->binary_mode;
+}
+
+#endif // SL_CLI_BINARY_FRAMING_ENABLED
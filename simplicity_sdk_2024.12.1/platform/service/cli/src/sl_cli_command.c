@@ -32,10 +32,14 @@
 #include "sl_cli.h"
 #include "sl_cli_command.h"
 #include "sl_cli_tokenize.h"
+#include "sli_cli_command.h"
 #include "sli_cli_io.h"
 #include "sli_cli_arguments.h"
 #include "sl_string.h"
 #include "sl_common.h"
+#if SL_CLI_BINARY_FRAMING_ENABLED
+#include "sli_cli_binary.h"
+#endif
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
@@ -307,15 +311,144 @@ static void cmd_help(sl_cli_handle_t handle, const sl_cli_command_entry_t *cmd_t
   }
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Compare two command table entries in index order.
+ *
+ * @param[in] command_table   The command table.
+ *
+ * @param[in] a               Offset of an entry in the command table.
+ *
+ * @param[in] b               Offset of an entry in the command table.
+ *
+ * @return                    An integer less than, equal to or greater than 0
+ *                            if entry a sorts before, equal to or after entry b.
+ ******************************************************************************/
+static int index_compare(const sl_cli_command_entry_t *command_table,
+                         uint16_t a,
+                         uint16_t b)
+{
+  int result = sl_strcasecmp(command_table[a].name, command_table[b].name);
+
+  if (result == 0) {
+    result = (int)a - (int)b;
+  }
+  return result;
+}
+
+#if SL_CLI_COMMAND_INDEX_POOL_SIZE > 0
+// Storage for the command group indexes. Indexes are kept for the lifetime
+// of the application, so removing and adding a group again reuses them.
+static uint16_t command_index_pool[SL_CLI_COMMAND_INDEX_POOL_SIZE];
+static size_t command_index_pool_used;
+
+/***************************************************************************//**
+ * @brief
+ *   Build the sorted index of a command group from the index pool.
+ *
+ * @details
+ *   The entries are sorted with a binary insertion sort, which needs no
+ *   scratch memory. The group is left without index if the table does not
+ *   fit in the pool. Debug builds also check the result before it is used,
+ *   and leave the group without index if the check fails.
+ *
+ * @param[in, out] command_group   The command group to build an index for.
+ ******************************************************************************/
+static void index_build(sl_cli_command_group_t *command_group)
+{
+  const sl_cli_command_entry_t *command_table = command_group->command_table;
+  uint16_t *entries = &command_index_pool[command_index_pool_used];
+  size_t count = 0;
+
+  if ((command_table == NULL) || (command_group->command_index.entries != NULL)) {
+    return;
+  }
+  while (command_table[count].name != NULL) {
+    count++;
+  }
+  if ((count == 0)
+      || (count > UINT16_MAX)
+      || (count > (SL_CLI_COMMAND_INDEX_POOL_SIZE - command_index_pool_used))) {
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    size_t low = 0;
+    size_t high = i;
+    while (low < high) {
+      size_t mid = low + ((high - low) / 2);
+      if (index_compare(command_table, entries[mid], (uint16_t)i) < 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    memmove(&entries[low + 1], &entries[low], (i - low) * sizeof(entries[0]));
+    entries[low] = (uint16_t)i;
+  }
+
+  command_group->command_index.entries = entries;
+  command_group->command_index.count = (uint16_t)count;
+#if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
+  if (!sli_cli_command_index_check(command_group)) {
+    command_group->command_index.entries = NULL;
+    command_group->command_index.count = 0;
+    return;
+  }
+#endif
+  command_index_pool_used += count;
+}
+#endif // SL_CLI_COMMAND_INDEX_POOL_SIZE > 0
+
 /*******************************************************************************
  ****************************   GLOBAL FUNCTIONS   *****************************
  ******************************************************************************/
+bool sli_cli_command_index_check(const sl_cli_command_group_t *command_group)
+{
+  const sl_cli_command_index_t *command_index = &command_group->command_index;
+  const sl_cli_command_entry_t *command_table = command_group->command_table;
+  uint16_t count = 0;
+
+  if (command_index->entries == NULL) {
+    return false;
+  }
+  while (command_table[count].name != NULL) {
+    if (count == UINT16_MAX) {
+      return false;
+    }
+    count++;
+  }
+  if (command_index->count != count) {
+    return false;
+  }
+  // Strictly increasing entries also rule out duplicates, so together with
+  // the count every table entry is indexed exactly once.
+  for (uint16_t i = 0; i < count; i++) {
+    if (command_index->entries[i] >= count) {
+      return false;
+    }
+    if ((i > 0)
+        && (index_compare(command_table,
+                          command_index->entries[i - 1],
+                          command_index->entries[i]) >= 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool sl_cli_command_add_command_group(sl_cli_handle_t handle, sl_cli_command_group_t *command_group)
 {
   bool status = false;
 
   if (command_group != NULL) {
     if (!command_group->in_use) {
+#if SL_CLI_COMMAND_INDEX_POOL_SIZE > 0
+      index_build(command_group);
+#endif
+#if SL_CLI_BINARY_FRAMING_ENABLED && (SL_CLI_BINARY_CMD_ID_POOL_SIZE > 0)
+      sli_cli_binary_index_build(command_group);
+#endif
       command_group->in_use = true;
       sl_slist_push(&handle->command_group, &command_group->node);
       status = true;
@@ -488,6 +621,90 @@ static const sl_cli_command_entry_t *scan_entry(const sl_cli_command_entry_t *cm
   return cmd_entry;
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Look up a command name in a sorted command table index.
+ *
+ * @param[in] command_table   The command table the index refers to.
+ *
+ * @param[in] command_index   The sorted index of the command table.
+ *
+ * @param[in] name            The command name to look for.
+ *
+ * @return                    A pointer to the first command table entry
+ *                            matching the name, or NULL if none is found.
+ ******************************************************************************/
+static const sl_cli_command_entry_t *index_lookup(const sl_cli_command_entry_t *command_table,
+                                                  const sl_cli_command_index_t *command_index,
+                                                  const char *name)
+{
+  const sl_cli_command_entry_t *cmd_entry;
+  uint16_t low = 0;
+  uint16_t high = command_index->count;
+
+  // Find the first entry that does not sort below the name
+  while (low < high) {
+    uint16_t mid = low + ((high - low) / 2);
+    cmd_entry = &command_table[command_index->entries[mid]];
+    if (sl_strcasecmp(cmd_entry->name, name) < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  // Names that only differ by case are adjacent and ordered by table offset,
+  // so the first one that compares equal is the one a table scan would find.
+  while (low < command_index->count) {
+    cmd_entry = &command_table[command_index->entries[low]];
+    if (sl_strcasecmp(cmd_entry->name, name) != 0) {
+      break;
+    }
+    if (cmd_strcmp(cmd_entry->name, name) == 0) {
+      return cmd_entry;
+    }
+    low++;
+  }
+
+  return NULL;
+}
+
+static const sl_cli_command_entry_t *scan_index(const sl_cli_command_group_t *cmd_group,
+                                                bool *found,
+                                                int *token_c,
+                                                char *token_v[],
+                                                int *arg_ofs,
+                                                bool *single_flag,
+                                                bool *help_flag)
+{
+  const sl_cli_command_entry_t *cmd_entry;
+
+  if (*arg_ofs >= *token_c) {
+    return NULL;
+  }
+
+  cmd_entry = index_lookup(cmd_group->command_table,
+                           &cmd_group->command_index,
+                           token_v[*arg_ofs]);
+  if (cmd_entry == NULL) {
+    return NULL;
+  }
+
+  // Command or group found
+  (*arg_ofs)++;
+  if (cmd_entry->command->arg_type_list[0] == SL_CLI_ARG_GROUP) {
+    // Group found, continue search. Sub groups are not indexed.
+    cmd_entry = (sl_cli_command_entry_t *)(cmd_entry->command->function);
+    cmd_entry = scan_entry(cmd_entry, true, found, token_c, token_v, arg_ofs, single_flag, help_flag);
+  } else {
+    // Command found, stop search
+    *single_flag = true;
+    *found = true;
+  }
+
+  return cmd_entry;
+}
+
 const sl_cli_command_entry_t *sl_cli_command_find(sl_cli_handle_t handle,
                                                   int *token_c,
                                                   char *token_v[],
@@ -514,7 +731,11 @@ const sl_cli_command_entry_t *sl_cli_command_find(sl_cli_handle_t handle,
     if (cmd_entry == NULL) {
       continue;
     }
-    cmd_entry = scan_entry(cmd_entry, false, &found, token_c, token_v, arg_ofs, single_flag, help_flag);
+    if (cmd_group->command_index.entries != NULL) {
+      cmd_entry = scan_index(cmd_group, &found, token_c, token_v, arg_ofs, single_flag, help_flag);
+    } else {
+      cmd_entry = scan_entry(cmd_entry, false, &found, token_c, token_v, arg_ofs, single_flag, help_flag);
+    }
     if (found) {
       break;
     }
@@ -533,7 +754,6 @@ sl_status_t sl_cli_command_execute(sl_cli_handle_t handle,
   int token_c;
   uint32_t memory_array[SL_CLI_MAX_INPUT_ARGUMENTS];
   void *argv[SL_CLI_MAX_INPUT_ARGUMENTS];
-  sl_cli_command_arg_t arguments;
   int arg_ofs;
 
   // Split input string
@@ -571,8 +791,22 @@ sl_status_t sl_cli_command_execute(sl_cli_handle_t handle,
   }
 
   // Call function
+  sli_cli_command_invoke(handle, cmd_info, token_c, argv, arg_ofs);
+
+  // Command executed, return status that in this case is success
+  return status;
+}
+
+void sli_cli_command_invoke(sl_cli_handle_t handle,
+                            const sl_cli_command_info_t *cmd_info,
+                            int argc,
+                            void *argv[],
+                            int arg_ofs)
+{
+  sl_cli_command_arg_t arguments;
+
   arguments.handle = handle;
-  arguments.argc = token_c;
+  arguments.argc = argc;
   arguments.argv = argv;
   arguments.arg_ofs = arg_ofs;
   arguments.arg_type_list = cmd_info->arg_type_list;
@@ -580,7 +814,4 @@ sl_status_t sl_cli_command_execute(sl_cli_handle_t handle,
   sli_cli_pre_cmd_hook(&arguments);
   cmd_info->function(&arguments);
   sli_cli_post_cmd_hook(&arguments);
-
-  // Command executed, return status that in this case is success
-  return status;
 }
@@ -0,0 +1,93 @@
+/***************************************************************************//**
+ * @file
+ * @brief Internal binary framing functions for the CLI.
+ * @version x.y.z
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_CLI_BINARY_H
+#define SLI_CLI_BINARY_H
+
+#include <stdbool.h>
+
+#include "sl_cli_config.h"
+#include "sl_cli_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Feed an input character to the binary frame receiver.
+ *
+ * @details
+ *   Characters are taken when the instance is in binary mode, and a SOF
+ *   character at the start of an empty text line switches to binary mode.
+ *
+ * @param[in, out] handle
+ *   A handle to a CLI instance.
+ *
+ * @param[in] c
+ *   The input character.
+ *
+ * @param[out] frame_ready
+ *   Set to true when a complete and valid frame is in the input buffer.
+ *
+ * @return
+ *   True if the character was taken by the binary frame receiver, false if
+ *   it shall be handled as text input.
+ ******************************************************************************/
+bool sli_cli_binary_input_char(sl_cli_handle_t handle, int c, bool *frame_ready);
+
+/***************************************************************************//**
+ * @brief
+ *   Execute the frame in the input buffer and send the response frame.
+ *
+ * @param[in, out] handle
+ *   A handle to a CLI instance.
+ ******************************************************************************/
+void sli_cli_binary_handle_frame(sl_cli_handle_t handle);
+
+/***************************************************************************//**
+ * @brief
+ *   Build the binary command ID index of a command group from the index pool.
+ *
+ * @details
+ *   The group is left without index if its commands do not fit in the pool,
+ *   and frames for it are then dispatched by walking its commands.
+ *
+ * @param[in, out] command_group
+ *   The command group to build an index for.
+ ******************************************************************************/
+void sli_cli_binary_index_build(sl_cli_command_group_t *command_group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLI_CLI_BINARY_H
@@ -0,0 +1,85 @@
+/***************************************************************************//**
+ * @file
+ * @brief Internal command execution functions for the CLI.
+ * @version x.y.z
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_CLI_COMMAND_H
+#define SLI_CLI_COMMAND_H
+
+#include "sl_cli_config.h"
+#include "sl_cli_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Call a command handler with converted arguments, surrounded by the pre
+ *   and post command hooks.
+ *
+ * @param[in] handle
+ *   A handle to a CLI instance.
+ *
+ * @param[in] cmd_info
+ *   The command to call.
+ *
+ * @param[in] argc
+ *   The total number of entries in argv.
+ *
+ * @param[in] argv
+ *   The command name(s) followed by the converted arguments.
+ *
+ * @param[in] arg_ofs
+ *   The offset in argv where the arguments start.
+ ******************************************************************************/
+void sli_cli_command_invoke(sl_cli_handle_t handle,
+                            const sl_cli_command_info_t *cmd_info,
+                            int argc,
+                            void *argv[],
+                            int arg_ofs);
+
+/***************************************************************************//**
+ * @brief
+ *   Check the sorted index of a command group.
+ *
+ * @param[in] command_group
+ *   A pointer to a command group structure.
+ *
+ * @return
+ *   True if the group has an index that holds every command table entry
+ *   exactly once, in lookup order. False otherwise.
+ ******************************************************************************/
+bool sli_cli_command_index_check(const sl_cli_command_group_t *command_group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLI_CLI_COMMAND_H
@@ -73,6 +73,8 @@ extern "C" {
  *
  *   Each UART stream type provides its initalization with parameters specific to them.
  * @note  Each UART stream requires a dedicated (L)DMA channel through DMADRV.
+ *        A second channel is allocated when an asynchronous TX buffer is
+ *        configured.
  *
  * ## Configuration
  *
@@ -103,6 +105,41 @@ extern "C" {
  *    This should ensure that flow control does not have to be asserted, slowing
  *    down the bus and if unavailable, that no data will be dropped.
  *
+ * ### TX Buffer Size
+ *
+ *    By default, a write pushes every byte into the UART peripheral and only
+ *    returns once the last byte has been accepted by the peripheral. When the
+ *    `SL_IOSTREAM_<Peripheral>_<Instance>_TX_BUFFER_SIZE` parameter is non-zero,
+ *    writes are instead copied into a TX ring buffer of that size and drained
+ *    by the (L)DMA in the background, so the write returns as soon as the data
+ *    has been copied. When the data wraps around the end of the ring, the
+ *    (L)DMA transfer is made of two chained descriptors.
+ *
+ *    A writer only waits when the ring is full; this event is counted as an
+ *    overrun in the TX statistics, see @ref sl_iostream_uart_get_tx_stats().
+ *    A write from an interrupt that preempts another write can't wait for
+ *    the room held by the interrupted write. What it can't fit is dropped and
+ *    counted in the same statistics.
+ *    The high-water mark reported by the same statistics can be used to tune
+ *    the buffer size. Use @ref sl_iostream_uart_flush_tx() as a barrier
+ *    before any operation that requires all the output to have been sent, such
+ *    as a reset.
+ *
+ *    The TX buffer is not used when software flow control is enabled, since
+ *    an XOFF could not stop a transfer already handed over to the (L)DMA.
+ *
+ *    The instance initialization code only knows the RX buffer. The TX buffer
+ *    is given to the stream with @ref sl_iostream_uart_set_tx_buffer(), sized
+ *    by the `SL_IOSTREAM_<Peripheral>_<Instance>_TX_BUFFER_SIZE` parameter of
+ *    the instance configuration file, e.g.:
+ *    ```c
+ *    static uint8_t vcom_tx_buffer[SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE];
+ *
+ *    sl_iostream_uart_set_tx_buffer(sl_iostream_uart_vcom_handle,
+ *                                   vcom_tx_buffer,
+ *                                   sizeof(vcom_tx_buffer));
+ *    ```
+ *
  * ### Baudrate
  *
  *    IOStream UART leverages the DMA in order consume data from the UART peripheral.
@@ -173,18 +210,23 @@ typedef struct {
 typedef struct {
   DMADRV_PeripheralSignal_t peripheral_signal;  ///< Peripheral signal to trigger a DMA transfer on
   uint8_t *src;                                 ///< Pointer to IO Stream peripheral data register
+  DMADRV_PeripheralSignal_t tx_peripheral_signal; ///< Peripheral signal to trigger a DMA TX transfer on. Only used with a TX buffer.
+  uint8_t *dst;                                 ///< Pointer to IO Stream peripheral TX data register. Only used with a TX buffer.
 } sl_iostream_dma_config_t;
 
 /// @brief I/O Steam (L)DMA Context
 typedef struct {
   sl_iostream_dma_config_t cfg;                       ///< DMA Configuration
   uint8_t channel;                                    ///< DMA Channel
+  uint8_t tx_channel;                                 ///< DMA TX Channel. Only allocated with a TX buffer.
   #if defined(EMDRV_DMADRV_LDMA)
   LDMA_Descriptor_t rx_resume_desc;                   ///< DMA reception resume descriptor
   LDMA_Descriptor_t wrap_desc;                        ///< DMA wrap descriptor
+  LDMA_Descriptor_t tx_desc[2];                       ///< DMA transmission descriptors, chained when the TX data wraps
   #elif defined(EMDRV_DMADRV_LDMA_S3)
   sl_hal_ldma_descriptor_t rx_resume_desc;            ///< DMA reception resume descriptor
   sl_hal_ldma_descriptor_t wrap_desc;                 ///< DMA wrap descriptor
+  sl_hal_ldma_descriptor_t tx_desc[2];                ///< DMA transmission descriptors, chained when the TX data wraps
   #endif
 } sl_iostream_dma_context_t;
 
@@ -198,8 +240,18 @@ typedef struct {
   bool lf_to_crlf;                                      ///< lf_to_crlf
   bool rx_when_sleeping;                                ///< rx_when_sleeping
   bool sw_flow_control;                                 ///< sw_flow_control
+  uint8_t *tx_buffer;                                   ///< UART Tx Buffer. NULL to transmit synchronously.
+  size_t tx_buffer_length;                              ///< UART Tx Buffer length
 } sl_iostream_uart_config_t;
 
+/// @brief I/O Stream UART TX statistics
+typedef struct {
+  size_t high_water;                                    ///< Highest number of bytes held in the TX buffer
+  uint32_t overruns;                                    ///< Number of times a write had to wait for room in the TX buffer
+  uint32_t transfers;                                   ///< Number of (L)DMA transfers completed
+  uint32_t dropped;                                     ///< Number of bytes dropped by a write from an interrupt that found the TX buffer full during another write
+} sl_iostream_uart_tx_stats_t;
+
 /// @brief I/O Stream UART context
 typedef struct {
   sl_iostream_dma_context_t dma;            ///< DMA Context
@@ -215,6 +267,15 @@ typedef struct {
   volatile bool xon;                        ///< Transmitter enabled
   bool remote_xon;                          ///< Remote Transmitter enabled
   IRQn_Type rx_irq_number;                  ///< Receive IRQ Number
+  uint8_t *tx_buffer;                       ///< UART Tx Buffer. NULL when transmitting synchronously.
+  size_t tx_buffer_len;                     ///< UART Tx Buffer length
+  volatile size_t tx_head;                  ///< Index of the next byte to be reserved in the Tx Buffer
+  volatile size_t tx_tail;                  ///< Index of the oldest byte not yet transmitted
+  volatile size_t tx_count;                 ///< Number of bytes held in the Tx Buffer, ready to be transmitted
+  volatile size_t tx_reserved;              ///< Number of bytes reserved by writes still copying their data
+  volatile uint8_t tx_writers;              ///< Number of writes copying their data, more than one when an interrupt writes during a write
+  volatile size_t tx_in_flight;             ///< Number of bytes handed over to the (L)DMA
+  sl_iostream_uart_tx_stats_t tx_stats;     ///< TX statistics
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
   IRQn_Type tx_irq_number;                  ///< Transmit IRQ Number
   volatile bool tx_idle;                    ///< tx_idle. Available only when Power Manager present.
@@ -278,6 +339,58 @@ __STATIC_INLINE bool sl_iostream_uart_get_auto_cr_lf(sl_iostream_uart_t *iostrea
   return iostream_uart->get_auto_cr_lf(iostream_uart->stream.context);
 }
 
+/***************************************************************************//**
+ * Give a TX buffer to a UART stream initialized without one. From then on,
+ * writes are copied into the buffer and drained by the (L)DMA in the background.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ *
+ * @param[in] buffer  TX buffer. It must stay valid as long as the stream is
+ *                    initialized.
+ *
+ * @param[in] buffer_length  Size of the TX buffer, at least 2 bytes.
+ *
+ * @return Status result
+ *
+ * @note Call this function before the stream is written from an interrupt,
+ *       typically right after the stream is initialized. The TX buffer is not
+ *       supported with software flow control.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_set_tx_buffer(sl_iostream_uart_t *iostream_uart,
+                                           uint8_t *buffer,
+                                           size_t buffer_length);
+
+/***************************************************************************//**
+ * Wait until all the data written to the stream has been handed over to the
+ * UART peripheral.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ *
+ * @return Status result
+ *
+ * @note When no TX buffer is configured, writes are synchronous and this
+ *       function returns immediately. The last bytes may still be shifting
+ *       out of the peripheral when this function returns.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_flush_tx(sl_iostream_uart_t *iostream_uart);
+
+/***************************************************************************//**
+ * Get the TX buffer statistics.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ *
+ * @param[out] stats  Statistics accumulated since init or the last clear.
+ ******************************************************************************/
+void sl_iostream_uart_get_tx_stats(sl_iostream_uart_t *iostream_uart,
+                                   sl_iostream_uart_tx_stats_t *stats);
+
+/***************************************************************************//**
+ * Clear the TX buffer statistics.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ ******************************************************************************/
+void sl_iostream_uart_clear_tx_stats(sl_iostream_uart_t *iostream_uart);
+
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
 /***************************************************************************//**
  * Set next byte detect IRQ.
@@ -52,6 +52,25 @@
 #define TASK_REGISTER_ID_INVALID   0xFF
 #endif
 
+// Number of characters formatted by sl_iostream_printf() before they are
+// written to the stream.
+#ifndef SL_IOSTREAM_PRINTF_BUFFER_SIZE
+#define SL_IOSTREAM_PRINTF_BUFFER_SIZE   32
+#endif
+
+/*******************************************************************************
+ *******************************   TYPEDEFS   **********************************
+ ******************************************************************************/
+
+#if defined(SL_CATALOG_PRINTF_PRESENT)
+// Characters collected by stream_putchar()
+typedef struct {
+  sl_iostream_t *stream;
+  size_t length;
+  char buffer[SL_IOSTREAM_PRINTF_BUFFER_SIZE];
+} stream_printf_buffer_t;
+#endif
+
 /*******************************************************************************
  ***************************  LOCAL VARIABLES   ********************************
  ******************************************************************************/
@@ -75,6 +94,8 @@ sl_iostream_t sl_iostream_null = {
 #if defined(SL_CATALOG_PRINTF_PRESENT)
 static void stream_putchar(char character,
                            void *arg);
+
+static void stream_printf_flush(stream_printf_buffer_t *printf_buffer);
 #endif
 
 /*******************************************************************************
@@ -249,10 +270,15 @@ sl_status_t sl_iostream_vprintf(sl_iostream_t *stream,
   int ret;
 
 #if defined(SL_CATALOG_PRINTF_PRESENT)
+  stream_printf_buffer_t printf_buffer;
+
   if (output_stream == SL_IOSTREAM_STDOUT) {
     output_stream = sl_iostream_get_default();
   }
-  ret = vfctprintf(stream_putchar, output_stream, format, argp);
+  printf_buffer.stream = output_stream;
+  printf_buffer.length = 0;
+  ret = vfctprintf(stream_putchar, &printf_buffer, format, argp);
+  stream_printf_flush(&printf_buffer);
 #else
   if (output_stream == SL_IOSTREAM_STDOUT) {
     default_stream = sl_iostream_get_default();
@@ -298,6 +324,22 @@ sl_status_t sl_iostream_printf(sl_iostream_t *stream,
 static void stream_putchar(char character,
                            void *arg)
 {
-  sl_iostream_putchar((sl_iostream_t *)arg, character);
+  stream_printf_buffer_t *printf_buffer = (stream_printf_buffer_t *)arg;
+
+  printf_buffer->buffer[printf_buffer->length++] = character;
+  if (printf_buffer->length == sizeof(printf_buffer->buffer)) {
+    stream_printf_flush(printf_buffer);
+  }
+}
+
+/***************************************************************************//**
+ * Write the characters collected by stream_putchar() to the stream.
+ ******************************************************************************/
+static void stream_printf_flush(stream_printf_buffer_t *printf_buffer)
+{
+  if (printf_buffer->length > 0) {
+    sl_iostream_write(printf_buffer->stream, printf_buffer->buffer, printf_buffer->length);
+    printf_buffer->length = 0;
+  }
 }
 #endif
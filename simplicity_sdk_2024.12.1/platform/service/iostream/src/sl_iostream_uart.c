@@ -86,6 +86,7 @@ typedef LDMA_TransferCfg_t iostream_ldma_xfer_cfg_t;
 #define IOSTREAM_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR
 #define IOSTREAM_LDMA_TFER_CFG_PERIPH            LDMA_TRANSFER_CFG_PERIPHERAL
 #define IOSTREAM_LDMA_DESCRIPTOR_SINGLE_P2M_BYTE LDMA_DESCRIPTOR_SINGLE_P2M_BYTE
+#define IOSTREAM_LDMA_DESCRIPTOR_SINGLE_M2P_BYTE LDMA_DESCRIPTOR_SINGLE_M2P_BYTE
 #define IOSTREAM_LDMA_TFER_CFG_REQ_SEL           ldmaReqSel
 #elif defined(EMDRV_DMADRV_LDMA_S3)
 typedef sl_hal_ldma_descriptor_t iostream_ldma_descriptor_t;
@@ -99,10 +100,14 @@ typedef sl_hal_ldma_transfer_config_t iostream_ldma_xfer_cfg_t;
 #define IOSTREAM_LDMA_TFER_CFG_PERIPH            SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL
 #define IOSTREAM_LDMA_TFER_CFG_REQ_SEL           request_sel
 #define IOSTREAM_LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(src, dst, cnt) SL_HAL_LDMA_DESCRIPTOR_SINGLE_P2M(SL_HAL_LDMA_CTRL_SIZE_BYTE, src, dst, cnt)
+#define IOSTREAM_LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(src, dst, cnt) SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(SL_HAL_LDMA_CTRL_SIZE_BYTE, src, dst, cnt)
 #endif
 
 #define RX_DATA_AVAILABLE_FLAG  1
 
+// Maximum number of bytes a single LDMA descriptor can transfer
+#define TX_DMA_MAX_XFER_COUNT   ((size_t)(_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1)
+
 /*******************************************************************************
  **************************** LOCAL VARIABLES **********************************
  ******************************************************************************/
@@ -157,6 +162,37 @@ static sl_status_t nolock_uart_write(void *context,
                                      const void *buffer,
                                      size_t buffer_length);
 
+static void nolock_uart_write_buffered(sl_iostream_uart_context_t *uart_context,
+                                       const uint8_t *buffer,
+                                       size_t buffer_length,
+                                       bool lf_to_crlf);
+
+static size_t tx_buffer_measure(const uint8_t *buffer,
+                                size_t buffer_length,
+                                bool lf_to_crlf,
+                                size_t room,
+                                size_t *stored);
+
+static size_t tx_buffer_put(sl_iostream_uart_context_t *uart_context,
+                            const uint8_t *buffer,
+                            size_t buffer_length,
+                            bool lf_to_crlf);
+
+static sl_status_t tx_buffer_attach(sl_iostream_uart_context_t *uart_context,
+                                    uint8_t *buffer,
+                                    size_t buffer_length);
+
+static bool tx_wait_for_room(sl_iostream_uart_context_t *uart_context);
+
+static void nolock_flush_tx(sl_iostream_uart_context_t *uart_context);
+
+static void __tx_start(sl_iostream_uart_context_t *uart_context);
+
+static void __tx_complete(sl_iostream_uart_context_t *uart_context);
+
+static bool tx_dma_irq_handler(unsigned int channel, unsigned int sequenceNo,
+                               void *userParam);
+
 static inline bool __rx_buffer_full(const sl_iostream_uart_context_t *uart_context);
 
 static inline bool rx_buffer_empty(const sl_iostream_uart_context_t *uart_context);
@@ -197,6 +233,7 @@ sl_status_t sli_iostream_uart_context_init(sl_iostream_uart_t *uart,
   (void)rx_em_req;
   (void)tx_em_req;
   Ecode_t ecode;
+  sl_status_t status;
 
   // Configure iostream struct and context
   memset(context, 0, sizeof(*context));
@@ -236,6 +273,15 @@ sl_status_t sli_iostream_uart_context_init(sl_iostream_uart_t *uart,
     return SL_STATUS_INITIALIZATION;
   }
 
+  // Software flow control must be able to hold back any byte not yet sent,
+  // which the (L)DMA can't do. Keep the synchronous path in that case.
+  if (config->tx_buffer != NULL && config->tx_buffer_length > 0 && !config->sw_flow_control) {
+    status = tx_buffer_attach(context, config->tx_buffer, config->tx_buffer_length);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+
 #if defined(SL_CATALOG_KERNEL_PRESENT)
   uart->set_read_block = set_read_block;
   uart->get_read_block = get_read_block;
@@ -359,6 +405,127 @@ void sl_iostream_uart_wakeup(sl_iostream_uart_t *iostream_uart)
   EFM_ASSERT(ecode == ECODE_OK);
 }
 
+/***************************************************************************//**
+ * Wait until all the data written has been handed over to the UART peripheral.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_flush_tx(sl_iostream_uart_t *iostream_uart)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  osStatus_t status;
+#endif
+
+  if (uart_context == NULL) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  if (uart_context->tx_buffer == NULL) {
+    // Writes are synchronous, nothing pending
+    return SL_STATUS_OK;
+  }
+
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  if (osKernelGetState() == osKernelRunning) {
+    // Hold the write lock so that concurrent writers can't extend the wait
+    status = osMutexAcquire(uart_context->write_lock, osWaitForever);
+    if (status != osOK) {
+      return SL_STATUS_INVALID_STATE;
+    }
+  }
+#endif
+
+  nolock_flush_tx(uart_context);
+
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  if (osKernelGetState() == osKernelRunning) {
+    status = osMutexRelease(uart_context->write_lock);
+    EFM_ASSERT(status == osOK);
+  }
+#endif
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Give a TX buffer to a stream initialized without one.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_set_tx_buffer(sl_iostream_uart_t *iostream_uart,
+                                           uint8_t *buffer,
+                                           size_t buffer_length)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+  sl_status_t status;
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  osStatus_t os_status;
+#endif
+
+  if (uart_context == NULL) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  if (buffer == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (uart_context->tx_buffer != NULL) {
+    return SL_STATUS_ALREADY_INITIALIZED;
+  }
+  // See sli_iostream_uart_context_init()
+  if (uart_context->sw_flow_control) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  if (osKernelGetState() == osKernelRunning) {
+    // Don't switch to the TX buffer in the middle of a synchronous write
+    os_status = osMutexAcquire(uart_context->write_lock, osWaitForever);
+    if (os_status != osOK) {
+      return SL_STATUS_INVALID_STATE;
+    }
+  }
+#endif
+
+  status = tx_buffer_attach(uart_context, buffer, buffer_length);
+
+#if (defined(SL_CATALOG_KERNEL_PRESENT))
+  if (osKernelGetState() == osKernelRunning) {
+    os_status = osMutexRelease(uart_context->write_lock);
+    EFM_ASSERT(os_status == osOK);
+  }
+#endif
+
+  return status;
+}
+
+/***************************************************************************//**
+ * Get the TX buffer statistics.
+ ******************************************************************************/
+void sl_iostream_uart_get_tx_stats(sl_iostream_uart_t *iostream_uart,
+                                   sl_iostream_uart_tx_stats_t *stats)
+{
+  const sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+
+  EFM_ASSERT(uart_context != NULL && stats != NULL);
+
+  CORE_ATOMIC_SECTION(
+    *stats = uart_context->tx_stats;
+    )
+}
+
+/***************************************************************************//**
+ * Clear the TX buffer statistics.
+ ******************************************************************************/
+void sl_iostream_uart_clear_tx_stats(sl_iostream_uart_t *iostream_uart)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+
+  EFM_ASSERT(uart_context != NULL);
+
+  // Restart the high-water mark from what the TX buffer currently holds
+  CORE_ATOMIC_SECTION(
+    memset(&uart_context->tx_stats, 0, sizeof(uart_context->tx_stats));
+    uart_context->tx_stats.high_water = uart_context->tx_count;
+    )
+}
+
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && !defined(SL_CATALOG_KERNEL_PRESENT)
 /**************************************************************************//**
  * Check if MCU was woken up by new data on UART.
@@ -626,6 +793,17 @@ static sl_status_t uart_deinit(void *stream)
   ecode = DMADRV_FreeChannel(uart_context->dma.channel);
   EFM_ASSERT(ecode == ECODE_OK);
 
+  if (uart_context->tx_buffer != NULL) {
+    // Send what is left in the TX buffer before releasing the TX DMA channel
+    nolock_flush_tx(uart_context);
+
+    ecode = DMADRV_StopTransfer(uart_context->dma.tx_channel);
+    EFM_ASSERT(ecode == ECODE_OK);
+
+    ecode = DMADRV_FreeChannel(uart_context->dma.tx_channel);
+    EFM_ASSERT(ecode == ECODE_OK);
+  }
+
   // Try to deinit the DMADRV
   ecode = DMADRV_DeInit();
   EFM_ASSERT(ecode == ECODE_OK || ecode == ECODE_EMDRV_DMADRV_IN_USE);
@@ -708,6 +886,11 @@ static sl_status_t nolock_uart_write(void *context,
   CORE_EXIT_ATOMIC();
 #endif
 
+  if (uart_context->tx_buffer != NULL) {
+    nolock_uart_write_buffered(uart_context, (const uint8_t *)buffer, buffer_length, lf_to_crlf);
+    return SL_STATUS_OK;
+  }
+
   uint32_t i = 0;
   while (i < buffer_length) {
     bool xon = false;
@@ -739,6 +922,347 @@ static sl_status_t nolock_uart_write(void *context,
   return status;
 }
 
+/***************************************************************************//**
+ * Copy the data to the TX buffer, waiting for the (L)DMA to free up room
+ * whenever the TX buffer is full.
+ ******************************************************************************/
+static void nolock_uart_write_buffered(sl_iostream_uart_context_t *uart_context,
+                                       const uint8_t *buffer,
+                                       size_t buffer_length,
+                                       bool lf_to_crlf)
+{
+  size_t written = 0;
+  size_t put;
+  CORE_DECLARE_IRQ_STATE;
+
+  while (written < buffer_length) {
+    put = tx_buffer_put(uart_context, buffer + written, buffer_length - written, lf_to_crlf);
+    written += put;
+    if (written < buffer_length && !tx_wait_for_room(uart_context)) {
+      CORE_ENTER_ATOMIC();
+      uart_context->tx_stats.dropped += buffer_length - written;
+      CORE_EXIT_ATOMIC();
+      break;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Find how much of the data fits in the given room, once LFs are converted.
+ ******************************************************************************/
+static size_t tx_buffer_measure(const uint8_t *buffer,
+                                size_t buffer_length,
+                                bool lf_to_crlf,
+                                size_t room,
+                                size_t *stored)
+{
+  size_t consumed = 0;
+
+  if (!lf_to_crlf) {
+    consumed = (buffer_length < room) ? buffer_length : room;
+    *stored = consumed;
+    return consumed;
+  }
+
+  *stored = 0;
+  while (consumed < buffer_length) {
+    // A LF is only consumed once its CR fits as well
+    size_t size = (buffer[consumed] == '\n') ? 2 : 1;
+    if (*stored + size > room) {
+      break;
+    }
+    *stored += size;
+    consumed++;
+  }
+  return consumed;
+}
+
+/***************************************************************************//**
+ * Copy as much data as the TX buffer can hold and start the (L)DMA if idle.
+ * Returns the number of bytes consumed from the input buffer.
+ *
+ * @note The span is reserved in an atomic section and then filled with
+ *       interrupts enabled. A write from an interrupt during the copy reserves
+ *       the span after it. Reserved data is only handed to the (L)DMA once the
+ *       last write in progress is done, so that the (L)DMA never sends a span
+ *       that is still being filled.
+ ******************************************************************************/
+static size_t tx_buffer_put(sl_iostream_uart_context_t *uart_context,
+                            const uint8_t *buffer,
+                            size_t buffer_length,
+                            bool lf_to_crlf)
+{
+  uint8_t *tx_buffer = uart_context->tx_buffer;
+  const size_t tx_buffer_len = uart_context->tx_buffer_len;
+  size_t room = tx_buffer_len - uart_context->tx_count - uart_context->tx_reserved;
+  size_t head;
+  size_t consumed;
+  size_t stored;
+  size_t chunk;
+  CORE_DECLARE_IRQ_STATE;
+
+  // An interrupt may reserve room between the measure and the reservation,
+  // measure again with what is left in that case
+  while (true) {
+    consumed = tx_buffer_measure(buffer, buffer_length, lf_to_crlf, room, &stored);
+    if (stored == 0) {
+      return 0;
+    }
+
+    CORE_ENTER_ATOMIC();
+    room = tx_buffer_len - uart_context->tx_count - uart_context->tx_reserved;
+    if (stored <= room) {
+      head = uart_context->tx_head;
+      uart_context->tx_head = (head + stored < tx_buffer_len)
+                              ? head + stored
+                              : head + stored - tx_buffer_len;
+      uart_context->tx_reserved += stored;
+      uart_context->tx_writers++;
+      CORE_EXIT_ATOMIC();
+      break;
+    }
+    CORE_EXIT_ATOMIC();
+  }
+
+  if (!lf_to_crlf) {
+    // Copy up to the end of the TX buffer, then wrap around
+    chunk = tx_buffer_len - head;
+    if (chunk > stored) {
+      chunk = stored;
+    }
+    memcpy(&tx_buffer[head], buffer, chunk);
+    memcpy(tx_buffer, &buffer[chunk], stored - chunk);
+  } else {
+    for (size_t i = 0; i < consumed; i++) {
+      if (buffer[i] == '\n') {
+        tx_buffer[head] = '\r';
+        head = (head + 1 == tx_buffer_len) ? 0 : head + 1;
+      }
+      tx_buffer[head] = buffer[i];
+      head = (head + 1 == tx_buffer_len) ? 0 : head + 1;
+    }
+  }
+
+  CORE_ENTER_ATOMIC();
+  uart_context->tx_writers--;
+  if (uart_context->tx_writers == 0) {
+    uart_context->tx_count += uart_context->tx_reserved;
+    uart_context->tx_reserved = 0;
+    if (uart_context->tx_count > uart_context->tx_stats.high_water) {
+      uart_context->tx_stats.high_water = uart_context->tx_count;
+    }
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && !defined(SL_IOSTREAM_UART_FLUSH_TX_BUFFER)
+    // Transmit complete is only meaningful once the TX buffer has drained
+    uart_context->tx_completed(uart_context, false);
+#endif
+    __tx_start(uart_context);
+  }
+  CORE_EXIT_ATOMIC();
+
+  return consumed;
+}
+
+/***************************************************************************//**
+ * Allocate the TX (L)DMA channel and start writing through the TX buffer.
+ ******************************************************************************/
+static sl_status_t tx_buffer_attach(sl_iostream_uart_context_t *uart_context,
+                                    uint8_t *buffer,
+                                    size_t buffer_length)
+{
+  Ecode_t ecode;
+  unsigned int tx_channel;
+  CORE_DECLARE_IRQ_STATE;
+
+  // A LF converted to CRLF must fit in the TX buffer at once
+  if (buffer_length < 2) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  // The (L)DMA needs to know where and when to write
+  if (uart_context->dma.cfg.dst == NULL) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+
+  // Allocate the TX LDMA channel
+  ecode = DMADRV_AllocateChannel(&tx_channel, NULL);
+  if (ecode != ECODE_OK) {
+    return SL_STATUS_INITIALIZATION;
+  }
+
+  CORE_ENTER_ATOMIC();
+  uart_context->dma.tx_channel = (uint8_t)tx_channel;
+  uart_context->tx_buffer_len = buffer_length;
+  uart_context->tx_buffer = buffer;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Wait for the in-flight (L)DMA transfer to free up room in the TX buffer.
+ * Returns false if no room can be freed, which happens when the rest of the TX
+ * buffer is reserved by the write this one interrupted.
+ *
+ * @note The (L)DMA completion is polled as well, since the writer can run with
+ *       interrupts masked or from an interrupt of higher priority than the
+ *       (L)DMA one.
+ ******************************************************************************/
+static bool tx_wait_for_room(sl_iostream_uart_context_t *uart_context)
+{
+  const size_t tx_count = uart_context->tx_count;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (tx_count == 0) {
+    return false;
+  }
+
+  CORE_ENTER_ATOMIC();
+  uart_context->tx_stats.overruns++;
+  CORE_EXIT_ATOMIC();
+
+  while (uart_context->tx_count >= tx_count) {
+    CORE_ENTER_ATOMIC();
+    __tx_complete(uart_context);
+    CORE_EXIT_ATOMIC();
+  }
+  return true;
+}
+
+/***************************************************************************//**
+ * Wait until the TX buffer has been drained by the (L)DMA.
+ ******************************************************************************/
+static void nolock_flush_tx(sl_iostream_uart_context_t *uart_context)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  while (uart_context->tx_count != 0) {
+    CORE_ENTER_ATOMIC();
+    __tx_complete(uart_context);
+    CORE_EXIT_ATOMIC();
+  }
+}
+
+/***************************************************************************//**
+ * Start transmitting the TX buffer content, if no transfer is in flight.
+ *
+ * @note Caller must be in an atomic section.
+ ******************************************************************************/
+static void __tx_start(sl_iostream_uart_context_t *uart_context)
+{
+  Ecode_t ecode;
+  size_t first;
+  size_t second = 0;
+  const size_t tail = uart_context->tx_tail;
+  iostream_ldma_xfer_cfg_t tx_xfer_cfg = IOSTREAM_LDMA_TFER_CFG_PERIPH(0);
+
+  if (uart_context->tx_in_flight != 0 || uart_context->tx_count == 0) {
+    return;
+  }
+
+  // Send everything up to the end of the TX buffer, then link to a second
+  // descriptor for what wrapped around to its start:
+  // [wrapped_data | room | data]
+  //  ↑               ↑    ↑
+  //  tx_desc[1]      head tail, tx_desc[0]
+  first = uart_context->tx_buffer_len - tail;
+  if (first >= uart_context->tx_count) {
+    first = uart_context->tx_count;
+  } else {
+    second = uart_context->tx_count - first;
+  }
+  if (first > TX_DMA_MAX_XFER_COUNT) {
+    first = TX_DMA_MAX_XFER_COUNT;
+    second = 0;
+  }
+  if (second > TX_DMA_MAX_XFER_COUNT) {
+    second = TX_DMA_MAX_XFER_COUNT;
+  }
+
+  uart_context->dma.tx_desc[0] = (iostream_ldma_descriptor_t)IOSTREAM_LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(&uart_context->tx_buffer[tail],
+                                                                                                      uart_context->dma.cfg.dst,
+                                                                                                      first);
+  if (second > 0) {
+    uart_context->dma.tx_desc[1] = (iostream_ldma_descriptor_t)IOSTREAM_LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(uart_context->tx_buffer,
+                                                                                                        uart_context->dma.cfg.dst,
+                                                                                                        second);
+    // Only signal completion at the end of the chain
+    uart_context->dma.tx_desc[0].xfer.IOSTREAM_LDMA_DESCRIPTOR_DONE_IFS = false;
+    uart_context->dma.tx_desc[0].xfer.link = true;
+    uart_context->dma.tx_desc[0].xfer.IOSTREAM_LDMA_DESCRIPTOR_LINK_MODE = LDMA_CH_LINK_LINKMODE_ABSOLUTE;
+    uart_context->dma.tx_desc[0].xfer.IOSTREAM_LDMA_DESCRIPTOR_LINK_ADDR = IOSTREAM_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&uart_context->dma.tx_desc[1]);
+  }
+
+  uart_context->tx_in_flight = first + second;
+
+  // Configure transfer config to trigger on UART peripheral TX buffer level
+  tx_xfer_cfg.IOSTREAM_LDMA_TFER_CFG_REQ_SEL = uart_context->dma.cfg.tx_peripheral_signal;
+  ecode = DMADRV_LdmaStartTransfer(uart_context->dma.tx_channel,
+                                   &tx_xfer_cfg,
+                                   &uart_context->dma.tx_desc[0],
+                                   tx_dma_irq_handler,
+                                   uart_context);
+  EFM_ASSERT(ecode == ECODE_OK);
+}
+
+/***************************************************************************//**
+ * Release the room used by the in-flight transfer once the (L)DMA is done with
+ * it, and chain the next transfer if more data was written in the meantime.
+ *
+ * @note Caller must be in an atomic section.
+ ******************************************************************************/
+static void __tx_complete(sl_iostream_uart_context_t *uart_context)
+{
+  Ecode_t ecode;
+  bool dma_done;
+  size_t tail;
+
+  if (uart_context->tx_in_flight == 0) {
+    return;
+  }
+
+  ecode = DMADRV_TransferDone(uart_context->dma.tx_channel, &dma_done);
+  EFM_ASSERT(ecode == ECODE_OK);
+  if (!dma_done) {
+    return;
+  }
+
+  tail = uart_context->tx_tail + uart_context->tx_in_flight;
+  if (tail >= uart_context->tx_buffer_len) {
+    tail -= uart_context->tx_buffer_len;
+  }
+  uart_context->tx_tail = tail;
+  uart_context->tx_count -= uart_context->tx_in_flight;
+  uart_context->tx_in_flight = 0;
+  uart_context->tx_stats.transfers++;
+
+  if (uart_context->tx_count > 0) {
+    __tx_start(uart_context);
+  }
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && !defined(SL_IOSTREAM_UART_FLUSH_TX_BUFFER)
+  else if (uart_context->tx_idle == false) {
+    // Drained, release the energy mode requirement on transmit complete
+    uart_context->tx_completed(uart_context, true);
+  }
+#endif
+}
+
+/***************************************************************************//**
+ * TX DMA channel interrupt handler.
+ ******************************************************************************/
+static bool tx_dma_irq_handler(unsigned int channel, unsigned int sequenceNo,
+                               void *userParam)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *) userParam;
+  CORE_DECLARE_IRQ_STATE;
+  (void) sequenceNo;
+  (void) channel;
+
+  CORE_ENTER_ATOMIC();
+  __tx_complete(uart_context);
+  CORE_EXIT_ATOMIC();
+
+  return false;
+}
+
 /***************************************************************************//**
  * Internal stream write implementation
  ******************************************************************************/
@@ -66,6 +66,8 @@ static void usart_tx_completed(void *context, bool enable);
 
 static sl_status_t usart_deinit(void *context);
 
+static DMADRV_PeripheralSignal_t usart_tx_dma_signal(USART_TypeDef *usart);
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -85,6 +87,13 @@ sl_status_t sl_iostream_usart_init(sl_iostream_uart_t *iostream_uart,
   bool rts = false;
 #endif
 
+  // The instance initialization only routes the RX (L)DMA. Route the TX one
+  // so that a TX buffer can be given to the stream.
+  if (uart_config->dma_cfg.dst == NULL) {
+    uart_config->dma_cfg.dst = (uint8_t *)&config->usart->TXDATA;
+    uart_config->dma_cfg.tx_peripheral_signal = usart_tx_dma_signal(config->usart);
+  }
+
   status = sli_iostream_uart_context_init(iostream_uart,
                                           &usart_context->context,
                                           uart_config,
@@ -280,6 +289,35 @@ static void usart_tx_completed(void *context, bool enable)
 }
 #endif
 
+/***************************************************************************//**
+ * (L)DMA signal raised when the USART TX buffer has room.
+ ******************************************************************************/
+static DMADRV_PeripheralSignal_t usart_tx_dma_signal(USART_TypeDef *usart)
+{
+#if defined(USART0)
+  if (usart == USART0) {
+    return dmadrvPeripheralSignal_USART0_TXBL;
+  }
+#endif
+#if defined(USART1)
+  if (usart == USART1) {
+    return dmadrvPeripheralSignal_USART1_TXBL;
+  }
+#endif
+#if defined(USART2)
+  if (usart == USART2) {
+    return dmadrvPeripheralSignal_USART2_TXBL;
+  }
+#endif
+#if defined(USART3)
+  if (usart == USART3) {
+    return dmadrvPeripheralSignal_USART3_TXBL;
+  }
+#endif
+  EFM_ASSERT(false);
+  return dmadrvPeripheralSignal_NONE;
+}
+
 /***************************************************************************//**
  * USART Stream De-init.
  ******************************************************************************/
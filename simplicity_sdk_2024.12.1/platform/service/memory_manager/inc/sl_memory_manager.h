@@ -244,6 +244,11 @@ extern "C" {
  *   - Delete a pool: sl_memory_delete_pool().
  *   - Get a block from the pool: sl_memory_pool_alloc().
  *   - Free a pool's block: sl_memory_pool_free().
+ *   - Get or free several blocks at once: sl_memory_pool_alloc_bulk() and
+ * sl_memory_pool_free_bulk().
+ *   - Cache blocks for a given execution context: sl_memory_pool_magazine_init(),
+ * sl_memory_pool_magazine_alloc(), sl_memory_pool_magazine_free() and
+ * sl_memory_pool_magazine_flush().
  *
  * Memory pools are convenient if you want to ensure a sort of guaranteed quotas
  * for some memory allocations situations. It is also more robust to unexpected
@@ -322,6 +327,34 @@ extern "C" {
  * }
  * @endcode
  *
+ * sl_memory_pool_alloc() and sl_memory_pool_free() enter a critical section for
+ * each block. Code handling bursts of blocks (e.g. RX descriptors or event
+ * records) can get or free N blocks with a single critical section by calling
+ * sl_memory_pool_alloc_bulk() and sl_memory_pool_free_bulk(). Freeing N blocks
+ * masks interrupts for a constant time, as the blocks are chained together
+ * before entering the critical section. Allocating N blocks masks interrupts
+ * for the time needed to walk N entries of the pool's free list.
+ *
+ * A magazine of type @ref sl_memory_pool_magazine_t "sl_memory_pool_magazine_t{}"
+ * is a small cache of free blocks taken from a pool. Each execution context
+ * (e.g. main loop, a given ISR or an RTOS task) owns its own magazine, so getting
+ * and freeing blocks from it requires no critical section. The magazine is
+ * refilled and emptied by half of its size (SL_MEMORY_POOL_MAGAZINE_SIZE) with
+ * the bulk functions. The blocks held by magazines are counted as used blocks
+ * of the pool. Call sl_memory_pool_magazine_flush() to give them back to the
+ * pool, e.g. before deleting the pool.
+ * @code{.c}
+ * sl_memory_pool_magazine_t rx_magazine;
+ * void *rx_descriptor;
+ *
+ * status = sl_memory_pool_magazine_init(&rx_magazine, &pool1_handle);
+ *
+ * // Only called from the RX ISR context.
+ * status = sl_memory_pool_magazine_alloc(&rx_magazine, &rx_descriptor);
+ * ...
+ * status = sl_memory_pool_magazine_free(&rx_magazine, rx_descriptor);
+ * @endcode
+ *
  * ### Dynamic Reservation
  *
  * The dynamic reservation is a special construct allowing to reserve a block
@@ -413,6 +446,15 @@ extern "C" {
  *   - You can reset the high heap usage watermark with
  * sl_memory_reset_heap_high_watermark().
  *
+ * If the configuration SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE is enabled, the
+ * allocations are also accounted per call site, i.e. per return address of the
+ * allocation function called by your code. For each site, the live size, the
+ * allocation and free counts and a histogram of the allocation sizes are kept
+ * in a fixed table. Read the table with sl_memory_get_site_stats() to find which
+ * code owns the heap after a long run, and clear the counters with
+ * sl_memory_reset_site_stats(). The return addresses can be resolved to function
+ * names with the application map file or with addr2line.
+ *
  * Besides a few functions each dedicated to a specific statistic, the function
  * sl_memory_get_heap_info() allows to get a general heap information structure
  * of type @ref sl_memory_heap_info_t "sl_memory_heap_info_t{}" with several heap
@@ -525,6 +567,10 @@ extern "C" {
 #define SL_MEMORY_BLOCK_ALIGN_256_BYTES   256U    ///< 256 bytes alignment.
 #define SL_MEMORY_BLOCK_ALIGN_512_BYTES   512U    ///< 512 bytes alignment.
 
+/// Number of size buckets in the allocation site histogram. Bucket n counts the
+/// allocations of up to (16 << n) bytes, the last bucket counts all larger ones.
+#define SL_MEMORY_SITE_HISTOGRAM_BUCKET_COUNT   8U
+
 // ----------------------------------------------------------------------------
 // DATA TYPES
 
@@ -548,12 +594,27 @@ typedef struct {
   size_t used_block_smallest_size;  ///< Smallest used block size (in bytes).
 } sl_memory_heap_info_t;
 
+/// @brief Allocation site statistics.
+typedef struct {
+  void *return_address;             ///< Return address of the allocation call site. NULL for the entry of the sites not fitting in the table.
+  size_t live_size;                 ///< Size (in bytes) of the blocks currently owned by the site.
+  size_t live_size_peak;            ///< Highest live size (in bytes) recorded.
+  uint32_t alloc_count;             ///< Number of allocations.
+  uint32_t free_count;              ///< Number of frees.
+  uint16_t size_histogram[SL_MEMORY_SITE_HISTOGRAM_BUCKET_COUNT]; ///< Number of allocations per size bucket, saturating at 0xFFFF.
+} sl_memory_site_stats_t;
+
 /// @brief Memory block reservation handle.
 typedef struct {
   void *block_address;                 ///< Reserved block base address.
   size_t block_size;                   ///< Reserved block size (in bytes).
 } sl_memory_reservation_t;
 
+/// Number of blocks a memory pool magazine can hold. Must be at least 2.
+#ifndef SL_MEMORY_POOL_MAGAZINE_SIZE
+#define SL_MEMORY_POOL_MAGAZINE_SIZE      8U
+#endif
+
 /// @brief Memory pool handle.
 typedef struct {
 #if defined(SL_MEMORY_POOL_POWER_AWARE)
@@ -566,6 +627,13 @@ typedef struct {
   size_t block_size;                    ///< Size of each block.
 } sl_memory_pool_t;
 
+/// @brief Memory pool magazine. Cache of free blocks owned by one execution context.
+typedef struct {
+  sl_memory_pool_t *pool_handle;              ///< Handle to the memory pool the blocks are taken from.
+  uint32_t block_count;                       ///< Number of blocks held by the magazine.
+  void *blocks[SL_MEMORY_POOL_MAGAZINE_SIZE]; ///< Blocks held by the magazine.
+} sl_memory_pool_magazine_t;
+
 // ----------------------------------------------------------------------------
 // PROTOTYPES
 
@@ -866,6 +934,99 @@ sl_status_t sl_memory_pool_alloc(sl_memory_pool_t *pool_handle,
 sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
                                 void *block);
 
+/***************************************************************************//**
+ * Allocates several blocks from a memory pool in a single critical section.
+ *
+ * @param[in]  pool_handle      Handle to the memory pool.
+ * @param[out] blocks           Array that will receive the addresses of the
+ *                              allocated blocks.
+ * @param[in]  block_count      Number of blocks requested.
+ * @param[out] allocated_count  Pointer to a variable that will receive the
+ *                              number of blocks allocated.
+ *
+ * @return  SL_STATUS_OK if all the blocks requested were allocated.
+ *          SL_STATUS_EMPTY if the pool ran out of blocks. The blocks allocated
+ *          before are returned in 'blocks' and 'allocated_count'.
+ *          Error code otherwise.
+ *
+ * @note  Interrupts are masked for the time needed to walk 'block_count'
+ *        entries of the pool's free list.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_alloc_bulk(sl_memory_pool_t *pool_handle,
+                                      void **blocks,
+                                      uint32_t block_count,
+                                      uint32_t *allocated_count);
+
+/***************************************************************************//**
+ * Frees several blocks to a memory pool in a single critical section.
+ *
+ * @param[in] pool_handle  Handle to the memory pool.
+ * @param[in] blocks       Array of the addresses of the blocks to free.
+ * @param[in] block_count  Number of blocks to free.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  The blocks are chained together before entering the critical section,
+ *        so interrupts are masked for a constant time.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_free_bulk(sl_memory_pool_t *pool_handle,
+                                     void * const *blocks,
+                                     uint32_t block_count);
+
+/***************************************************************************//**
+ * Initializes an empty memory pool magazine.
+ *
+ * @param[out] magazine     Pointer to the magazine.
+ * @param[in]  pool_handle  Handle to the memory pool the blocks are taken from.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  A magazine must only be used from a single execution context. Its
+ *        functions do not protect it against preemption.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_init(sl_memory_pool_magazine_t *magazine,
+                                         sl_memory_pool_t *pool_handle);
+
+/***************************************************************************//**
+ * Allocates a block from a memory pool magazine.
+ *
+ * @param[in]  magazine  Pointer to the magazine.
+ * @param[out] block     Pointer to a variable that will receive the address
+ *                       of the allocated block. NULL in case of error
+ *                       condition.
+ *
+ * @return  SL_STATUS_OK if successful.
+ *          SL_STATUS_EMPTY if both the magazine and the pool are empty.
+ *          Error code otherwise.
+ *
+ * @note  An empty magazine is refilled from the pool with half of its size.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_alloc(sl_memory_pool_magazine_t *magazine,
+                                          void **block);
+
+/***************************************************************************//**
+ * Frees a block to a memory pool magazine.
+ *
+ * @param[in] magazine  Pointer to the magazine.
+ * @param[in] block     Pointer to the block to free. It must belong to the pool
+ *                      of the magazine.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  Half of the blocks of a full magazine are given back to the pool.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_free(sl_memory_pool_magazine_t *magazine,
+                                         void *block);
+
+/***************************************************************************//**
+ * Gives all the blocks of a memory pool magazine back to the pool.
+ *
+ * @param[in] magazine  Pointer to the magazine.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_flush(sl_memory_pool_magazine_t *magazine);
+
 /***************************************************************************//**
  * Dynamically allocates a memory pool handle.
  *
@@ -962,6 +1123,34 @@ size_t sl_memory_get_heap_high_watermark(void);
  ******************************************************************************/
 void sl_memory_reset_heap_high_watermark(void);
 
+/***************************************************************************//**
+ * Gets the statistics of an allocation site.
+ *
+ * @param[in]  site_index  Index of the site in the site table. Index 0 accounts
+ *                         for the sites not fitting in the table.
+ * @param[out] stats       Pointer to site statistics structure to fill.
+ *
+ * @return  SL_STATUS_OK if successful.
+ *          SL_STATUS_EMPTY if the site table entry is unused.
+ *          SL_STATUS_INVALID_INDEX if site_index is out of the site table.
+ *          SL_STATUS_NOT_AVAILABLE if the allocation site profiler is disabled.
+ *          Error code otherwise.
+ *
+ * @note  Iterate over the site table by incrementing site_index from 0 until
+ *        SL_STATUS_INVALID_INDEX is returned.
+ ******************************************************************************/
+sl_status_t sl_memory_get_site_stats(uint32_t site_index,
+                                     sl_memory_site_stats_t *stats);
+
+/***************************************************************************//**
+ * Resets the allocation site statistics.
+ *
+ * @note  Counters, histograms and peaks are cleared. The live sizes are kept as
+ *        the blocks are still allocated. Sites not owning any block anymore are
+ *        released.
+ ******************************************************************************/
+void sl_memory_reset_site_stats(void);
+
 /** @} (end addtogroup memory_manager) */
 
 #ifdef __cplusplus
@@ -86,6 +86,10 @@ static size_t heap_high_watermark;
 #if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
 bool reserve_no_retention_first = true;
 #endif
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+// Allocation site table. Entry 0 accounts for the sites not fitting in the table.
+static sl_memory_site_stats_t site_table[SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT];
+#endif
 
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
@@ -94,6 +98,24 @@ bool reserve_no_retention_first = true;
 static sli_block_metadata_t *memory_manage_data_alignment(sli_block_metadata_t *current_block_metadata,
                                                           size_t block_align);
 
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+static uint32_t memory_site_get_bucket(size_t size);
+
+static uint16_t memory_site_get_index(void *return_address);
+
+static void memory_site_track_alloc(sli_block_metadata_t *block,
+                                    void *return_address);
+
+static void memory_site_track_free(sli_block_metadata_t *block);
+
+static void memory_site_track_resize(sli_block_metadata_t *block,
+                                     size_t old_size);
+#else
+#define memory_site_track_alloc(block, return_address)   ((void)0)
+#define memory_site_track_free(block)                    ((void)0)
+#define memory_site_track_resize(block, old_size)        ((void)(old_size))
+#endif
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -121,6 +143,13 @@ sl_status_t sl_memory_init(void)
   sli_free_lt_list_head->length = (uint16_t)SLI_BLOCK_LEN_BYTE_TO_DWORD(heap_region.size - SLI_BLOCK_METADATA_SIZE_BYTE);
   sli_free_blocks_number++;
 
+  sli_memory_tlsf_init();
+  sli_memory_tlsf_insert_free_block(sli_free_lt_list_head);
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+  memset(site_table, 0, sizeof(site_table));
+#endif
+
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   // Create the pool tracker for the physical RAM
   sli_memory_profiler_create_pool_tracker(sli_mm_ram_name,
@@ -227,6 +256,8 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
   block_size_remaining = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_free_st_list_head->length);
   // Verify there is enough space in heap.
   if (block_size_remaining >= size_real) {
+    sli_memory_tlsf_remove_free_block(sli_free_st_list_head);
+
     // Get aligned block: get address from end of available heap minus the requested size. Round down this address.
     *block = (void *)(((uint64_t *)sli_free_st_list_head + (sli_free_st_list_head->length + SLI_BLOCK_METADATA_SIZE_DWORD)) - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real));
     *block = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)*block), block_align);
@@ -240,6 +271,7 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
       CORE_EXIT_ATOMIC();
       return SL_STATUS_ALLOCATION_FAILED;
     }
+    sli_memory_tlsf_insert_free_block(sli_free_st_list_head);
 
     status = SL_STATUS_OK;
   } else {
@@ -266,8 +298,8 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
  ******************************************************************************/
 void *sl_malloc(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *block_avail = NULL;
 
@@ -276,6 +308,7 @@ void *sl_malloc(size_t size)
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(block_avail, return_address);
 
   return block_avail;
 }
@@ -287,8 +320,8 @@ sl_status_t sl_memory_alloc(size_t size,
                             sl_memory_block_type_t type,
                             void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   sl_status_t status;
 
@@ -297,6 +330,7 @@ sl_status_t sl_memory_alloc(size_t size,
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(*block, return_address);
 
   return status;
 }
@@ -316,8 +350,8 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
                                      sl_memory_block_type_t type,
                                      void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
 
   // Check proper alignment characteristics.
@@ -374,6 +408,7 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
 
   // Prepare found block.
   allocated_blk = current_block_metadata;
+  sli_memory_tlsf_remove_free_block(current_block_metadata);
 
   // Update counter of free blocks.
   sli_free_blocks_number--;
@@ -417,6 +452,7 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
 
       // Update head pointers. See Note #1.
       sli_update_free_list_heads(new_free_blk, old_block_metadata, false);
+      sli_memory_tlsf_insert_free_block(new_free_blk);
     } else {
       // Create a new block = allocated block returned to requester. This new block is the nearest to the heap end.
       allocated_blk = (sli_block_metadata_t *)((uint8_t *)current_block_metadata + block_size_remaining);
@@ -440,6 +476,7 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
       new_free_blk->length = (uint16_t)SLI_BLOCK_LEN_BYTE_TO_DWORD(block_size_remaining - SLI_BLOCK_METADATA_SIZE_BYTE);
       new_free_blk->offset_neighbour_next = allocated_blk->offset_neighbour_prev;
       // new_free_blk->offset_neighbour_prev doesn't change. It points to the right previous block.
+      sli_memory_tlsf_insert_free_block(new_free_blk);
 
       // Data payload alignment for short-term is managed during the first-fit algorithm loop
       // at the beginning of this function.
@@ -473,6 +510,8 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
     sli_update_free_list_heads(allocated_blk, old_block_metadata, true);
   }
 
+  memory_site_track_alloc(allocated_blk, return_address);
+
   heap_used_size += size_adjusted;
   if (heap_used_size > heap_high_watermark) {
     heap_high_watermark = heap_used_size;
@@ -554,6 +593,7 @@ sl_status_t sl_memory_free(void *block)
   sli_block_metadata_t *next_block = NULL;
 
   heap_used_size -= SLI_BLOCK_LEN_DWORD_TO_BYTE(current_metadata->length);
+  memory_site_track_free(current_metadata);
 
   // Update counter with block being freed.
   sli_free_blocks_number++;
@@ -569,6 +609,7 @@ sl_status_t sl_memory_free(void *block)
         && (reservations_size_prev <= SLI_BLOCK_METADATA_SIZE_DWORD)) {
       // Merge current block to free with previous adjacent block.
       free_block = metadata_prev_blk;
+      sli_memory_tlsf_remove_free_block(metadata_prev_blk);
       total_size_free_block += metadata_prev_blk->length + SLI_BLOCK_METADATA_SIZE_DWORD;
 
       // 2 free blocks have been merged, account for 1 free block only.
@@ -595,6 +636,7 @@ sl_status_t sl_memory_free(void *block)
     if ((!next_block->block_in_use) && (reservations_size_next <= SLI_BLOCK_METADATA_SIZE_DWORD)) {
       // Merge block with next adjacent block.
       total_size_free_block += next_block->length + SLI_BLOCK_METADATA_SIZE_DWORD;
+      sli_memory_tlsf_remove_free_block(next_block);
       // Invalidate the next block metadata.
       next_block->length = 0;
       // Get the "next" block adjacent to the invalidated next block.
@@ -619,6 +661,7 @@ sl_status_t sl_memory_free(void *block)
   } else {
     free_block->offset_neighbour_next = 0;  // Next block is the heap end.
   } // free_block->offset_neighbour_prev does not change.
+  sli_memory_tlsf_insert_free_block(free_block);
 
   // Update free list heads. See Note #2.
   if (sli_free_lt_list_head == NULL             // LT list is empty. Freed block becomes the new 1st element.
@@ -652,8 +695,8 @@ sl_status_t sl_memory_free(void *block)
 void *sl_calloc(size_t item_count,
                 size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *block_avail = NULL;
 
@@ -662,6 +705,7 @@ void *sl_calloc(size_t item_count,
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(block_avail, return_address);
 
   return block_avail;
 }
@@ -674,8 +718,8 @@ sl_status_t sl_memory_calloc(size_t item_count,
                              sl_memory_block_type_t type,
                              void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   size_t block_size;
   sl_status_t status = SL_STATUS_OK;
@@ -705,6 +749,7 @@ sl_status_t sl_memory_calloc(size_t item_count,
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(*block, return_address);
 
   return status;
 }
@@ -715,8 +760,8 @@ sl_status_t sl_memory_calloc(size_t item_count,
 void *sl_realloc(void *ptr,
                  size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *block_avail = NULL;
 
@@ -729,6 +774,7 @@ void *sl_realloc(void *ptr,
     sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
   }
 #endif
+  sli_memory_site_profiler_track_ownership(block_avail, return_address);
 
   return block_avail;
 }
@@ -751,8 +797,8 @@ sl_status_t sl_memory_realloc(void *ptr,
                               size_t size,
                               void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   sl_memory_region_t heap_region = sl_memory_get_heap_region();
   sl_status_t status = SL_STATUS_OK;
@@ -783,6 +829,7 @@ sl_status_t sl_memory_realloc(void *ptr,
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
     sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
 #endif
+    sli_memory_site_profiler_track_ownership(*block, return_address);
     return status;
   } else if (size == 0) {
     status = sl_memory_free(ptr);
@@ -809,6 +856,8 @@ sl_status_t sl_memory_realloc(void *ptr,
 
       // Verify if next block is free & has room to extend the current block.
       if ((next_block->block_in_use == 0) && (next_block_len_remaining >= 0)) {
+        sli_memory_tlsf_remove_free_block(next_block);
+
         if (next_block_len_remaining >= SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE) {
           // Enough space left in next block to leave a smaller free block.
 
@@ -837,6 +886,7 @@ sl_status_t sl_memory_realloc(void *ptr,
           sli_update_free_list_heads(adjusted_next_block, next_block, false);
           // Ensure old next block metadata is invalid.
           sli_memory_metadata_init(next_block);
+          sli_memory_tlsf_insert_free_block(adjusted_next_block);
         } else {
           // Not enough space in next block, simply append all next block to current one.
           sli_free_blocks_number--;
@@ -904,6 +954,7 @@ sl_status_t sl_memory_realloc(void *ptr,
     }
 
     if (find_new_block == false) {
+      memory_site_track_resize(current_block, current_block_len);
       heap_used_size += size_real - current_block_len;
       if (heap_used_size > heap_high_watermark) {
         heap_high_watermark = heap_used_size;
@@ -920,6 +971,8 @@ sl_status_t sl_memory_realloc(void *ptr,
 
       // Verify if next block is free to merge the newly unallocated portion of the current block.
       if (next_block->block_in_use == 0) {
+        sli_memory_tlsf_remove_free_block(next_block);
+
         // Compute adjusted adjacent free block location.
         sli_block_metadata_t *adjusted_next_block = (sli_block_metadata_t *)((uint8_t *)current_block + SLI_BLOCK_METADATA_SIZE_BYTE + size_real);
 
@@ -943,6 +996,7 @@ sl_status_t sl_memory_realloc(void *ptr,
 
         // Ensure old next block metadata is invalid.
         sli_memory_metadata_init(next_block);
+        sli_memory_tlsf_insert_free_block(adjusted_next_block);
       } else {
         // Next block is in use and cannot be merged with the newly unallocated portion.
         create_new_block = true;
@@ -974,6 +1028,7 @@ sl_status_t sl_memory_realloc(void *ptr,
         sli_free_blocks_number++;
         // Update head pointers accordingly.
         sli_update_free_list_heads(adjusted_next_block, NULL, false);
+        sli_memory_tlsf_insert_free_block(adjusted_next_block);
       } else {
         // Not enough space in current block remaining area to create a new free block.
         // consider the current block unallocated portion as lost for now until the current block is freed.
@@ -990,6 +1045,7 @@ sl_status_t sl_memory_realloc(void *ptr,
                                       size_real + SLI_BLOCK_METADATA_SIZE_BYTE);
 #endif
 
+    memory_site_track_resize(current_block, current_block_len);
     heap_used_size -= current_block_len - size_real;
   } else {
     // If the size requested does not provoke a block extension or reduction, consider no error.
@@ -1008,6 +1064,7 @@ sl_status_t sl_memory_realloc(void *ptr,
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(*block, return_address);
 
   return status;
 }
@@ -1140,6 +1197,111 @@ void sl_memory_reset_heap_high_watermark(void)
   CORE_EXIT_ATOMIC();
 }
 
+/***************************************************************************//**
+ * Gets the statistics of an allocation site.
+ ******************************************************************************/
+sl_status_t sl_memory_get_site_stats(uint32_t site_index,
+                                     sl_memory_site_stats_t *stats)
+{
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+  sl_status_t status = SL_STATUS_OK;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (site_index >= SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT) {
+    return SL_STATUS_INVALID_INDEX;
+  }
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  // The overflow entry is only reported once it has accounted for an allocation.
+  if ((site_index == 0u) ? (site_table[0].alloc_count == 0u && site_table[0].live_size == 0u)
+      : (site_table[site_index].return_address == NULL)) {
+    status = SL_STATUS_EMPTY;
+  } else {
+    *stats = site_table[site_index];
+  }
+  CORE_EXIT_ATOMIC();
+
+  return status;
+#else
+  (void)site_index;
+  (void)stats;
+
+  return SL_STATUS_NOT_AVAILABLE;
+#endif
+}
+
+/***************************************************************************//**
+ * Resets the allocation site statistics.
+ ******************************************************************************/
+void sl_memory_reset_site_stats(void)
+{
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  for (uint32_t i = 0u; i < SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT; i++) {
+    sl_memory_site_stats_t *site = &site_table[i];
+
+    site->alloc_count = 0u;
+    site->free_count = 0u;
+    site->live_size_peak = site->live_size;
+    memset(site->size_histogram, 0, sizeof(site->size_histogram));
+    if (site->live_size == 0u) {
+      site->return_address = NULL;
+    }
+  }
+  CORE_EXIT_ATOMIC();
+#endif
+}
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+/***************************************************************************//**
+ * Transfers the ownership of an allocated block to another allocation site.
+ ******************************************************************************/
+void sli_memory_site_profiler_track_ownership(void *ptr,
+                                              void *return_address)
+{
+  if (ptr == NULL) {
+    return;
+  }
+
+  sli_block_metadata_t *block = (sli_block_metadata_t *)((uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE);
+  size_t size = SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  uint16_t old_site_index = block->site_index;
+  sl_memory_site_stats_t *old_site = &site_table[old_site_index];
+
+  if (return_address == old_site->return_address) {
+    CORE_EXIT_ATOMIC();
+    return;
+  }
+
+  // Withdraw the allocation from the current owner. Its counters may have been reset meanwhile.
+  uint16_t *bucket = &old_site->size_histogram[memory_site_get_bucket(size)];
+
+  old_site->live_size -= size;
+  if (old_site->alloc_count > 0u) {
+    old_site->alloc_count--;
+  }
+  if (*bucket > 0u) {
+    (*bucket)--;
+  }
+  // Release the site of an allocation wrapper once all its blocks are given to their callers.
+  if ((old_site_index != 0u) && (old_site->live_size == 0u)
+      && (old_site->alloc_count == 0u) && (old_site->free_count == 0u)) {
+    old_site->return_address = NULL;
+  }
+
+  memory_site_track_alloc(block, return_address);
+  CORE_EXIT_ATOMIC();
+}
+#endif
+
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -1180,7 +1342,18 @@ static sli_block_metadata_t *memory_manage_data_alignment(sli_block_metadata_t *
     // Merge lost space because of the alignment into the previous block. It helps to keep
     // all computations in malloc()/free() valid. For ST split block, the lost space is back into
     // a free block space.
-    prev_block->length += align_offset;
+    if (prev_block->block_in_use == 0) {
+      // Free block changes size class.
+      sli_memory_tlsf_remove_free_block(prev_block);
+      prev_block->length += align_offset;
+      sli_memory_tlsf_insert_free_block(prev_block);
+    } else {
+      size_t prev_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(prev_block->length);
+
+      // The allocated block owns the lost space until it is freed.
+      prev_block->length += align_offset;
+      memory_site_track_resize(prev_block, prev_block_len);
+    }
   } else {
     // Special case where the block data payload being aligned is at the heap start. A special flag in the block metadata
     // is used to identify this special block in sl_memory_free() and accordingly perform the merge with previous adjacent block.
@@ -1196,5 +1369,131 @@ static sli_block_metadata_t *memory_manage_data_alignment(sli_block_metadata_t *
     current_block_metadata->offset_neighbour_next = 0;
   }
 
+  if (current_block_metadata->heap_start_align) {
+    // Keep the lost zone at heap start walkable from the heap start. It is seen as an in-use block
+    // ending at the aligned block, so it is never allocated before being merged back by sl_memory_free().
+    old_block_metadata->block_in_use = 1;
+    old_block_metadata->length = align_offset - SLI_BLOCK_METADATA_SIZE_DWORD;
+    old_block_metadata->offset_neighbour_next = align_offset;
+  }
+
   return current_block_metadata;
 }
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+/***************************************************************************//**
+ * Gets the size histogram bucket of an allocation.
+ *
+ * @param[in]  size  Allocated block size, in bytes.
+ *
+ * @return     Index of the bucket counting the allocation.
+ ******************************************************************************/
+static uint32_t memory_site_get_bucket(size_t size)
+{
+  uint32_t bucket = 0u;
+
+  while ((bucket < (SL_MEMORY_SITE_HISTOGRAM_BUCKET_COUNT - 1u)) && (size > (16u << bucket))) {
+    bucket++;
+  }
+
+  return bucket;
+}
+
+/***************************************************************************//**
+ * Gets the site table entry of an allocation site, creating it if needed.
+ *
+ * @param[in]  return_address  Return address of the allocation call site.
+ *
+ * @return     Index of the site in the site table. 0 if the table is full.
+ *
+ * @note  Must be called in an atomic section.
+ ******************************************************************************/
+static uint16_t memory_site_get_index(void *return_address)
+{
+  uint16_t free_index = 0u;
+
+  if (return_address == NULL) {
+    return 0u;
+  }
+
+  for (uint16_t i = 1u; i < SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT; i++) {
+    if (site_table[i].return_address == return_address) {
+      return i;
+    }
+    if ((free_index == 0u) && (site_table[i].return_address == NULL)) {
+      free_index = i;
+    }
+  }
+
+  if (free_index != 0u) {
+    memset(&site_table[free_index], 0, sizeof(site_table[free_index]));
+    site_table[free_index].return_address = return_address;
+  }
+
+  return free_index;
+}
+
+/***************************************************************************//**
+ * Accounts an allocated block to an allocation site.
+ *
+ * @param[in]  block           Pointer to allocated block metadata.
+ *
+ * @param[in]  return_address  Return address of the allocation call site.
+ *
+ * @note  Must be called in an atomic section.
+ ******************************************************************************/
+static void memory_site_track_alloc(sli_block_metadata_t *block,
+                                    void *return_address)
+{
+  uint16_t site_index = memory_site_get_index(return_address);
+  sl_memory_site_stats_t *site = &site_table[site_index];
+  size_t size = SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+  uint16_t *bucket = &site->size_histogram[memory_site_get_bucket(size)];
+
+  block->site_index = site_index;
+  site->live_size += size;
+  if (site->live_size > site->live_size_peak) {
+    site->live_size_peak = site->live_size;
+  }
+  site->alloc_count++;
+  if (*bucket < UINT16_MAX) {
+    (*bucket)++;
+  }
+}
+
+/***************************************************************************//**
+ * Withdraws a block being freed from its allocation site.
+ *
+ * @param[in]  block  Pointer to block metadata, before any merge.
+ *
+ * @note  Must be called in an atomic section.
+ ******************************************************************************/
+static void memory_site_track_free(sli_block_metadata_t *block)
+{
+  sl_memory_site_stats_t *site = &site_table[block->site_index];
+
+  site->live_size -= SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+  site->free_count++;
+}
+
+/***************************************************************************//**
+ * Updates the live size of an allocation site after an allocated block is
+ * resized in place, by a reallocation or by an alignment lost space merge.
+ *
+ * @param[in]  block     Pointer to reallocated block metadata.
+ *
+ * @param[in]  old_size  Block size before the reallocation, in bytes.
+ *
+ * @note  Must be called in an atomic section.
+ ******************************************************************************/
+static void memory_site_track_resize(sli_block_metadata_t *block,
+                                     size_t old_size)
+{
+  sl_memory_site_stats_t *site = &site_table[block->site_index];
+
+  site->live_size = site->live_size - old_size + SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+  if (site->live_size > site->live_size_peak) {
+    site->live_size_peak = site->live_size;
+  }
+}
+#endif
@@ -125,11 +125,13 @@ sl_status_t sl_memory_reserve_block(size_t size,
   reserved_blk = (sli_block_metadata_t *)((uint8_t *)free_block_metadata + block_size_remaining);
 
   sli_free_blocks_number--;
+  sli_memory_tlsf_remove_free_block(free_block_metadata);
 
   // Split free and reserved blocks if possible.
   if (block_size_remaining >= SLI_BLOCK_RESERVATION_MIN_SIZE_BYTE) {
     // Changes size of free block.
     free_block_metadata->length -= SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real);
+    sli_memory_tlsf_insert_free_block(free_block_metadata);
 
     // Account for the split block that is free.
     sli_free_blocks_number++;
@@ -251,6 +253,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     if ((prev_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's previous block is free, so merge both free blocks.
       new_free_block = prev_block;
+      sli_memory_tlsf_remove_free_block(prev_block);
       prev_block = (sli_block_metadata_t *)((uint64_t *)prev_block - prev_block->offset_neighbour_prev);
       new_free_block_length += new_free_block->length + SLI_BLOCK_METADATA_SIZE_DWORD;
     } else {
@@ -271,6 +274,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     if ((next_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's following block is free, so merge both free blocks.
       new_free_block_length += next_block->length + reserved_block_offset + SLI_BLOCK_METADATA_SIZE_DWORD;
+      sli_memory_tlsf_remove_free_block(next_block);
       // Invalidate the next block metadata.
       next_block->length = 0;
       // 2 free blocks have been merged, account for 1 free block only.
@@ -304,6 +308,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     // Heap start.
     new_free_block->offset_neighbour_prev = 0;
   }
+  sli_memory_tlsf_insert_free_block(new_free_block);
 
   if (sli_free_lt_list_head == NULL             // LT list is empty. Freed block becomes the new 1st element.
       || sli_free_lt_list_head > new_free_block // LT list not empty. Verify if freed block becomes the head.
@@ -45,6 +45,20 @@
 #define SLI_MEM_POOL_OUT_OF_MEMORY     0xFFFFFFFF
 #define SLI_MEM_POOL_REQUIRED_PADDING(obj_size) (((sizeof(size_t) - ((obj_size) % sizeof(size_t))) % sizeof(size_t)))
 
+// Validate that the provided address is in the pool payload range.
+#define SLI_MEM_POOL_ASSERT_BLOCK(pool_handle, block)                          \
+  EFM_ASSERT(((void *)(block) >= (pool_handle)->block_address)                 \
+             && ((size_t)(block) <= ((size_t)(pool_handle)->block_address      \
+                                     + ((pool_handle)->block_size * (pool_handle)->block_count))))
+
+// Number of blocks moved between a magazine and its pool when the magazine is
+// refilled or emptied.
+#define SLI_MEM_POOL_MAGAZINE_BATCH_COUNT   (SL_MEMORY_POOL_MAGAZINE_SIZE / 2U)
+
+#if (SL_MEMORY_POOL_MAGAZINE_SIZE < 2U)
+#error "SL_MEMORY_POOL_MAGAZINE_SIZE must be at least 2."
+#endif
+
 /***************************************************************************//**
  * Creates a memory pool.
  ******************************************************************************/
@@ -194,9 +208,7 @@ sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
     return SL_STATUS_NULL_POINTER;
   }
 
-  // Validate that the provided address is in the pool payload range.
-  EFM_ASSERT((block >= pool_handle->block_address) \
-             && ((size_t)block <= ((size_t)pool_handle->block_address + (pool_handle->block_size * pool_handle->block_count))));
+  SLI_MEM_POOL_ASSERT_BLOCK(pool_handle, block);
 
 #if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
   sli_memory_profiler_track_free(pool_handle, block);
@@ -213,6 +225,222 @@ sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * Allocates several blocks from a memory pool in a single critical section.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_alloc_bulk(sl_memory_pool_t *pool_handle,
+                                      void **blocks,
+                                      uint32_t block_count,
+                                      uint32_t *allocated_count)
+{
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  void * volatile return_address = sli_memory_profiler_get_return_address();
+#endif
+  CORE_DECLARE_IRQ_STATE;
+  size_t block_addr;
+  size_t first_block_addr;
+  uint32_t count = 0;
+
+  if ((pool_handle == NULL) || (blocks == NULL) || (allocated_count == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  *allocated_count = 0;
+
+  if (block_count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // Detach the first blocks of the free list. Only the list links are read with interrupts masked.
+  first_block_addr = (size_t)pool_handle->block_free;
+  block_addr = first_block_addr;
+  while ((count < block_count) && (block_addr != SLI_MEM_POOL_OUT_OF_MEMORY)) {
+    block_addr = *(size_t *)block_addr;
+    count++;
+  }
+  pool_handle->block_free = (uint32_t *)block_addr;
+
+  CORE_EXIT_ATOMIC();
+
+  // The detached blocks are owned by the caller. Their links can be followed with interrupts enabled.
+  block_addr = first_block_addr;
+  for (uint32_t i = 0; i < count; i++) {
+    blocks[i] = (void *)block_addr;
+    block_addr = *(size_t *)block_addr;
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+    sli_memory_profiler_track_alloc_with_ownership(pool_handle, blocks[i], pool_handle->block_size, return_address);
+#endif
+  }
+
+  *allocated_count = count;
+
+  if (count < block_count) {
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+    sli_memory_profiler_track_alloc_with_ownership(pool_handle, NULL, pool_handle->block_size, return_address);
+#endif
+    return SL_STATUS_EMPTY;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Frees several blocks to a memory pool in a single critical section.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_free_bulk(sl_memory_pool_t *pool_handle,
+                                     void * const *blocks,
+                                     uint32_t block_count)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((pool_handle == NULL) || (blocks == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  for (uint32_t i = 0; i < block_count; i++) {
+    if (blocks[i] == NULL) {
+      return SL_STATUS_NULL_POINTER;
+    }
+    SLI_MEM_POOL_ASSERT_BLOCK(pool_handle, blocks[i]);
+  }
+
+  if (block_count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  // Chain the blocks together while they are still owned by the caller.
+  for (uint32_t i = 0; i < block_count; i++) {
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+    sli_memory_profiler_track_free(pool_handle, blocks[i]);
+#endif
+    if (i < (block_count - 1)) {
+      *(size_t *)blocks[i] = (size_t)blocks[i + 1];
+    }
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // Put the whole chain at the head of the free list.
+  *(size_t *)blocks[block_count - 1] = (size_t)pool_handle->block_free;
+  pool_handle->block_free = blocks[0];
+
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Initializes an empty memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_init(sl_memory_pool_magazine_t *magazine,
+                                         sl_memory_pool_t *pool_handle)
+{
+  if ((magazine == NULL) || (pool_handle == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  magazine->pool_handle = pool_handle;
+  magazine->block_count = 0;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Allocates a block from a memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_alloc(sl_memory_pool_magazine_t *magazine,
+                                          void **block)
+{
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  void * volatile return_address = sli_memory_profiler_get_return_address();
+#endif
+  sl_status_t status;
+
+  if ((magazine == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // No block allocated yet.
+  *block = NULL;
+
+  if (magazine->block_count == 0) {
+    status = sl_memory_pool_alloc_bulk(magazine->pool_handle,
+                                       magazine->blocks,
+                                       SLI_MEM_POOL_MAGAZINE_BATCH_COUNT,
+                                       &magazine->block_count);
+    if (magazine->block_count == 0) {
+      return status;
+    }
+  }
+
+  // Most recently freed blocks are given first, as they are the most likely to be in cache.
+  magazine->block_count--;
+  *block = magazine->blocks[magazine->block_count];
+
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+#endif
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Frees a block to a memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_free(sl_memory_pool_magazine_t *magazine,
+                                         void *block)
+{
+  sl_status_t status;
+
+  if ((magazine == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  SLI_MEM_POOL_ASSERT_BLOCK(magazine->pool_handle, block);
+
+  if (magazine->block_count == SL_MEMORY_POOL_MAGAZINE_SIZE) {
+    // Give the oldest blocks back to the pool and keep the most recent ones.
+    status = sl_memory_pool_free_bulk(magazine->pool_handle,
+                                      magazine->blocks,
+                                      SLI_MEM_POOL_MAGAZINE_BATCH_COUNT);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    magazine->block_count -= SLI_MEM_POOL_MAGAZINE_BATCH_COUNT;
+    memmove(&magazine->blocks[0],
+            &magazine->blocks[SLI_MEM_POOL_MAGAZINE_BATCH_COUNT],
+            magazine->block_count * sizeof(magazine->blocks[0]));
+  }
+
+  magazine->blocks[magazine->block_count] = block;
+  magazine->block_count++;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Gives all the blocks of a memory pool magazine back to the pool.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_flush(sl_memory_pool_magazine_t *magazine)
+{
+  sl_status_t status;
+
+  if (magazine == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  status = sl_memory_pool_free_bulk(magazine->pool_handle,
+                                    magazine->blocks,
+                                    magazine->block_count);
+  if (status == SL_STATUS_OK) {
+    magazine->block_count = 0;
+  }
+
+  return status;
+}
+
 /***************************************************************************//**
  * Gets the count of free blocks in a memory pool.
  ******************************************************************************/
@@ -28,7 +28,9 @@
  *
  ******************************************************************************/
 
+#include "sl_memory_manager_config.h"
 #include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
@@ -153,8 +155,8 @@ volatile uint32_t retarget_realloc_counter = 0;
 ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
                                           size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   VOID_RARG;
   void *ptr;
@@ -169,6 +171,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
@@ -176,8 +179,8 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
 #if defined(__IAR_SYSTEMS_ICC__) && (__VER__ == 9040001)
 void *STD_LIB_WRAPPER_MALLOC_ADVANCED(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *ptr;
 
@@ -188,14 +191,15 @@ void *STD_LIB_WRAPPER_MALLOC_ADVANCED(size_t size)
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
 
 void *STD_LIB_WRAPPER_MALLOC_NO_FREE(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *ptr;
 
@@ -206,6 +210,7 @@ void *STD_LIB_WRAPPER_MALLOC_NO_FREE(size_t size)
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
@@ -251,8 +256,8 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
                                           size_t item_count,
                                           size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   VOID_RARG;
   void *ptr;
@@ -267,6 +272,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
@@ -275,8 +281,8 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
 void *STD_LIB_WRAPPER_CALLOC_ADVANCED(size_t item_count,
                                       size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *ptr;
 
@@ -287,6 +293,7 @@ void *STD_LIB_WRAPPER_CALLOC_ADVANCED(size_t item_count,
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
@@ -294,8 +301,8 @@ void *STD_LIB_WRAPPER_CALLOC_ADVANCED(size_t item_count,
 void *STD_LIB_WRAPPER_CALLOC_NO_FREE(size_t item_count,
                                      size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *ptr;
 
@@ -306,6 +313,7 @@ void *STD_LIB_WRAPPER_CALLOC_NO_FREE(size_t item_count,
                                       ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(ptr, return_address);
 
   return ptr;
 }
@@ -336,8 +344,8 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
                                            void *ptr,
                                            size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   VOID_RARG;
   void *r_ptr;
@@ -352,6 +360,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
                                       r_ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(r_ptr, return_address);
 
   return r_ptr;
 }
@@ -360,8 +369,8 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
 void *STD_LIB_WRAPPER_REALLOC_ADVANCED(void *ptr,
                                        size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
-  void * volatile return_address = sli_memory_profiler_get_return_address();
+#if defined(SLI_MEMORY_MANAGER_TRACK_CALLER)
+  void * volatile return_address = SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS();
 #endif
   void *r_ptr;
 
@@ -372,6 +381,7 @@ void *STD_LIB_WRAPPER_REALLOC_ADVANCED(void *ptr,
                                       r_ptr,
                                       return_address);
 #endif
+  sli_memory_site_profiler_track_ownership(r_ptr, return_address);
 
   return r_ptr;
 }
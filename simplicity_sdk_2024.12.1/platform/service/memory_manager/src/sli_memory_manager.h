@@ -91,6 +91,70 @@ extern "C" {
 #define SLI_MAX_RESERVATION_COUNT 32
 #endif
 
+// Segregated-fit (TLSF) free block lookup. Disabled by default.
+#ifndef SL_MEMORY_MANAGER_TLSF_ENABLE
+#define SL_MEMORY_MANAGER_TLSF_ENABLE   0
+#endif
+
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+// Number of second-level size classes per power of two, as log2. With 8
+// classes, the memory lost to the class rounding is at most 1/8 of a block.
+#define SLI_TLSF_SL_INDEX_COUNT_LOG2    3u
+#define SLI_TLSF_SL_INDEX_COUNT         (1u << SLI_TLSF_SL_INDEX_COUNT_LOG2)
+
+// Number of first-level size classes. Block lengths are 16-bit values
+// expressed in double words.
+#define SLI_TLSF_FL_INDEX_COUNT         (16u - SLI_TLSF_SL_INDEX_COUNT_LOG2 + 1u)
+
+// Free list link value marking the end of a size class list.
+#define SLI_TLSF_LINK_NONE              0xFFFFu
+#endif
+
+// Allocation site profiler. Disabled by default.
+#ifndef SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE
+#define SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE      0
+#endif
+
+#ifndef SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT
+#define SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT  32
+#endif
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+// Number of metadata bits holding the index of the site owning a block.
+#define SLI_SITE_INDEX_NBR_BITS         6u
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT < 4) \
+  || (SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT > (1 << SLI_SITE_INDEX_NBR_BITS) - 1)
+#error "SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT must be in the range 4-63."
+#endif
+#else
+#define SLI_SITE_INDEX_NBR_BITS         0u
+#endif
+
+// The caller return address is needed by the Memory Profiler and by the allocation site profiler.
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT) || (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+#define SLI_MEMORY_MANAGER_TRACK_CALLER
+
+// Gets the return address of the current function. Must be used at the very
+// beginning of the function (see sli_memory_profiler_get_return_address()).
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#define SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS()   sli_memory_profiler_get_return_address()
+#elif defined(__GNUC__)
+#define SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS()   __builtin_extract_return_addr(__builtin_return_address(0))
+#elif defined(__IAR_SYSTEMS_ICC__)
+#define SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS()   ((void *)__get_LR())
+#else
+#define SLI_MEMORY_MANAGER_GET_RETURN_ADDRESS()   NULL
+#endif
+#endif
+
+// Number of metadata bits unallocated for future usage.
+#if defined(SLI_MEMORY_MANAGER_ENABLE_SYSTEMVIEW)
+#define SLI_BLOCK_METADATA_RESERVED_NBR_BITS  (13u - SLI_SITE_INDEX_NBR_BITS)
+#else
+#define SLI_BLOCK_METADATA_RESERVED_NBR_BITS  (14u - SLI_SITE_INDEX_NBR_BITS)
+#endif
+
 /*******************************************************************************
  **********************************   MACROS   *********************************
  ******************************************************************************/
@@ -126,15 +190,26 @@ typedef struct {
   uint16_t heap_start_align : 1;    // Flag indicating if first block at heap start undergone a data payload adjustment.
 #if defined(SLI_MEMORY_MANAGER_ENABLE_SYSTEMVIEW)
   uint16_t block_type : 1;          // Block type (LT or ST).
-  uint16_t reserved : 13;           // Unallocated for future usage.
-#else
-  uint16_t reserved : 14;           // Unallocated for future usage.
 #endif
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+  uint16_t site_index : SLI_SITE_INDEX_NBR_BITS; // Index of the allocation site owning the block.
+#endif
+  uint16_t reserved : SLI_BLOCK_METADATA_RESERVED_NBR_BITS; // Unallocated for future usage.
   uint16_t length;                  // Block size (metadata not included just data payload), in double words (64 bit).
   uint16_t offset_neighbour_prev;   // Offset to previous neighbor, in double words. It includes metadata/payload sizes.
   uint16_t offset_neighbour_next;   // Offset to next neighbor, in double words.
 } sli_block_metadata_t;
 
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+// Links of a free block in its size class list. They are stored in the first
+// bytes of the free block data payload, so they cost no metadata space.
+// Links are expressed in double words from the heap start.
+typedef struct {
+  uint16_t free_next;               // Next free block of the same size class.
+  uint16_t free_prev;               // Previous free block of the same size class.
+} sli_block_free_links_t;
+#endif
+
 /*******************************************************************************
  ****************************   GLOBAL VARIABLES   *****************************
  ******************************************************************************/
@@ -237,6 +312,56 @@ void sli_update_free_list_heads(sli_block_metadata_t *free_head,
                                 const sli_block_metadata_t *condition_block,
                                 bool search);
 
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+/***************************************************************************//**
+ * Initializes the segregated free lists to empty lists.
+ ******************************************************************************/
+void sli_memory_tlsf_init(void);
+
+/***************************************************************************//**
+ * Inserts a free block in the free list of its size class.
+ *
+ * @param[in]  block  Pointer to free block metadata. Blocks with a null length
+ *                    are not inserted.
+ *
+ * @note  Must be called each time a free block is created or its length
+ *        changes, after the block metadata has been updated.
+ ******************************************************************************/
+void sli_memory_tlsf_insert_free_block(sli_block_metadata_t *block);
+
+/***************************************************************************//**
+ * Removes a free block from the free list of its size class.
+ *
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @note  Must be called before a free block is allocated, merged, resized or
+ *        invalidated, while its length is still the one it was inserted with.
+ ******************************************************************************/
+void sli_memory_tlsf_remove_free_block(sli_block_metadata_t *block);
+#else
+#define sli_memory_tlsf_init()                     ((void)0)
+#define sli_memory_tlsf_insert_free_block(block)   ((void)(block))
+#define sli_memory_tlsf_remove_free_block(block)   ((void)(block))
+#endif
+
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+/***************************************************************************//**
+ * Transfers the ownership of an allocated block to another allocation site.
+ *
+ * @param[in]  ptr             Pointer to the allocated block data payload.
+ *                             NULL pointers are ignored.
+ * @param[in]  return_address  Return address of the new owner call site.
+ *
+ * @note  Allocation wrappers call this function so that the block is accounted
+ *        to the code calling the wrapper instead of the wrapper itself. The
+ *        site of the wrapper is released when it owns no blocks anymore.
+ ******************************************************************************/
+void sli_memory_site_profiler_track_ownership(void *ptr,
+                                              void *return_address);
+#else
+#define sli_memory_site_profiler_track_ownership(ptr, return_address)   ((void)0)
+#endif
+
 #ifdef SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES
 /***************************************************************************//**
  * Gets the pointer to sl_memory_reservation_t{} by block address.
@@ -73,6 +73,17 @@ sli_block_metadata_t *sli_free_lt_list_head;
 sli_block_metadata_t *sli_free_st_list_head;
 uint32_t sli_free_blocks_number;
 
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+// Segregated free lists. Heads are expressed in double words from the heap start.
+static uint16_t tlsf_free_heads[SLI_TLSF_FL_INDEX_COUNT][SLI_TLSF_SL_INDEX_COUNT];
+// Bitmap of the first-level classes that have at least one non-empty list.
+static uint32_t tlsf_fl_bitmap;
+// Bitmaps of the non-empty second-level lists, per first-level class.
+static uint8_t tlsf_sl_bitmap[SLI_TLSF_FL_INDEX_COUNT];
+// Heap start used as the origin of the free lists links.
+static uint64_t *tlsf_heap_base;
+#endif
+
 #ifdef SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES
 // Dynamic reservation bookkeeping.
 sl_memory_reservation_t *sli_reservation_handle_ptr_table[SLI_MAX_RESERVATION_COUNT] = { NULL };
@@ -181,6 +192,268 @@ static uint32_t get_available_reservation_no_retention_ix(void)
 }
 #endif
 
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+/***************************************************************************//**
+ * Finds the index of the most significant bit set.
+ *
+ * @param[in]  value  Non-null value.
+ *
+ * @return    Index of the most significant bit set.
+ ******************************************************************************/
+__STATIC_INLINE uint32_t tlsf_fls(uint32_t value)
+{
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+  return 31U - __CLZ(value);
+#else
+  uint32_t bit = 0;
+
+  while ((value >>= 1) != 0U) {
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+/***************************************************************************//**
+ * Computes the size class of a block length.
+ *
+ * @param[in]  length  Block length, in double words.
+ * @param[out] fl      Pointer to variable that will receive the first-level
+ *                     index.
+ * @param[out] sl      Pointer to variable that will receive the second-level
+ *                     index.
+ ******************************************************************************/
+static void tlsf_mapping(uint32_t length,
+                         uint32_t *fl,
+                         uint32_t *sl)
+{
+  if (length < SLI_TLSF_SL_INDEX_COUNT) {
+    // Small lengths get one linear class each.
+    *fl = 0;
+    *sl = length;
+  } else {
+    uint32_t msb = tlsf_fls(length);
+
+    *fl = msb - SLI_TLSF_SL_INDEX_COUNT_LOG2 + 1u;
+    *sl = (length >> (msb - SLI_TLSF_SL_INDEX_COUNT_LOG2)) ^ SLI_TLSF_SL_INDEX_COUNT;
+  }
+}
+
+/***************************************************************************//**
+ * Gets the free block links stored in a free block data payload.
+ *
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @return    Pointer to the free block links.
+ ******************************************************************************/
+__STATIC_INLINE sli_block_free_links_t *tlsf_get_links(sli_block_metadata_t *block)
+{
+  return (sli_block_free_links_t *)((uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE);
+}
+
+/***************************************************************************//**
+ * Converts a free list link into a block metadata pointer.
+ ******************************************************************************/
+__STATIC_INLINE sli_block_metadata_t *tlsf_link_to_block(uint16_t link)
+{
+  return (sli_block_metadata_t *)(tlsf_heap_base + link);
+}
+
+/***************************************************************************//**
+ * Converts a block metadata pointer into a free list link.
+ ******************************************************************************/
+__STATIC_INLINE uint16_t tlsf_block_to_link(const sli_block_metadata_t *block)
+{
+  return (uint16_t)((const uint64_t *)block - tlsf_heap_base);
+}
+
+/***************************************************************************//**
+ * Finds a free block whose length is at least the given length.
+ *
+ * @param[in]  length  Minimum block length, in double words.
+ *
+ * @return    Pointer to the free block metadata. NULL if none found.
+ *
+ * @note (1) The length is rounded up to the next size class boundary so that
+ *           any block of the selected list is large enough (good-fit). This
+ *           avoids walking the list and keeps the search constant-time.
+ ******************************************************************************/
+static sli_block_metadata_t *tlsf_find_suitable_block(uint32_t length)
+{
+  uint32_t fl;
+  uint32_t sl;
+  uint32_t sl_map;
+  uint32_t fl_map;
+
+  // Round up to the next size class. See Note #1.
+  if (length >= SLI_TLSF_SL_INDEX_COUNT) {
+    length += (1u << (tlsf_fls(length) - SLI_TLSF_SL_INDEX_COUNT_LOG2)) - 1u;
+  }
+  if (length > UINT16_MAX) {
+    return NULL;
+  }
+  tlsf_mapping(length, &fl, &sl);
+
+  // First look in the same first-level class, then in the larger ones.
+  sl_map = (uint32_t)tlsf_sl_bitmap[fl] & (~0UL << sl);
+  if (sl_map == 0u) {
+    fl_map = tlsf_fl_bitmap & (~0UL << (fl + 1u));
+    if (fl_map == 0u) {
+      return NULL;
+    }
+    fl = SL_CTZ(fl_map);
+    sl_map = tlsf_sl_bitmap[fl];
+  }
+  sl = SL_CTZ(sl_map);
+
+  return tlsf_link_to_block(tlsf_free_heads[fl][sl]);
+}
+
+/***************************************************************************//**
+ * Initializes the segregated free lists to empty lists.
+ ******************************************************************************/
+void sli_memory_tlsf_init(void)
+{
+  sl_memory_region_t heap_region = sl_memory_get_heap_region();
+
+  tlsf_heap_base = (uint64_t *)heap_region.addr;
+  tlsf_fl_bitmap = 0u;
+  memset(tlsf_sl_bitmap, 0, sizeof(tlsf_sl_bitmap));
+  memset(tlsf_free_heads, 0xFF, sizeof(tlsf_free_heads));
+}
+
+/***************************************************************************//**
+ * Inserts a free block in the free list of its size class.
+ ******************************************************************************/
+void sli_memory_tlsf_insert_free_block(sli_block_metadata_t *block)
+{
+  sli_block_free_links_t *links;
+  uint16_t link;
+  uint32_t fl;
+  uint32_t sl;
+
+  if ((block == NULL) || (block->length == 0)) {
+    return;  // No payload to hold the links. Block is not usable anyway.
+  }
+
+  tlsf_mapping(block->length, &fl, &sl);
+  link = tlsf_block_to_link(block);
+  links = tlsf_get_links(block);
+
+  links->free_prev = SLI_TLSF_LINK_NONE;
+  links->free_next = tlsf_free_heads[fl][sl];
+  if (links->free_next != SLI_TLSF_LINK_NONE) {
+    tlsf_get_links(tlsf_link_to_block(links->free_next))->free_prev = link;
+  }
+  tlsf_free_heads[fl][sl] = link;
+
+  tlsf_fl_bitmap |= (1UL << fl);
+  tlsf_sl_bitmap[fl] |= (uint8_t)(1u << sl);
+}
+
+/***************************************************************************//**
+ * Removes a free block from the free list of its size class.
+ ******************************************************************************/
+void sli_memory_tlsf_remove_free_block(sli_block_metadata_t *block)
+{
+  sli_block_free_links_t *links;
+  uint32_t fl;
+  uint32_t sl;
+
+  if ((block == NULL) || (block->length == 0)) {
+    return;  // Never inserted.
+  }
+
+  tlsf_mapping(block->length, &fl, &sl);
+  links = tlsf_get_links(block);
+
+  if (links->free_next != SLI_TLSF_LINK_NONE) {
+    tlsf_get_links(tlsf_link_to_block(links->free_next))->free_prev = links->free_prev;
+  }
+  if (links->free_prev != SLI_TLSF_LINK_NONE) {
+    tlsf_get_links(tlsf_link_to_block(links->free_prev))->free_next = links->free_next;
+  } else {
+    tlsf_free_heads[fl][sl] = links->free_next;
+    if (links->free_next == SLI_TLSF_LINK_NONE) {
+      // Size class list is now empty.
+      tlsf_sl_bitmap[fl] &= (uint8_t)~(1u << sl);
+      if (tlsf_sl_bitmap[fl] == 0u) {
+        tlsf_fl_bitmap &= ~(1UL << fl);
+      }
+    }
+  }
+}
+#endif
+
+/***************************************************************************//**
+ * Checks if a free block can hold a block of the given size and alignment.
+ *
+ * @param[in]  block              Pointer to free block metadata.
+ * @param[in]  size               Size of the block, in bytes.
+ * @param[in]  block_align        Required alignment for the block, in bytes.
+ * @param[in]  type               Type of block (long-term or short term).
+ * @param[in]  block_reservation  Indicates if the free block is for a dynamic
+ *                                reservation.
+ * @param[out] size_adjusted      Pointer to variable that will receive the
+ *                                size of the block adjusted with the alignment.
+ *
+ * @return    true if the block fits, false otherwise.
+ ******************************************************************************/
+static bool free_block_fits(sli_block_metadata_t *block,
+                            size_t size,
+                            size_t block_align,
+                            sl_memory_block_type_t type,
+                            bool block_reservation,
+                            size_t *size_adjusted)
+{
+  void *data_payload = NULL;
+  size_t block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+  size_t data_payload_offset;
+  bool is_aligned = false;
+
+  // For a block reservation, add the metadata's size to the free blocks' available memory space.
+  // See sli_memory_find_free_block() Note #1.
+  block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
+
+  if ((block->block_in_use) || (block_len < size)) {
+    return false;
+  }
+
+  if (type == BLOCK_TYPE_LONG_TERM) {
+    // Check alignment requested and ensure size of found block can accommodate worst case alignment.
+    // For LT, alignment requirement can be verified here whether the block is split or not.
+    data_payload = (void *)((uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE);
+    is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
+    // Offset by which memory_manage_data_alignment() moves the block forward.
+    data_payload_offset = block_align - ((uintptr_t)data_payload % block_align);
+
+    if (is_aligned || (block_len >= (size + data_payload_offset))) {
+      // Compute remaining block size given an alignment handling or not.
+      *size_adjusted = is_aligned ? size : (size + data_payload_offset);
+      return true;
+    }
+  } else {
+    if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
+      // If alignment is 8 bytes (default min alignment), take the requested adjusted size.
+      *size_adjusted = size;
+    } else {
+      // If non 8-byte alignment, search the more optimized size accounting for the required alignment.
+      // See sli_memory_find_free_block() Note #2.
+      uint8_t *block_end = (uint8_t *)((uint64_t *)block + SLI_BLOCK_METADATA_SIZE_DWORD + block->length);
+
+      data_payload = (void *)(block_end - size);
+      data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
+      *size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
+    }
+
+    if (block_len >= *size_adjusted) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /***************************************************************************//**
  * Initializes a memory block metadata to some reset values.
  ******************************************************************************/
@@ -188,6 +461,9 @@ void sli_memory_metadata_init(sli_block_metadata_t *block_metadata)
 {
   block_metadata->block_in_use = 0;
   block_metadata->heap_start_align = 0;
+#if (SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE == 1)
+  block_metadata->site_index = 0;
+#endif
   block_metadata->reserved = 0;
   block_metadata->length = 0;
   block_metadata->offset_neighbour_prev = 0;
@@ -210,6 +486,13 @@ void sli_memory_metadata_init(sli_block_metadata_t *block_metadata)
  *           alignment (size_real + block_align) cannot be taken by default
  *           as it may imply loosing too many bytes in internal fragmentation
  *           due to the alignment requirement.
+ *
+ * @note (3) In segregated-fit (TLSF) mode, the free block is taken from the
+ *           first non-empty size class large enough for the requested size
+ *           plus the worst alignment adjustment. Any block of that class fits,
+ *           so the look-up takes a constant time regardless of the heap
+ *           fragmentation. Long-term and short-term blocks only differ by the
+ *           end of the free block they are carved from.
  ******************************************************************************/
 size_t sli_memory_find_free_block(size_t size,
                                   size_t align,
@@ -218,59 +501,32 @@ size_t sli_memory_find_free_block(size_t size,
                                   sli_block_metadata_t **block)
 {
   sli_block_metadata_t *current_block_metadata = NULL;
-  void *data_payload = NULL;
   size_t size_adjusted = 0;
-  size_t current_block_len;
   size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
-  size_t data_payload_offset;
-  bool is_aligned = false;
 
   *block = NULL;
 
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+  // Look for a size class that fits the worst case alignment. See Note #3.
+  size_t size_worst = size + (block_align - SLI_BLOCK_ALLOC_MIN_ALIGN);
+
+  if (block_reservation) {
+    size_worst -= SL_MIN(size_worst, SLI_BLOCK_METADATA_SIZE_BYTE);
+  }
+
+  current_block_metadata = tlsf_find_suitable_block(SL_MAX(SLI_BLOCK_LEN_BYTE_TO_DWORD(size_worst), 1u));
+  if ((current_block_metadata == NULL)
+      || !free_block_fits(current_block_metadata, size, block_align, type, block_reservation, &size_adjusted)) {
+    return 0;
+  }
+#else
   current_block_metadata = (type == BLOCK_TYPE_LONG_TERM) ? sli_free_lt_list_head : sli_free_st_list_head;
   if (current_block_metadata == NULL) {
     return 0;
   }
 
-  current_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(current_block_metadata->length);
-
-  // For a block reservation, add the metadata's size to the free blocks' available memory space. See Note #2.
-  current_block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
-
   // Try to find a block to allocate (first-fit).
-  while (current_block_metadata != NULL) {
-    if ((!current_block_metadata->block_in_use) && (current_block_len >= size)) {
-      if (type == BLOCK_TYPE_LONG_TERM) {
-        // Check alignment requested and ensure size of found block can accommodate worst case alignment.
-        // For LT, alignment requirement can be verified here whether the block is split or not.
-        data_payload = (void *)((uint8_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_BYTE);
-        is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
-        data_payload_offset = (uintptr_t)data_payload % block_align;
-
-        if (is_aligned || (current_block_len >= (size + data_payload_offset))) {
-          // Compute remaining block size given an alignment handling or not.
-          size_adjusted = is_aligned ? size : (size + data_payload_offset);
-          break;
-        }
-      } else {
-        if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
-          // If alignment is 8 bytes (default min alignment), take the requested adjusted size.
-          size_adjusted = size;
-        } else {
-          // If non 8-byte alignment, search the more optimized size accounting for the required alignment. See Note #3.
-          uint8_t *block_end = (uint8_t *)((uint64_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_DWORD + current_block_metadata->length);
-
-          data_payload = (void *)(block_end - size);
-          data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
-          size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
-        }
-
-        if (current_block_len >= size_adjusted) {
-          break;
-        }
-      }
-    }
-
+  while (!free_block_fits(current_block_metadata, size, block_align, type, block_reservation, &size_adjusted)) {
     // Get next block.
     if (type == BLOCK_TYPE_LONG_TERM) {
       if (current_block_metadata->offset_neighbour_next == 0) {
@@ -285,10 +541,8 @@ size_t sli_memory_find_free_block(size_t size,
       // Short-term browsing direction goes from end to start of heap.
       current_block_metadata = (sli_block_metadata_t *)((uint64_t *)current_block_metadata - (current_block_metadata->offset_neighbour_prev));
     }
-
-    current_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(current_block_metadata->length);
-    current_block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
   }
+#endif
 
   *block = current_block_metadata;
   return size_adjusted;
@@ -359,11 +613,19 @@ void *sli_memory_get_shortterm_head_ptr(void)
 
 /***************************************************************************//**
  * Update free lists heads (short and long terms).
+ *
+ * @note (1) In segregated-fit (TLSF) mode, free blocks are not looked up from
+ *           the head pointers. The heads are only kept pointing to a valid
+ *           block metadata so the heap is never walked here.
  ******************************************************************************/
 void sli_update_free_list_heads(sli_block_metadata_t *free_head,
                                 const sli_block_metadata_t *condition_block,
                                 bool search)
 {
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+  // See Note #1.
+  search = false;
+#endif
   if (search) {
     if ((sli_free_lt_list_head == condition_block) || (condition_block == NULL)) {
       sli_free_lt_list_head = sli_memory_find_head_free_block(BLOCK_TYPE_LONG_TERM, free_head);
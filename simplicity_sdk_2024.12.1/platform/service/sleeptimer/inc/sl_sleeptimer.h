@@ -127,6 +127,13 @@ typedef  struct  time_date {
   sl_sleeptimer_time_zone_offset_t time_zone; ///< Offset, in seconds, from UTC
 } sl_sleeptimer_date_t;
 
+/// @brief Timer coalescing statistics.
+typedef struct {
+  uint32_t wakeup_count;        ///< Number of timer interrupts that expired at least one timer.
+  uint32_t expiration_count;    ///< Number of timer expirations processed by these interrupts.
+  uint32_t wakeup_saved_count;  ///< Number of wakeups avoided by processing timers expiring on different ticks in the same interrupt.
+} sl_sleeptimer_coalescing_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -305,6 +312,67 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flags,
                                                             uint32_t *time_remaining);
 
+/***************************************************************************//**
+ * Sets the slack of a timer.
+ *
+ * The timer can expire up to slack ticks after its timeout, so that the
+ * timers expiring within each other's slack are processed in a single wakeup.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slack Slack in timer ticks. 0 removes the slack of the timer.
+ *
+ * @note The timer must be running. The slack is removed when the timer is
+ *       stopped or restarted, and when a one-shot timer expires, so it must be
+ *       set again after every start.
+ *
+ * @note The slack of a periodic timer should be smaller than its period.
+ *
+ * @note Function definition is accessible only when
+ *       SL_SLEEPTIMER_COALESCING_ENABLE is set to 1.
+ *
+ * @return SL_STATUS_OK if successful. SL_STATUS_INVALID_STATE if the timer is
+ *         not running. SL_STATUS_FULL if SL_SLEEPTIMER_COALESCING_TIMER_COUNT
+ *         running timers already have a slack. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                          uint32_t slack);
+
+/***************************************************************************//**
+ * Sets the slack of a timer in milliseconds.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slack_ms Slack in milliseconds. 0 removes the slack of the timer.
+ *
+ * @note Same as sl_sleeptimer_set_timer_slack() otherwise.
+ *
+ * @note Function definition is accessible only when
+ *       SL_SLEEPTIMER_COALESCING_ENABLE is set to 1.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack_ms(sl_sleeptimer_timer_handle_t *handle,
+                                             uint32_t slack_ms);
+
+/***************************************************************************//**
+ * Gets the timer coalescing statistics.
+ *
+ * @param stats Pointer to statistics structure to fill.
+ *
+ * @note Function definition is accessible only when
+ *       SL_SLEEPTIMER_COALESCING_ENABLE is set to 1.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_get_coalescing_stats(sl_sleeptimer_coalescing_stats_t *stats);
+
+/***************************************************************************//**
+ * Resets the timer coalescing statistics.
+ *
+ * @note Function definition is accessible only when
+ *       SL_SLEEPTIMER_COALESCING_ENABLE is set to 1.
+ ******************************************************************************/
+void sl_sleeptimer_reset_coalescing_stats(void);
+
 /***************************************************************************//**
  * Gets current 32 bits global tick count.
  *
@@ -70,6 +70,25 @@
 // The difference should be null or of few ticks since the counter never stop.
 #define MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION  2
 
+#ifndef SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+#define SL_SLEEPTIMER_TIMER_HEAP_ENABLE  0
+#endif
+
+#ifndef SL_SLEEPTIMER_TIMER_HEAP_SIZE
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE  32
+#endif
+
+// Size of the stack used to walk the timer heap. Covers the depth of any heap size.
+#define TIMER_HEAP_WALK_STACK_SIZE  32
+
+#ifndef SL_SLEEPTIMER_COALESCING_ENABLE
+#define SL_SLEEPTIMER_COALESCING_ENABLE  0
+#endif
+
+#ifndef SL_SLEEPTIMER_COALESCING_TIMER_COUNT
+#define SL_SLEEPTIMER_COALESCING_TIMER_COUNT  8
+#endif
+
 /// @brief Time Format.
 SLEEPTIMER_ENUM(sl_sleeptimer_time_format_t) {
   TIME_FORMAT_UNIX = 0,           ///< Number of seconds since January 1, 1970, 00:00. Type is signed, so represented on 31 bit.
@@ -101,8 +120,44 @@ static uint32_t calculated_sec_count = 0;
 static uint32_t timer_frequency;
 
 // Head of timer list.
+// When the timer heap is enabled, this list only holds the expired timers, ordered by priority.
 static sl_sleeptimer_timer_handle_t *timer_head;
 
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+// Entry of the running timers heap.
+typedef struct {
+  sl_sleeptimer_timer_handle_t *handle;   // Timer handle. The handle's delta holds its index in the heap.
+  sl_sleeptimer_tick_count_t expiration;  // Counter value at which the timer expires.
+} timer_heap_entry_t;
+
+// Min-heap of the running timers that are not expired yet, ordered by expiration and priority.
+static timer_heap_entry_t timer_heap[SL_SLEEPTIMER_TIMER_HEAP_SIZE];
+
+// Number of timers in the heap.
+static uint32_t timer_heap_count;
+
+// Number of timers in the expired timers list. Counts against the heap size,
+// so that a periodic timer always finds a heap entry when it is re-inserted.
+static uint32_t expired_timer_count;
+#endif
+
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+// Slack of a timer.
+typedef struct {
+  const sl_sleeptimer_timer_handle_t *handle;  // Timer handle. NULL if the entry is free.
+  uint32_t slack;                              // Slack in ticks.
+} timer_slack_entry_t;
+
+// Slack of the running timers that have one.
+static timer_slack_entry_t timer_slack_table[SL_SLEEPTIMER_COALESCING_TIMER_COUNT];
+
+// Timer coalescing statistics.
+static sl_sleeptimer_coalescing_stats_t coalescing_stats;
+
+// Number of distinct expiration ticks that elapsed since the last processed timer interrupt.
+static uint32_t elapsed_expiration_count;
+#endif
+
 // Count at last update of delta of first timer.
 static volatile sl_sleeptimer_tick_count_t last_delta_update_count;
 
@@ -119,8 +174,8 @@ static uint32_t max_millisecond_conversion;
 static volatile bool sleep_on_isr_exit = false;
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
-                                    sl_sleeptimer_tick_count_t timeout);
+static sl_status_t delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                                           sl_sleeptimer_tick_count_t timeout);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle);
@@ -131,6 +186,38 @@ static sl_status_t set_comparator_for_next_timer(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static void update_delta_list(void);
 
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_timer_handle_t *get_first_timer(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_timer_handle_t *get_next_expired_timer(void);
+
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static uint32_t get_timer_slack(const sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void clear_timer_slack(const sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_tick_count_t get_coalesced_timeout(void);
+#endif
+
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool timer_heap_contains(const sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void timer_heap_sift_up(uint32_t index,
+                               const timer_heap_entry_t *entry);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void timer_heap_remove(uint32_t index);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void expired_list_insert_timer(sl_sleeptimer_timer_handle_t *handle);
+#endif
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 __STATIC_INLINE uint32_t div_to_log2(uint32_t div);
 
@@ -193,6 +280,10 @@ sl_status_t sl_sleeptimer_init(void)
   CORE_ENTER_ATOMIC();
   if (!is_sleeptimer_initialized) {
     timer_head  = NULL;
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+    timer_heap_count = 0u;
+    expired_timer_count = 0u;
+#endif
     last_delta_update_count = 0u;
     overflow_counter = 0u;
     sleeptimer_hal_init_timer();
@@ -465,7 +556,13 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
   update_delta_list();
 
   // If first timer in list, update timer comparator.
-  if (timer_head == handle) {
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+  // With coalescing, any timer can set the wakeup time. When expired timers
+  // are pending, the comparator is updated once they are processed.
+  if (get_first_timer() == handle || get_next_expired_timer() == NULL) {
+#else
+  if (get_first_timer() == handle) {
+#endif
     set_comparator = true;
   }
 
@@ -476,6 +573,10 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
     return error;
   }
 
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+  clear_timer_slack(handle);
+#endif
+
   if (set_comparator) {
     error = set_comparator_for_next_timer();
     if (error == SL_STATUS_NULL_POINTER) {
@@ -501,6 +602,9 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
   } else {
     *running = false;
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+    *running = timer_heap_contains(handle);
+#endif
     current = timer_head;
     while (current != NULL && !*running) {
       if (current == handle) {
@@ -530,6 +634,19 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
   CORE_ENTER_ATOMIC();
 
   update_delta_list();
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  if (timer_heap_contains(handle)) {
+    *time = timer_heap[handle->delta].expiration - last_delta_update_count;
+    current = (sl_sleeptimer_timer_handle_t *)handle;
+  } else {
+    // Retrieve timer in the expired timers list.
+    *time = 0u;
+    current = timer_head;
+    while (current != handle && current != NULL) {
+      current = current->next;
+    }
+  }
+#else
   *time  = handle->delta;
 
   // Retrieve timer in list and add the deltas.
@@ -538,6 +655,7 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
     *time += current->delta;
     current = current->next;
   }
+#endif
 
   if (current != handle) {
     CORE_EXIT_ATOMIC();
@@ -569,6 +687,50 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
   uint32_t time = 0;
 
   CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  // Expired timers come first, they have no time remaining.
+  current = timer_head;
+  while (current != NULL) {
+    if (current->option_flags == option_flags
+        || option_flags == SL_SLEEPTIMER_ANY_FLAG) {
+      *time_remaining = 0u;
+      CORE_EXIT_ATOMIC();
+
+      return SL_STATUS_OK;
+    }
+    current = current->next;
+  }
+
+  // Heap order is only partial, look for the matching timer that expires first.
+  uint32_t first_index = timer_heap_count;
+  for (uint32_t i = 0u; i < timer_heap_count; i++) {
+    current = timer_heap[i].handle;
+    if ((current->option_flags == option_flags
+         || option_flags == SL_SLEEPTIMER_ANY_FLAG)
+        && (first_index == timer_heap_count
+            || (timer_heap[i].expiration - last_delta_update_count)
+            < (timer_heap[first_index].expiration - last_delta_update_count))) {
+      first_index = i;
+      if (i == 0u) {
+        break;
+      }
+    }
+  }
+
+  if (first_index < timer_heap_count) {
+    time = timer_heap[first_index].expiration - last_delta_update_count;
+    // Substract time since last compare match.
+    if (time > (sleeptimer_hal_get_counter() - last_delta_update_count)) {
+      time -= (sleeptimer_hal_get_counter() - last_delta_update_count);
+    } else {
+      time = 0;
+    }
+    *time_remaining = time;
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_OK;
+  }
+#else
   // parse list and retrieve first timer with option flags requirement.
   current = timer_head;
   while (current != NULL) {
@@ -590,11 +752,122 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
     }
     current = current->next;
   }
+#endif
   CORE_EXIT_ATOMIC();
 
   return SL_STATUS_EMPTY;
 }
 
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+/***************************************************************************//**
+ * Sets the slack of a timer.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                          uint32_t slack)
+{
+  CORE_DECLARE_IRQ_STATE;
+  timer_slack_entry_t *entry = NULL;
+
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_CRITICAL();
+  if (slack == 0u) {
+    clear_timer_slack(handle);
+  } else {
+    bool is_running = false;
+
+    // Entries are freed when their timer stops, so only running timers get one.
+    sl_sleeptimer_is_timer_running(handle, &is_running);
+    if (!is_running) {
+      CORE_EXIT_CRITICAL();
+
+      return SL_STATUS_INVALID_STATE;
+    }
+
+    // Look for the timer entry, or a free one.
+    for (uint32_t i = 0u; i < SL_SLEEPTIMER_COALESCING_TIMER_COUNT; i++) {
+      if (timer_slack_table[i].handle == handle) {
+        entry = &timer_slack_table[i];
+        break;
+      } else if (entry == NULL && timer_slack_table[i].handle == NULL) {
+        entry = &timer_slack_table[i];
+      }
+    }
+
+    if (entry == NULL) {
+      CORE_EXIT_CRITICAL();
+
+      return SL_STATUS_FULL;
+    }
+
+    entry->handle = handle;
+    entry->slack = slack;
+  }
+
+  // Update wakeup time in case the timer is running, unless expired timers
+  // are pending and the comparator is updated once they are processed.
+  update_delta_list();
+  if (get_next_expired_timer() == NULL
+      && set_comparator_for_next_timer() == SL_STATUS_NULL_POINTER) {
+    sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
+  }
+  CORE_EXIT_CRITICAL();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Sets the slack of a timer in milliseconds.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack_ms(sl_sleeptimer_timer_handle_t *handle,
+                                             uint32_t slack_ms)
+{
+  uint32_t slack_tick;
+  sl_status_t status;
+
+  status = sl_sleeptimer_ms32_to_tick(slack_ms, &slack_tick);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return sl_sleeptimer_set_timer_slack(handle, slack_tick);
+}
+
+/***************************************************************************//**
+ * Gets the timer coalescing statistics.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_get_coalescing_stats(sl_sleeptimer_coalescing_stats_t *stats)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *stats = coalescing_stats;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Resets the timer coalescing statistics.
+ ******************************************************************************/
+void sl_sleeptimer_reset_coalescing_stats(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  coalescing_stats.wakeup_count = 0u;
+  coalescing_stats.expiration_count = 0u;
+  coalescing_stats.wakeup_saved_count = 0u;
+  CORE_EXIT_ATOMIC();
+}
+#endif
+
 /**************************************************************************//**
  * Determines if next timer to expire has the option flag
  * "SL_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG".
@@ -618,7 +891,7 @@ bool sli_sleeptimer_is_power_manager_timer_next_to_expire(void)
   // Make sure that the Power Manager Sleeptimer is actually expired in addition
   // to being the next timer.
   if (next_timer_is_power_manager
-      && ((sl_sleeptimer_get_tick_count() - timer_head->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
+      && ((sl_sleeptimer_get_tick_count() - get_first_timer()->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
     next_timer_is_power_manager = false;
   }
 
@@ -1166,7 +1439,7 @@ void sl_sleeptimer_delay_millisecond(uint16_t time_ms)
 {
   volatile bool wait = true;
   sl_status_t error_code;
-  sl_sleeptimer_timer_handle_t delay_timer;
+  sl_sleeptimer_timer_handle_t delay_timer = { 0 };
   uint32_t delay = sl_sleeptimer_ms_to_tick(time_ms);
 
   error_code = sl_sleeptimer_start_timer(&delay_timer,
@@ -1288,18 +1561,8 @@ void process_timer_irq(uint8_t local_flag)
     // Make sure the timers list is up to date with the time elapsed since the last update
     update_delta_list();
 
-    // Process all timers that have expired.
-    while (timer_head && (timer_head->delta == 0)) {
-      sl_sleeptimer_timer_handle_t *temp = timer_head;
-      current = timer_head;
-
-      // Process timers with higher priority first
-      while ((temp != NULL) && (temp->delta == 0)) {
-        if (current->priority > temp->priority) {
-          current = temp;
-        }
-        temp = temp->next;
-      }
+    // Process all timers that have expired, higher priority first.
+    while ((current = get_next_expired_timer()) != NULL) {
       CORE_EXIT_ATOMIC();
 
       process_expired_timer(current);
@@ -1321,6 +1584,18 @@ void process_timer_irq(uint8_t local_flag)
       sleep_on_isr_exit = true;
     }
 
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+    // Every expiration tick processed after the first one would have needed its own wakeup.
+    if (nb_timer_expire > 0u) {
+      coalescing_stats.wakeup_count++;
+      coalescing_stats.expiration_count += nb_timer_expire;
+      if (elapsed_expiration_count > 1u) {
+        coalescing_stats.wakeup_saved_count += elapsed_expiration_count - 1u;
+      }
+      elapsed_expiration_count = 0u;
+    }
+#endif
+
     sl_status_t error = set_comparator_for_next_timer();
     if (error == SL_STATUS_NULL_POINTER) {
       sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
@@ -1350,9 +1625,12 @@ static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
  *
  * @param handle Pointer to handle to timer.
  * @param timeout Timer timeout, in ticks.
+ *
+ * @return SL_STATUS_OK if successful. SL_STATUS_FULL if the timer heap is
+ *         enabled and SL_SLEEPTIMER_TIMER_HEAP_SIZE timers are running.
  ******************************************************************************/
-static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
-                                    sl_sleeptimer_tick_count_t timeout)
+static sl_status_t delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                                           sl_sleeptimer_tick_count_t timeout)
 {
   sl_sleeptimer_tick_count_t local_handle_delta = timeout;
 
@@ -1371,6 +1649,24 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
   }
 #endif
 
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  if (timer_heap_count + expired_timer_count >= SL_SLEEPTIMER_TIMER_HEAP_SIZE) {
+    return SL_STATUS_FULL;
+  }
+
+  if (local_handle_delta == 0u) {
+    expired_list_insert_timer(handle);
+    return SL_STATUS_OK;
+  }
+
+  timer_heap_entry_t entry = {
+    .handle = handle,
+    .expiration = last_delta_update_count + local_handle_delta,
+  };
+
+  timer_heap_count++;
+  timer_heap_sift_up(timer_heap_count - 1u, &entry);
+#else
   handle->delta = local_handle_delta;
 
   if (timer_head != NULL) {
@@ -1401,6 +1697,9 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
     timer_head = handle;
     handle->next = NULL;
   }
+#endif
+
+  return SL_STATUS_OK;
 }
 
 /*******************************************************************************
@@ -1419,6 +1718,14 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
     return SL_STATUS_NULL_POINTER;
   }
 
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  if (timer_heap_contains(handle)) {
+    timer_heap_remove(handle->delta);
+
+    return SL_STATUS_OK;
+  }
+#endif
+
   // Retrieve timer in delta list.
   while (current != NULL && current != handle) {
     prev = current;
@@ -1435,10 +1742,14 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
     timer_head = handle->next;
   }
 
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  expired_timer_count--;
+#else
   // Update delta of next timer
   if (handle->next != NULL) {
     handle->next->delta += handle->delta;
   }
+#endif
 
   return SL_STATUS_OK;
 }
@@ -1448,11 +1759,33 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
  ******************************************************************************/
 static sl_status_t set_comparator_for_next_timer(void)
 {
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  if (timer_head != NULL) {
+    // Expired timers are waiting to be processed. Just trigger compare match interrupt.
+    sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+    sleeptimer_hal_set_int(SLEEPTIMER_EVENT_COMP);
+    update_next_timer_to_expire_is_power_manager();
+    return SL_STATUS_OK;
+  } else if (timer_heap_count > 0u) {
+    sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+    sleeptimer_hal_set_compare(last_delta_update_count + get_coalesced_timeout());
+#else
+    sleeptimer_hal_set_compare(timer_heap[0].expiration);
+#endif
+    update_next_timer_to_expire_is_power_manager();
+    return SL_STATUS_OK;
+  }
+#else
   if (timer_head) {
     if (timer_head->delta > 0) {
       sl_sleeptimer_tick_count_t compare_value;
 
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+      compare_value = last_delta_update_count + get_coalesced_timeout();
+#else
       compare_value = last_delta_update_count + timer_head->delta;
+#endif
 
       sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
       sleeptimer_hal_set_compare(compare_value);
@@ -1465,6 +1798,7 @@ static sl_status_t set_comparator_for_next_timer(void)
     update_next_timer_to_expire_is_power_manager();
     return SL_STATUS_OK;
   }
+#endif
 
   return SL_STATUS_NULL_POINTER;
 }
@@ -1475,12 +1809,40 @@ static sl_status_t set_comparator_for_next_timer(void)
 static void update_delta_list(void)
 {
   sl_sleeptimer_tick_count_t current_cnt = sleeptimer_hal_get_counter();
-  sl_sleeptimer_timer_handle_t *timer_handle = timer_head;
   sl_sleeptimer_tick_count_t time_diff = current_cnt - last_delta_update_count;
 
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+  // No timer in the heap expires on the last update tick.
+  sl_sleeptimer_tick_count_t expiration = last_delta_update_count;
+#endif
+
+  // Move the timers that expired since the last update to the expired timers list.
+  while (timer_heap_count > 0u
+         && (timer_heap[0].expiration - last_delta_update_count) <= time_diff) {
+    sl_sleeptimer_timer_handle_t *timer_handle = timer_heap[0].handle;
+
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+    if (timer_heap[0].expiration != expiration) {
+      expiration = timer_heap[0].expiration;
+      elapsed_expiration_count++;
+    }
+#endif
+    timer_heap_remove(0u);
+    expired_list_insert_timer(timer_handle);
+  }
+#else
+  sl_sleeptimer_timer_handle_t *timer_handle = timer_head;
+
   // Go through the delta timer list and update every necessary deltas
   // according to the time elapsed since the last update.
   while (timer_handle != NULL && time_diff > 0) {
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+    // Timers with a null delta expire on the same tick as the previous one.
+    if (timer_handle->delta > 0u && timer_handle->delta <= time_diff) {
+      elapsed_expiration_count++;
+    }
+#endif
     if (timer_handle->delta >= time_diff) {
       timer_handle->delta -= time_diff;
       time_diff = 0;
@@ -1490,10 +1852,289 @@ static void update_delta_list(void)
     }
     timer_handle = timer_handle->next;
   }
+#endif
 
   last_delta_update_count = current_cnt;
 }
 
+/*******************************************************************************
+ * Gets the next timer to expire.
+ *
+ * @return Pointer to handle of the first timer. NULL if no timer is running.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *get_first_timer(void)
+{
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  if (timer_head == NULL && timer_heap_count > 0u) {
+    return timer_heap[0].handle;
+  }
+#endif
+
+  return timer_head;
+}
+
+/*******************************************************************************
+ * Gets the expired timer with the highest priority.
+ *
+ * @return Pointer to handle of the timer. NULL if no timer expired.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *get_next_expired_timer(void)
+{
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  // Expired timers list is ordered by priority.
+  return timer_head;
+#else
+  sl_sleeptimer_timer_handle_t *current = timer_head;
+  sl_sleeptimer_timer_handle_t *temp = timer_head;
+
+  if (timer_head == NULL || timer_head->delta != 0u) {
+    return NULL;
+  }
+
+  // Process timers with higher priority first
+  while ((temp != NULL) && (temp->delta == 0)) {
+    if (current->priority > temp->priority) {
+      current = temp;
+    }
+    temp = temp->next;
+  }
+
+  return current;
+#endif
+}
+
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+/*******************************************************************************
+ * Gets the slack of a timer.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return Slack in ticks. 0 if the timer has no slack.
+ ******************************************************************************/
+static uint32_t get_timer_slack(const sl_sleeptimer_timer_handle_t *handle)
+{
+  for (uint32_t i = 0u; i < SL_SLEEPTIMER_COALESCING_TIMER_COUNT; i++) {
+    if (timer_slack_table[i].handle == handle) {
+      return timer_slack_table[i].slack;
+    }
+  }
+
+  return 0u;
+}
+
+/*******************************************************************************
+ * Removes the slack of a timer, if it has one.
+ *
+ * @param handle Pointer to handle to timer.
+ ******************************************************************************/
+static void clear_timer_slack(const sl_sleeptimer_timer_handle_t *handle)
+{
+  for (uint32_t i = 0u; i < SL_SLEEPTIMER_COALESCING_TIMER_COUNT; i++) {
+    if (timer_slack_table[i].handle == handle) {
+      timer_slack_table[i].handle = NULL;
+      timer_slack_table[i].slack = 0u;
+      return;
+    }
+  }
+}
+
+/*******************************************************************************
+ * Gets the wakeup time that serves the most timers without exceeding the
+ * slack of any of them. It is the earliest timeout plus slack of all the
+ * running timers.
+ *
+ * @return Wakeup time relative to the last delta list update, in ticks.
+ *
+ * @note Must only be called when no timer is expired.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_coalesced_timeout(void)
+{
+  sl_sleeptimer_tick_count_t wakeup_timeout = UINT32_MAX;
+  uint32_t slack;
+
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  uint32_t stack[TIMER_HEAP_WALK_STACK_SIZE];
+  uint32_t stack_count = 0u;
+
+  // Only the timers expiring before the wakeup time can bring it forward,
+  // skip the heap subtrees that expire later.
+  if (timer_heap_count > 0u) {
+    stack[stack_count++] = 0u;
+  }
+  while (stack_count > 0u) {
+    uint32_t index = stack[--stack_count];
+    sl_sleeptimer_tick_count_t timeout = timer_heap[index].expiration - last_delta_update_count;
+
+    if (timeout >= wakeup_timeout) {
+      continue;
+    }
+    slack = get_timer_slack(timer_heap[index].handle);
+    wakeup_timeout = (slack < (wakeup_timeout - timeout)) ? (timeout + slack) : wakeup_timeout;
+    for (uint32_t child = (2u * index) + 1u; child <= (2u * index) + 2u; child++) {
+      if (child < timer_heap_count && stack_count < TIMER_HEAP_WALK_STACK_SIZE) {
+        stack[stack_count++] = child;
+      }
+    }
+  }
+#else
+  sl_sleeptimer_timer_handle_t *current = timer_head;
+  sl_sleeptimer_tick_count_t timeout = 0u;
+
+  // Only the timers expiring before the wakeup time can bring it forward.
+  while (current != NULL) {
+    timeout += current->delta;
+    if (timeout >= wakeup_timeout) {
+      break;
+    }
+    slack = get_timer_slack(current);
+    wakeup_timeout = (slack < (wakeup_timeout - timeout)) ? (timeout + slack) : wakeup_timeout;
+    current = current->next;
+  }
+#endif
+
+  return wakeup_timeout;
+}
+#endif
+
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+/*******************************************************************************
+ * Determines if a heap entry expires before another one.
+ *
+ * @param a Pointer to first heap entry.
+ * @param b Pointer to second heap entry.
+ *
+ * @return true if entry a expires first, or at the same time with a higher
+ *         priority, false otherwise.
+ ******************************************************************************/
+__STATIC_INLINE bool timer_heap_is_before(const timer_heap_entry_t *a,
+                                          const timer_heap_entry_t *b)
+{
+  sl_sleeptimer_tick_count_t a_timeout = a->expiration - last_delta_update_count;
+  sl_sleeptimer_tick_count_t b_timeout = b->expiration - last_delta_update_count;
+
+  return (a_timeout < b_timeout)
+         || ((a_timeout == b_timeout) && (a->handle->priority < b->handle->priority));
+}
+
+/*******************************************************************************
+ * Stores an entry in the heap and records its index in the timer handle.
+ *
+ * @param index Heap index.
+ * @param entry Pointer to entry to store.
+ ******************************************************************************/
+__STATIC_INLINE void timer_heap_set(uint32_t index,
+                                    const timer_heap_entry_t *entry)
+{
+  timer_heap[index] = *entry;
+  entry->handle->delta = index;
+}
+
+/*******************************************************************************
+ * Moves an entry up the heap until its parent expires before it.
+ *
+ * @param index Heap index where the entry starts.
+ * @param entry Pointer to entry to place.
+ ******************************************************************************/
+static void timer_heap_sift_up(uint32_t index,
+                               const timer_heap_entry_t *entry)
+{
+  while (index > 0u) {
+    uint32_t parent = (index - 1u) / 2u;
+
+    if (!timer_heap_is_before(entry, &timer_heap[parent])) {
+      break;
+    }
+    timer_heap_set(index, &timer_heap[parent]);
+    index = parent;
+  }
+  timer_heap_set(index, entry);
+}
+
+/*******************************************************************************
+ * Moves an entry down the heap until it expires before its children.
+ *
+ * @param index Heap index where the entry starts.
+ * @param entry Pointer to entry to place.
+ ******************************************************************************/
+static void timer_heap_sift_down(uint32_t index,
+                                 const timer_heap_entry_t *entry)
+{
+  while ((2u * index) + 1u < timer_heap_count) {
+    uint32_t child = (2u * index) + 1u;
+
+    if ((child + 1u < timer_heap_count)
+        && timer_heap_is_before(&timer_heap[child + 1u], &timer_heap[child])) {
+      child++;
+    }
+    if (!timer_heap_is_before(&timer_heap[child], entry)) {
+      break;
+    }
+    timer_heap_set(index, &timer_heap[child]);
+    index = child;
+  }
+  timer_heap_set(index, entry);
+}
+
+/*******************************************************************************
+ * Determines if a timer is in the heap.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return true if the timer is in the heap, false otherwise.
+ ******************************************************************************/
+static bool timer_heap_contains(const sl_sleeptimer_timer_handle_t *handle)
+{
+  return (handle->delta < timer_heap_count)
+         && (timer_heap[handle->delta].handle == handle);
+}
+
+/*******************************************************************************
+ * Removes an entry from the heap.
+ *
+ * @param index Heap index of the entry to remove.
+ ******************************************************************************/
+static void timer_heap_remove(uint32_t index)
+{
+  timer_heap_count--;
+  if (index < timer_heap_count) {
+    // Fill the hole with the last entry.
+    timer_heap_entry_t last = timer_heap[timer_heap_count];
+
+    if ((index > 0u)
+        && timer_heap_is_before(&last, &timer_heap[(index - 1u) / 2u])) {
+      timer_heap_sift_up(index, &last);
+    } else {
+      timer_heap_sift_down(index, &last);
+    }
+  }
+}
+
+/*******************************************************************************
+ * Inserts a timer in the expired timers list, after the expired timers of
+ * higher or same priority.
+ *
+ * @param handle Pointer to handle to timer.
+ ******************************************************************************/
+static void expired_list_insert_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+  sl_sleeptimer_timer_handle_t *prev = NULL;
+  sl_sleeptimer_timer_handle_t *current = timer_head;
+
+  while (current != NULL && current->priority <= handle->priority) {
+    prev = current;
+    current = current->next;
+  }
+
+  if (prev != NULL) {
+    prev->next = handle;
+  } else {
+    timer_head = handle;
+  }
+  handle->next = current;
+  expired_timer_count++;
+}
+#endif
+
 /*******************************************************************************
  * Creates and start a 32 bits timer.
  *
@@ -1556,10 +2197,20 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
 
   CORE_ENTER_CRITICAL();
   update_delta_list();
-  delta_list_insert_timer(handle, timeout_initial);
+  if (delta_list_insert_timer(handle, timeout_initial) != SL_STATUS_OK) {
+    CORE_EXIT_CRITICAL();
+
+    return SL_STATUS_FULL;
+  }
 
   // If first timer, update timer comparator.
-  if (timer_head == handle) {
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+  // With coalescing, any timer can set the wakeup time. When expired timers
+  // are pending, the comparator is updated once they are processed.
+  if (get_first_timer() == handle || get_next_expired_timer() == NULL) {
+#else
+  if (get_first_timer() == handle) {
+#endif
     set_comparator_for_next_timer();
   }
 
@@ -1593,16 +2244,8 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
     }
   }
 
-  // Remove timer from list except if the timer is a periodic timer that was
-  // intentionally kept at the head of the timers list.
-  if (skip_remove != true) {
-    CORE_ENTER_ATOMIC();
-    delta_list_remove_timer(timer);
-    CORE_EXIT_ATOMIC();
-  }
-
-  // Re-insert periodic timer that was previsouly removed from the list
-  // and compensate for any deviation from the periodic timer frequency.
+  // Compensate the next timeout of a periodic timer for any deviation from
+  // the periodic timer frequency.
   if (timer->timeout_periodic != 0u && skip_remove != true) {
     timeout_temp -= periodic_correction;
     EFM_ASSERT(timeout_temp > 0);
@@ -1618,9 +2261,29 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
         timer->timeout_expected_tc -= 1;
       }
     }
+  }
+
+  // Remove timer from list except if the timer is a periodic timer that was
+  // intentionally kept at the head of the timers list.
+  if (skip_remove != true) {
+    sl_status_t status = SL_STATUS_OK;
+
     CORE_ENTER_ATOMIC();
-    delta_list_insert_timer(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
-    timer->timeout_expected_tc += timer->timeout_periodic;
+    delta_list_remove_timer(timer);
+    // Re-insert a periodic timer in the same atomic section, so that a timer
+    // started from an interrupt cannot take the place it just freed.
+    if (timer->timeout_periodic != 0u) {
+      status = delta_list_insert_timer(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
+      if (status == SL_STATUS_OK) {
+        timer->timeout_expected_tc += timer->timeout_periodic;
+      }
+    }
+#if SL_SLEEPTIMER_COALESCING_ENABLE
+    // A timer that is done, or could not be re-inserted, loses its slack.
+    if (timer->timeout_periodic == 0u || status != SL_STATUS_OK) {
+      clear_timer_slack(timer);
+    }
+#endif
     CORE_EXIT_ATOMIC();
   }
 
@@ -1637,6 +2300,49 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
 static void update_next_timer_to_expire_is_power_manager(void)
 {
   sl_sleeptimer_timer_handle_t *current = timer_head;
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  sl_sleeptimer_tick_count_t timeout_limit = 1u;
+  uint32_t stack[TIMER_HEAP_WALK_STACK_SIZE];
+  uint32_t stack_count = 0u;
+
+  next_timer_to_expire_is_power_manager = false;
+
+  // Expired timers are all next to expire.
+  while (current != NULL) {
+    if (current->option_flags & SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) {
+      next_timer_to_expire_is_power_manager = true;
+      return;
+    }
+    current = current->next;
+  }
+
+  if (timer_heap_count == 0u) {
+    return;
+  }
+
+  // Check the heap timers that expire within a tick of the first timer,
+  // skipping the subtrees that expire later.
+  if (timer_head == NULL) {
+    timeout_limit = (timer_heap[0].expiration - last_delta_update_count) + 1u;
+  }
+  stack[stack_count++] = 0u;
+  while (stack_count > 0u) {
+    uint32_t index = stack[--stack_count];
+
+    if ((timer_heap[index].expiration - last_delta_update_count) > timeout_limit) {
+      continue;
+    }
+    if (timer_heap[index].handle->option_flags & SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) {
+      next_timer_to_expire_is_power_manager = true;
+      return;
+    }
+    for (uint32_t child = (2u * index) + 1u; child <= (2u * index) + 2u; child++) {
+      if (child < timer_heap_count && stack_count < TIMER_HEAP_WALK_STACK_SIZE) {
+        stack[stack_count++] = child;
+      }
+    }
+  }
+#else
   uint32_t delta_diff_with_first = 0;
 
   next_timer_to_expire_is_power_manager = false;
@@ -1652,6 +2358,7 @@ static void update_next_timer_to_expire_is_power_manager(void)
       delta_diff_with_first += current->delta;
     }
   }
+#endif
 }
 
 /**************************************************************************//**
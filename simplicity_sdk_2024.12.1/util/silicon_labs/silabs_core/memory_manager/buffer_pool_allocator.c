@@ -1,7 +1,10 @@
 /***************************************************************************//**
  * @file
  * @brief The source for a simple memory allocator that statically creates pools
- *        of fixed size buffers to allocate from.
+ *        of fixed size buffers to allocate from. An optional pool of small
+ *        buffers serves small requests first, so they do not use up the
+ *        large buffers. Each pool keeps a free list, so allocating and
+ *        freeing a buffer take constant time.
  *******************************************************************************
  * # License
  * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
@@ -17,6 +20,7 @@
  ******************************************************************************/
 
 #include <stdlib.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "buffer_pool_allocator.h"
@@ -47,21 +51,112 @@
   #endif
 #endif // defined(BUFFER_POOL_ALLOCATOR_USE_LOCAL_CONFIG_HEADER)
 
+#ifndef BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE
+  #define BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE 0U
+#endif
+
+#ifndef BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE
+  #define BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE 64U
+#endif
+
+#if BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE > 0U
+  #if BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE >= BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX
+    #error "BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE must be smaller than BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX"
+  #endif
+  #define BUFFER_POOL_COUNT 2U
+#else
+  #define BUFFER_POOL_COUNT 1U
+#endif
+
+#define BUFFER_POOL_TOTAL_SIZE \
+  (BUFFER_POOL_ALLOCATOR_POOL_SIZE + BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE)
+
+#if BUFFER_POOL_TOTAL_SIZE > 0xFFFFU
+  #error "Too many buffers in the buffer pool allocator"
+#endif
+
 #define INVALID_BUFFER_OBJ ((void*)0xFFFFFFFF)
+#define END_OF_FREE_LIST   (0xFFFFU)
+
+// Buffers are stored as words to keep the data 32 bit aligned. This will
+// prevent issues with the load and store multiple instructions if we overlay
+// a structure on the memory returned by the allocator.
+#define BUFFER_POOL_WORDS(size) (((size) + sizeof(uint32_t) - 1U) / sizeof(uint32_t))
 
+// A pool is a set of buffers of the same size, with a free list of the
+// buffers that are not in use. Handles of a pool are contiguous, starting at
+// firstHandle, and pools are ordered by increasing buffer size.
 typedef struct {
-  // Ensure the alignment is 32 bits for data. This will prevent issues with the
-  // load and store multiple instructions if we overlay a structure on the
-  // memory returned by the allocator.
-  uint32_t refCount;
-  uint8_t data[BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX];
-} BufferPoolObj_t;
+  uint32_t *data;
+  uint16_t bufferSize;
+  uint16_t firstHandle;
+  uint16_t count;
+  uint16_t freeHead;
+} BufferPool_t;
+
+static uint32_t largeBuffers[BUFFER_POOL_ALLOCATOR_POOL_SIZE]
+[BUFFER_POOL_WORDS(BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX)];
+#if BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE > 0U
+static uint32_t smallBuffers[BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE]
+[BUFFER_POOL_WORDS(BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE)];
+#endif
+
+static BufferPool_t pools[BUFFER_POOL_COUNT] = {
+#if BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE > 0U
+  {
+    .data = &smallBuffers[0][0],
+    .bufferSize = BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE,
+    .firstHandle = BUFFER_POOL_ALLOCATOR_POOL_SIZE,
+    .count = BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE,
+  },
+#endif
+  {
+    .data = &largeBuffers[0][0],
+    .bufferSize = BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX,
+    .firstHandle = 0U,
+    .count = BUFFER_POOL_ALLOCATOR_POOL_SIZE,
+  },
+};
+
+// Handles keep the values they had with a single pool: the large buffers
+// come first, followed by the small buffers.
+static uint32_t refCounts[BUFFER_POOL_TOTAL_SIZE];
+static uint16_t nextFree[BUFFER_POOL_TOTAL_SIZE];
+static bool freeListsInitialized = false;
+
+// Must be called from within a critical section
+static void initFreeLists(void)
+{
+  for (uint32_t c = 0; c < BUFFER_POOL_COUNT; c++) {
+    BufferPool_t *pool = &pools[c];
+    pool->freeHead = (pool->count > 0U) ? pool->firstHandle : END_OF_FREE_LIST;
+    for (uint16_t i = 0; i < pool->count; i++) {
+      uint16_t handle = pool->firstHandle + i;
+      nextFree[handle] = ((i + 1U) < pool->count) ? (handle + 1U) : END_OF_FREE_LIST;
+    }
+  }
+  freeListsInitialized = true;
+}
+
+static BufferPool_t *poolFromHandle(uint32_t handle)
+{
+#if BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE > 0U
+  if (handle >= BUFFER_POOL_ALLOCATOR_POOL_SIZE) {
+    return &pools[0];
+  }
+#endif
+  return &pools[BUFFER_POOL_COUNT - 1U];
+}
 
-static BufferPoolObj_t memoryObjs[BUFFER_POOL_ALLOCATOR_POOL_SIZE];
+static void *bufferFromHandle(uint32_t handle)
+{
+  BufferPool_t *pool = poolFromHandle(handle);
+
+  return &pool->data[(handle - pool->firstHandle) * BUFFER_POOL_WORDS(pool->bufferSize)];
+}
 
 void *memoryAllocate(uint32_t size)
 {
-  uint32_t i = 0;
   void *handle = INVALID_BUFFER_OBJ;
 
   // We can't support sizes greater than the maximum heap buffer size
@@ -71,10 +166,19 @@ void *memoryAllocate(uint32_t size)
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_CRITICAL();
-  for (i = 0; i < BUFFER_POOL_ALLOCATOR_POOL_SIZE; i++) {
-    if (memoryObjs[i].refCount == 0) {
-      memoryObjs[i].refCount = 1;
-      handle = (void*)i;
+  if (!freeListsInitialized) {
+    initFreeLists();
+  }
+  // Take a buffer from the smallest pool that fits, falling back to larger
+  // pools when it is exhausted.
+  for (uint32_t c = 0; c < BUFFER_POOL_COUNT; c++) {
+    BufferPool_t *pool = &pools[c];
+    if ((size <= pool->bufferSize)
+        && (pool->freeHead != END_OF_FREE_LIST)) {
+      uint16_t index = pool->freeHead;
+      pool->freeHead = nextFree[index];
+      refCounts[index] = 1;
+      handle = (void*)(uint32_t)index;
       break;
     }
   }
@@ -82,9 +186,9 @@ void *memoryAllocate(uint32_t size)
 
 #if BUFFER_POOL_ALLOCATOR_CLEAR_ON_INIT != 0U
   if (INVALID_BUFFER_OBJ != handle) {
-    memset(&memoryObjs[(uint32_t)handle].data,
+    memset(bufferFromHandle((uint32_t)handle),
            0,
-           BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX);
+           poolFromHandle((uint32_t)handle)->bufferSize);
   }
 #endif // BUFFER_POOL_ALLOCATOR_CLEAR_ON_INIT
 
@@ -97,14 +201,14 @@ void *memoryPtrFromHandle(void *handle)
 
   // Make sure we were given a valid handle
   if ((handle == INVALID_BUFFER_OBJ)
-      || ((uint32_t)handle >= BUFFER_POOL_ALLOCATOR_POOL_SIZE)) {
+      || ((uint32_t)handle >= BUFFER_POOL_TOTAL_SIZE)) {
     return NULL;
   }
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_CRITICAL();
-  if (memoryObjs[(uint32_t)handle].refCount > 0) {
-    ptr = memoryObjs[(uint32_t)handle].data;
+  if (refCounts[(uint32_t)handle] > 0) {
+    ptr = bufferFromHandle((uint32_t)handle);
   }
   CORE_EXIT_CRITICAL();
 
@@ -116,7 +220,14 @@ void memoryFree(void *handle)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_CRITICAL();
   if (memoryPtrFromHandle(handle) != NULL) {
-    memoryObjs[(uint32_t)handle].refCount--;
+    uint32_t index = (uint32_t)handle;
+    refCounts[index]--;
+    if (refCounts[index] == 0) {
+      // Return the buffer to the free list of its pool
+      BufferPool_t *pool = poolFromHandle(index);
+      nextFree[index] = pool->freeHead;
+      pool->freeHead = (uint16_t)index;
+    }
   }
   CORE_EXIT_CRITICAL();
 }
@@ -126,7 +237,7 @@ void memoryTakeReference(void *handle)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_CRITICAL();
   if (memoryPtrFromHandle(handle) != NULL) {
-    memoryObjs[(uint32_t)handle].refCount++;
+    refCounts[(uint32_t)handle]++;
   }
   CORE_EXIT_CRITICAL();
 }
@@ -1,7 +1,8 @@
 /***************************************************************************//**
  * @file
- * @brief This is a simple memory allocator that uses a build time defined pool
- *   of constant sized buffers. It's a very simple allocator, but one that can
+ * @brief This is a simple memory allocator that uses build time defined pools
+ *   of constant sized buffers. Requests are served from the pool with the
+ *   smallest buffers that fit. It's a very simple allocator, but one that can
  *   be easily used in any application.
  *******************************************************************************
  * # License
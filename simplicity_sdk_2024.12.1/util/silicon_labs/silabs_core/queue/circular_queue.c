@@ -21,6 +21,12 @@
 
 #include "sl_core.h"
 
+static inline uint16_t nextIndex(const Queue_t *queue, uint16_t index)
+{
+  index++;
+  return (index < queue->size) ? index : 0U;
+}
+
 bool queueInit(Queue_t *queue, uint16_t size)
 {
   // Make sure we have enough room for this queue
@@ -57,7 +63,10 @@ bool queueAdd(Queue_t *queue, void *data)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_CRITICAL();
   if (queue->count < queue->size) {
-    uint16_t index = (queue->head + queue->count) % queue->size;
+    uint16_t index = queue->head + queue->count;
+    if (index >= queue->size) {
+      index -= queue->size;
+    }
 
     // Insert this item at the end of the queue
     queue->data[index] = data;
@@ -71,7 +80,7 @@ bool queueAdd(Queue_t *queue, void *data)
     // Overwrite what's at the head of the queue since we're out of space
     if (added) {
       queue->data[queue->head] = data;
-      queue->head = (queue->head + 1) % queue->size;
+      queue->head = nextIndex(queue, queue->head);
     }
   }
   CORE_EXIT_CRITICAL();
@@ -111,7 +120,7 @@ void *queueRemove(Queue_t *queue)
   CORE_ENTER_CRITICAL();
   if (queue->count > 0) {
     ptr = queue->data[queue->head];
-    queue->head = (queue->head + 1) % queue->size;
+    queue->head = nextIndex(queue, queue->head);
     queue->count--;
   }
   CORE_EXIT_CRITICAL();
@@ -150,3 +159,170 @@ bool queueIsFull(Queue_t *queue)
 
   return result;
 }
+
+// -----------------------------------------------------------------------------
+// Single-Producer/Single-Consumer Queue Functions
+// -----------------------------------------------------------------------------
+// The indices count modulo 2^31, which a power of two size divides, and the
+// head keeps its index above a claim flag. The tail is only written by the
+// producer. The head is moved by the consumer, and by the producer when it
+// discards the oldest item on overflow. Both move it with a compare and swap,
+// so an item is only ever handed to one side, and the consumer backs off
+// while the producer has the oldest item claimed.
+
+#define SPSC_INDEX_MASK   0x7FFFFFFFUL
+#define SPSC_HEAD_CLAIMED 1UL
+
+static inline uint32_t spscHeadIndex(uint32_t head)
+{
+  return head >> 1;
+}
+
+static inline uint32_t spscHead(uint32_t index)
+{
+  return (index & SPSC_INDEX_MASK) << 1;
+}
+
+static inline uint32_t spscCount(uint32_t head, uint32_t tail)
+{
+  return (tail - spscHeadIndex(head)) & SPSC_INDEX_MASK;
+}
+
+bool spscQueueInit(SpscQueue_t *queue, uint16_t size)
+{
+  // Make sure we have enough room for this queue, and that the size is a
+  // power of two so the indices can be masked
+  if (queue == NULL || size == 0U || size > CIRCULAR_QUEUE_LEN_MAX
+      || (size & (size - 1U)) != 0U) {
+    return false;
+  }
+
+  queue->mask = size - 1U;
+  queue->callback = NULL;
+  atomic_store_explicit(&queue->head, 0U, memory_order_relaxed);
+  atomic_store_explicit(&queue->tail, 0U, memory_order_release);
+
+  return true;
+}
+
+bool spscQueueOverflow(SpscQueue_t *queue, SpscQueueOverflowCallback_t callback)
+{
+  queue->callback = callback;
+  return (callback != NULL);
+}
+
+bool spscQueueAdd(SpscQueue_t *queue, void *data)
+{
+  // Do nothing if there's no queue given
+  if (queue == NULL) {
+    return false;
+  }
+
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+  // Only the producer claims the head, so it is never claimed here
+  if (spscCount(head, tail) > queue->mask) {
+    // The queue is full. Claim the oldest item, unless the consumer got to
+    // it first, in which case there is room now.
+    if (atomic_compare_exchange_strong_explicit(&queue->head, &head,
+                                                head | SPSC_HEAD_CLAIMED,
+                                                memory_order_acquire,
+                                                memory_order_acquire)) {
+      bool discard = true;
+
+      // If an overflow callback exists, call it to see if the oldest queued
+      // item is to be replaced (default) or not.
+      if (queue->callback != NULL) {
+        void *oldest = atomic_load_explicit(&queue->data[spscHeadIndex(head) & queue->mask],
+                                            memory_order_relaxed);
+        discard = queue->callback(queue, oldest);
+      }
+      if (!discard) {
+        // Release the claim, leaving the oldest item at the head
+        atomic_store_explicit(&queue->head, head, memory_order_release);
+        return false;
+      }
+      atomic_store_explicit(&queue->head, spscHead(spscHeadIndex(head) + 1U),
+                            memory_order_release);
+    }
+  }
+
+  // Insert this item at the end of the queue
+  atomic_store_explicit(&queue->data[tail & queue->mask], data,
+                        memory_order_relaxed);
+  atomic_store_explicit(&queue->tail, (tail + 1U) & SPSC_INDEX_MASK,
+                        memory_order_release);
+
+  return true;
+}
+
+void *spscQueuePeek(SpscQueue_t *queue)
+{
+  // Do nothing if there's no queue given
+  if (queue == NULL) {
+    return NULL;
+  }
+
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  if (((head & SPSC_HEAD_CLAIMED) != 0U) || (spscCount(head, tail) == 0U)) {
+    return NULL;
+  }
+  return atomic_load_explicit(&queue->data[spscHeadIndex(head) & queue->mask],
+                              memory_order_relaxed);
+}
+
+void *spscQueueRemove(SpscQueue_t *queue)
+{
+  void *ptr;
+
+  // Do nothing if there's no queue given
+  if (queue == NULL) {
+    return NULL;
+  }
+
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  do {
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    // Leave the oldest item to the producer while it has it claimed
+    if (((head & SPSC_HEAD_CLAIMED) != 0U) || (spscCount(head, tail) == 0U)) {
+      return NULL;
+    }
+    ptr = atomic_load_explicit(&queue->data[spscHeadIndex(head) & queue->mask],
+                               memory_order_relaxed);
+    // Fails if the producer claimed or discarded this item meanwhile, in
+    // which case the head is looked at again
+  } while (!atomic_compare_exchange_weak_explicit(&queue->head, &head,
+                                                  spscHead(spscHeadIndex(head) + 1U),
+                                                  memory_order_acq_rel,
+                                                  memory_order_acquire));
+
+  return ptr;
+}
+
+bool spscQueueIsEmpty(SpscQueue_t *queue)
+{
+  if (queue == NULL) {
+    return true;
+  }
+
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  return spscCount(head, tail) == 0U;
+}
+
+bool spscQueueIsFull(SpscQueue_t *queue)
+{
+  if (queue == NULL) {
+    return true;
+  }
+
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  return spscCount(head, tail) > queue->mask;
+}
@@ -129,4 +129,110 @@ bool queueIsEmpty(Queue_t *queue);
  */
 bool queueIsFull(Queue_t *queue);
 
+// -----------------------------------------------------------------------------
+// Single-Producer/Single-Consumer Queue Functions
+// -----------------------------------------------------------------------------
+// C11 atomics have no C++ equivalent usable from a C header, so this variant
+// is only declared for C.
+#ifndef __cplusplus
+#include <stdatomic.h>
+
+/**
+ * Single-producer/single-consumer queue. Adding and removing items never
+ * disables interrupts, so the producer can be an interrupt handler that must
+ * not be delayed by the consumer, or the other way around. The size is a power
+ * of two and the indices run freely, so a slot is found by masking.
+ *
+ * The producer only moves the tail. The consumer moves the head, and so does
+ * the producer on overflow, after claiming the oldest item with a flag in the
+ * head index so that the consumer leaves it alone meanwhile.
+ */
+typedef struct SpscQueue {
+  atomic_uint_least32_t head;   // Index of the oldest item << 1, claim flag
+  atomic_uint_least32_t tail;   // Index of the next item to add
+  uint16_t mask;
+  bool (*callback)(const struct SpscQueue *queue, void *data);
+  _Atomic(void *) data[CIRCULAR_QUEUE_LEN_MAX];
+} SpscQueue_t;
+
+/**
+ * Pointer to a single-producer/single-consumer queue overflow callback
+ * function. It is called from the producer context.
+ * @param queue Pointer to the queue structure being overflowed.
+ * @param data Pointer to the oldest item, which is being considered for
+ * removal from the queue. The consumer can not take it while the callback
+ * runs.
+ * @return True to discard the oldest item and add the new one (default
+ * behavior) and false to keep the queue as it is and drop the new item.
+ */
+typedef bool (*SpscQueueOverflowCallback_t)(const SpscQueue_t *queue, void *data);
+
+/**
+ * Function to initialize a single-producer/single-consumer queue. Must not be
+ * called while the queue is in use.
+ * @param queue A pointer to the queue structure to initialize
+ * @param size The number of entries we want to allow you to store in this
+ * queue. Must be a power of two and not larger than CIRCULAR_QUEUE_LEN_MAX.
+ * @return Returns true if we were able to initialize the queue and false
+ * otherwise.
+ */
+bool spscQueueInit(SpscQueue_t *queue, uint16_t size);
+
+/**
+ * Specify a callback to be called upon queue overflow, as queueOverflow()
+ * does. Must not be called while the queue is in use.
+ * @param queue The queue to specify an overflow callback for.
+ * @param callback The callback to be called on queue overflow. If callback is
+ * NULL, no callback will be issued on queue overflow.
+ * @return Return true if a callback will be issued on queue overflow and
+ * false otherwise.
+ */
+bool spscQueueOverflow(SpscQueue_t *queue, SpscQueueOverflowCallback_t callback);
+
+/**
+ * Add the specified data pointer to the end of the queue. Must only be called
+ * from the producer context. Overflow is handled as by queueAdd().
+ * @param queue The queue to add the item to.
+ * @param data The pointer object to store in the queue.
+ * @return Returns true if the data was stored and false otherwise.
+ */
+bool spscQueueAdd(SpscQueue_t *queue, void *data);
+
+/**
+ * Return a pointer to the head of the queue without removing that item. Must
+ * only be called from the consumer context.
+ * @param queue The queue to peek at the item from.
+ * @return Returns a pointer to the data that is at the head of the queue. If
+ * the queue is empty, or the producer is deciding whether to discard the
+ * oldest item, this value will be NULL. The item may still be discarded by
+ * the producer on overflow before it is removed.
+ */
+void *spscQueuePeek(SpscQueue_t *queue);
+
+/**
+ * Remove an item from the head of the queue and return its pointer. Must only
+ * be called from the consumer context.
+ * @param queue The queue to remove the item from.
+ * @return Returns a pointer to the data that was at the head of the queue. If
+ * the queue is empty, or the producer is deciding whether to discard the
+ * oldest item, this value will be NULL. It's worth noting that NULL can also
+ * be a valid stored pointer.
+ */
+void *spscQueueRemove(SpscQueue_t *queue);
+
+/**
+ * Determine if the given queue is empty.
+ * @param queue The queue to check the status of.
+ * @return Returns true if the queue is empty and false otherwise.
+ */
+bool spscQueueIsEmpty(SpscQueue_t *queue);
+
+/**
+ * Determine if the given queue is full.
+ * @param queue The queue to check the status of.
+ * @return Returns true if the queue is full and false otherwise.
+ */
+bool spscQueueIsFull(SpscQueue_t *queue);
+#endif // __cplusplus
+
 #endif // CIRCULAR_QUEUE_H__
@@ -22,6 +22,8 @@
 #include <stdarg.h>
 
 #include "response_print.h"
+#include "sl_core.h"
+#include "sl_iostream.h"
 
 // -----------------------------------------------------------------------------
 // Configuration Macros
@@ -41,6 +43,18 @@
   #endif
 #endif // defined(RESPONSE_PRINT_USE_LOCAL_CONFIG_HEADER)
 
+#ifndef RESPONSE_PRINT_OUTPUT_BUFFER_SIZE
+  #define RESPONSE_PRINT_OUTPUT_BUFFER_SIZE 256U
+#endif
+
+#ifndef RESPONSE_PRINT_FAST_FORMAT
+  #define RESPONSE_PRINT_FAST_FORMAT 1U
+#endif
+
+// The fast formatter writes straight into the staging buffer
+#define RESPONSE_PRINT_FAST_FORMAT_ENABLED \
+  ((RESPONSE_PRINT_OUTPUT_BUFFER_SIZE > 0) && (RESPONSE_PRINT_FAST_FORMAT != 0))
+
 #define TAG_VALUE_OVERHEAD 3  // '{', '}', and '\0'
 
 #define RESPONSE_PRINT_RETURN_IF_DISABLED \
@@ -64,6 +78,19 @@ typedef enum StripMode {
   STRIP_VALUE, /**< Strip the ':valueFormat' portion of the string */
 } StripMode_t;
 
+/**
+ * @struct FormatSpec_t
+ * A parsed printf conversion specification as handled by the fast formatter.
+ */
+typedef struct FormatSpec {
+  bool leftJustify;  /**< The '-' flag was given */
+  bool zeroPad;      /**< The '0' flag was given */
+  bool isLong;       /**< The 'l' length modifier was given */
+  uint8_t width;     /**< Minimum field width */
+  int8_t precision;  /**< Precision, or -1 if none was given */
+  char conversion;   /**< The conversion character */
+} FormatSpec_t;
+
 // -----------------------------------------------------------------------------
 // Static Function Prototypes
 // -----------------------------------------------------------------------------
@@ -78,15 +105,407 @@ static int responsePrintInternal(StripMode_t stripMode,
                                  va_list args,
                                  bool finalize);
 
+static void responseOutputFlush(void);
+static void responseVOutput(const char *format, va_list args);
+static void responseOutput(const char *format, ...);
+
+#if RESPONSE_PRINT_FAST_FORMAT_ENABLED
+static size_t parseFormatSpec(const char *format, FormatSpec_t *spec);
+static bool fastFormatSupported(const char *formatString, StripMode_t stripMode);
+static void fastFormatOutput(const char *formatString,
+                             StripMode_t stripMode,
+                             va_list args);
+#endif
+
 // -----------------------------------------------------------------------------
 // Static Variables
 // -----------------------------------------------------------------------------
 static volatile bool responsePrintEnabled = true;
+static ResponsePrintStats_t responsePrintStats;
+
+#if RESPONSE_PRINT_OUTPUT_BUFFER_SIZE > 0
+// Staging buffer that collects a response until it is complete so that the
+// whole line can be handed to the output stream in a single write.
+static char outputBuffer[RESPONSE_PRINT_OUTPUT_BUFFER_SIZE];
+static size_t outputLength = 0;
+#endif
 
 // -----------------------------------------------------------------------------
 // Response Print Private Functions
 // -----------------------------------------------------------------------------
 
+#if RESPONSE_PRINT_OUTPUT_BUFFER_SIZE > 0
+/**
+ * Output printed from interrupt context bypasses the staging buffer so that it
+ * can't corrupt a response being assembled by the main loop.
+ * @return Returns true if output may be staged.
+ */
+static bool responseOutputStagingAvailable(void)
+{
+  return !CORE_InIrqContext();
+}
+#endif
+
+/**
+ * Write out anything collected in the staging buffer.
+ */
+static void responseOutputFlush(void)
+{
+#if RESPONSE_PRINT_OUTPUT_BUFFER_SIZE > 0
+  if ((outputLength == 0) || !responseOutputStagingAvailable()) {
+    return;
+  }
+  // Anything printed straight through stdio must go out first
+  fflush(stdout);
+  (void)sl_iostream_write(SL_IOSTREAM_STDOUT, outputBuffer, outputLength);
+  outputLength = 0;
+  responsePrintStats.flushes++;
+#endif
+}
+
+/**
+ * Format output into the staging buffer. Output that doesn't fit is printed
+ * directly after flushing whatever was already staged, so ordering is kept.
+ * @param format The printf-style format string.
+ * @param args The arguments for the format string.
+ */
+static void responseVOutput(const char *format, va_list args)
+{
+#if RESPONSE_PRINT_OUTPUT_BUFFER_SIZE > 0
+  if (responseOutputStagingAvailable()) {
+    va_list argsCopy;
+    size_t space = sizeof(outputBuffer) - outputLength;
+
+    va_copy(argsCopy, args);
+    int length = vsnprintf(&outputBuffer[outputLength], space, format, argsCopy);
+    va_end(argsCopy);
+    if ((length >= 0) && ((size_t)length < space)) {
+      outputLength += (size_t)length;
+      return;
+    }
+
+    // Make room by flushing what we have and try again with the whole buffer
+    if ((length >= 0) && (outputLength > 0)) {
+      responseOutputFlush();
+      va_copy(argsCopy, args);
+      length = vsnprintf(outputBuffer, sizeof(outputBuffer), format, argsCopy);
+      va_end(argsCopy);
+      if ((length >= 0) && ((size_t)length < sizeof(outputBuffer))) {
+        outputLength = (size_t)length;
+        return;
+      }
+    }
+    responseOutputFlush();
+    responsePrintStats.overflows++;
+  }
+#endif
+  vprintf(format, args);
+}
+
+static void responseOutput(const char *format, ...)
+{
+  va_list ap;
+
+  va_start(ap, format);
+  responseVOutput(format, ap);
+  va_end(ap);
+}
+
+#if RESPONSE_PRINT_FAST_FORMAT_ENABLED
+/**
+ * Put one character into the staging buffer, flushing it if it is full.
+ * Responses are made up of short fragments, so copying byte by byte is
+ * cheaper than calling into the C library for each one.
+ * @param c The character to output.
+ */
+static void responseOutputChar(char c)
+{
+  if (outputLength == sizeof(outputBuffer)) {
+    responseOutputFlush();
+  }
+  outputBuffer[outputLength++] = c;
+}
+
+static void responseOutputChars(const char *chars, size_t count)
+{
+  for (; count > 0; count--) {
+    responseOutputChar(*chars++);
+  }
+}
+
+static void responseOutputRepeat(char c, size_t count)
+{
+  for (; count > 0; count--) {
+    responseOutputChar(c);
+  }
+}
+
+/**
+ * Parse the printf conversion specification that follows a '%'. Only the
+ * subset needed by typical responses is supported: the '-' and '0' flags, a
+ * decimal width and precision, the 'l' length modifier and the d, i, u, x, X,
+ * c, s and % conversions.
+ * @param format The characters following the '%'.
+ * @param spec Where to store the parsed specification.
+ * @return Returns the number of characters consumed, or 0 if the
+ * specification is not supported.
+ */
+static size_t parseFormatSpec(const char *format, FormatSpec_t *spec)
+{
+  size_t i = 0;
+
+  memset(spec, 0, sizeof(*spec));
+  spec->precision = -1;
+
+  for (;; i++) {
+    if (format[i] == '-') {
+      spec->leftJustify = true;
+    } else if (format[i] == '0') {
+      spec->zeroPad = true;
+    } else {
+      break;
+    }
+  }
+  for (; (format[i] >= '0') && (format[i] <= '9'); i++) {
+    spec->width = (uint8_t)((spec->width * 10) + (format[i] - '0'));
+    if (spec->width > 64) {
+      return 0;
+    }
+  }
+  if (format[i] == '.') {
+    spec->precision = 0;
+    for (i++; (format[i] >= '0') && (format[i] <= '9'); i++) {
+      spec->precision = (int8_t)((spec->precision * 10) + (format[i] - '0'));
+      if (spec->precision > 64) {
+        return 0;
+      }
+    }
+  }
+  if (format[i] == 'l') {
+    spec->isLong = true;
+    i++;
+  }
+
+  spec->conversion = format[i];
+  switch (spec->conversion) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'c':
+    case 's':
+      return i + 1;
+    case '%':
+      // Only a bare "%%" is meaningful
+      return (i == 0) ? 1 : 0;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Check whether the fast formatter can produce exactly what the format string
+ * rewrite followed by vprintf() would. Anything it can't, including malformed
+ * tag:valueFormat pairs, is left to the general path.
+ * @param formatString The response format string.
+ * @param stripMode The strip mode the string will be printed with.
+ * @return Returns true if fastFormatOutput() can print this string.
+ */
+static bool fastFormatSupported(const char *formatString, StripMode_t stripMode)
+{
+  const char *segment = formatString;
+  size_t offset = 0;
+
+  if (stripMode == STRIP_VALUE) {
+    return false;
+  }
+
+  while (segment != NULL) {
+    const char *end = strchr(segment, ',');
+    size_t size = (end != NULL) ? (size_t)(end - segment) : strlen(segment);
+    uint32_t delimiters = 0;
+    size_t tagLength = 0;
+
+    if ((stripMode == STRIP_TAG) && (size > 0) && (segment[0] == '\n')) {
+      return false;
+    }
+    for (size_t i = 0; i < size; i++) {
+      if (segment[i] == ':') {
+        delimiters++;
+        tagLength = i + 1;
+      } else if (segment[i] == '%') {
+        FormatSpec_t spec;
+        size_t length = parseFormatSpec(&segment[i + 1], &spec);
+        if (length == 0) {
+          return false;
+        }
+        i += length;
+      }
+    }
+    if ((stripMode == STRIP_NONE) ? (delimiters != 1) : (delimiters > 1)) {
+      return false;
+    }
+
+    // Stay within the limit the rewritten format string would be held to
+    if ((RESPONSE_PRINT_FORMAT_STR_SIZE_MAX - offset) < (size + TAG_VALUE_OVERHEAD)) {
+      return false;
+    }
+    offset += size + 2 - ((stripMode == STRIP_TAG) ? tagLength : 0);
+    segment = (end != NULL) ? (end + 1) : NULL;
+  }
+  return true;
+}
+
+static void fastFormatInteger(const FormatSpec_t *spec,
+                              unsigned long magnitude,
+                              bool negative)
+{
+  static const char lowerDigits[] = "0123456789abcdef";
+  static const char upperDigits[] = "0123456789ABCDEF";
+  const char *digitTable = (spec->conversion == 'X') ? upperDigits : lowerDigits;
+  unsigned long base = ((spec->conversion == 'x') || (spec->conversion == 'X'))
+                       ? 16UL : 10UL;
+  char digits[3 * sizeof(unsigned long)];
+  char *first = &digits[sizeof(digits)];
+
+  // A zero value with a zero precision prints no digits at all
+  if ((magnitude != 0) || (spec->precision != 0)) {
+    do {
+      *--first = digitTable[magnitude % base];
+      magnitude /= base;
+    } while (magnitude != 0);
+  }
+  size_t count = (size_t)(&digits[sizeof(digits)] - first);
+
+  size_t zeros = ((spec->precision > 0) && ((size_t)spec->precision > count))
+                 ? ((size_t)spec->precision - count) : 0;
+  size_t length = count + zeros + (negative ? 1 : 0);
+  size_t padding = (spec->width > length) ? (spec->width - length) : 0;
+
+  if (spec->zeroPad && !spec->leftJustify && (spec->precision < 0)) {
+    zeros += padding;
+    padding = 0;
+  }
+  if (!spec->leftJustify) {
+    responseOutputRepeat(' ', padding);
+  }
+  if (negative) {
+    responseOutputChar('-');
+  }
+  responseOutputRepeat('0', zeros);
+  responseOutputChars(first, count);
+  if (spec->leftJustify) {
+    responseOutputRepeat(' ', padding);
+  }
+}
+
+static void fastFormatString(const FormatSpec_t *spec,
+                             const char *string,
+                             size_t length)
+{
+  size_t padding = (spec->width > length) ? (spec->width - length) : 0;
+
+  if (!spec->leftJustify) {
+    responseOutputRepeat(' ', padding);
+  }
+  responseOutputChars(string, length);
+  if (spec->leftJustify) {
+    responseOutputRepeat(' ', padding);
+  }
+}
+
+/**
+ * Print a response format string straight into the staging buffer, producing
+ * the same output as building the rewritten format string and handing it to
+ * vprintf(). Must only be called for strings that fastFormatSupported()
+ * accepted.
+ * @param formatString The response format string.
+ * @param stripMode Specifies whether the tag should be stripped.
+ * @param args The arguments for the value formats.
+ */
+static void fastFormatOutput(const char *formatString,
+                             StripMode_t stripMode,
+                             va_list args)
+{
+  const char *p = formatString;
+
+  while (true) {
+    // Any leading newlines go before the '{'
+    while (*p == '\n') {
+      responseOutputChar(*p++);
+    }
+    responseOutputChar('{');
+    if (stripMode == STRIP_TAG) {
+      const char *value = p;
+      while ((*value != '\0') && (*value != ',') && (*value != ':')) {
+        value++;
+      }
+      if (*value == ':') {
+        p = value + 1;
+      }
+    }
+
+    while ((*p != '\0') && (*p != ',')) {
+      if (*p != '%') {
+        responseOutputChar(*p++);
+        continue;
+      }
+
+      FormatSpec_t spec;
+      p += 1 + parseFormatSpec(p + 1, &spec);
+      switch (spec.conversion) {
+        case 'd':
+        case 'i': {
+          long value = spec.isLong ? va_arg(args, long) : va_arg(args, int);
+          unsigned long magnitude = (value < 0)
+                                    ? (0UL - (unsigned long)value)
+                                    : (unsigned long)value;
+          fastFormatInteger(&spec, magnitude, (value < 0));
+          break;
+        }
+        case 'u':
+        case 'x':
+        case 'X': {
+          unsigned long value = spec.isLong
+                                ? va_arg(args, unsigned long)
+                                : va_arg(args, unsigned int);
+          fastFormatInteger(&spec, value, false);
+          break;
+        }
+        case 'c': {
+          char c = (char)va_arg(args, int);
+          fastFormatString(&spec, &c, 1);
+          break;
+        }
+        case 's': {
+          const char *string = va_arg(args, const char *);
+          if (string == NULL) {
+            string = "(null)";
+          }
+          size_t length = 0;
+          while ((string[length] != '\0')
+                 && ((spec.precision < 0) || (length < (size_t)spec.precision))) {
+            length++;
+          }
+          fastFormatString(&spec, string, length);
+          break;
+        }
+        default: // '%'
+          responseOutputChar('%');
+          break;
+      }
+    }
+    responseOutputChar('}');
+
+    if (*p == '\0') {
+      break;
+    }
+    p++; // Skip the ','
+  }
+}
+#endif // RESPONSE_PRINT_FAST_FORMAT_ENABLED
+
 /**
  * Append the given tag:valueFormat pair to the format string while validating
  * it and adding any necessary framing characters. It can optionally strip off
@@ -184,6 +603,21 @@ static int responsePrintInternal(StripMode_t stripMode,
   uint32_t offset = 0;
   int rval = 0;
 
+#if RESPONSE_PRINT_FAST_FORMAT_ENABLED
+  // Most responses only use simple integer and string conversions; format
+  // those directly into the staging buffer without rewriting the string.
+  if (responseOutputStagingAvailable()
+      && fastFormatSupported(formatString, stripMode)) {
+    fastFormatOutput(formatString, stripMode, args);
+    responsePrintStats.fastFormats++;
+    if (finalize) {
+      responseOutputChars("}\n", 2);
+      responseOutputFlush();
+    }
+    return 0;
+  }
+#endif
+
   // Take the input string and convert it into valid response format
   while (end != NULL) {
     uint32_t size;
@@ -214,16 +648,17 @@ static int responsePrintInternal(StripMode_t stripMode,
     start = end + 1;
   }
   // Print out the parsed format buffer
-  vprintf(buffer, args);
+  responseVOutput(buffer, args);
 
   // Print out the error code if there is one
   if (rval < 0) {
-    printf(" {internal_error:%d}", -rval);
+    responseOutput(" {internal_error:%d}", -rval);
   } else {
     rval = 0;
   }
   if (finalize) {
-    printf("}\n");
+    responseOutput("}\n");
+    responseOutputFlush();
   }
 
   return rval;
@@ -244,7 +679,7 @@ bool responsePrintHeader(char *command, char *formatString, ...)
   va_list ap;
 
   va_start(ap, formatString);
-  printf("#");  // Header strings start with a '#'
+  responseOutput("#");  // Header strings start with a '#'
   if (!responsePrintStart(command)) {
     va_end(ap);
     return false;
@@ -300,9 +735,10 @@ bool responsePrintStart(char *command)
 {
   RESPONSE_PRINT_RETURN_IF_DISABLED;
   // Print the start of command standard formatting
-  printf("{");
   if (command != NULL) {
-    printf("{(%s)}", command);
+    responseOutput("{{(%s)}", command);
+  } else {
+    responseOutput("{");
   }
   return true;
 }
@@ -329,7 +765,8 @@ bool responsePrintEnd(char *formatString, ...)
   bool success = true;
   va_start(ap, formatString);
   if (formatString[0] == '}') {
-    printf("%s\n", formatString);
+    responseOutput("%s\n", formatString);
+    responseOutputFlush();
   } else {
     success = (responsePrintInternal(STRIP_NONE, formatString, ap, true) == 0);
   }
@@ -345,28 +782,50 @@ bool responsePrintError(char *command, uint8_t code, char *formatString, ...)
   va_start(ap, formatString);
 
   // Print the command name
-  printf("{");
   if (command != NULL) {
-    printf("{(%s)}", command);
+    responseOutput("{{(%s)}", command);
+  } else {
+    responseOutput("{");
   }
 
   // Print the formatted error string.
   // @todo: Add validation of the formatString
-  printf("{error:");
-  vprintf(formatString, ap);
-  printf("}");
+  responseOutput("{error:");
+  responseVOutput(formatString, ap);
+
+  // Print the error code if it was specified and terminate the response
+  responseOutput("}{errorCode:%d}}\n", code);
+  responseOutputFlush();
 
-  // Print the error code if it was specified
-  printf("{errorCode:%d}", code);
+  va_end(ap);
 
-  // Terminate the response
-  printf("}\n");
+  return true;
+}
+
+bool responsePrintRaw(char *formatString, ...)
+{
+  RESPONSE_PRINT_RETURN_IF_DISABLED;
+  va_list ap;
 
+  va_start(ap, formatString);
+  responseVOutput(formatString, ap);
   va_end(ap);
 
   return true;
 }
 
+void responsePrintFlush(void)
+{
+  responseOutputFlush();
+}
+
+void responsePrintGetStats(ResponsePrintStats_t *stats)
+{
+  if (stats != NULL) {
+    *stats = responsePrintStats;
+  }
+}
+
 int sprintfFloat(char *buffer, int8_t len, float f, uint8_t precision)
 {
   int8_t isNegative = (f < 0) ? 1 : 0;
@@ -63,6 +63,20 @@
 #include <stdbool.h>
 #include <stdarg.h>
 
+// -----------------------------------------------------------------------------
+// Structures and Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @struct ResponsePrintStats_t
+ * Counters describing how responses were written to the output stream.
+ */
+typedef struct ResponsePrintStats {
+  uint32_t flushes;     /**< Number of writes of the staging buffer */
+  uint32_t overflows;   /**< Number of prints too large to stage */
+  uint32_t fastFormats; /**< Number of prints handled by the fast formatter */
+} ResponsePrintStats_t;
+
 // -----------------------------------------------------------------------------
 // Response Print Functions
 // -----------------------------------------------------------------------------
@@ -179,4 +193,27 @@ bool responsePrintError(char *command, uint8_t code, char *formatString, ...);
  */
 int sprintfFloat(char *buffer, int8_t len, float f, uint8_t precision);
 
+/**
+ * Print free-form text as part of the response currently being built. Output
+ * is staged along with the response so it is written out in order with it.
+ * Use this instead of printf() between responsePrintStart and responsePrintEnd.
+ * @param formatString The printf-style format string.
+ * @param ... The values to be printed based on the given format.
+ * @return Returns true on success and false on failure.
+ */
+bool responsePrintRaw(char *formatString, ...);
+
+/**
+ * Write out any staged output immediately. Responses are flushed
+ * automatically when they are terminated, so this is only needed when
+ * text was printed with responsePrintRaw outside of a response.
+ */
+void responsePrintFlush(void);
+
+/**
+ * Get the output staging counters.
+ * @param stats Where to store the counters.
+ */
+void responsePrintGetStats(ResponsePrintStats_t *stats);
+
 #endif // RESPONSE_PRINT_H__
@@ -0,0 +1,140 @@
+/***************************************************************************//**
+ * @file
+ * @brief Times binary frame dispatch over the generated command table, with and without the command ID index.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "sl_cli.h"
+#include "sl_cli_command.h"
+#include "sl_cli_binary.h"
+#include "sli_cli_binary.h"
+#include "sl_iostream.h"
+
+// Usage: bench_cli_binary_dispatch [rounds]
+//
+// Each round sends one frame without fields for every command of the
+// generated command table, sub group commands included. Commands that take
+// arguments answer with an error, after the same lookup.
+
+#define MAX_COMMANDS 512
+
+extern const sl_cli_command_entry_t sl_cli_default_command_table[];
+
+static uint32_t cmd_ids[MAX_COMMANDS];
+static size_t cmd_count;
+
+static sl_status_t discard_write(void *context, const void *buffer, size_t buffer_length)
+{
+  (void)context;
+  (void)buffer;
+  (void)buffer_length;
+  return SL_STATUS_OK;
+}
+
+static sl_iostream_t discard_stream = { .write = discard_write };
+
+static void collect(const sl_cli_command_entry_t *table, const char *prefix)
+{
+  char path[SL_CLI_INPUT_BUFFER_SIZE];
+
+  for (; table->name != NULL; table++) {
+    if (table->is_shortcut) {
+      continue;
+    }
+    snprintf(path, sizeof(path), "%s%s%s", prefix, (prefix[0] != '\0') ? " " : "", table->name);
+    if (table->command->arg_type_list[0] == SL_CLI_ARG_GROUP) {
+      collect((const sl_cli_command_entry_t *)table->command->function, path);
+    } else {
+      TEST_ASSERT(cmd_count < MAX_COMMANDS);
+      cmd_ids[cmd_count++] = sl_cli_binary_get_command_id(path);
+    }
+  }
+}
+
+static void send_frame(struct sl_cli *cli, uint32_t cmd_id)
+{
+  uint8_t frame[8];
+  uint8_t checksum = 0;
+  bool ready = false;
+
+  frame[0] = SL_CLI_BINARY_SOF;
+  frame[1] = 4;
+  frame[2] = 0;
+  for (int i = 0; i < 4; i++) {
+    frame[3 + i] = (uint8_t)(cmd_id >> (8 * i));
+  }
+  for (int i = 1; i < 7; i++) {
+    checksum += frame[i];
+  }
+  frame[7] = (uint8_t)(0U - checksum);
+  for (int i = 0; i < 8; i++) {
+    (void)sli_cli_binary_input_char(cli, frame[i], &ready);
+  }
+  TEST_ASSERT(ready);
+  sli_cli_binary_handle_frame(cli);
+}
+
+static double run(struct sl_cli *cli, unsigned long rounds)
+{
+  uint64_t start = host_time_ns();
+
+  for (unsigned long r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < cmd_count; i++) {
+      send_frame(cli, cmd_ids[i]);
+    }
+  }
+  return (double)(host_time_ns() - start) / ((double)rounds * (double)cmd_count);
+}
+
+int main(int argc, char *argv[])
+{
+  static struct sl_cli indexed;
+  static struct sl_cli walked;
+  static sl_cli_command_group_t group = { { NULL }, false, sl_cli_default_command_table };
+  static sl_cli_command_group_t group_walk = { { NULL }, false, sl_cli_default_command_table };
+  unsigned long rounds = host_arg(argc, argv, 1, 2000);
+
+  collect(sl_cli_default_command_table, "");
+  indexed.input_size = SL_CLI_INPUT_BUFFER_SIZE;
+  indexed.iostream_handle = &discard_stream;
+  walked.input_size = SL_CLI_INPUT_BUFFER_SIZE;
+  walked.iostream_handle = &discard_stream;
+  sl_cli_command_add_command_group(&indexed, &group);
+  sl_cli_command_add_command_group(&walked, &group_walk);
+  group_walk.command_id_index.entries = NULL;
+  TEST_ASSERT(group.command_id_index.entries != NULL);
+  sl_iostream_set_default(&discard_stream);
+
+  printf("%zu commands, %lu rounds\n", cmd_count, rounds);
+  printf("  walk:  %7.1f ns per frame\n", run(&walked, rounds));
+  printf("  index: %7.1f ns per frame\n", run(&indexed, rounds));
+  return 0;
+}
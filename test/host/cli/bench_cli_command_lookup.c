@@ -0,0 +1,87 @@
+/***************************************************************************//**
+ * @file
+ * @brief Benchmark of CLI command lookup with and without the command index.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "host_test.h"
+#include "sl_cli_command.h"
+#include "sl_cli_tokenize.h"
+
+// Usage: bench_cli_command_lookup [rounds]
+//
+// Each round looks up every command of the generated command table once,
+// tokenizing a fresh copy of the name as the CLI does for each input line.
+
+extern const sl_cli_command_entry_t sl_cli_default_command_table[];
+
+static volatile uintptr_t sink;
+
+static double run(struct sl_cli *cli, unsigned long rounds, size_t count)
+{
+  char input[SL_CLI_INPUT_BUFFER_SIZE];
+  char *token_v[SL_CLI_MAX_INPUT_ARGUMENTS];
+  int token_c;
+  int arg_ofs;
+  bool single;
+  bool help;
+  uint64_t start = host_time_ns();
+
+  for (unsigned long r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      strcpy(input, sl_cli_default_command_table[i].name);
+      sl_cli_tokenize(input, &token_c, token_v);
+      sink += (uintptr_t)sl_cli_command_find(cli, &token_c, token_v, &arg_ofs, &single, &help);
+    }
+  }
+  return (double)(host_time_ns() - start) / ((double)rounds * (double)count);
+}
+
+int main(int argc, char *argv[])
+{
+  static struct sl_cli indexed;
+  static struct sl_cli scanned;
+  static sl_cli_command_group_t group = { { NULL }, false, sl_cli_default_command_table };
+  static sl_cli_command_group_t group_scan = { { NULL }, false, sl_cli_default_command_table };
+  unsigned long rounds = host_arg(argc, argv, 1, 20000);
+  size_t count = 0;
+
+  while (sl_cli_default_command_table[count].name != NULL) {
+    count++;
+  }
+  sl_cli_command_add_command_group(&indexed, &group);
+  sl_cli_command_add_command_group(&scanned, &group_scan);
+  group_scan.command_index.entries = NULL;
+  TEST_ASSERT(group.command_index.entries != NULL);
+
+  printf("%zu commands, %lu rounds\n", count, rounds);
+  printf("  scan:  %7.1f ns per lookup\n", run(&scanned, rounds, count));
+  printf("  index: %7.1f ns per lookup\n", run(&indexed, rounds, count));
+  return 0;
+}
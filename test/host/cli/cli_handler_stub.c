@@ -0,0 +1,42 @@
+/***************************************************************************//**
+ * @file
+ * @brief Records calls to the stubbed command handlers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "cli_handler_stub.h"
+
+const char *cli_handler_stub_last_name;
+sl_cli_command_arg_t cli_handler_stub_last_arguments;
+unsigned long cli_handler_stub_call_count;
+
+void cli_handler_stub_called(const char *name, sl_cli_command_arg_t *arguments)
+{
+  cli_handler_stub_last_name = name;
+  cli_handler_stub_last_arguments = *arguments;
+  cli_handler_stub_call_count++;
+}
@@ -0,0 +1,54 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the CLI standard I/O functions.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "sli_cli_io.h"
+
+// Help and error text is not checked by the harnesses, only counted.
+unsigned long cli_io_output_count;
+
+int sli_cli_io_getchar(void)
+{
+  return EOF;
+}
+
+int sli_cli_io_putchar(int ch)
+{
+  cli_io_output_count++;
+  return ch;
+}
+
+int sli_cli_io_printf(const char *format, ...)
+{
+  (void)format;
+  cli_io_output_count++;
+  return 0;
+}
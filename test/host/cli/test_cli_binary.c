@@ -0,0 +1,382 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks binary framed CLI commands: command IDs, discovery and output capture.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "sl_cli.h"
+#include "sl_cli_command.h"
+#include "sl_cli_arguments.h"
+#include "sl_cli_binary.h"
+#include "sli_cli_binary.h"
+#include "sl_iostream.h"
+
+#define FILLER_COUNT  40
+// More than fit in the command ID pool next to the root table
+#define LARGE_COUNT   (SL_CLI_BINARY_CMD_ID_POOL_SIZE - 8)
+
+// Bytes written to a test stream
+typedef struct {
+  uint8_t data[4096];
+  size_t len;
+} sink_t;
+
+static sink_t console;   // Stands for the default stream of the application
+static sink_t wire;      // The iostream of the CLI instance
+
+static sl_status_t sink_write(void *context, const void *buffer, size_t buffer_length)
+{
+  sink_t *sink = (sink_t *)context;
+
+  TEST_ASSERT(sink->len + buffer_length <= sizeof(sink->data));
+  memcpy(&sink->data[sink->len], buffer, buffer_length);
+  sink->len += buffer_length;
+  return SL_STATUS_OK;
+}
+
+static sl_iostream_t console_stream = { .context = &console, .write = sink_write };
+static sl_iostream_t wire_stream = { .context = &wire, .write = sink_write };
+
+// stdout retargeted to the default iostream, fully buffered as newlib does
+static ssize_t retarget_write(void *cookie, const char *buf, size_t size)
+{
+  (void)cookie;
+  sl_iostream_write(sl_iostream_get_default(), buf, size);
+  return (ssize_t)size;
+}
+
+static uint8_t echo_value;
+static char echo_string[32];
+static uint16_t inner_value;
+static int inner_argc;
+
+static void cmd_echo(sl_cli_command_arg_t *arguments)
+{
+  echo_value = sl_cli_get_argument_uint8(arguments, 0);
+  strncpy(echo_string, sl_cli_get_argument_string(arguments, 1), sizeof(echo_string) - 1);
+  // No newline, so the text stays in the stdio buffer until flushed
+  printf("echo %s", echo_string);
+}
+
+static void cmd_inner(sl_cli_command_arg_t *arguments)
+{
+  inner_argc = sl_cli_get_argument_count(arguments);
+  inner_value = (inner_argc > 0) ? sl_cli_get_argument_uint16(arguments, 0) : 0;
+}
+
+static void cmd_filler(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+}
+
+static const sl_cli_command_info_t echo_info =
+  SL_CLI_COMMAND(cmd_echo, "", "", { SL_CLI_ARG_UINT8, SL_CLI_ARG_STRING, SL_CLI_ARG_END, });
+static const sl_cli_command_info_t inner_info =
+  SL_CLI_COMMAND(cmd_inner, "", "", { SL_CLI_ARG_UINT16OPT, SL_CLI_ARG_END, });
+static const sl_cli_command_info_t filler_info =
+  SL_CLI_COMMAND(cmd_filler, "", "", { SL_CLI_ARG_END, });
+
+static const sl_cli_command_entry_t sub_table[] = {
+  { "inner", &inner_info, false },
+  { NULL, NULL, false },
+};
+static const sl_cli_command_info_t sub_group_info = SL_CLI_COMMAND_GROUP(sub_table, "");
+
+static char filler_names[FILLER_COUNT][8];
+static sl_cli_command_entry_t root_table[FILLER_COUNT + 4];
+
+static struct sl_cli cli;
+
+static void add_entry(size_t i, const char *name, const sl_cli_command_info_t *info, bool is_shortcut)
+{
+  sl_cli_command_entry_t entry = { name, info, is_shortcut };
+
+  // The entry members are const, so the table is filled by copy
+  memcpy(&root_table[i], &entry, sizeof(entry));
+}
+static sl_cli_command_group_t group = { { NULL }, false, root_table };
+
+static char large_names[LARGE_COUNT][8];
+static sl_cli_command_entry_t large_table[LARGE_COUNT + 1];
+static sl_cli_command_group_t large_group = { { NULL }, false, large_table };
+
+// Response of the last request
+static uint32_t rsp_cmd_id;
+static sl_status_t rsp_status;
+static uint8_t rsp_flags;
+static uint8_t rsp_fields[1024];
+static size_t rsp_fields_len;
+
+static void request(uint32_t cmd_id, const uint8_t *fields, size_t fields_len)
+{
+  uint8_t frame[SL_CLI_INPUT_BUFFER_SIZE + 8];
+  size_t len = 4 + fields_len;
+  uint8_t checksum = 0;
+  size_t n = 0;
+  bool ready = false;
+
+  frame[n++] = SL_CLI_BINARY_SOF;
+  frame[n++] = (uint8_t)len;
+  frame[n++] = (uint8_t)(len >> 8);
+  for (int i = 0; i < 4; i++) {
+    frame[n++] = (uint8_t)(cmd_id >> (8 * i));
+  }
+  memcpy(&frame[n], fields, fields_len);
+  n += fields_len;
+  for (size_t i = 1; i < n; i++) {
+    checksum += frame[i];
+  }
+  frame[n++] = (uint8_t)(0U - checksum);
+
+  for (size_t i = 0; i < n; i++) {
+    TEST_ASSERT(!ready);
+    TEST_ASSERT(sli_cli_binary_input_char(&cli, frame[i], &ready));
+  }
+  TEST_ASSERT(ready);
+
+  wire.len = 0;
+  sli_cli_binary_handle_frame(&cli);
+
+  // Parse the response frame
+  TEST_ASSERT(wire.len >= 4 + SL_CLI_BINARY_RESPONSE_HEADER_SIZE);
+  TEST_ASSERT_EQUAL(SL_CLI_BINARY_SOF, wire.data[0]);
+  len = wire.data[1] | ((size_t)wire.data[2] << 8);
+  TEST_ASSERT_EQUAL(wire.len, len + 4);
+  checksum = 0;
+  for (size_t i = 1; i < wire.len; i++) {
+    checksum += wire.data[i];
+  }
+  TEST_ASSERT_EQUAL(0, checksum);
+  rsp_cmd_id = 0;
+  rsp_status = 0;
+  for (int i = 0; i < 4; i++) {
+    rsp_cmd_id |= (uint32_t)wire.data[3 + i] << (8 * i);
+    rsp_status |= (uint32_t)wire.data[7 + i] << (8 * i);
+  }
+  rsp_flags = wire.data[11];
+  rsp_fields_len = len - SL_CLI_BINARY_RESPONSE_HEADER_SIZE;
+  memcpy(rsp_fields, &wire.data[3 + SL_CLI_BINARY_RESPONSE_HEADER_SIZE], rsp_fields_len);
+  TEST_ASSERT_EQUAL(cmd_id, rsp_cmd_id);
+}
+
+static uint32_t fnv1a(const char *s)
+{
+  uint32_t hash = 2166136261UL;
+
+  while (*s != '\0') {
+    hash ^= (uint8_t)*s++;
+    hash *= 16777619UL;
+  }
+  return hash & 0x7FFFFFFFUL;
+}
+
+// Collect the command list, page by page
+static size_t list_all(char paths[][32], uint32_t ids[], size_t max, int *pages)
+{
+  uint16_t start = 0;
+  uint16_t total;
+  size_t count = 0;
+
+  *pages = 0;
+  do {
+    uint8_t field[4] = { SL_CLI_ARG_UINT16, 2, (uint8_t)start, (uint8_t)(start >> 8) };
+    size_t pos = 0;
+    size_t first = count;
+    uint16_t next;
+
+    request(SL_CLI_BINARY_CMD_ID_LIST, field, sizeof(field));
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+    (*pages)++;
+    while (rsp_fields_len - pos > 8) {
+      TEST_ASSERT_EQUAL(SL_CLI_ARG_UINT32, rsp_fields[pos]);
+      TEST_ASSERT_EQUAL(4, rsp_fields[pos + 1]);
+      TEST_ASSERT(count < max);
+      memcpy(&ids[count], &rsp_fields[pos + 2], 4);
+      pos += 6;
+      TEST_ASSERT_EQUAL(SL_CLI_ARG_STRING, rsp_fields[pos]);
+      memcpy(paths[count], &rsp_fields[pos + 2], rsp_fields[pos + 1]);
+      paths[count][rsp_fields[pos + 1]] = '\0';
+      pos += 2 + rsp_fields[pos + 1];
+      count++;
+    }
+    TEST_ASSERT_EQUAL(8, rsp_fields_len - pos);
+    TEST_ASSERT_EQUAL(SL_CLI_ARG_UINT16, rsp_fields[pos]);
+    next = rsp_fields[pos + 2] | (rsp_fields[pos + 3] << 8);
+    total = rsp_fields[pos + 6] | (rsp_fields[pos + 7] << 8);
+    TEST_ASSERT_EQUAL(start + (count - first), next);
+    TEST_ASSERT((next > start) || (next == total));
+    start = next;
+  } while (start < total);
+
+  TEST_ASSERT_EQUAL(total, count);
+  return count;
+}
+
+int main(void)
+{
+  static char paths[FILLER_COUNT + 8][32];
+  static uint32_t ids[FILLER_COUNT + 8];
+  uint8_t fields[64];
+  size_t n = 0;
+  int pages;
+
+  // A shortcut, a command with arguments, a sub group and filler commands
+  add_entry(n++, "e", &echo_info, true);
+  add_entry(n++, "echo", &echo_info, false);
+  add_entry(n++, "grp", &sub_group_info, false);
+  for (int i = 0; i < FILLER_COUNT; i++) {
+    snprintf(filler_names[i], sizeof(filler_names[i]), "fill%02d", i);
+    add_entry(n++, filler_names[i], &filler_info, false);
+  }
+
+  cli.input_size = SL_CLI_INPUT_BUFFER_SIZE;
+  cli.iostream_handle = &wire_stream;
+  TEST_ASSERT(sl_cli_command_add_command_group(&cli, &group));
+  sl_iostream_set_default(&console_stream);
+  cookie_io_functions_t retarget = { .write = retarget_write };
+  FILE *retargeted = fopencookie(NULL, "w", retarget);
+  setvbuf(retargeted, NULL, _IOFBF, 256);
+  FILE *host_stdout = stdout;
+  stdout = retargeted;
+
+  // IDs are the FNV-1a hash of the command path
+  TEST_ASSERT_EQUAL(0x640C292CUL, sl_cli_binary_get_command_id("a"));
+  TEST_ASSERT_EQUAL(fnv1a("echo"), sl_cli_binary_get_command_id("echo"));
+  TEST_ASSERT_EQUAL(fnv1a("grp inner"), sl_cli_binary_get_command_id("  grp   inner "));
+
+  // Discovery lists every command, sub group commands included and shortcuts
+  // excluded, over several pages
+  size_t count = list_all(paths, ids, sizeof(ids) / sizeof(ids[0]), &pages);
+  TEST_ASSERT_EQUAL(2 + FILLER_COUNT, count);
+  TEST_ASSERT(pages > 1);
+  TEST_ASSERT(strcmp(paths[0], "echo") == 0);
+  TEST_ASSERT(strcmp(paths[1], "grp inner") == 0);
+  for (size_t i = 0; i < count; i++) {
+    TEST_ASSERT_EQUAL(sl_cli_binary_get_command_id(paths[i]), ids[i]);
+  }
+  // A start past the end gives an empty list
+  uint8_t past[4] = { SL_CLI_ARG_UINT16, 2, 200, 0 };
+  request(SL_CLI_BINARY_CMD_ID_LIST, past, sizeof(past));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+  TEST_ASSERT_EQUAL(8, rsp_fields_len);
+
+  // A command in a sub group, with and without its optional argument
+  uint8_t inner_arg[4] = { SL_CLI_ARG_UINT16, 2, 0x34, 0x12 };
+  request(sl_cli_binary_get_command_id("grp inner"), inner_arg, sizeof(inner_arg));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+  TEST_ASSERT_EQUAL(1, inner_argc);
+  TEST_ASSERT_EQUAL(0x1234, inner_value);
+  request(sl_cli_binary_get_command_id("grp inner"), NULL, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+  TEST_ASSERT_EQUAL(0, inner_argc);
+
+  // Groups, shortcuts and unknown IDs are not commands
+  request(sl_cli_binary_get_command_id("grp"), NULL, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, rsp_status);
+  request(sl_cli_binary_get_command_id("e"), NULL, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, rsp_status);
+
+  // Output pending before the request stays on the default stream. The
+  // handler's buffered output goes into the response, not after it.
+  printf("pending");
+  console.len = 0;
+  n = 0;
+  fields[n++] = SL_CLI_ARG_UINT8;
+  fields[n++] = 1;
+  fields[n++] = 41;
+  fields[n++] = SL_CLI_ARG_STRING;
+  fields[n++] = 2;
+  fields[n++] = 'h';
+  fields[n++] = 'i';
+  request(sl_cli_binary_get_command_id("echo"), fields, n);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+  TEST_ASSERT_EQUAL(0, rsp_flags);
+  TEST_ASSERT_EQUAL(41, echo_value);
+  TEST_ASSERT(strcmp(echo_string, "hi") == 0);
+  TEST_ASSERT_EQUAL(SL_CLI_ARG_STRING, rsp_fields[0]);
+  TEST_ASSERT_EQUAL(7, rsp_fields[1]);
+  TEST_ASSERT(memcmp(&rsp_fields[2], "echo hi", 7) == 0);
+  TEST_ASSERT_EQUAL(9, rsp_fields_len);
+  TEST_ASSERT_EQUAL(7, console.len);
+  TEST_ASSERT(memcmp(console.data, "pending", 7) == 0);
+  fflush(stdout);
+  TEST_ASSERT_EQUAL(7, console.len);
+
+  // Wrong argument type
+  fields[0] = SL_CLI_ARG_UINT16;
+  request(sl_cli_binary_get_command_id("echo"), fields, n);
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_TYPE, rsp_status);
+
+  // The root group got an ID index. Dispatch through it finds the same
+  // commands as walking the group, and unknown IDs in neither.
+  TEST_ASSERT(group.command_id_index.entries != NULL);
+  TEST_ASSERT_EQUAL(2 + FILLER_COUNT, group.command_id_index.count);
+  for (size_t i = 0; i < group.command_id_index.count; i++) {
+    TEST_ASSERT((i == 0)
+                || (group.command_id_index.entries[i - 1].cmd_id
+                    <= group.command_id_index.entries[i].cmd_id));
+  }
+  sl_cli_command_id_index_t id_index = group.command_id_index;
+  for (int pass = 0; pass < 2; pass++) {
+    request(sl_cli_binary_get_command_id("grp inner"), inner_arg, sizeof(inner_arg));
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+    request(sl_cli_binary_get_command_id("fill07"), NULL, 0);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+    request(sl_cli_binary_get_command_id("fill"), NULL, 0);
+    TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, rsp_status);
+    group.command_id_index.entries = NULL;
+  }
+  group.command_id_index = id_index;
+
+  // A group that does not fit in the pool is walked
+  for (size_t i = 0; i < LARGE_COUNT; i++) {
+    snprintf(large_names[i], sizeof(large_names[i]), "big%03zu", i);
+    sl_cli_command_entry_t entry = { large_names[i], &filler_info, false };
+    memcpy(&large_table[i], &entry, sizeof(entry));
+  }
+  TEST_ASSERT(sl_cli_command_add_command_group(&cli, &large_group));
+  TEST_ASSERT(large_group.command_id_index.entries == NULL);
+  request(sl_cli_binary_get_command_id("big123"), NULL, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, rsp_status);
+  request(sl_cli_binary_get_command_id("echo"), fields, n);
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_TYPE, rsp_status);
+  TEST_ASSERT(sl_cli_command_remove_command_group(&cli, &large_group));
+
+  // Exit goes back to text mode
+  request(SL_CLI_BINARY_CMD_ID_EXIT, NULL, 0);
+  TEST_ASSERT(!sl_cli_binary_get_mode(&cli));
+
+  stdout = host_stdout;
+  fclose(retargeted);
+  printf("%zu commands listed in %d pages\n", count, pages);
+  return 0;
+}
@@ -0,0 +1,214 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks the CLI command index against a scan of the command table.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <ctype.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "sl_cli_command.h"
+#include "sl_cli_arguments.h"
+#include "sl_cli_tokenize.h"
+#include "sli_cli_command.h"
+
+extern const sl_cli_command_entry_t sl_cli_default_command_table[];
+
+static void handler(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+}
+
+static const sl_cli_command_info_t cmd_info = SL_CLI_COMMAND(handler, "", "", { SL_CLI_ARG_END, });
+
+static const sl_cli_command_entry_t sub_table[] = {
+  { "inner", &cmd_info, false },
+  { NULL, NULL, false },
+};
+
+static const sl_cli_command_info_t sub_group_info = SL_CLI_COMMAND_GROUP(sub_table, "");
+
+// Names that only differ by case, a shortcut and a sub group
+static const sl_cli_command_entry_t case_table[] = {
+  { "beta", &cmd_info, false },
+  { "Alpha", &cmd_info, false },
+  { "alpha", &cmd_info, false },
+  { "grp", &sub_group_info, false },
+  { "b", &cmd_info, true },
+  { "ALPHA", &cmd_info, false },
+  { NULL, NULL, false },
+};
+
+#define LARGE_TABLE_SIZE  50
+static char large_names[LARGE_TABLE_SIZE][8];
+static sl_cli_command_entry_t large_table[LARGE_TABLE_SIZE + 1];
+
+typedef struct {
+  const sl_cli_command_entry_t *entry;
+  int arg_ofs;
+  bool single;
+  bool help;
+} lookup_t;
+
+static lookup_t lookup(struct sl_cli *cli, const char *line)
+{
+  char input[SL_CLI_INPUT_BUFFER_SIZE];
+  char *token_v[SL_CLI_MAX_INPUT_ARGUMENTS];
+  int token_c;
+  lookup_t result;
+
+  strncpy(input, line, sizeof(input) - 1);
+  input[sizeof(input) - 1] = '\0';
+  TEST_ASSERT(sl_cli_tokenize(input, &token_c, token_v) == SL_STATUS_OK);
+  result.entry = sl_cli_command_find(cli, &token_c, token_v, &result.arg_ofs,
+                                     &result.single, &result.help);
+  return result;
+}
+
+// Look a line up in an indexed and in a scanned instance of the same table
+static void check_same(struct sl_cli *indexed, struct sl_cli *scanned, const char *line)
+{
+  lookup_t a = lookup(indexed, line);
+  lookup_t b = lookup(scanned, line);
+
+  if ((a.entry != b.entry) || (a.arg_ofs != b.arg_ofs)
+      || (a.single != b.single) || (a.help != b.help)) {
+    fprintf(stderr, "lookup of \"%s\" differs\n", line);
+    exit(1);
+  }
+}
+
+static void add_scanned(struct sl_cli *cli, sl_cli_command_group_t *group)
+{
+  TEST_ASSERT(sl_cli_command_add_command_group(cli, group));
+  group->command_index.entries = NULL;
+  group->command_index.count = 0;
+}
+
+int main(void)
+{
+  static struct sl_cli indexed;
+  static struct sl_cli scanned;
+  static sl_cli_command_group_t group = { { NULL }, false, sl_cli_default_command_table };
+  static sl_cli_command_group_t group_scan = { { NULL }, false, sl_cli_default_command_table };
+  static sl_cli_command_group_t cases = { { NULL }, false, case_table };
+  static sl_cli_command_group_t cases_scan = { { NULL }, false, case_table };
+  static sl_cli_command_group_t large = { { NULL }, false, large_table };
+  static sl_cli_command_group_t large_scan = { { NULL }, false, large_table };
+  char line[SL_CLI_INPUT_BUFFER_SIZE];
+  size_t count = 0;
+
+  // The generated table gets an index, and the index passes the check
+  TEST_ASSERT(sl_cli_command_add_command_group(&indexed, &group));
+  while (sl_cli_default_command_table[count].name != NULL) {
+    count++;
+  }
+  TEST_ASSERT(group.command_index.entries != NULL);
+  TEST_ASSERT_EQUAL(count, group.command_index.count);
+  TEST_ASSERT(sli_cli_command_index_check(&group));
+  add_scanned(&scanned, &group_scan);
+
+  // Every name, in upper case, with arguments and as help, and names that
+  // are not in the table, give the same result as a scan
+  for (size_t i = 0; i < count; i++) {
+    const char *name = sl_cli_default_command_table[i].name;
+    size_t len = strlen(name);
+    check_same(&indexed, &scanned, name);
+    snprintf(line, sizeof(line), "%s 1 2 3", name);
+    check_same(&indexed, &scanned, line);
+    snprintf(line, sizeof(line), "help %s", name);
+    check_same(&indexed, &scanned, line);
+    for (size_t j = 0; j < len && j < sizeof(line) - 1; j++) {
+      line[j] = (char)toupper((unsigned char)name[j]);
+    }
+    line[len < sizeof(line) - 1 ? len : sizeof(line) - 1] = '\0';
+    check_same(&indexed, &scanned, line);
+    snprintf(line, sizeof(line), "%.*s", (int)(len / 2), name);
+    check_same(&indexed, &scanned, line);
+    snprintf(line, sizeof(line), "%sx", name);
+    check_same(&indexed, &scanned, line);
+  }
+  check_same(&indexed, &scanned, "");
+  check_same(&indexed, &scanned, "help");
+  check_same(&indexed, &scanned, "~");
+
+  // Names that only differ by case resolve to the first one in the table.
+  // Sub groups keep working behind an indexed group.
+  TEST_ASSERT(sl_cli_command_add_command_group(&indexed, &cases));
+  TEST_ASSERT(sli_cli_command_index_check(&cases));
+  add_scanned(&scanned, &cases_scan);
+  TEST_ASSERT(lookup(&indexed, "alpha").entry == &case_table[1]);
+  TEST_ASSERT(lookup(&indexed, "b").entry == &case_table[4]);
+  TEST_ASSERT(lookup(&indexed, "grp inner").entry == &sub_table[0]);
+  check_same(&indexed, &scanned, "ALPHA");
+  check_same(&indexed, &scanned, "grp");
+  check_same(&indexed, &scanned, "grp inner");
+  check_same(&indexed, &scanned, "grp other");
+  check_same(&indexed, &scanned, "help grp");
+
+  // A table that does not fit in the remaining pool is scanned
+  for (int i = 0; i < LARGE_TABLE_SIZE; i++) {
+    snprintf(large_names[i], sizeof(large_names[i]), "zz%02d", LARGE_TABLE_SIZE - i);
+    large_table[i].name = large_names[i];
+    large_table[i].command = &cmd_info;
+  }
+  if ((count + 6 + LARGE_TABLE_SIZE) > SL_CLI_COMMAND_INDEX_POOL_SIZE) {
+    TEST_ASSERT(sl_cli_command_add_command_group(&indexed, &large));
+    TEST_ASSERT(large.command_index.entries == NULL);
+    TEST_ASSERT(lookup(&indexed, "zz07").entry == &large_table[LARGE_TABLE_SIZE - 7]);
+    add_scanned(&scanned, &large_scan);
+    check_same(&indexed, &scanned, "zz50");
+  }
+
+  // Removing and adding a group again keeps its index
+  uint16_t *entries = group.command_index.entries;
+  TEST_ASSERT(sl_cli_command_remove_command_group(&indexed, &group));
+  TEST_ASSERT(sl_cli_command_add_command_group(&indexed, &group));
+  TEST_ASSERT(group.command_index.entries == entries);
+
+  // The check catches indexes that are out of order, short or out of range
+  static uint16_t copy[SL_CLI_COMMAND_INDEX_POOL_SIZE];
+  sl_cli_command_group_t broken = group;
+  memcpy(copy, entries, count * sizeof(copy[0]));
+  broken.command_index.entries = copy;
+  TEST_ASSERT(sli_cli_command_index_check(&broken));
+  uint16_t tmp = copy[10];
+  copy[10] = copy[11];
+  copy[11] = tmp;
+  TEST_ASSERT(!sli_cli_command_index_check(&broken));
+  copy[11] = copy[10];
+  copy[10] = tmp;
+  broken.command_index.count--;
+  TEST_ASSERT(!sli_cli_command_index_check(&broken));
+  broken.command_index.count++;
+  copy[count - 1] = (uint16_t)count;
+  TEST_ASSERT(!sli_cli_command_index_check(&broken));
+
+  printf("%zu commands checked\n", count);
+  return 0;
+}
@@ -0,0 +1,49 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the CORE interrupt masking API and EFM_ASSERT.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef HOST_CORE_H
+#define HOST_CORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Set by a harness while it runs code that stands for an interrupt handler
+extern volatile bool host_core_irq_context;
+
+// Current nesting of atomic and critical sections, and the number of
+// sections entered since the start of the run
+extern volatile uint32_t host_core_mask_depth;
+extern volatile uint32_t host_core_mask_count;
+
+// Called when the outermost atomic or critical section ends, if set. Lets a
+// harness run a pending "interrupt" at the point where it would be taken.
+extern void (*host_core_on_unmask)(void);
+
+#endif // HOST_CORE_H
@@ -0,0 +1,104 @@
+/***************************************************************************//**
+ * @file
+ * @brief CORE critical and atomic sections as a process-wide lock, for threaded harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_core.h"
+#include "host_core.h"
+
+// The same state as host_core.c, so that harnesses can check it. Sections
+// entered by several threads at once are not told apart.
+volatile bool host_core_irq_context;
+volatile uint32_t host_core_mask_depth;
+volatile uint32_t host_core_mask_count;
+void (*host_core_on_unmask)(void);
+
+// Threads stand for the contexts that a section keeps out. The lock is
+// recursive, as sections nest.
+static pthread_mutex_t core_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+static CORE_irqState_t enter(void)
+{
+  pthread_mutex_lock(&core_lock);
+  host_core_mask_count++;
+  return host_core_mask_depth++;
+}
+
+static void leave(CORE_irqState_t state)
+{
+  host_core_mask_depth = state;
+  pthread_mutex_unlock(&core_lock);
+}
+
+CORE_irqState_t CORE_EnterCritical(void)
+{
+  return enter();
+}
+
+void CORE_ExitCritical(CORE_irqState_t irqState)
+{
+  leave(irqState);
+}
+
+CORE_irqState_t CORE_EnterAtomic(void)
+{
+  return enter();
+}
+
+void CORE_ExitAtomic(CORE_irqState_t irqState)
+{
+  leave(irqState);
+}
+
+void CORE_YieldCritical(void)
+{
+}
+
+void CORE_YieldAtomic(void)
+{
+}
+
+bool CORE_InIrqContext(void)
+{
+  return host_core_irq_context;
+}
+
+bool CORE_IrqIsDisabled(void)
+{
+  return host_core_mask_depth != 0U;
+}
+
+void assertEFM(const char *file, int line)
+{
+  fprintf(stderr, "%s:%d: EFM_ASSERT failed\n", file, line);
+  exit(1);
+}
@@ -0,0 +1,88 @@
+/***************************************************************************//**
+ * @file
+ * @brief Minimal assertion, timing and random helpers for host harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Fail the harness with the location of the check. Harnesses are single
+// programs, so the first failure ends the run with a non-zero exit code.
+#define TEST_ASSERT(cond)                                              \
+  do {                                                                 \
+    if (!(cond)) {                                                     \
+      fprintf(stderr, "%s:%d: check failed: %s\n",                     \
+              __FILE__, __LINE__, #cond);                              \
+      exit(1);                                                         \
+    }                                                                  \
+  } while (0)
+
+#define TEST_ASSERT_EQUAL(expected, actual)                            \
+  do {                                                                 \
+    long long test_e_ = (long long)(expected);                         \
+    long long test_a_ = (long long)(actual);                           \
+    if (test_e_ != test_a_) {                                          \
+      fprintf(stderr, "%s:%d: expected %s == %lld, got %lld\n",        \
+              __FILE__, __LINE__, #actual, test_e_, test_a_);          \
+      exit(1);                                                         \
+    }                                                                  \
+  } while (0)
+
+// Monotonic time in nanoseconds
+static inline uint64_t host_time_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+// Small deterministic generator, so that runs can be repeated from a seed
+static inline uint32_t host_rand(uint32_t *state)
+{
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+// Optional unsigned command line argument, with a default
+static inline unsigned long host_arg(int argc, char *argv[], int index, unsigned long def)
+{
+  return (argc > index) ? strtoul(argv[index], NULL, 0) : def;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,252 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scripted LDMA behind the host DMADRV stand-in.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "em_device.h"
+#include "dmadrv.h"
+#include "host_core.h"
+#include "host_test.h"
+#include "fake_dmadrv.h"
+
+// Longest chain the UART iostream builds
+#define CHAIN_MAX      2U
+#define SNAPSHOT_SIZE  (CHAIN_MAX * 2048U)
+
+typedef struct {
+  bool allocated;
+  bool active;
+  bool done;
+  bool m2p;
+  DMADRV_Callback_t callback;
+  void *user_param;
+  LDMA_Descriptor_t chain[CHAIN_MAX];
+  size_t chain_len;
+  uint8_t snapshot[SNAPSHOT_SIZE];
+} channel_t;
+
+LDMA_TypeDef host_ldma;
+uint8_t fake_dmadrv_log[FAKE_DMADRV_LOG_SIZE];
+size_t fake_dmadrv_log_len;
+bool fake_dmadrv_done_on_poll;
+
+static channel_t channels[LDMA_CH_NUM];
+static bool initialized;
+
+void fake_dmadrv_reset(void)
+{
+  memset(channels, 0, sizeof(channels));
+  memset(&host_ldma, 0, sizeof(host_ldma));
+  fake_dmadrv_log_len = 0;
+  fake_dmadrv_done_on_poll = false;
+  initialized = false;
+}
+
+bool fake_dmadrv_busy(unsigned int channel)
+{
+  return channels[channel].active && !channels[channel].done && channels[channel].m2p;
+}
+
+static void load(unsigned int channel, const LDMA_Descriptor_t *descriptor)
+{
+  channel_t *ch = &channels[channel];
+
+  host_ldma.CH[channel].SRC = descriptor->xfer.srcAddr;
+  host_ldma.CH[channel].DST = descriptor->xfer.dstAddr;
+  host_ldma.CH[channel].CTRL = (uintptr_t)descriptor->xfer.xferCnt << _LDMA_CH_CTRL_XFERCNT_SHIFT;
+  host_ldma.CH[channel].LINK = ((uintptr_t)descriptor->xfer.linkAddr & _LDMA_CH_LINK_LINKADDR_MASK)
+                               | (descriptor->xfer.link ? _LDMA_CH_LINK_LINK_MASK : 0)
+                               | (descriptor->xfer.linkMode ? _LDMA_CH_LINK_LINKMODE_MASK : 0);
+  ch->active = true;
+  ch->done = false;
+}
+
+void fake_dmadrv_complete(unsigned int channel, bool irq)
+{
+  channel_t *ch = &channels[channel];
+  size_t offset = 0;
+
+  TEST_ASSERT(fake_dmadrv_busy(channel));
+  for (size_t i = 0; i < ch->chain_len; i++) {
+    const size_t count = ch->chain[i].xfer.xferCnt + 1U;
+    const uint8_t *src = (const uint8_t *)ch->chain[i].xfer.srcAddr;
+
+    // The span must not change while the LDMA reads it
+    TEST_ASSERT(memcmp(src, &ch->snapshot[offset], count) == 0);
+    TEST_ASSERT(fake_dmadrv_log_len + count <= FAKE_DMADRV_LOG_SIZE);
+    memcpy(&fake_dmadrv_log[fake_dmadrv_log_len], src, count);
+    fake_dmadrv_log_len += count;
+    offset += count;
+  }
+  ch->done = true;
+
+  if (irq && ch->callback != NULL) {
+    const bool was_irq = host_core_irq_context;
+
+    host_core_irq_context = true;
+    ch->callback(channel, 0, ch->user_param);
+    host_core_irq_context = was_irq;
+  }
+}
+
+Ecode_t DMADRV_Init(void)
+{
+  if (initialized) {
+    return ECODE_EMDRV_DMADRV_ALREADY_INITIALIZED;
+  }
+  initialized = true;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_DeInit(void)
+{
+  for (unsigned int i = 0; i < LDMA_CH_NUM; i++) {
+    if (channels[i].allocated) {
+      return ECODE_EMDRV_DMADRV_IN_USE;
+    }
+  }
+  initialized = false;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_AllocateChannel(unsigned int *channelId, void *capabilities)
+{
+  (void)capabilities;
+  for (unsigned int i = 0; i < LDMA_CH_NUM; i++) {
+    if (!channels[i].allocated) {
+      channels[i].allocated = true;
+      *channelId = i;
+      return ECODE_OK;
+    }
+  }
+  return ECODE_EMDRV_DMADRV_CHANNELS_EXHAUSTED;
+}
+
+Ecode_t DMADRV_FreeChannel(unsigned int channelId)
+{
+  if (!channels[channelId].allocated) {
+    return ECODE_EMDRV_DMADRV_ALREADY_FREED;
+  }
+  channels[channelId].allocated = false;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_PeripheralMemory(unsigned int channelId,
+                                DMADRV_PeripheralSignal_t peripheralSignal,
+                                void *dst,
+                                void *src,
+                                bool dstInc,
+                                int len,
+                                DMADRV_DataSize_t size,
+                                DMADRV_Callback_t callback,
+                                void *cbUserParam)
+{
+  LDMA_Descriptor_t descriptor = LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(src, dst, len);
+
+  (void)peripheralSignal;
+  (void)dstInc;
+  (void)size;
+  channels[channelId].callback = callback;
+  channels[channelId].user_param = cbUserParam;
+  channels[channelId].m2p = false;
+  load(channelId, &descriptor);
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_LdmaStartTransfer(int channelId,
+                                 LDMA_TransferCfg_t *transfer,
+                                 LDMA_Descriptor_t *descriptor,
+                                 DMADRV_Callback_t callback,
+                                 void *cbUserParam)
+{
+  channel_t *ch = &channels[channelId];
+  const LDMA_Descriptor_t *next = descriptor;
+  size_t offset = 0;
+
+  (void)transfer;
+  TEST_ASSERT(ch->allocated);
+  ch->callback = callback;
+  ch->user_param = cbUserParam;
+  ch->m2p = (descriptor->xfer.srcInc != 0) && (descriptor->xfer.dstInc == 0);
+  if (ch->m2p) {
+    // A new transfer must not be started over one in progress
+    TEST_ASSERT(!fake_dmadrv_busy((unsigned int)channelId));
+
+    // Follow the chain now, like the LDMA does as it goes
+    ch->chain_len = 0;
+    while (next != NULL) {
+      const size_t count = next->xfer.xferCnt + 1U;
+
+      TEST_ASSERT(ch->chain_len < CHAIN_MAX);
+      TEST_ASSERT(offset + count <= SNAPSHOT_SIZE);
+      ch->chain[ch->chain_len++] = *next;
+      memcpy(&ch->snapshot[offset], (const void *)next->xfer.srcAddr, count);
+      offset += count;
+      next = next->xfer.link ? (const LDMA_Descriptor_t *)next->xfer.linkAddr : NULL;
+    }
+  }
+  load((unsigned int)channelId, descriptor);
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_PauseTransfer(unsigned int channelId)
+{
+  (void)channelId;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_ResumeTransfer(unsigned int channelId)
+{
+  (void)channelId;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_StopTransfer(unsigned int channelId)
+{
+  channels[channelId].active = false;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_TransferDone(unsigned int channelId, bool *done)
+{
+  if (fake_dmadrv_done_on_poll && fake_dmadrv_busy(channelId)) {
+    fake_dmadrv_complete(channelId, false);
+  }
+  *done = channels[channelId].done;
+  return ECODE_OK;
+}
+
+Ecode_t DMADRV_TransferRemainingCount(unsigned int channelId, int *remaining)
+{
+  *remaining = channels[channelId].active && !channels[channelId].done
+               ? (int)((host_ldma.CH[channelId].CTRL & _LDMA_CH_CTRL_XFERCNT_MASK) >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1
+               : 0;
+  return ECODE_OK;
+}
@@ -0,0 +1,62 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scripted LDMA behind the host DMADRV stand-in.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef FAKE_DMADRV_H
+#define FAKE_DMADRV_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dmadrv.h"
+
+// Memory to peripheral transfers end up in this log, in the order the LDMA
+// sends them
+#define FAKE_DMADRV_LOG_SIZE  (1024U * 1024U)
+extern uint8_t fake_dmadrv_log[FAKE_DMADRV_LOG_SIZE];
+extern size_t fake_dmadrv_log_len;
+
+// When set, a transfer polled with DMADRV_TransferDone() completes at that
+// point, as if the LDMA had been running meanwhile. The completion callback is
+// then left to the caller, like an interrupt that is masked.
+extern bool fake_dmadrv_done_on_poll;
+
+void fake_dmadrv_reset(void);
+
+// Whether a memory to peripheral transfer is in progress on the channel
+bool fake_dmadrv_busy(unsigned int channel);
+
+// Send the whole descriptor chain of the channel to the log. The data is
+// taken when the transfer starts and checked again here, so that a write to
+// a span in flight, or a span handed over before it was filled, is caught.
+// With irq set, the completion callback runs as an interrupt.
+void fake_dmadrv_complete(unsigned int channel, bool irq);
+
+#endif // FAKE_DMADRV_H
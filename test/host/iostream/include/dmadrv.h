@@ -0,0 +1,147 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for DMADRV, backed by a scripted LDMA (see fake_dmadrv.h).
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef DMADRV_H
+#define DMADRV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "em_device.h"
+
+#define EMDRV_DMADRV_LDMA
+
+typedef uint32_t Ecode_t;
+
+#define ECODE_OK                                0U
+#define ECODE_EMDRV_DMADRV_PARAM_ERROR          0x0F000001U
+#define ECODE_EMDRV_DMADRV_NOT_INITIALIZED      0x0F000002U
+#define ECODE_EMDRV_DMADRV_ALREADY_INITIALIZED  0x0F000003U
+#define ECODE_EMDRV_DMADRV_CHANNELS_EXHAUSTED   0x0F000004U
+#define ECODE_EMDRV_DMADRV_IN_USE               0x0F000005U
+#define ECODE_EMDRV_DMADRV_ALREADY_FREED        0x0F000006U
+#define ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED     0x0F000007U
+
+typedef uint32_t DMADRV_PeripheralSignal_t;
+
+typedef enum {
+  dmadrvDataSize1 = 0,
+  dmadrvDataSize2 = 1,
+  dmadrvDataSize4 = 2
+} DMADRV_DataSize_t;
+
+// Same field names as the emlib LDMA transfer descriptor, with the addresses
+// wide enough to hold a host pointer
+typedef union {
+  struct {
+    uint32_t  structType;
+    uint32_t  structReq;
+    uint32_t  xferCnt;
+    uint32_t  doneIfs;
+    uint32_t  srcInc;
+    uint32_t  dstInc;
+    uintptr_t srcAddr;
+    uintptr_t dstAddr;
+    uint32_t  linkMode;
+    uint32_t  link;
+    intptr_t  linkAddr;
+  } xfer;
+} LDMA_Descriptor_t;
+
+typedef struct {
+  uint32_t ldmaReqSel;
+} LDMA_TransferCfg_t;
+
+#define LDMA_TRANSFER_CFG_PERIPHERAL(signal)  { signal }
+
+#define LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(addr) ((intptr_t)(addr))
+
+#define LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(src, dest, count) \
+  {                                                       \
+    .xfer =                                               \
+    {                                                     \
+      .structReq = 0,                                     \
+      .xferCnt   = (count) - 1,                           \
+      .doneIfs   = 1,                                     \
+      .srcInc    = 1,                                     \
+      .dstInc    = 0,                                     \
+      .srcAddr   = (uintptr_t)(src),                      \
+      .dstAddr   = (uintptr_t)(dest),                     \
+      .link      = 0,                                     \
+    }                                                     \
+  }
+
+#define LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(src, dest, count) \
+  {                                                       \
+    .xfer =                                               \
+    {                                                     \
+      .structReq = 0,                                     \
+      .xferCnt   = (count) - 1,                           \
+      .doneIfs   = 1,                                     \
+      .srcInc    = 0,                                     \
+      .dstInc    = 1,                                     \
+      .srcAddr   = (uintptr_t)(src),                      \
+      .dstAddr   = (uintptr_t)(dest),                     \
+      .link      = 0,                                     \
+    }                                                     \
+  }
+
+typedef bool (*DMADRV_Callback_t)(unsigned int channel,
+                                  unsigned int sequenceNo,
+                                  void *userParam);
+
+Ecode_t DMADRV_AllocateChannel(unsigned int *channelId,
+                               void         *capabilities);
+Ecode_t DMADRV_DeInit(void);
+Ecode_t DMADRV_FreeChannel(unsigned int channelId);
+Ecode_t DMADRV_Init(void);
+Ecode_t DMADRV_PeripheralMemory(unsigned int              channelId,
+                                DMADRV_PeripheralSignal_t peripheralSignal,
+                                void                      *dst,
+                                void                      *src,
+                                bool                      dstInc,
+                                int                       len,
+                                DMADRV_DataSize_t         size,
+                                DMADRV_Callback_t         callback,
+                                void                      *cbUserParam);
+Ecode_t DMADRV_LdmaStartTransfer(int                channelId,
+                                 LDMA_TransferCfg_t *transfer,
+                                 LDMA_Descriptor_t  *descriptor,
+                                 DMADRV_Callback_t  callback,
+                                 void               *cbUserParam);
+Ecode_t DMADRV_PauseTransfer(unsigned int channelId);
+Ecode_t DMADRV_ResumeTransfer(unsigned int channelId);
+Ecode_t DMADRV_StopTransfer(unsigned int channelId);
+Ecode_t DMADRV_TransferDone(unsigned int channelId,
+                            bool         *done);
+Ecode_t DMADRV_TransferRemainingCount(unsigned int channelId,
+                                      int          *remaining);
+
+#endif // DMADRV_H
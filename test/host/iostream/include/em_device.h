@@ -0,0 +1,96 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the device header, with the LDMA registers used by the UART iostream.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+
+#define LDMA_PRESENT
+#define LDMA_CH_NUM    8
+
+typedef int IRQn_Type;
+
+// Registers are wide enough to hold a host pointer
+typedef struct {
+  uintptr_t CTRL;
+  uintptr_t SRC;
+  uintptr_t DST;
+  uintptr_t LINK;
+} LDMA_CH_TypeDef;
+
+typedef struct {
+  LDMA_CH_TypeDef CH[LDMA_CH_NUM];
+  LDMA_CH_TypeDef CH_CLR[LDMA_CH_NUM];
+  uint32_t IEN_CLR;
+  uint32_t CHDIS_SET;
+  uint32_t CHDONE_SET;
+  uint32_t LINKLOAD;
+} LDMA_TypeDef;
+
+extern LDMA_TypeDef host_ldma;
+#define LDMA (&host_ldma)
+
+#define _LDMA_CH_CTRL_XFERCNT_SHIFT       4
+#define _LDMA_CH_CTRL_XFERCNT_MASK        0x7FF0UL
+#define LDMA_CH_CTRL_DONEIEN              (0x1UL << 20)
+
+// Descriptors are linked by their full address on the host
+#define _LDMA_CH_LINK_LINKMODE_SHIFT      0
+#define _LDMA_CH_LINK_LINKMODE_MASK       ((uintptr_t)0x1)
+#define _LDMA_CH_LINK_LINKMODE_ABSOLUTE   ((uintptr_t)0x0)
+#define LDMA_CH_LINK_LINKMODE_ABSOLUTE    0
+#define _LDMA_CH_LINK_LINK_SHIFT          1
+#define _LDMA_CH_LINK_LINK_MASK           ((uintptr_t)0x2)
+#define LDMA_CH_LINK_LINK                 _LDMA_CH_LINK_LINK_MASK
+#define _LDMA_CH_LINK_LINKADDR_SHIFT      0
+#define _LDMA_CH_LINK_LINKADDR_MASK       (~(uintptr_t)0x3)
+
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,366 @@
+/***************************************************************************//**
+ * @file
+ * @brief Interrupt writes into the UART iostream TX buffer while a write copies its data.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sl_iostream.h"
+#include "sl_iostream_uart.h"
+#include "sli_iostream_uart.h"
+#include "host_core.h"
+#include "host_test.h"
+#include "fake_dmadrv.h"
+
+#define RX_BUFFER_SIZE  32U
+#define TX_BUFFER_MAX   256U
+#define MESSAGE_MAX     (3U * TX_BUFFER_MAX)
+
+static sl_iostream_uart_t uart;
+static sl_iostream_uart_context_t context;
+static uint8_t rx_buffer[RX_BUFFER_SIZE];
+static uint8_t tx_buffer[TX_BUFFER_MAX];
+static uint8_t rx_register;
+static uint8_t tx_register;
+
+// The write done by the "interrupt", and where it is taken
+typedef enum {
+  INJECT_NONE,
+  INJECT_DURING_COPY,   // halfway through a memcpy() into the TX buffer
+  INJECT_AT_UNMASK,     // when a section of the write ends
+} inject_t;
+
+static inject_t inject;
+static const uint8_t *isr_data;
+static size_t isr_length;
+static uint32_t isr_dropped;
+static bool isr_ran;
+static bool isr_complete_dma;
+static bool in_isr;
+
+static sl_status_t tx_unused(void *ctx, char c)
+{
+  (void)ctx;
+  (void)c;
+  TEST_ASSERT(false);
+  return SL_STATUS_FAIL;
+}
+
+static void tx_completed_unused(void *ctx, bool enable)
+{
+  (void)ctx;
+  (void)enable;
+}
+
+static sl_status_t deinit_unused(void *ctx)
+{
+  (void)ctx;
+  return SL_STATUS_OK;
+}
+
+static void open_uart(size_t tx_buffer_length, bool lf_to_crlf)
+{
+  sl_iostream_uart_config_t config = {
+    .dma_cfg = {
+      .peripheral_signal = 1,
+      .src = &rx_register,
+      .tx_peripheral_signal = 2,
+      .dst = &tx_register,
+    },
+    .rx_buffer = rx_buffer,
+    .rx_buffer_length = sizeof(rx_buffer),
+    .lf_to_crlf = lf_to_crlf,
+    .tx_buffer = tx_buffer,
+    .tx_buffer_length = tx_buffer_length,
+  };
+
+  fake_dmadrv_reset();
+  inject = INJECT_NONE;
+  isr_complete_dma = false;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK,
+                    sli_iostream_uart_context_init(&uart, &context, &config,
+                                                   tx_unused, tx_completed_unused,
+                                                   deinit_unused, 0, 0));
+}
+
+static uint32_t dropped(void)
+{
+  sl_iostream_uart_tx_stats_t stats;
+
+  sl_iostream_uart_get_tx_stats(&uart, &stats);
+  return stats.dropped;
+}
+
+static void write(const void *data, size_t length)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_iostream_write(&uart.stream, data, length));
+}
+
+// Run the LDMA until everything written is sent
+static void drain(void)
+{
+  while (fake_dmadrv_busy(context.dma.tx_channel)) {
+    fake_dmadrv_complete(context.dma.tx_channel, true);
+  }
+  TEST_ASSERT_EQUAL(0, context.tx_count);
+  TEST_ASSERT_EQUAL(0, context.tx_reserved);
+  TEST_ASSERT_EQUAL(0, context.tx_writers);
+}
+
+static void run_isr(void)
+{
+  uint32_t before;
+
+  in_isr = true;
+  isr_ran = true;
+  host_core_irq_context = true;
+  if (isr_complete_dma && fake_dmadrv_busy(context.dma.tx_channel)) {
+    fake_dmadrv_complete(context.dma.tx_channel, true);
+  }
+  if (isr_length > 0) {
+    before = dropped();
+    write(isr_data, isr_length);
+    isr_dropped = dropped() - before;
+  }
+  host_core_irq_context = false;
+  in_isr = false;
+}
+
+static void on_unmask(void)
+{
+  if (inject == INJECT_AT_UNMASK && !in_isr) {
+    inject = INJECT_NONE;
+    run_isr();
+  }
+}
+
+// The UART iostream is built with its memcpy() calls going here
+void *host_uart_memcpy(void *dst, const void *src, size_t n)
+{
+  const size_t half = n / 2U;
+
+  memcpy(dst, src, half);
+  if (inject == INJECT_DURING_COPY && !in_isr && host_core_mask_depth == 0U) {
+    inject = INJECT_NONE;
+    run_isr();
+  }
+  memcpy((uint8_t *)dst + half, (const uint8_t *)src + half, n - half);
+  return dst;
+}
+
+static void expect_log(const char *expected)
+{
+  const size_t length = strlen(expected);
+
+  TEST_ASSERT_EQUAL(length, fake_dmadrv_log_len);
+  TEST_ASSERT(memcmp(fake_dmadrv_log, expected, length) == 0);
+}
+
+// An interrupt writing while the data is copied goes after it, and neither is
+// sent before both are copied
+static void test_write_during_copy(void)
+{
+  open_uart(64, false);
+  isr_data = (const uint8_t *)"bbbbbbbbbb";
+  isr_length = 10;
+  inject = INJECT_DURING_COPY;
+  write("aaaaaaaaaaaaaaaaaaaa", 20);
+  TEST_ASSERT_EQUAL(INJECT_NONE, inject);
+  drain();
+  expect_log("aaaaaaaaaaaaaaaaaaaabbbbbbbbbb");
+  TEST_ASSERT_EQUAL(0, dropped());
+}
+
+// Same with LF to CRLF conversion, where the data is copied byte by byte once
+// its span is reserved
+static void test_write_after_reserve_crlf(void)
+{
+  open_uart(64, true);
+  isr_data = (const uint8_t *)"x\ny";
+  isr_length = 3;
+  inject = INJECT_AT_UNMASK;
+  host_core_on_unmask = on_unmask;
+  write("ab\ncd\n", 6);
+  host_core_on_unmask = NULL;
+  TEST_ASSERT_EQUAL(INJECT_NONE, inject);
+  drain();
+  expect_log("ab\r\ncd\r\nx\r\ny");
+  TEST_ASSERT_EQUAL(0, dropped());
+}
+
+// An interrupt that finds the TX buffer reserved by the write it interrupted
+// can't wait for it, and drops its data
+static void test_write_into_full_buffer(void)
+{
+  open_uart(16, false);
+  isr_data = (const uint8_t *)"bbbb";
+  isr_length = 4;
+  inject = INJECT_DURING_COPY;
+  write("aaaaaaaaaaaaaaaa", 16);
+  drain();
+  expect_log("aaaaaaaaaaaaaaaa");
+  TEST_ASSERT_EQUAL(4, isr_dropped);
+  TEST_ASSERT_EQUAL(4, dropped());
+}
+
+// With data in flight, the interrupt waits for it to be sent and wraps around
+static void test_write_waits_for_transfer(void)
+{
+  open_uart(16, false);
+  fake_dmadrv_done_on_poll = true;
+  write("cccccccc", 8);
+  TEST_ASSERT(fake_dmadrv_busy(context.dma.tx_channel));
+  isr_data = (const uint8_t *)"bbbb";
+  isr_length = 4;
+  inject = INJECT_DURING_COPY;
+  write("aaaaaaaa", 8);
+  drain();
+  expect_log("ccccccccaaaaaaaabbbb");
+  TEST_ASSERT_EQUAL(0, dropped());
+}
+
+// A stream initialized without a TX buffer switches to it once given one
+static void test_set_tx_buffer(void)
+{
+  open_uart(0, false);
+  TEST_ASSERT(context.tx_buffer == NULL);
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_PARAMETER,
+                    sl_iostream_uart_set_tx_buffer(&uart, tx_buffer, 1));
+  TEST_ASSERT(context.tx_buffer == NULL);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK,
+                    sl_iostream_uart_set_tx_buffer(&uart, tx_buffer, 16));
+  TEST_ASSERT_EQUAL(SL_STATUS_ALREADY_INITIALIZED,
+                    sl_iostream_uart_set_tx_buffer(&uart, tx_buffer, 16));
+  fake_dmadrv_done_on_poll = true;
+  write("aaaaaaaaaaaaaaaaaaaaaaaa", 24);
+  drain();
+  expect_log("aaaaaaaaaaaaaaaaaaaaaaaa");
+  TEST_ASSERT_EQUAL(0, dropped());
+}
+
+// Count the bytes sent so far and empty the log
+static void count_log(uint64_t *counts, uint8_t *last, bool lf_to_crlf)
+{
+  for (size_t i = 0; i < fake_dmadrv_log_len; i++) {
+    counts[fake_dmadrv_log[i]]++;
+    if (lf_to_crlf && fake_dmadrv_log[i] == '\n') {
+      TEST_ASSERT(*last == '\r');
+    }
+    *last = fake_dmadrv_log[i];
+  }
+  fake_dmadrv_log_len = 0;
+}
+
+// Random writes, with interrupts writing and completing transfers at random
+// points. Every byte accepted must be sent once and unchanged, and LFs must
+// stay behind their CR.
+static void test_random(uint32_t iterations, bool lf_to_crlf, uint32_t seed)
+{
+  static uint8_t main_data[MESSAGE_MAX];
+  static uint8_t irq_data[TX_BUFFER_MAX];
+  uint64_t expected[256] = { 0 };
+  uint64_t actual[256] = { 0 };
+  uint32_t state = seed;
+  uint8_t id = 0;
+  uint8_t last = 0;
+  const size_t tx_length = 16U + (host_rand(&state) % (TX_BUFFER_MAX - 15U));
+
+  open_uart(tx_length, lf_to_crlf);
+  fake_dmadrv_done_on_poll = true;
+  host_core_on_unmask = on_unmask;
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    const size_t main_length = 1U + (host_rand(&state) % (3U * tx_length));
+    const uint8_t main_id = (uint8_t)(0x21U + (id++ % 90U));
+    const uint8_t irq_id = (uint8_t)(0x21U + (id++ % 90U));
+    uint32_t before;
+
+    for (size_t j = 0; j < main_length; j++) {
+      main_data[j] = ((host_rand(&state) % 8U) == 0U) ? '\n' : main_id;
+    }
+    isr_length = (host_rand(&state) % 2U) ? 1U + (host_rand(&state) % tx_length) : 0U;
+    for (size_t j = 0; j < isr_length; j++) {
+      irq_data[j] = ((host_rand(&state) % 8U) == 0U) ? '\n' : irq_id;
+    }
+    isr_data = irq_data;
+    isr_complete_dma = (host_rand(&state) % 2U) != 0U;
+    isr_dropped = 0;
+    isr_ran = false;
+    inject = (inject_t)(host_rand(&state) % 3U);
+
+    before = dropped();
+    write(main_data, main_length);
+    // Only an interrupt write can drop data
+    TEST_ASSERT_EQUAL(isr_dropped, dropped() - before);
+
+    for (size_t j = 0; j < main_length; j++) {
+      expected[main_data[j]]++;
+    }
+    if (isr_ran) {
+      // The interrupt ran, the tail of its data may have been dropped
+      for (size_t j = 0; j < isr_length - isr_dropped; j++) {
+        expected[irq_data[j]]++;
+      }
+    }
+    inject = INJECT_NONE;
+
+    if ((host_rand(&state) % 4U) == 0U) {
+      drain();
+      count_log(actual, &last, lf_to_crlf);
+    }
+  }
+  host_core_on_unmask = NULL;
+  drain();
+  count_log(actual, &last, lf_to_crlf);
+
+  if (lf_to_crlf) {
+    expected['\r'] = expected['\n'];
+  }
+  for (size_t i = 0; i < 256; i++) {
+    TEST_ASSERT_EQUAL(expected[i], actual[i]);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  const uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 20000);
+
+  test_write_during_copy();
+  test_write_after_reserve_crlf();
+  test_write_into_full_buffer();
+  test_write_waits_for_transfer();
+  test_set_tx_buffer();
+  for (uint32_t seed = 1; seed <= 8; seed++) {
+    test_random(iterations, (seed & 1U) != 0U, seed * 2654435761U);
+  }
+
+  printf("iostream uart tx: ok\n");
+  return 0;
+}
@@ -0,0 +1,217 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory pool benchmark: burst cost against the interrupt latency of the sections.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_core.h"
+#include "host_core.h"
+#include "mm_host.h"
+
+// Usage: bench_memory_manager_pool [rounds] [repeats]
+//
+// The main thread allocates and frees bursts of 1 to MAX_BURST blocks, one
+// block per call, with the bulk calls or through a magazine. An "interrupt"
+// thread meanwhile enters an atomic section at random times and records how
+// long it waited for the main thread to leave its sections. Reports the cost
+// per block of each mode, the sections taken, and the wait percentiles.
+
+#define HEAP_SIZE       (32U * 1024U)
+#define BLOCK_COUNT     128U
+#define BLOCK_SIZE      32U
+#define MAX_BURST       16U
+#define MAX_SAMPLES     (1U << 20)
+
+typedef enum {
+  MODE_SINGLE,
+  MODE_BULK,
+  MODE_MAGAZINE,
+  MODE_COUNT
+} Mode_t;
+
+static const char *const mode_names[MODE_COUNT] = { "single", "bulk", "magazine" };
+
+static sl_memory_pool_t pool;
+static sl_memory_pool_magazine_t magazine;
+static atomic_bool isr_stop;
+static atomic_bool isr_started;
+static atomic_uint isr_sections;
+static uint64_t samples[MAX_SAMPLES];
+static uint32_t sample_count;
+
+static void spin_ns(uint64_t ns)
+{
+  uint64_t end = host_time_ns() + ns;
+
+  while (host_time_ns() < end) {
+  }
+}
+
+// The interrupt: waits to enter an atomic section, then takes and gives back
+// a block as a handler would
+static void *isr_thread(void *arg)
+{
+  uint32_t rnd = 17;
+
+  (void)arg;
+  while (!atomic_load(&isr_stop)) {
+    void *block = NULL;
+    uint32_t sections;
+    uint64_t start;
+
+    spin_ns(host_rand(&rnd) % 4000U);
+    start = host_time_ns();
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    sections = host_core_mask_count;
+    if (sample_count < MAX_SAMPLES) {
+      samples[sample_count++] = host_time_ns() - start;
+    }
+    host_core_irq_context = true;
+    if (sl_memory_pool_alloc(&pool, &block) == SL_STATUS_OK) {
+      sl_memory_pool_free(&pool, block);
+    }
+    host_core_irq_context = false;
+    atomic_fetch_add(&isr_sections, 1U + host_core_mask_count - sections);
+    CORE_EXIT_ATOMIC();
+    atomic_store(&isr_started, true);
+  }
+  return NULL;
+}
+
+static void burst(Mode_t mode, void **blocks, uint32_t count)
+{
+  uint32_t allocated = 0;
+
+  switch (mode) {
+    case MODE_SINGLE:
+      for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_alloc(&pool, &blocks[i]));
+      }
+      for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free(&pool, blocks[i]));
+      }
+      break;
+    case MODE_BULK:
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_alloc_bulk(&pool, blocks, count, &allocated));
+      TEST_ASSERT_EQUAL(count, allocated);
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free_bulk(&pool, blocks, count));
+      break;
+    default:
+      for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_alloc(&magazine, &blocks[i]));
+      }
+      for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_free(&magazine, blocks[i]));
+      }
+      break;
+  }
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static uint64_t percentile(uint32_t permille)
+{
+  uint32_t i = (uint32_t)(((uint64_t)sample_count * permille) / 1000U);
+
+  return samples[(i < sample_count) ? i : (sample_count - 1U)];
+}
+
+// One mode: the best cost per block over the repeats, the sections that the
+// main thread took in the last one, and the interrupt waits over all of them
+static void run_mode(Mode_t mode, uint32_t rounds, uint32_t repeats)
+{
+  void *blocks[MAX_BURST];
+  uint64_t best = UINT64_MAX;
+  uint32_t sections = 0;
+  pthread_t isr;
+
+  atomic_store(&isr_stop, false);
+  atomic_store(&isr_started, false);
+  sample_count = 0;
+  TEST_ASSERT_EQUAL(0, pthread_create(&isr, NULL, isr_thread, NULL));
+  // Measure with the interrupt running, which also gives at least one sample
+  while (!atomic_load(&isr_started)) {
+  }
+  for (uint32_t r = 0; r < repeats; r++) {
+    uint32_t rnd = 3;
+    uint64_t blocks_done = 0;
+    uint64_t start = host_time_ns();
+    uint64_t ns;
+
+    sections = host_core_mask_count - atomic_load(&isr_sections);
+    for (uint32_t i = 0; i < rounds; i++) {
+      uint32_t count = 1U + (host_rand(&rnd) % MAX_BURST);
+
+      burst(mode, blocks, count);
+      blocks_done += count;
+    }
+    ns = host_time_ns() - start;
+    sections = host_core_mask_count - atomic_load(&isr_sections) - sections;
+    if ((ns * 1000U) / blocks_done < best) {
+      best = (ns * 1000U) / blocks_done;
+    }
+  }
+  atomic_store(&isr_stop, true);
+  pthread_join(isr, NULL);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_flush(&magazine));
+
+  qsort(samples, sample_count, sizeof(samples[0]), compare_u64);
+  printf("%-9s %8.1f ns/block %9u sections  irq wait ns: p50 %6llu  p99 %6llu  p99.9 %7llu  max %8llu  (%u)\n",
+         mode_names[mode], (double)best / 1000.0, sections,
+         (unsigned long long)percentile(500), (unsigned long long)percentile(990),
+         (unsigned long long)percentile(999), (unsigned long long)samples[sample_count - 1U],
+         sample_count);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 200000);
+  uint32_t repeats = (uint32_t)host_arg(argc, argv, 2, 5);
+
+  mm_host_init(HEAP_SIZE);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_create_pool(BLOCK_SIZE, BLOCK_COUNT, &pool));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_init(&magazine, &pool));
+
+  printf("pool of %u x %u bytes, bursts of 1..%u blocks, %u rounds x %u\n",
+         BLOCK_COUNT, BLOCK_SIZE, MAX_BURST, rounds, repeats);
+  for (Mode_t mode = MODE_SINGLE; mode < MODE_COUNT; mode++) {
+    run_mode(mode, rounds, repeats);
+  }
+  return 0;
+}
@@ -0,0 +1,189 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager trace replay: per-operation latency and fragmentation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mm_host.h"
+
+#define HEAP_SIZE       (96U * 1024U)
+#define MAX_SLOTS       512U
+#define FRAG_PERIOD     64U
+
+#if (SL_MEMORY_MANAGER_TLSF_ENABLE == 1)
+#define VARIANT_NAME    "tlsf"
+#else
+#define VARIANT_NAME    "first-fit"
+#endif
+
+// One step of a trace. A step on an empty slot allocates, a step on a live
+// slot frees it, or resizes it in the realloc trace.
+typedef struct {
+  uint32_t align;
+  uint16_t slot;
+  uint16_t size;
+  uint8_t type;
+  uint8_t resize;
+} TraceOp_t;
+
+typedef struct {
+  const char *name;
+  uint32_t slots;         // Live set bound
+  uint32_t min_size;
+  uint32_t max_size;
+  uint32_t pinned;        // One slot in this many is never freed, 0 for none
+  bool aligned;
+  bool resize;
+} TraceShape_t;
+
+static const TraceShape_t shapes[] = {
+  { "random", 256, 8, 512, 0, false, false },
+  { "realloc", 256, 8, 512, 0, false, true },
+  { "align", 256, 8, 512, 0, true, false },
+  { "pinned", 256, 8, 512, 8, false, false },
+  { "dense", 512, 8, 160, 0, false, false },
+};
+
+static const uint32_t aligns[] = { 8, 8, 8, 16, 32, 64, 128, 256 };
+
+static void *slots[MAX_SLOTS];
+
+static int compare_u32(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static void make_trace(const TraceShape_t *shape, TraceOp_t *ops, uint32_t count)
+{
+  uint32_t rnd = 0x7ACEU;
+
+  for (uint32_t i = 0; i < count; i++) {
+    TraceOp_t *op = &ops[i];
+
+    op->slot = (uint16_t)(host_rand(&rnd) % shape->slots);
+    op->size = (uint16_t)(shape->min_size + (host_rand(&rnd) % (shape->max_size - shape->min_size + 1U)));
+    op->align = shape->aligned ? aligns[host_rand(&rnd) % (sizeof(aligns) / sizeof(aligns[0]))] : SL_MEMORY_BLOCK_ALIGN_DEFAULT;
+    op->type = (uint8_t)((host_rand(&rnd) & 1U) ? BLOCK_TYPE_SHORT_TERM : BLOCK_TYPE_LONG_TERM);
+    op->resize = (uint8_t)(shape->resize && ((host_rand(&rnd) % 4U) != 0U));
+  }
+}
+
+// One replay of a trace on a new heap. Keeps the lowest time seen for each
+// step, so that the host scheduler noise falls out over the replays.
+static void replay(const TraceShape_t *shape, const TraceOp_t *ops, uint32_t count,
+                   uint32_t *best_ns, double *frag_max, uint32_t *fails)
+{
+  mm_host_init(HEAP_SIZE);
+  memset(slots, 0, sizeof(slots));
+  *fails = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    const TraceOp_t *op = &ops[i];
+    void **slot = &slots[op->slot];
+    bool pinned = (shape->pinned != 0U) && ((op->slot % shape->pinned) == 0U);
+    sl_status_t status = SL_STATUS_OK;
+    uint64_t start;
+    uint32_t ns;
+
+    if ((*slot != NULL) && pinned) {
+      best_ns[i] = 0;
+      continue;
+    }
+    start = host_time_ns();
+    if (*slot == NULL) {
+      status = sl_memory_alloc_advanced(op->size, op->align, (sl_memory_block_type_t)op->type, slot);
+    } else if (op->resize) {
+      void *ptr = NULL;
+
+      status = sl_memory_realloc(*slot, op->size, &ptr);
+      if (status == SL_STATUS_OK) {
+        *slot = ptr;
+      }
+    } else {
+      status = sl_memory_free(*slot);
+      *slot = NULL;
+    }
+    ns = (uint32_t)(host_time_ns() - start);
+    if (status != SL_STATUS_OK) {
+      *slot = (op->resize) ? *slot : NULL;
+      (*fails)++;
+    }
+    if (ns < best_ns[i]) {
+      best_ns[i] = ns;
+    }
+    if ((i % FRAG_PERIOD) == 0U) {
+      double frag = mm_host_fragmentation();
+
+      if (frag > *frag_max) {
+        *frag_max = frag;
+      }
+    }
+  }
+}
+
+static void bench_trace(const TraceShape_t *shape, uint32_t count, uint32_t replays)
+{
+  TraceOp_t *ops = malloc(count * sizeof(*ops));
+  uint32_t *best_ns = malloc(count * sizeof(*best_ns));
+  double frag_max = 0.0;
+  uint32_t fails = 0;
+  uint64_t total = 0;
+
+  TEST_ASSERT((ops != NULL) && (best_ns != NULL));
+  make_trace(shape, ops, count);
+  memset(best_ns, 0xFF, count * sizeof(*best_ns));
+  for (uint32_t r = 0; r < replays; r++) {
+    replay(shape, ops, count, best_ns, &frag_max, &fails);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    total += best_ns[i];
+  }
+  qsort(best_ns, count, sizeof(*best_ns), compare_u32);
+  printf("%-9s %-8s %7u ops: mean %6.1f  p99 %6u  worst %6u ns  fragmentation max %.2f  failed %u\n",
+         VARIANT_NAME, shape->name, (unsigned)count, (double)total / count,
+         (unsigned)best_ns[(count * 99U) / 100U], (unsigned)best_ns[count - 1U], frag_max, (unsigned)fails);
+  free(ops);
+  free(best_ns);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t count = (uint32_t)host_arg(argc, argv, 1, 150000);
+  uint32_t replays = (uint32_t)host_arg(argc, argv, 2, 5);
+
+  for (size_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+    bench_trace(&shapes[i], count, replays);
+  }
+  return 0;
+}
@@ -0,0 +1,52 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager configuration of the host harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MEMORY_MANAGER_CONFIG_H
+#define SL_MEMORY_MANAGER_CONFIG_H
+
+// The project configuration (config/sl_memory_manager_config.h), with every
+// option overridable by the harness variants
+#ifndef SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE
+#define SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE   (32)
+#endif
+
+#ifndef SL_MEMORY_MANAGER_TLSF_ENABLE
+#define SL_MEMORY_MANAGER_TLSF_ENABLE   0
+#endif
+
+#ifndef SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE
+#define SL_MEMORY_MANAGER_SITE_PROFILER_ENABLE   0
+#endif
+
+#ifndef SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT
+#define SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT   32
+#endif
+
+#endif /* SL_MEMORY_MANAGER_CONFIG_H */
@@ -0,0 +1,120 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager on a host heap, shared by the Memory Manager harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "mm_host.h"
+#include "sl_memory_manager_region.h"
+
+static uint64_t __attribute__((aligned(MM_HOST_HEAP_ALIGN))) heap[MM_HOST_MAX_HEAP_SIZE / sizeof(uint64_t)];
+static size_t heap_size = MM_HOST_MAX_HEAP_SIZE;
+static uint64_t stack[64];
+
+sl_memory_region_t sl_memory_get_heap_region(void)
+{
+  sl_memory_region_t region = { heap, heap_size };
+
+  return region;
+}
+
+sl_memory_region_t sl_memory_get_stack_region(void)
+{
+  sl_memory_region_t region = { stack, sizeof(stack) };
+
+  return region;
+}
+
+void mm_host_init(size_t size)
+{
+  TEST_ASSERT((size <= MM_HOST_MAX_HEAP_SIZE) && ((size % sizeof(uint64_t)) == 0U));
+  heap_size = size;
+  memset(heap, 0xA5, size);
+#if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
+  reserve_no_retention_first = true;
+#endif
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_init());
+}
+
+void mm_host_check(mm_host_walk_t *walk)
+{
+  const uint64_t *end = heap + (heap_size / sizeof(uint64_t));
+  const uint64_t *pos = heap;
+  bool prev_free = false;
+
+  memset(walk, 0, sizeof(*walk));
+  for (;;) {
+    const sli_block_metadata_t *block = (const sli_block_metadata_t *)pos;
+    const uint64_t *block_end = pos + SLI_BLOCK_METADATA_SIZE_DWORD + block->length;
+
+    TEST_ASSERT(block_end <= end);
+    if (block->block_in_use) {
+      walk->used_block_count++;
+      prev_free = false;
+    } else {
+      size_t len = SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+
+      // Free blocks are merged with their free neighbours
+      TEST_ASSERT(!prev_free);
+      walk->free_block_count++;
+      walk->free_size += len;
+      if (len > walk->free_block_largest) {
+        walk->free_block_largest = len;
+      }
+      prev_free = true;
+    }
+    if (block->offset_neighbour_next == 0U) {
+      TEST_ASSERT(block_end == end);
+      break;
+    }
+
+    // A gap between two blocks holds a reservation, without metadata
+    const uint64_t *next_pos = pos + block->offset_neighbour_next;
+    const sli_block_metadata_t *next = (const sli_block_metadata_t *)next_pos;
+
+    TEST_ASSERT(next_pos >= block_end);
+    TEST_ASSERT(next_pos < end);
+    TEST_ASSERT_EQUAL(block->offset_neighbour_next, next->offset_neighbour_prev);
+    if (next_pos != block_end) {
+      prev_free = false;
+    }
+    pos = next_pos;
+  }
+}
+
+double mm_host_fragmentation(void)
+{
+  sl_memory_heap_info_t info;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_get_heap_info(&info));
+  if (info.free_size == 0U) {
+    return 0.0;
+  }
+  return 1.0 - ((double)info.free_block_largest_size / (double)info.free_size);
+}
@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager on a host heap, shared by the Memory Manager harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef MM_HOST_H
+#define MM_HOST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "host_test.h"
+#include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
+
+// Block lengths are 16-bit counts of double words, so a heap is at most 512 KB
+#define MM_HOST_MAX_HEAP_SIZE   (256U * 1024U)
+
+// Heap start alignment. Allocations aligned on more than this see the lost
+// zone at the heap start.
+#define MM_HOST_HEAP_ALIGN      4096U
+
+// What a walk of the heap blocks from the heap start found
+typedef struct {
+  size_t free_size;             // Free payload bytes
+  size_t free_block_largest;    // Largest free payload, in bytes
+  uint32_t free_block_count;
+  uint32_t used_block_count;
+} mm_host_walk_t;
+
+// Start the memory manager on an empty heap of the given size
+void mm_host_init(size_t heap_size);
+
+// Walk the blocks from the heap start and check their links: every block
+// ends before the next one starts, the neighbours point back at each other,
+// the last block ends at the heap end and no two free blocks touch.
+void mm_host_check(mm_host_walk_t *walk);
+
+// Fragmentation of the free space: 1 - largest free block / total free
+double mm_host_fragmentation(void);
+
+#endif // MM_HOST_H
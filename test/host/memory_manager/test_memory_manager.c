@@ -0,0 +1,185 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager test: aligned allocations and the lost zone at the heap start.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mm_host.h"
+
+#define HEAP_SIZE     (64U * 1024U)
+#define MAX_LIVE      384U
+#define MAX_SIZE      600U
+
+typedef struct {
+  uint8_t *ptr;
+  size_t size;
+  uint8_t fill;
+} LiveBlock_t;
+
+static const size_t aligns[] = {
+  SL_MEMORY_BLOCK_ALIGN_DEFAULT, 8, 16, 32, 64, 128, 256, 512
+};
+
+static LiveBlock_t live[MAX_LIVE];
+
+static size_t align_of(size_t align)
+{
+  return (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SL_MEMORY_BLOCK_ALIGN_8_BYTES : align;
+}
+
+static void check_heap(void)
+{
+  mm_host_walk_t walk;
+
+  mm_host_check(&walk);
+}
+
+static void check_empty(void)
+{
+  mm_host_walk_t walk;
+
+  mm_host_check(&walk);
+  TEST_ASSERT_EQUAL(0U, walk.used_block_count);
+  TEST_ASSERT_EQUAL(1U, walk.free_block_count);
+  TEST_ASSERT_EQUAL(HEAP_SIZE - SLI_BLOCK_METADATA_SIZE_BYTE, walk.free_size);
+  TEST_ASSERT_EQUAL(0U, sl_memory_get_used_heap_size());
+}
+
+static bool alloc_block(LiveBlock_t *b, size_t size, size_t align, sl_memory_block_type_t type, uint8_t fill)
+{
+  void *ptr = NULL;
+
+  if (sl_memory_alloc_advanced(size, align, type, &ptr) != SL_STATUS_OK) {
+    return false;
+  }
+  TEST_ASSERT(ptr != NULL);
+  TEST_ASSERT(((uintptr_t)ptr % align_of(align)) == 0U);
+  memset(ptr, fill, size);
+  b->ptr = ptr;
+  b->size = size;
+  b->fill = fill;
+  return true;
+}
+
+static void free_block(LiveBlock_t *b)
+{
+  for (size_t i = 0; i < b->size; i++) {
+    TEST_ASSERT_EQUAL(b->fill, b->ptr[i]);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(b->ptr));
+  b->ptr = NULL;
+}
+
+// A long-term block aligned past the heap start alignment is moved forward,
+// and leaves a lost zone at the heap start. The heap stays walkable from its
+// start, and the zone is merged back when the block is freed.
+static void test_heap_start_lost_zone(void)
+{
+  for (size_t a = 2; a < sizeof(aligns) / sizeof(aligns[0]); a++) {
+    LiveBlock_t first;
+    LiveBlock_t other[4];
+
+    mm_host_init(HEAP_SIZE);
+    TEST_ASSERT(alloc_block(&first, 40, aligns[a], BLOCK_TYPE_LONG_TERM, 0x11));
+    TEST_ASSERT((uint8_t *)first.ptr > (uint8_t *)sl_memory_get_heap_region().addr + SLI_BLOCK_METADATA_SIZE_BYTE);
+    check_heap();
+
+    for (uint32_t i = 0; i < 4U; i++) {
+      TEST_ASSERT(alloc_block(&other[i], 24U + (i * 40U), SL_MEMORY_BLOCK_ALIGN_DEFAULT,
+                              (i & 1U) ? BLOCK_TYPE_SHORT_TERM : BLOCK_TYPE_LONG_TERM, (uint8_t)(0x20 + i)));
+      check_heap();
+    }
+
+    // Free the aligned block first, and then the others
+    free_block(&first);
+    check_heap();
+    for (uint32_t i = 0; i < 4U; i++) {
+      free_block(&other[i]);
+      check_heap();
+    }
+    check_empty();
+
+    // The whole heap is back in one block, that takes a block of 3/4 of it
+    void *ptr = NULL;
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_alloc_advanced((HEAP_SIZE / 4U) * 3U,
+                                                             SL_MEMORY_BLOCK_ALIGN_DEFAULT,
+                                                             BLOCK_TYPE_LONG_TERM, &ptr));
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(ptr));
+  }
+}
+
+// Long-term and short-term blocks of every alignment, allocated and freed at
+// random until the heap is full and back. Each block keeps its own pattern,
+// so that a block placed over another one is seen when either is freed.
+static void test_aligned_random(uint32_t iterations)
+{
+  uint32_t rnd = 7;
+  uint32_t allocs = 0;
+  uint32_t fails = 0;
+
+  mm_host_init(HEAP_SIZE);
+  memset(live, 0, sizeof(live));
+  for (uint32_t n = 0; n < iterations; n++) {
+    LiveBlock_t *b = &live[host_rand(&rnd) % MAX_LIVE];
+
+    if (b->ptr != NULL) {
+      free_block(b);
+    } else {
+      size_t size = 1U + (host_rand(&rnd) % MAX_SIZE);
+      size_t align = aligns[host_rand(&rnd) % (sizeof(aligns) / sizeof(aligns[0]))];
+      sl_memory_block_type_t type = (host_rand(&rnd) & 1U) ? BLOCK_TYPE_SHORT_TERM : BLOCK_TYPE_LONG_TERM;
+
+      if (alloc_block(b, size, align, type, (uint8_t)(n | 1U))) {
+        allocs++;
+      } else {
+        fails++;
+      }
+    }
+    check_heap();
+  }
+  for (uint32_t i = 0; i < MAX_LIVE; i++) {
+    if (live[i].ptr != NULL) {
+      free_block(&live[i]);
+    }
+  }
+  check_empty();
+  TEST_ASSERT(allocs > (iterations / 4U));
+  printf("test_memory_manager: %u allocations, %u failed on a full heap\n", (unsigned)allocs, (unsigned)fails);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 20000);
+
+  test_heap_start_lost_zone();
+  test_aligned_random(iterations);
+  printf("test_memory_manager: passed\n");
+  return 0;
+}
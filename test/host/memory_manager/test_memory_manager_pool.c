@@ -0,0 +1,291 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory pool test: bulk calls and magazines, with an interrupt that uses the pool.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host_core.h"
+#include "mm_host.h"
+
+#define HEAP_SIZE     (16U * 1024U)
+#define BLOCK_COUNT   64U
+#define BLOCK_SIZE    48U
+#define MAX_BURST     16U
+
+// Owners of the blocks out of the pool. Each block holds its owner in every
+// byte, so that a block handed out twice is seen by the other owner.
+#define OWNER_NONE    0U
+#define OWNER_MAIN    1U
+#define OWNER_ISR     2U
+
+static sl_memory_pool_t pool;
+static uint8_t owner[BLOCK_COUNT];
+static sl_memory_pool_magazine_t main_magazine;
+static sl_memory_pool_magazine_t isr_magazine;
+static void *main_blocks[BLOCK_COUNT];
+static uint32_t main_count;
+static void *isr_blocks[BLOCK_COUNT];
+static uint32_t isr_count;
+static uint32_t isr_rnd = 5;
+static uint32_t isr_runs;
+static bool in_isr;
+
+static uint32_t index_of(const void *block)
+{
+  uintptr_t ofs = (uintptr_t)block - (uintptr_t)pool.block_address;
+
+  TEST_ASSERT((ofs % pool.block_size) == 0U);
+  TEST_ASSERT((ofs / pool.block_size) < BLOCK_COUNT);
+  return (uint32_t)(ofs / pool.block_size);
+}
+
+static void take(void *block, uint8_t who)
+{
+  uint32_t i = index_of(block);
+
+  TEST_ASSERT_EQUAL(OWNER_NONE, owner[i]);
+  owner[i] = who;
+  memset(block, who, BLOCK_SIZE);
+}
+
+static void give(void *block, uint8_t who)
+{
+  uint32_t i = index_of(block);
+  const uint8_t *p = block;
+
+  TEST_ASSERT_EQUAL(who, owner[i]);
+  for (uint32_t k = 0; k < BLOCK_SIZE; k++) {
+    TEST_ASSERT_EQUAL(who, p[k]);
+  }
+  owner[i] = OWNER_NONE;
+}
+
+// The "interrupt": taken when the main loop leaves a critical section. It
+// allocates and frees through its own magazine, and through the pool.
+static void isr(void)
+{
+  void *block = NULL;
+  uint32_t op = host_rand(&isr_rnd) % 4U;
+
+  if (in_isr) {
+    return;
+  }
+  in_isr = true;
+  host_core_irq_context = true;
+  isr_runs++;
+  if ((op < 2U) && (isr_count < BLOCK_COUNT)) {
+    sl_status_t status = (op == 0U) ? sl_memory_pool_magazine_alloc(&isr_magazine, &block)
+                         : sl_memory_pool_alloc(&pool, &block);
+
+    if (status == SL_STATUS_OK) {
+      take(block, OWNER_ISR);
+      isr_blocks[isr_count++] = block;
+    }
+  } else if (isr_count > 0U) {
+    block = isr_blocks[--isr_count];
+    give(block, OWNER_ISR);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, (op == 2U) ? sl_memory_pool_magazine_free(&isr_magazine, block)
+                      : sl_memory_pool_free(&pool, block));
+  }
+  host_core_irq_context = false;
+  in_isr = false;
+}
+
+static void setup(void)
+{
+  mm_host_init(HEAP_SIZE);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_create_pool(BLOCK_SIZE, BLOCK_COUNT, &pool));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_init(&main_magazine, &pool));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_init(&isr_magazine, &pool));
+  memset(owner, 0, sizeof(owner));
+  main_count = 0;
+  isr_count = 0;
+}
+
+// Every block is back in the pool once the magazines are flushed
+static void check_all_free(void)
+{
+  void *blocks[BLOCK_COUNT + 1U];
+  uint32_t count = 0;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_flush(&main_magazine));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_flush(&isr_magazine));
+  TEST_ASSERT_EQUAL(0U, main_magazine.block_count);
+  TEST_ASSERT_EQUAL(0U, isr_magazine.block_count);
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_memory_pool_alloc_bulk(&pool, blocks, BLOCK_COUNT + 1U, &count));
+  TEST_ASSERT_EQUAL(BLOCK_COUNT, count);
+  for (uint32_t i = 0; i < count; i++) {
+    take(blocks[i], OWNER_MAIN);
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    give(blocks[i], OWNER_MAIN);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free_bulk(&pool, blocks, count));
+}
+
+// Bulk calls take one critical section, and stop at an empty pool
+static void test_bulk(void)
+{
+  void *blocks[BLOCK_COUNT];
+  void *block = NULL;
+  uint32_t count = 0;
+  uint32_t sections;
+
+  setup();
+  sections = host_core_mask_count;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_alloc_bulk(&pool, blocks, 40, &count));
+  TEST_ASSERT_EQUAL(1U, host_core_mask_count - sections);
+  TEST_ASSERT_EQUAL(40U, count);
+  for (uint32_t i = 0; i < count; i++) {
+    take(blocks[i], OWNER_MAIN);
+  }
+
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_memory_pool_alloc_bulk(&pool, &blocks[40], 40, &count));
+  TEST_ASSERT_EQUAL(BLOCK_COUNT - 40U, count);
+  for (uint32_t i = 40; i < BLOCK_COUNT; i++) {
+    take(blocks[i], OWNER_MAIN);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_memory_pool_alloc_bulk(&pool, blocks, 1, &count));
+  TEST_ASSERT_EQUAL(0U, count);
+  TEST_ASSERT(sl_memory_pool_alloc(&pool, &block) != SL_STATUS_OK);
+
+  for (uint32_t i = 0; i < BLOCK_COUNT; i++) {
+    give(blocks[i], OWNER_MAIN);
+  }
+  sections = host_core_mask_count;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free_bulk(&pool, blocks, BLOCK_COUNT));
+  TEST_ASSERT_EQUAL(1U, host_core_mask_count - sections);
+  check_all_free();
+}
+
+// A magazine only goes to the pool when it is empty or full, by half of its
+// size at a time
+static void test_magazine(void)
+{
+  void *blocks[SL_MEMORY_POOL_MAGAZINE_SIZE * 2U];
+  uint32_t sections;
+  uint32_t refills = 0;
+
+  setup();
+  sections = host_core_mask_count;
+  for (uint32_t i = 0; i < SL_MEMORY_POOL_MAGAZINE_SIZE * 2U; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_alloc(&main_magazine, &blocks[i]));
+    take(blocks[i], OWNER_MAIN);
+  }
+  refills = host_core_mask_count - sections;
+  TEST_ASSERT_EQUAL((SL_MEMORY_POOL_MAGAZINE_SIZE * 2U) / (SL_MEMORY_POOL_MAGAZINE_SIZE / 2U), refills);
+
+  sections = host_core_mask_count;
+  for (uint32_t i = 0; i < SL_MEMORY_POOL_MAGAZINE_SIZE * 2U; i++) {
+    give(blocks[i], OWNER_MAIN);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_magazine_free(&main_magazine, blocks[i]));
+    TEST_ASSERT(main_magazine.block_count <= SL_MEMORY_POOL_MAGAZINE_SIZE);
+  }
+  TEST_ASSERT(host_core_mask_count - sections < refills);
+  check_all_free();
+}
+
+// Random bursts through every API of the main loop, with the interrupt
+// taken at the end of each critical section
+static void test_contention(uint32_t rounds)
+{
+  uint32_t rnd = 9;
+
+  setup();
+  isr_runs = 0;
+  host_core_on_unmask = isr;
+  for (uint32_t r = 0; r < rounds; r++) {
+    uint32_t burst = 1U + (host_rand(&rnd) % MAX_BURST);
+    uint32_t api = host_rand(&rnd) % 3U;
+
+    if ((host_rand(&rnd) & 1U) && ((main_count + burst) <= BLOCK_COUNT)) {
+      if (api == 0U) {
+        uint32_t count = 0;
+        sl_status_t status = sl_memory_pool_alloc_bulk(&pool, &main_blocks[main_count], burst, &count);
+
+        TEST_ASSERT((status == SL_STATUS_OK) ? (count == burst) : (status == SL_STATUS_EMPTY && count < burst));
+        for (uint32_t i = 0; i < count; i++) {
+          take(main_blocks[main_count++], OWNER_MAIN);
+        }
+      } else {
+        for (uint32_t i = 0; i < burst; i++) {
+          void *block = NULL;
+          sl_status_t status = (api == 1U) ? sl_memory_pool_magazine_alloc(&main_magazine, &block)
+                               : sl_memory_pool_alloc(&pool, &block);
+
+          if (status != SL_STATUS_OK) {
+            break;
+          }
+          take(block, OWNER_MAIN);
+          main_blocks[main_count++] = block;
+        }
+      }
+    } else {
+      burst = (burst > main_count) ? main_count : burst;
+      main_count -= burst;
+      for (uint32_t i = 0; i < burst; i++) {
+        give(main_blocks[main_count + i], OWNER_MAIN);
+      }
+      if (api == 0U) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free_bulk(&pool, &main_blocks[main_count], burst));
+      } else {
+        for (uint32_t i = 0; i < burst; i++) {
+          void *block = main_blocks[main_count + i];
+
+          TEST_ASSERT_EQUAL(SL_STATUS_OK, (api == 1U) ? sl_memory_pool_magazine_free(&main_magazine, block)
+                            : sl_memory_pool_free(&pool, block));
+        }
+      }
+    }
+  }
+  host_core_on_unmask = NULL;
+  TEST_ASSERT(isr_runs > rounds);
+
+  while (main_count > 0U) {
+    give(main_blocks[--main_count], OWNER_MAIN);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free(&pool, main_blocks[main_count]));
+  }
+  while (isr_count > 0U) {
+    give(isr_blocks[--isr_count], OWNER_ISR);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_pool_free(&pool, isr_blocks[isr_count]));
+  }
+  check_all_free();
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 20000);
+
+  test_bulk();
+  test_magazine();
+  test_contention(rounds);
+  printf("test_memory_manager_pool: passed\n");
+  return 0;
+}
@@ -0,0 +1,253 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager test: allocation site profiler statistics.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mm_host.h"
+
+#define HEAP_SIZE     (64U * 1024U)
+#define MAX_LIVE      256U
+#define MAX_SIZE      400U
+#define SITE_COUNT    SL_MEMORY_MANAGER_SITE_PROFILER_SITE_COUNT
+
+// More call sites than the table holds, so that entry 0 is used
+#define CALL_SITES    (SITE_COUNT + 3U)
+
+typedef void *(*SiteFn_t)(size_t size, size_t align, sl_memory_block_type_t type);
+
+// Every function below is a distinct allocation call site
+#define SITE_FN(n)                                                                     \
+  static __attribute__((noinline)) void *site_##n(size_t size, size_t align,           \
+                                                  sl_memory_block_type_t type)         \
+  {                                                                                    \
+    void *ptr = NULL;                                                                  \
+    return (sl_memory_alloc_advanced(size, align, type, &ptr) == SL_STATUS_OK) ? ptr : NULL; \
+  }
+
+SITE_FN(0) SITE_FN(1) SITE_FN(2) SITE_FN(3) SITE_FN(4) SITE_FN(5)
+SITE_FN(6) SITE_FN(7) SITE_FN(8) SITE_FN(9) SITE_FN(10)
+
+static const SiteFn_t sites[CALL_SITES] = {
+  site_0, site_1, site_2, site_3, site_4, site_5, site_6, site_7, site_8, site_9, site_10
+};
+
+static const size_t aligns[] = {
+  SL_MEMORY_BLOCK_ALIGN_DEFAULT, SL_MEMORY_BLOCK_ALIGN_DEFAULT, 16, 64, 256
+};
+
+static void *live[MAX_LIVE];
+
+static const sli_block_metadata_t *metadata_of(const void *ptr)
+{
+  return (const sli_block_metadata_t *)((const uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE);
+}
+
+// The live size of every table entry is the size of the blocks it owns
+static void check_live_sizes(void)
+{
+  size_t owned[SITE_COUNT] = { 0 };
+
+  for (uint32_t i = 0; i < MAX_LIVE; i++) {
+    if (live[i] != NULL) {
+      const sli_block_metadata_t *block = metadata_of(live[i]);
+
+      TEST_ASSERT(block->site_index < SITE_COUNT);
+      owned[block->site_index] += SLI_BLOCK_LEN_DWORD_TO_BYTE(block->length);
+    }
+  }
+  for (uint32_t s = 0; s < SITE_COUNT; s++) {
+    sl_memory_site_stats_t stats;
+    sl_status_t status = sl_memory_get_site_stats(s, &stats);
+
+    if (status == SL_STATUS_EMPTY) {
+      TEST_ASSERT_EQUAL(0U, owned[s]);
+      continue;
+    }
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, status);
+    TEST_ASSERT_EQUAL(owned[s], stats.live_size);
+    TEST_ASSERT(stats.live_size_peak >= stats.live_size);
+  }
+}
+
+// Counters of one call site, found through the block it just allocated
+static void test_counters(void)
+{
+  static const size_t sizes[] = { 8, 16, 24, 100, 1000, 2000 };
+  sl_memory_site_stats_t stats;
+  uint32_t histogram[SL_MEMORY_SITE_HISTOGRAM_BUCKET_COUNT] = { 0 };
+  size_t peak = 0;
+  size_t now = 0;
+  uint16_t index;
+
+  mm_host_init(HEAP_SIZE);
+  memset(live, 0, sizeof(live));
+  for (uint32_t i = 0; i < 6U; i++) {
+    live[i] = site_0(sizes[i], SL_MEMORY_BLOCK_ALIGN_DEFAULT, BLOCK_TYPE_LONG_TERM);
+    TEST_ASSERT(live[i] != NULL);
+    now += SLI_BLOCK_LEN_DWORD_TO_BYTE(metadata_of(live[i])->length);
+  }
+  peak = now;
+  index = metadata_of(live[0])->site_index;
+  TEST_ASSERT(index != 0U);
+
+  // Sizes are bucketed by the block size: <=16, <=32, ..., >1024 bytes
+  histogram[0] = 2;
+  histogram[1] = 1;
+  histogram[3] = 1;
+  histogram[6] = 1;
+  histogram[7] = 1;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_get_site_stats(index, &stats));
+  TEST_ASSERT_EQUAL(6U, stats.alloc_count);
+  TEST_ASSERT_EQUAL(0U, stats.free_count);
+  TEST_ASSERT_EQUAL(now, stats.live_size);
+  for (uint32_t b = 0; b < SL_MEMORY_SITE_HISTOGRAM_BUCKET_COUNT; b++) {
+    TEST_ASSERT_EQUAL(histogram[b], stats.size_histogram[b]);
+  }
+
+  for (uint32_t i = 0; i < 3U; i++) {
+    now -= SLI_BLOCK_LEN_DWORD_TO_BYTE(metadata_of(live[i])->length);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(live[i]));
+    live[i] = NULL;
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_get_site_stats(index, &stats));
+  TEST_ASSERT_EQUAL(3U, stats.free_count);
+  TEST_ASSERT_EQUAL(now, stats.live_size);
+  TEST_ASSERT_EQUAL(peak, stats.live_size_peak);
+
+  // A reset keeps the live blocks, and the site that owns them
+  sl_memory_reset_site_stats();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_get_site_stats(index, &stats));
+  TEST_ASSERT_EQUAL(0U, stats.alloc_count);
+  TEST_ASSERT_EQUAL(0U, stats.free_count);
+  TEST_ASSERT_EQUAL(now, stats.live_size);
+  TEST_ASSERT_EQUAL(now, stats.live_size_peak);
+
+  // A site that owns nothing is released by a reset
+  for (uint32_t i = 3; i < 6U; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(live[i]));
+    live[i] = NULL;
+  }
+  sl_memory_reset_site_stats();
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_memory_get_site_stats(index, &stats));
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_INDEX, sl_memory_get_site_stats(SITE_COUNT, &stats));
+}
+
+// The C library style wrappers give the block to their own caller
+static void test_wrappers(void)
+{
+  void *a;
+  void *b;
+  uint16_t index;
+
+  mm_host_init(HEAP_SIZE);
+  memset(live, 0, sizeof(live));
+  a = sl_malloc(40);
+  b = sl_calloc(4, 10);
+  TEST_ASSERT((a != NULL) && (b != NULL));
+  TEST_ASSERT(metadata_of(a)->site_index != metadata_of(b)->site_index);
+
+  // A moved block belongs to the realloc caller
+  a = sl_realloc(a, 2000);
+  TEST_ASSERT(a != NULL);
+  index = metadata_of(a)->site_index;
+  TEST_ASSERT(index != metadata_of(b)->site_index);
+  live[0] = a;
+  live[1] = b;
+  check_live_sizes();
+
+  // A block resized in place keeps its owner
+  live[0] = sl_realloc(a, 100);
+  TEST_ASSERT(live[0] == a);
+  TEST_ASSERT_EQUAL(index, metadata_of(a)->site_index);
+  check_live_sizes();
+  sl_free(live[0]);
+  sl_free(live[1]);
+  live[0] = NULL;
+  live[1] = NULL;
+  check_live_sizes();
+}
+
+// Random allocations of every alignment from more call sites than the
+// table holds, frees and reallocations
+static void test_random(uint32_t iterations)
+{
+  uint32_t rnd = 3;
+  uint64_t allocs[SITE_COUNT] = { 0 };
+
+  mm_host_init(HEAP_SIZE);
+  sl_memory_reset_site_stats();
+  memset(live, 0, sizeof(live));
+  for (uint32_t n = 0; n < iterations; n++) {
+    void **slot = &live[host_rand(&rnd) % MAX_LIVE];
+    size_t size = 1U + (host_rand(&rnd) % MAX_SIZE);
+
+    if (*slot == NULL) {
+      size_t align = aligns[host_rand(&rnd) % (sizeof(aligns) / sizeof(aligns[0]))];
+      sl_memory_block_type_t type = (host_rand(&rnd) & 1U) ? BLOCK_TYPE_SHORT_TERM : BLOCK_TYPE_LONG_TERM;
+
+      *slot = sites[host_rand(&rnd) % CALL_SITES](size, align, type);
+      if (*slot != NULL) {
+        allocs[metadata_of(*slot)->site_index]++;
+      }
+    } else if ((host_rand(&rnd) % 4U) == 0U) {
+      void *ptr = NULL;
+
+      if (sl_memory_realloc(*slot, size, &ptr) == SL_STATUS_OK) {
+        *slot = ptr;
+      }
+    } else {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(*slot));
+      *slot = NULL;
+    }
+    check_live_sizes();
+  }
+
+  // Entry 0 took the call sites that did not fit in the table
+  TEST_ASSERT(allocs[0] > 0U);
+  for (uint32_t i = 0; i < MAX_LIVE; i++) {
+    if (live[i] != NULL) {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_memory_free(live[i]));
+      live[i] = NULL;
+    }
+  }
+  check_live_sizes();
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 20000);
+
+  test_counters();
+  test_wrappers();
+  test_random(iterations);
+  printf("test_memory_manager_sites: passed\n");
+  return 0;
+}
@@ -0,0 +1,134 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 mount time, read and write latency, repack cost and write amplification on the RAM HAL.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "nvm3_host.h"
+
+typedef struct {
+  uint32_t objects;
+  uint32_t size;
+  uint32_t pages;
+} config_t;
+
+// Object counts and sizes, with an NVM area about three times the live data
+static const config_t configs[] = {
+  { 100, 16, 4 },
+  { 200, 32, 6 },
+  { 500, 64, 12 },
+  { 1000, 16, 10 },
+  { 1000, 128, 48 },
+  { 2000, 32, 32 },
+};
+
+// Each object is written once, then rewritten at random `rewrites` times on
+// average. A repack is run whenever NVM3 asks for one, half a page before the
+// writes would have to do it themselves.
+static void bench(const config_t *c, uint32_t rewrites)
+{
+  static uint8_t data[NVM3_MAX_OBJECT_SIZE];
+  nvm3_HalRamStats_t ram;
+  nvm3_Init_t init;
+  nvm3_Handle_t h;
+  uint32_t state = 0x1234567U + c->objects;
+  uint32_t writes = c->objects * (1U + rewrites);
+  uint64_t userBytes = 0;
+  uint64_t writeNs = 0;
+  uint64_t writeMaxNs = 0;
+  uint64_t repackNs = 0;
+  uint64_t repackMaxNs = 0;
+  uint32_t repacks = 0;
+  uint64_t readNs;
+  uint64_t mountNs;
+  uint64_t start;
+  uint64_t ns;
+
+  nvm3_host_erase();
+  nvm3_host_init(&init, c->pages, c->objects + 16U);
+  init.repackHeadroom = NVM3_HAL_RAM_PAGE_SIZE / 2U;
+  memset(&h, 0, sizeof(h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(&h, &init));
+  nvm3_halRamResetStats();
+
+  for (uint32_t i = 0; i < writes; i++) {
+    nvm3_ObjectKey_t key = (i < c->objects) ? i : (host_rand(&state) % c->objects);
+
+    nvm3_host_fill(data, c->size, key, i);
+    start = host_time_ns();
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, key, data, c->size));
+    ns = host_time_ns() - start;
+    writeNs += ns;
+    writeMaxNs = (ns > writeMaxNs) ? ns : writeMaxNs;
+    userBytes += c->size;
+    while (nvm3_repackNeeded(&h)) {
+      start = host_time_ns();
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+      ns = host_time_ns() - start;
+      repackNs += ns;
+      repackMaxNs = (ns > repackMaxNs) ? ns : repackMaxNs;
+      repacks++;
+    }
+  }
+  nvm3_halRamGetStats(&ram);
+
+  start = host_time_ns();
+  for (uint32_t i = 0; i < writes; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(&h, i % c->objects, data, c->size));
+  }
+  readNs = host_time_ns() - start;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+  memset(&h, 0, sizeof(h));
+  start = host_time_ns();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(&h, &init));
+  mountNs = host_time_ns() - start;
+  TEST_ASSERT_EQUAL(c->objects, nvm3_countObjects(&h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("%5u x %4u B %3u pages | mount %8.1f us | write %6.2f us (max %7.1f) | read %5.2f us"
+         " | repack %7.1f us x %5u (max %7.1f) | WA %5.2f | erases %5u | flash busy %6.1f us/write\n",
+         c->objects, c->size, c->pages, (double)mountNs / 1e3,
+         (double)writeNs / writes / 1e3, (double)writeMaxNs / 1e3,
+         (double)readNs / writes / 1e3,
+         repacks ? (double)repackNs / repacks / 1e3 : 0.0, repacks, (double)repackMaxNs / 1e3,
+         (double)ram.wordWriteCnt * sizeof(uint32_t) / (double)userBytes,
+         ram.pageEraseCnt, (double)ram.busyTimeUs / writes);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rewrites = (uint32_t)host_arg(argc, argv, 1, 20);
+
+  printf("NVM3 on the RAM HAL, %u B pages, %u rewrites per object; WA is FLASH bytes "
+         "written per data byte, flash busy is the emulated FLASH time\n",
+         (unsigned)NVM3_HAL_RAM_PAGE_SIZE, rewrites);
+  for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+    bench(&configs[i], rewrites);
+  }
+  return 0;
+}
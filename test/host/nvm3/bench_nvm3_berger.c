@@ -0,0 +1,158 @@
+/***************************************************************************//**
+ * @file
+ * @brief Micro-benchmark of the NVM3 Berger code functions and the counter paths using them.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_host.h"
+#include "nvm3_utils.h"
+
+#define WORDS     1024U
+#define PAGES     4U
+
+#if defined(__GNUC__) && defined(__POPCNT__)
+#define BUILD     "popcount"
+#else
+#define BUILD     "bit count"
+#endif
+
+// Widths used by NVM3: counter increments, page counter, small and large
+// object headers
+static const uint8_t widths[] = { 8, 16, 27, 32 };
+
+static uint32_t input[WORDS];
+static uint8_t codes[WORDS];
+static volatile uint32_t sink;
+
+// Bit by bit, the definition of the code
+static uint8_t reference_code(uint32_t word, uint8_t numberOfBits)
+{
+  uint8_t zeros = 0;
+
+  for (uint8_t bit = 0; bit < numberOfBits; bit++) {
+    zeros += ((word >> bit) & 1U) ? 0U : 1U;
+  }
+  return zeros;
+}
+
+static void check(uint8_t numberOfBits)
+{
+  nvm3_utilsComputeBergerCodes(codes, input, WORDS, numberOfBits);
+  for (size_t i = 0; i < WORDS; i++) {
+    uint8_t code = 0;
+
+    nvm3_utilsComputeBergerCode(&code, &input[i], numberOfBits);
+    TEST_ASSERT_EQUAL(reference_code(input[i], numberOfBits), code);
+    TEST_ASSERT_EQUAL(code, codes[i]);
+  }
+}
+
+static void bench_codes(uint8_t numberOfBits, uint32_t rounds)
+{
+  uint64_t start;
+  uint64_t wordNs;
+  uint64_t batchNs;
+  uint32_t sum = 0;
+
+  check(numberOfBits);
+
+  start = host_time_ns();
+  for (uint32_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < WORDS; i++) {
+      uint8_t code = 0;
+
+      nvm3_utilsComputeBergerCode(&code, &input[i], numberOfBits);
+      sum += code;
+    }
+  }
+  wordNs = host_time_ns() - start;
+
+  start = host_time_ns();
+  for (uint32_t r = 0; r < rounds; r++) {
+    nvm3_utilsComputeBergerCodes(codes, input, WORDS, numberOfBits);
+    sum += codes[r % WORDS];
+  }
+  batchNs = host_time_ns() - start;
+  sink = sum;
+
+  printf("%-9s %2u bits: per word %5.2f ns, batched %5.2f ns/word\n", BUILD, numberOfBits,
+         (double)wordNs / rounds / WORDS, (double)batchNs / rounds / WORDS);
+}
+
+// Counter reads and increments, which check the Berger code of every
+// increment field
+static void bench_counter(uint32_t rounds)
+{
+  nvm3_Handle_t h;
+  uint32_t value;
+  uint64_t start;
+  uint64_t readNs = 0;
+  uint64_t incNs = 0;
+  uint32_t ops = 0;
+
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, 16));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeCounter(&h, 1, 0));
+  for (uint32_t r = 0; r < rounds; r++) {
+    start = host_time_ns();
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_incrementCounter(&h, 1, &value));
+    incNs += host_time_ns() - start;
+    start = host_time_ns();
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readCounter(&h, 1, &value));
+    readNs += host_time_ns() - start;
+    TEST_ASSERT_EQUAL(r + 1U, value);
+    ops++;
+    if (nvm3_repackNeeded(&h)) {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+    }
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("%-9s counter: read %6.1f ns, increment %6.1f ns\n", BUILD,
+         (double)readNs / ops, (double)incNs / ops);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 10000);
+  uint32_t state = 0xBE26E2U;
+
+  for (size_t i = 0; i < WORDS; i++) {
+    input[i] = host_rand(&state);
+  }
+  // Erased and fully programmed words too
+  input[0] = 0xFFFFFFFFU;
+  input[1] = 0U;
+
+  for (size_t i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+    bench_codes(widths[i], rounds);
+  }
+  bench_counter(rounds);
+  return 0;
+}
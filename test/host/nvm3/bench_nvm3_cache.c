@@ -0,0 +1,232 @@
+/***************************************************************************//**
+ * @file
+ * @brief Benchmark of the hash cache against the default cache, 100 to 5000 keys.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_cache.h"
+#include "nvm3_host.h"
+
+#define PAGES       32U
+#define MAX_KEYS    5000U
+#define DATA_SIZE   4U
+
+#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
+#define DEFAULT_NAME  "sorted"
+#else
+#define DEFAULT_NAME  "linear"
+#endif
+
+static const uint32_t keyCounts[] = { 100, 1000, 5000 };
+
+static nvm3_ObjectKey_t keys[MAX_KEYS];
+static nvm3_ObjectKey_t order[MAX_KEYS];
+
+static const char *type_name(nvm3_CacheType_t type)
+{
+  return (type == NVM3_CACHE_TYPE_HASH) ? "hash" : DEFAULT_NAME;
+}
+
+static nvm3_ObjPtr_t fake_obj(uint32_t i)
+{
+  return (nvm3_ObjPtr_t)(uintptr_t)(0x10000000U + (i * 16U));
+}
+
+// Distinct keys spread over the key space, and a shuffled lookup order
+static void make_keys(uint32_t count)
+{
+  uint32_t state = 0x5EEDU;
+
+  for (uint32_t i = 0; i < count; i++) {
+    keys[i] = (i * 2654435761U) & NVM3_KEY_MAX;
+    order[i] = keys[i];
+  }
+  for (uint32_t i = count - 1U; i > 0U; i--) {
+    uint32_t j = host_rand(&state) % (i + 1U);
+    nvm3_ObjectKey_t tmp = order[i];
+
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+}
+
+// Update a present key the way nvm3_writeData() does
+static void cache_update(nvm3_Cache_t *c, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj)
+{
+#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
+  if (c->type != NVM3_CACHE_TYPE_HASH) {
+    TEST_ASSERT(nvm3_cacheUpdateEntry(c, key, obj, objGroupData));
+    return;
+  }
+#endif
+  nvm3_cacheSet(c, key, obj, objGroupData);
+}
+
+// Add a new key the way nvm3_writeData() does
+static void cache_add(nvm3_Cache_t *c, nvm3_ObjectKey_t key, nvm3_ObjPtr_t obj)
+{
+#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
+  if (c->type != NVM3_CACHE_TYPE_HASH) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_cacheAddEntry(c, key, obj, objGroupData));
+    return;
+  }
+#endif
+  nvm3_cacheSet(c, key, obj, objGroupData);
+}
+
+// The cache operations on their own: the fill a mount makes, hits, misses,
+// updates and a delete followed by an add
+static void bench_cache(nvm3_CacheType_t type, uint32_t count, uint32_t rounds)
+{
+  nvm3_Cache_t c;
+  nvm3_ObjGroup_t group;
+  uint64_t start;
+  uint64_t fillNs = 0;
+  uint64_t hitNs = 0;
+  uint64_t missNs = 0;
+  uint64_t updateNs = 0;
+  uint64_t churnNs = 0;
+
+  make_keys(count);
+  for (uint32_t r = 0; r < rounds; r++) {
+    start = host_time_ns();
+    nvm3_cacheOpen(&c, nvm3_host_cache, count + (count / 8U) + 1U, type);
+    for (uint32_t i = 0; i < count; i++) {
+      nvm3_cacheSet(&c, keys[i], fake_obj(i), objGroupData);
+    }
+#if defined(NVM3_OPTIMIZATION) && (NVM3_OPTIMIZATION == 1)
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_cacheSort(&c));
+#endif
+    fillNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      TEST_ASSERT(nvm3_cacheGet(&c, order[i], &group) != NVM3_OBJ_PTR_INVALID);
+    }
+    hitNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      TEST_ASSERT(nvm3_cacheGet(&c, order[i] ^ 0x80000U, &group) == NVM3_OBJ_PTR_INVALID);
+    }
+    missNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      cache_update(&c, order[i], fake_obj(i + 1U));
+    }
+    updateNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      nvm3_cacheDelete(&c, order[i]);
+      cache_add(&c, order[i], fake_obj(i));
+    }
+    churnNs += host_time_ns() - start;
+    TEST_ASSERT(!c.overflow);
+  }
+
+  printf("%-6s %5u keys: fill %7.1f  hit %7.1f  miss %7.1f  update %7.1f  delete+add %8.1f ns/key\n",
+         type_name(type), count,
+         (double)fillNs / rounds / count, (double)hitNs / rounds / count, (double)missNs / rounds / count,
+         (double)updateNs / rounds / count, (double)churnNs / rounds / count);
+}
+
+static void open_with(nvm3_Handle_t *h, nvm3_CacheType_t type, uint32_t count)
+{
+  nvm3_Init_t init;
+
+  nvm3_host_init(&init, PAGES, count + 16U);
+  init.cacheType = type;
+  memset(h, 0, sizeof(*h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(h, &init));
+}
+
+// Through NVM3: mount, and a read and a rewrite of every key
+static void bench_nvm3(nvm3_CacheType_t type, uint32_t count, uint32_t rounds)
+{
+  uint8_t data[DATA_SIZE];
+  nvm3_Handle_t h;
+  uint64_t start;
+  uint64_t mountNs = 0;
+  uint64_t readNs = 0;
+  uint64_t writeNs = 0;
+
+  make_keys(count);
+  nvm3_host_erase();
+  open_with(&h, type, count);
+  for (uint32_t i = 0; i < count; i++) {
+    nvm3_host_fill(data, DATA_SIZE, keys[i], 0);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, keys[i], data, DATA_SIZE));
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  for (uint32_t r = 0; r < rounds; r++) {
+    start = host_time_ns();
+    open_with(&h, type, count);
+    mountNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(&h, order[i], data, DATA_SIZE));
+    }
+    readNs += host_time_ns() - start;
+
+    start = host_time_ns();
+    for (uint32_t i = 0; i < count; i++) {
+      nvm3_host_fill(data, DATA_SIZE, order[i], r + 1U);
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, order[i], data, DATA_SIZE));
+      if (nvm3_repackNeeded(&h)) {
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+      }
+    }
+    writeNs += host_time_ns() - start;
+    TEST_ASSERT_EQUAL(count, nvm3_countObjects(&h));
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+  }
+
+  printf("%-6s %5u keys: mount %8.1f us  read %7.1f  write %7.1f ns/key\n",
+         type_name(type), count, (double)mountNs / rounds / 1e3,
+         (double)readNs / rounds / count, (double)writeNs / rounds / count);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 10);
+
+  for (size_t i = 0; i < sizeof(keyCounts) / sizeof(keyCounts[0]); i++) {
+    bench_cache(NVM3_CACHE_TYPE_DEFAULT, keyCounts[i], rounds);
+    bench_cache(NVM3_CACHE_TYPE_HASH, keyCounts[i], rounds);
+  }
+  for (size_t i = 0; i < sizeof(keyCounts) / sizeof(keyCounts[0]); i++) {
+    bench_nvm3(NVM3_CACHE_TYPE_DEFAULT, keyCounts[i], rounds);
+    bench_nvm3(NVM3_CACHE_TYPE_HASH, keyCounts[i], rounds);
+  }
+  return 0;
+}
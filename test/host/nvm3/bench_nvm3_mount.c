@@ -0,0 +1,98 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 mount time after a clean close, with or without the mount checkpoint.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "nvm3_host.h"
+
+#define PAGES   16U
+
+#if defined(NVM3_CHECKPOINT) && (NVM3_CHECKPOINT == 1)
+#define BUILD   "checkpoint"
+#else
+#define BUILD   "full scan"
+#endif
+
+typedef struct {
+  uint32_t objects;
+  uint32_t size;
+} config_t;
+
+static const config_t configs[] = {
+  { 200, 32 },
+  { 500, 32 },
+  { 1000, 16 },
+  { 300, 200 },
+};
+
+// Write every object, rewrite them twice at random, close, then mount the
+// instance again and again
+static void bench(const config_t *c, uint32_t mounts)
+{
+  static uint8_t data[NVM3_MAX_OBJECT_SIZE];
+  nvm3_HalRamStats_t stats;
+  nvm3_Handle_t h;
+  uint32_t state = 0xC0FFEEU;
+  uint64_t start;
+  uint64_t ns = 0;
+
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, c->objects + 16U));
+  for (uint32_t i = 0; i < 3U * c->objects; i++) {
+    nvm3_ObjectKey_t key = (i < c->objects) ? i : (host_rand(&state) % c->objects);
+
+    nvm3_host_fill(data, c->size, key, i);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, key, data, c->size));
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  nvm3_halRamResetStats();
+  for (uint32_t i = 0; i < mounts; i++) {
+    start = host_time_ns();
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, c->objects + 16U));
+    ns += host_time_ns() - start;
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+  }
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, c->objects + 16U));
+  TEST_ASSERT_EQUAL(c->objects, nvm3_countObjects(&h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("%-10s %5u x %3u B: mount %7.1f us, %6u words read\n", BUILD,
+         c->objects, c->size, (double)ns / mounts / 1e3, stats.wordReadCnt / mounts);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t mounts = (uint32_t)host_arg(argc, argv, 1, 20);
+
+  for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+    bench(&configs[i], mounts);
+  }
+  return 0;
+}
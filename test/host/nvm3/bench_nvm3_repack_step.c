@@ -0,0 +1,174 @@
+/***************************************************************************//**
+ * @file
+ * @brief Write latency histograms with and without nvm3_repackStep().
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "nvm3_host.h"
+
+#define PAGES       16U
+#define KEYS        250U
+#define MIN_SIZE    20U
+#define MAX_SIZE    200U
+
+// Histogram bucket upper bounds, in microseconds of FLASH busy time
+static const uint32_t bucketUs[] = { 100, 500, 1000, 2000, 5000, 10000, 20000, 50000 };
+#define BUCKETS   (sizeof(bucketUs) / sizeof(bucketUs[0]) + 1U)
+
+typedef struct {
+  const char *name;
+  uint32_t steps;           // Repack steps between writes
+  size_t copyBudget;        // Bytes copied per step
+  size_t headroom;          // repackHeadroom, steps start this early
+} step_mode_t;
+
+static const step_mode_t modes[] = {
+  { "no steps", 0, 0, 0 },
+  { "1 x 256 B", 1, 256, 0 },
+  { "4 x 256 B", 4, 256, 8192 },
+  { "1 x 1 kB", 1, 1024, 8192 },
+};
+
+typedef struct {
+  uint32_t count[BUCKETS];
+  uint32_t total;
+  uint64_t sumUs;
+  uint32_t *samples;
+} histogram_t;
+
+static uint32_t writeSamples[100000];
+static uint32_t stepSamples[400000];
+
+static void hist_add(histogram_t *hist, uint32_t us)
+{
+  size_t b = 0;
+
+  while ((b < (BUCKETS - 1U)) && (us >= bucketUs[b])) {
+    b++;
+  }
+  hist->count[b]++;
+  hist->samples[hist->total] = us;
+  hist->total++;
+  hist->sumUs += us;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static void hist_print(const char *what, histogram_t *hist)
+{
+  if (hist->total == 0U) {
+    return;
+  }
+  qsort(hist->samples, hist->total, sizeof(uint32_t), compare_u32);
+  printf("  %-6s n %6u  mean %7.1f  p50 %6u  p99 %6u  max %6u us |", what, hist->total,
+         (double)hist->sumUs / hist->total, hist->samples[hist->total / 2U],
+         hist->samples[(hist->total * 99U) / 100U], hist->samples[hist->total - 1U]);
+  for (size_t b = 0; b < BUCKETS; b++) {
+    printf(" %6u", hist->count[b]);
+  }
+  printf("\n");
+}
+
+static uint64_t busy_us(void)
+{
+  nvm3_HalRamStats_t stats;
+
+  nvm3_halRamGetStats(&stats);
+  return stats.busyTimeUs;
+}
+
+// Random rewrites of values of random sizes, with repack steps in between.
+// The latency of a call is the FLASH busy time it causes.
+static void bench(const step_mode_t *m, uint32_t writes)
+{
+  static uint8_t data[MAX_SIZE];
+  histogram_t writeHist = { .samples = writeSamples };
+  histogram_t stepHist = { .samples = stepSamples };
+  nvm3_HalRamStats_t stats;
+  nvm3_Init_t init;
+  nvm3_Handle_t h;
+  uint32_t state = 0xBADC0DEU;
+  uint64_t start;
+  bool moreWork;
+
+  TEST_ASSERT(writes <= (sizeof(writeSamples) / sizeof(writeSamples[0])));
+  nvm3_host_erase();
+  nvm3_host_init(&init, PAGES, KEYS + 16U);
+  init.repackHeadroom = m->headroom;
+  memset(&h, 0, sizeof(h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(&h, &init));
+  nvm3_halRamResetStats();
+
+  for (uint32_t i = 0; i < writes; i++) {
+    nvm3_ObjectKey_t key = host_rand(&state) % KEYS;
+    size_t len = MIN_SIZE + (host_rand(&state) % (MAX_SIZE - MIN_SIZE + 1U));
+
+    nvm3_host_fill(data, len, key, i);
+    start = busy_us();
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, key, data, len));
+    hist_add(&writeHist, (uint32_t)(busy_us() - start));
+
+    for (uint32_t s = 0; (s < m->steps) && nvm3_repackNeeded(&h); s++) {
+      TEST_ASSERT(stepHist.total < (sizeof(stepSamples) / sizeof(stepSamples[0])));
+      start = busy_us();
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repackStep(&h, m->copyBudget, &moreWork));
+      hist_add(&stepHist, (uint32_t)(busy_us() - start));
+    }
+  }
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("%-10s headroom %5u B: erases %5u\n", m->name, (unsigned)m->headroom, stats.pageEraseCnt);
+  hist_print("write", &writeHist);
+  hist_print("step", &stepHist);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t writes = (uint32_t)host_arg(argc, argv, 1, 20000);
+
+  printf("NVM3 on the RAM HAL, %u pages, %u keys of %u-%u B, %u writes; latency is emulated FLASH busy time\n",
+         PAGES, KEYS, MIN_SIZE, MAX_SIZE, writes);
+  printf("%70s |", "histogram buckets, below (us)");
+  for (size_t b = 0; b < (BUCKETS - 1U); b++) {
+    printf(" %6u", bucketUs[b]);
+  }
+  printf("   more\n");
+  for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+    bench(&modes[i], writes);
+  }
+  return 0;
+}
@@ -0,0 +1,194 @@
+/***************************************************************************//**
+ * @file
+ * @brief Peak RAM and time of streamed object writes and reads against whole-buffer ones.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_host.h"
+
+#define PAGES         16U
+#define KEY           1U
+#define CHUNK_SIZE    64U
+#define STACK_PAINT   32768U
+#define PAINT_BYTE    0xA5U
+
+static const size_t objLens[] = { 120, 500, 1024, NVM3_MAX_OBJECT_SIZE };
+
+static uint32_t checksum;
+static uintptr_t paintArea;
+
+// Fill the stack below the caller with a pattern
+static void __attribute__((noinline)) stack_paint(void)
+{
+  volatile uint8_t area[STACK_PAINT];
+
+  for (size_t i = 0; i < sizeof(area); i++) {
+    area[i] = PAINT_BYTE;
+  }
+  paintArea = (uintptr_t)area;
+}
+
+// Bytes of the painted stack used since stack_paint(), counted from the
+// deepest byte that lost the pattern
+static size_t stack_used(void)
+{
+  volatile const uint8_t *area = (volatile const uint8_t *)paintArea;
+  size_t i = 0;
+
+  while ((i < STACK_PAINT) && (area[i] == PAINT_BYTE)) {
+    i++;
+  }
+  return STACK_PAINT - i;
+}
+
+static sl_status_t fill(void *user, size_t ofs, void *buf, size_t len)
+{
+  nvm3_host_fill(buf, len, KEY, (uint32_t)(uintptr_t)user + (uint32_t)ofs);
+  return SL_STATUS_OK;
+}
+
+static bool sum(void *user, size_t ofs, const void *buf, size_t len)
+{
+  const uint8_t *p = buf;
+
+  (void)user;
+  (void)ofs;
+  for (size_t i = 0; i < len; i++) {
+    checksum += p[i];
+  }
+  return true;
+}
+
+// The application holds the whole object in RAM
+static void __attribute__((noinline)) write_whole(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+
+  nvm3_host_fill(data, len, KEY, gen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(h, KEY, data, len));
+}
+
+static void __attribute__((noinline)) read_whole(nvm3_Handle_t *h, size_t len)
+{
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(h, KEY, data, len));
+  (void)sum(NULL, 0, data, len);
+}
+
+// The application holds one chunk at a time
+static void __attribute__((noinline)) write_stream(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  uint32_t buf[CHUNK_SIZE / sizeof(uint32_t)];
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeDataStream(h, KEY, len, buf, sizeof(buf), fill, (void *)(uintptr_t)gen));
+}
+
+static void __attribute__((noinline)) read_stream(nvm3_Handle_t *h, size_t len)
+{
+  uint32_t buf[CHUNK_SIZE / sizeof(uint32_t)];
+
+  (void)len;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readDataStream(h, KEY, buf, sizeof(buf), sum, NULL));
+}
+
+typedef void (*op_fn_t)(nvm3_Handle_t *h, size_t len, uint32_t gen);
+
+static void write_whole_op(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  write_whole(h, len, gen);
+}
+
+static void read_whole_op(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  (void)gen;
+  read_whole(h, len);
+}
+
+static void write_stream_op(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  write_stream(h, len, gen);
+}
+
+static void read_stream_op(nvm3_Handle_t *h, size_t len, uint32_t gen)
+{
+  (void)gen;
+  read_stream(h, len);
+}
+
+// The deepest stack of one call, and the mean time over the rounds
+static void measure(nvm3_Handle_t *h, op_fn_t op, size_t len, uint32_t rounds, size_t *peak, double *ns)
+{
+  uint64_t start;
+  uint64_t total = 0;
+
+  *peak = 0;
+  for (uint32_t r = 0; r < rounds; r++) {
+    size_t used;
+
+    stack_paint();
+    start = host_time_ns();
+    op(h, len, r);
+    total += host_time_ns() - start;
+    used = stack_used();
+    if (used > *peak) {
+      *peak = used;
+    }
+  }
+  *ns = (double)total / rounds;
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 200);
+  nvm3_Handle_t h;
+
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, 16));
+  printf("peak stack bytes and time per call, %u B stream chunks\n", CHUNK_SIZE);
+  for (size_t i = 0; i < (sizeof(objLens) / sizeof(objLens[0])); i++) {
+    size_t len = objLens[i];
+    size_t wrWhole, wrStream, rdWhole, rdStream;
+    double wrWholeNs, wrStreamNs, rdWholeNs, rdStreamNs;
+
+    measure(&h, write_whole_op, len, rounds, &wrWhole, &wrWholeNs);
+    measure(&h, read_whole_op, len, rounds, &rdWhole, &rdWholeNs);
+    measure(&h, write_stream_op, len, rounds, &wrStream, &wrStreamNs);
+    measure(&h, read_stream_op, len, rounds, &rdStream, &rdStreamNs);
+    printf("%4u B: write %5u B %8.0f ns, stream %5u B %8.0f ns | read %5u B %7.0f ns, stream %5u B %7.0f ns\n",
+           (unsigned)len,
+           (unsigned)wrWhole, wrWholeNs, (unsigned)wrStream, wrStreamNs,
+           (unsigned)rdWhole, rdWholeNs, (unsigned)rdStream, rdStreamNs);
+    TEST_ASSERT(wrStream < wrWhole);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("checksum %u\n", checksum);
+  return 0;
+}
@@ -0,0 +1,41 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the memory manager, used by the sorted NVM3 cache.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MEMORY_MANAGER_H
+#define SL_MEMORY_MANAGER_H
+
+#include <stdlib.h>
+
+// The sorted cache only takes scratch arrays for its merge sort, so the C
+// library heap stands in for the memory manager.
+#define sl_malloc(size)   malloc(size)
+#define sl_free(ptr)      free(ptr)
+
+#endif // SL_MEMORY_MANAGER_H
@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 instances on the RAM HAL, shared by the NVM3 harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef NVM3_HOST_H
+#define NVM3_HOST_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "nvm3.h"
+#include "nvm3_hal_ram.h"
+
+#define NVM3_HOST_MAX_PAGES     NVM3_HAL_RAM_MAX_PAGE_COUNT
+#define NVM3_HOST_MAX_CACHE     6000U
+
+// The emulated FLASH, page aligned as NVM3 requires. It keeps its content
+// across nvm3_close() and nvm3_open(), as the device FLASH keeps it across a
+// reset.
+static uint32_t __attribute__((aligned(NVM3_HAL_RAM_PAGE_SIZE))) nvm3_host_area[NVM3_HOST_MAX_PAGES * NVM3_HAL_RAM_PAGE_SIZE / sizeof(uint32_t)];
+static nvm3_CacheEntry_t nvm3_host_cache[NVM3_HOST_MAX_CACHE];
+
+// Erase the whole area, as a new device would be
+static inline void nvm3_host_erase(void)
+{
+  memset(nvm3_host_area, 0xFF, sizeof(nvm3_host_area));
+}
+
+// Initialization data for the first pageCount pages, with the default cache
+static inline void nvm3_host_init(nvm3_Init_t *init, size_t pageCount, size_t cacheCount)
+{
+  TEST_ASSERT((pageCount <= NVM3_HOST_MAX_PAGES) && (cacheCount <= NVM3_HOST_MAX_CACHE));
+  memset(init, 0, sizeof(*init));
+  init->nvmAdr = (nvm3_HalPtr_t)nvm3_host_area;
+  init->nvmSize = pageCount * NVM3_HAL_RAM_PAGE_SIZE;
+  init->cachePtr = nvm3_host_cache;
+  init->cacheEntryCount = cacheCount;
+  init->maxObjectSize = NVM3_MAX_OBJECT_SIZE;
+  init->halHandle = &nvm3_halRamHandle;
+  init->cacheType = NVM3_CACHE_TYPE_DEFAULT;
+}
+
+static inline sl_status_t nvm3_host_open(nvm3_Handle_t *h, size_t pageCount, size_t cacheCount)
+{
+  nvm3_Init_t init;
+
+  nvm3_host_init(&init, pageCount, cacheCount);
+  memset(h, 0, sizeof(*h));
+  return nvm3_open(h, &init);
+}
+
+// Data that depends on the key and on a generation number, so that a stale
+// value is told apart from the current one
+static inline void nvm3_host_fill(uint8_t *data, size_t len, nvm3_ObjectKey_t key, uint32_t gen)
+{
+  uint32_t state = (key * 2654435761U) ^ (gen * 40503U) ^ 0x9E3779B9U;
+
+  for (size_t i = 0; i < len; i++) {
+    data[i] = (uint8_t)host_rand(&state);
+  }
+}
+
+#endif // NVM3_HOST_H
@@ -0,0 +1,120 @@
+/***************************************************************************//**
+ * @file
+ * @brief A model of the NVM3 content, checked against an instance on the RAM HAL.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef NVM3_MODEL_H
+#define NVM3_MODEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nvm3_host.h"
+
+#define NVM3_MODEL_MAX_KEYS   2000U
+#define NVM3_MODEL_MAX_LEN    200U
+
+// What each data object should hold, by key
+typedef struct {
+  uint32_t keyCount;
+  uint32_t gen;
+  bool present[NVM3_MODEL_MAX_KEYS];
+  uint16_t len[NVM3_MODEL_MAX_KEYS];
+  uint32_t objGen[NVM3_MODEL_MAX_KEYS];
+} nvm3_model_t;
+
+static inline void nvm3_model_clear(nvm3_model_t *m, uint32_t keyCount)
+{
+  TEST_ASSERT(keyCount <= NVM3_MODEL_MAX_KEYS);
+  memset(m, 0, sizeof(*m));
+  m->keyCount = keyCount;
+}
+
+static inline size_t nvm3_model_len(nvm3_ObjectKey_t key, uint32_t gen)
+{
+  return 1U + ((key * 7U + gen) % NVM3_MODEL_MAX_LEN);
+}
+
+static inline void nvm3_model_write(nvm3_Handle_t *h, nvm3_model_t *m, nvm3_ObjectKey_t key)
+{
+  uint8_t data[NVM3_MODEL_MAX_LEN];
+  size_t len;
+
+  m->gen++;
+  len = nvm3_model_len(key, m->gen);
+  nvm3_host_fill(data, len, key, m->gen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(h, key, data, len));
+  m->present[key] = true;
+  m->len[key] = (uint16_t)len;
+  m->objGen[key] = m->gen;
+}
+
+static inline void nvm3_model_delete(nvm3_Handle_t *h, nvm3_model_t *m, nvm3_ObjectKey_t key)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_deleteObject(h, key));
+  m->present[key] = false;
+}
+
+// Write three times out of four, delete otherwise
+static inline void nvm3_model_step(nvm3_Handle_t *h, nvm3_model_t *m, uint32_t *state)
+{
+  nvm3_ObjectKey_t key = host_rand(state) % m->keyCount;
+
+  if (((host_rand(state) % 4U) == 0U) && m->present[key]) {
+    nvm3_model_delete(h, m, key);
+  } else {
+    nvm3_model_write(h, m, key);
+  }
+}
+
+// Every object of the model is found with its data, and nothing else is
+static inline void nvm3_model_check(nvm3_Handle_t *h, const nvm3_model_t *m)
+{
+  uint8_t expected[NVM3_MODEL_MAX_LEN];
+  uint8_t data[NVM3_MODEL_MAX_LEN];
+  size_t count = 0;
+  uint32_t type;
+  size_t len;
+
+  for (nvm3_ObjectKey_t key = 0; key < m->keyCount; key++) {
+    if (!m->present[key]) {
+      TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, nvm3_getObjectInfo(h, key, &type, &len));
+      continue;
+    }
+    count++;
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getObjectInfo(h, key, &type, &len));
+    TEST_ASSERT_EQUAL(NVM3_OBJECTTYPE_DATA, type);
+    TEST_ASSERT_EQUAL(m->len[key], len);
+    nvm3_host_fill(expected, len, key, m->objGen[key]);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(h, key, data, len));
+    TEST_ASSERT(memcmp(expected, data, len) == 0);
+  }
+  TEST_ASSERT_EQUAL(count, nvm3_countObjects(h));
+}
+
+#endif // NVM3_MODEL_H
@@ -0,0 +1,353 @@
+/***************************************************************************//**
+ * @file
+ * @brief Hash cache: index operations, and NVM3 content with the hash and default caches.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_cache.h"
+#include "nvm3_model.h"
+
+#define MAX_ENTRIES   600U
+#define MAX_KEYS      1200U
+
+#define PAGES         16U
+#define KEYS          300U
+
+static nvm3_CacheEntry_t entries[MAX_ENTRIES];
+static nvm3_model_t model;
+
+// What the cache should hold, by key
+static struct {
+  bool present;
+  nvm3_ObjGroup_t group;
+  nvm3_ObjPtr_t obj;
+} expected[MAX_KEYS];
+static uint32_t expectedCount;
+
+static nvm3_ObjPtr_t fake_obj(nvm3_ObjectKey_t key, uint32_t gen)
+{
+  return (nvm3_ObjPtr_t)(uintptr_t)(0x10000000U + (key * 4096U) + ((gen % 1024U) * 4U));
+}
+
+static void check_key(nvm3_Cache_t *c, nvm3_ObjectKey_t key)
+{
+  nvm3_ObjGroup_t group = objGroupUnknown;
+  nvm3_ObjPtr_t obj = nvm3_cacheGet(c, key, &group);
+
+  if (expected[key].present) {
+    TEST_ASSERT(obj == expected[key].obj);
+    TEST_ASSERT_EQUAL(expected[key].group, group);
+  } else {
+    TEST_ASSERT(obj == NVM3_OBJ_PTR_INVALID);
+  }
+}
+
+static bool count_entry(nvm3_Cache_t *c, nvm3_ObjectKey_t key, nvm3_ObjGroup_t group, nvm3_ObjPtr_t obj, void *user)
+{
+  (void)c;
+  TEST_ASSERT(expected[key].present && (expected[key].obj == obj) && (expected[key].group == group));
+  (*(uint32_t *)user)++;
+  return true;
+}
+
+// Random sets, updates and deletes, up to the entries the index can hold.
+// Every key is found with its last pointer and group, and nothing else.
+static void test_hash_ops(size_t entryCount, uint32_t keyCount, uint32_t iterations, uint32_t seed)
+{
+  nvm3_Cache_t c;
+  uint32_t state = seed;
+  uint32_t scanned;
+
+  TEST_ASSERT((entryCount <= MAX_ENTRIES) && (keyCount <= MAX_KEYS));
+  memset(expected, 0, sizeof(expected));
+  expectedCount = 0;
+  nvm3_cacheOpen(&c, entries, entryCount, NVM3_CACHE_TYPE_HASH);
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    nvm3_ObjectKey_t key = host_rand(&state) % keyCount;
+
+    if (((host_rand(&state) % 3U) == 0U) && expected[key].present) {
+      nvm3_cacheDelete(&c, key);
+      expected[key].present = false;
+      expectedCount--;
+    } else if (expected[key].present || ((expectedCount + 1U) < entryCount)) {
+      nvm3_ObjGroup_t group = ((host_rand(&state) % 4U) == 0U) ? objGroupCounter : objGroupData;
+
+      nvm3_cacheSet(&c, key, fake_obj(key, i), group);
+      if (!expected[key].present) {
+        expectedCount++;
+      }
+      expected[key].present = true;
+      expected[key].group = group;
+      expected[key].obj = fake_obj(key, i);
+    }
+    check_key(&c, key);
+    check_key(&c, host_rand(&state) % keyCount);
+
+    if ((i % 1024U) == 0U) {
+      for (key = 0; key < keyCount; key++) {
+        check_key(&c, key);
+      }
+      scanned = 0;
+      nvm3_cacheScan(&c, count_entry, &scanned);
+      TEST_ASSERT_EQUAL(expectedCount, scanned);
+    }
+  }
+  TEST_ASSERT(!c.overflow);
+}
+
+static bool delete_odd(nvm3_Cache_t *c, nvm3_ObjectKey_t key, nvm3_ObjGroup_t group, nvm3_ObjPtr_t obj, void *user)
+{
+  (void)group;
+  (void)obj;
+  TEST_ASSERT(expected[key].present);
+  // Visited once only
+  expected[key].present = false;
+  (*(uint32_t *)user)++;
+  if ((key % 2U) != 0U) {
+    nvm3_cacheDelete(c, key);
+  }
+  return true;
+}
+
+// A scan that deletes entries from its callback, as a repack does, visits
+// every entry once
+static void test_hash_scan_delete(size_t entryCount, uint32_t seed)
+{
+  nvm3_Cache_t c;
+  uint32_t state = seed;
+  uint32_t added = 0;
+  uint32_t scanned = 0;
+
+  memset(expected, 0, sizeof(expected));
+  nvm3_cacheOpen(&c, entries, entryCount, NVM3_CACHE_TYPE_HASH);
+  while ((added + 1U) < entryCount) {
+    nvm3_ObjectKey_t key = host_rand(&state) % MAX_KEYS;
+
+    if (!expected[key].present) {
+      nvm3_cacheSet(&c, key, fake_obj(key, 0), objGroupData);
+      expected[key].present = true;
+      added++;
+    }
+  }
+
+  nvm3_cacheScan(&c, delete_odd, &scanned);
+  TEST_ASSERT_EQUAL(added, scanned);
+  for (nvm3_ObjectKey_t key = 0; key < MAX_KEYS; key++) {
+    nvm3_ObjGroup_t group;
+    nvm3_ObjPtr_t obj = nvm3_cacheGet(&c, key, &group);
+
+    TEST_ASSERT(expected[key].present == false);
+    if (obj != NVM3_OBJ_PTR_INVALID) {
+      TEST_ASSERT((key % 2U) == 0U);
+      TEST_ASSERT(obj == fake_obj(key, 0));
+    }
+  }
+}
+
+// A full index gives room to data by dropping a deleted object, and flags an
+// overflow when it cannot
+static void test_hash_overflow(void)
+{
+  nvm3_Cache_t c;
+  nvm3_ObjGroup_t group;
+
+  nvm3_cacheOpen(&c, entries, 8, NVM3_CACHE_TYPE_HASH);
+  for (nvm3_ObjectKey_t key = 0; key < 7U; key++) {
+    nvm3_cacheSet(&c, key, fake_obj(key, 0), (key == 3U) ? objGroupDeleted : objGroupData);
+  }
+  TEST_ASSERT(!c.overflow);
+
+  // A deleted object is not worth an entry
+  nvm3_cacheSet(&c, 100, fake_obj(100, 0), objGroupDeleted);
+  TEST_ASSERT(c.overflow);
+  TEST_ASSERT(nvm3_cacheGet(&c, 100, &group) == NVM3_OBJ_PTR_INVALID);
+
+  // Data replaces the deleted object
+  nvm3_cacheClear(&c);
+  for (nvm3_ObjectKey_t key = 0; key < 7U; key++) {
+    nvm3_cacheSet(&c, key, fake_obj(key, 0), (key == 3U) ? objGroupDeleted : objGroupData);
+  }
+  nvm3_cacheSet(&c, 101, fake_obj(101, 0), objGroupData);
+  TEST_ASSERT(!c.overflow);
+  TEST_ASSERT(nvm3_cacheGet(&c, 101, &group) == fake_obj(101, 0));
+  TEST_ASSERT(nvm3_cacheGet(&c, 3, &group) == NVM3_OBJ_PTR_INVALID);
+  for (nvm3_ObjectKey_t key = 0; key < 7U; key++) {
+    if (key != 3U) {
+      TEST_ASSERT(nvm3_cacheGet(&c, key, &group) == fake_obj(key, 0));
+    }
+  }
+
+  // No deleted object left to drop
+  nvm3_cacheSet(&c, 102, fake_obj(102, 0), objGroupData);
+  TEST_ASSERT(c.overflow);
+  TEST_ASSERT_EQUAL(2U, c.stats.overflowCount);
+
+  // Updates still work when full
+  nvm3_cacheSet(&c, 101, fake_obj(101, 1), objGroupCounter);
+  TEST_ASSERT(nvm3_cacheGet(&c, 101, &group) == fake_obj(101, 1));
+  TEST_ASSERT_EQUAL(objGroupCounter, group);
+}
+
+static void open_with(nvm3_Handle_t *h, nvm3_CacheType_t type, size_t cacheCount)
+{
+  nvm3_Init_t init;
+
+  nvm3_host_init(&init, PAGES, cacheCount);
+  init.cacheType = type;
+  memset(h, 0, sizeof(*h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(h, &init));
+}
+
+// Random writes and deletes through NVM3, with repacks and reopens. The cache
+// holds every object, or fewer when it is too small and lookups fall back to
+// a FLASH scan.
+static void test_nvm3(nvm3_CacheType_t type, size_t cacheCount, uint32_t iterations, uint32_t seed)
+{
+  nvm3_Handle_t h;
+  uint32_t state = seed;
+
+  nvm3_host_erase();
+  nvm3_model_clear(&model, KEYS);
+  open_with(&h, type, cacheCount);
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint32_t ops = 1U + (host_rand(&state) % 100U);
+
+    for (uint32_t op = 0; op < ops; op++) {
+      nvm3_model_step(&h, &model, &state);
+    }
+    switch (host_rand(&state) % 4U) {
+      case 0:
+        if (nvm3_repackNeeded(&h)) {
+          TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+        }
+        break;
+      case 1:
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+        open_with(&h, type, cacheCount);
+        break;
+      default:
+        break;
+    }
+    nvm3_model_check(&h, &model);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+static void read_key(nvm3_Handle_t *h, nvm3_ObjectKey_t key, size_t len)
+{
+  uint8_t data[NVM3_MODEL_MAX_LEN];
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(h, key, data, len));
+}
+
+static void check_stats(nvm3_Handle_t *h, uint32_t hits, uint32_t verifiedHits, uint32_t misses)
+{
+  nvm3_CacheStats_t stats;
+
+  nvm3_getCacheStats(h, &stats, true);
+  TEST_ASSERT_EQUAL(hits, stats.hitCount);
+  TEST_ASSERT_EQUAL(verifiedHits, stats.verifiedHitCount);
+  TEST_ASSERT_EQUAL(misses, stats.missCount);
+}
+
+// An object is validated on its first read after a write or an open, and
+// later reads are verified hits. Keys that are not stored are misses.
+static void test_stats(nvm3_CacheType_t type)
+{
+  nvm3_Handle_t h;
+  nvm3_CacheStats_t stats;
+  uint8_t data[NVM3_MODEL_MAX_LEN];
+  uint32_t objType;
+  size_t len;
+
+  nvm3_host_erase();
+  open_with(&h, type, KEYS);
+  nvm3_host_fill(data, 40, 1, 1);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, 1, data, 40));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, 2, data, 8));
+  nvm3_getCacheStats(&h, &stats, true);
+
+  read_key(&h, 1, 40);
+  read_key(&h, 1, 40);
+  read_key(&h, 1, 40);
+  check_stats(&h, 3, 2, 0);
+
+  TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, nvm3_getObjectInfo(&h, 3, &objType, &len));
+  check_stats(&h, 0, 0, 1);
+
+  // A write clears the verified state of its key only
+  nvm3_host_fill(data, 40, 1, 2);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, 1, data, 40));
+  read_key(&h, 2, 8);
+  nvm3_getCacheStats(&h, &stats, true);
+  read_key(&h, 1, 40);
+  read_key(&h, 1, 40);
+  read_key(&h, 2, 8);
+  check_stats(&h, 3, 2, 0);
+
+  // Statistics are kept until reset, and cleared by an open
+  read_key(&h, 1, 40);
+  nvm3_getCacheStats(&h, &stats, false);
+  TEST_ASSERT_EQUAL(1U, stats.hitCount);
+  check_stats(&h, 1, 1, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+  open_with(&h, type, KEYS);
+  check_stats(&h, 0, 0, 0);
+  read_key(&h, 1, 40);
+  read_key(&h, 1, 40);
+  check_stats(&h, 2, 1, 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 100);
+
+  for (uint32_t seed = 1; seed <= 4; seed++) {
+    // Sizes that are and are not powers of two, the index scales any size
+    test_hash_ops(64, 100, iterations * 200U, seed);
+    test_hash_ops(509, 1200, iterations * 200U, seed);
+    test_hash_ops(600, 600, iterations * 200U, seed);
+    test_hash_scan_delete(100 + seed * 97U, seed);
+  }
+  test_hash_overflow();
+  test_stats(NVM3_CACHE_TYPE_DEFAULT);
+  test_stats(NVM3_CACHE_TYPE_HASH);
+
+  for (uint32_t seed = 1; seed <= 2; seed++) {
+    test_nvm3(NVM3_CACHE_TYPE_HASH, KEYS + 16U, iterations, seed);
+    test_nvm3(NVM3_CACHE_TYPE_HASH, KEYS / 4U, iterations, seed);
+    test_nvm3(NVM3_CACHE_TYPE_DEFAULT, KEYS + 16U, iterations, seed);
+    test_nvm3(NVM3_CACHE_TYPE_DEFAULT, KEYS / 4U, iterations, seed);
+  }
+
+  printf("nvm3 cache: ok\n");
+  return 0;
+}
@@ -0,0 +1,152 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 mounted from a checkpoint finds the same objects as a full scan.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "nvm3_model.h"
+
+#define PAGES       16U
+#define KEYS        400U
+#define CACHE_SIZE  (KEYS + 16U)
+
+// "CKP1", first word of every checkpoint chunk
+#define CHECKPOINT_MAGIC  0x31504B43U
+
+static nvm3_model_t model;
+
+static uint32_t mount(nvm3_Handle_t *h)
+{
+  nvm3_HalRamStats_t stats;
+
+  nvm3_halRamResetStats();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(h, PAGES, CACHE_SIZE));
+  nvm3_halRamGetStats(&stats);
+  return stats.wordReadCnt;
+}
+
+// Clear bits of every checkpoint chunk header, as a FLASH write can
+static uint32_t damage_checkpoints(void)
+{
+  uint32_t count = 0;
+
+  for (size_t i = 0; i < PAGES * NVM3_HAL_RAM_PAGE_SIZE / sizeof(uint32_t); i++) {
+    if (nvm3_host_area[i] == CHECKPOINT_MAGIC) {
+      nvm3_host_area[i] &= ~1U;
+      count++;
+    }
+  }
+  return count;
+}
+
+// A clean mount reads less than a full scan, and both find the same objects
+static void test_checkpoint_used(void)
+{
+  nvm3_Handle_t h;
+  uint32_t state = 7;
+  uint32_t checkpointWords;
+  uint32_t scanWords;
+
+  nvm3_host_erase();
+  nvm3_model_clear(&model, KEYS);
+  mount(&h);
+  for (uint32_t i = 0; i < 3U * KEYS; i++) {
+    nvm3_model_step(&h, &model, &state);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  checkpointWords = mount(&h);
+  nvm3_model_check(&h, &model);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  TEST_ASSERT(damage_checkpoints() > 0);
+  scanWords = mount(&h);
+  nvm3_model_check(&h, &model);
+  TEST_ASSERT(checkpointWords < scanWords);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  printf("words read on mount: checkpoint %u, full scan %u\n", checkpointWords, scanWords);
+}
+
+// Random writes and deletes, with repacks, clean closes, resets without a
+// close and erases in between. Every mount must find the model content.
+static void test_random(uint32_t iterations, uint32_t seed)
+{
+  nvm3_Handle_t h;
+  uint32_t state = seed;
+
+  nvm3_host_erase();
+  nvm3_model_clear(&model, KEYS);
+  mount(&h);
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint32_t ops = 1U + (host_rand(&state) % 200U);
+
+    for (uint32_t op = 0; op < ops; op++) {
+      nvm3_model_step(&h, &model, &state);
+    }
+    switch (host_rand(&state) % 8U) {
+      case 0:
+        if (nvm3_repackNeeded(&h)) {
+          TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+        }
+        break;
+      case 1:
+      case 2:
+        TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+        mount(&h);
+        break;
+      case 3:
+      case 4:
+        // Reset: the instance is not closed
+        mount(&h);
+        break;
+      case 5:
+        if ((host_rand(&state) % 8U) == 0U) {
+          TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_eraseAll(&h));
+          nvm3_model_clear(&model, KEYS);
+        }
+        break;
+      default:
+        break;
+    }
+    nvm3_model_check(&h, &model);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 2000);
+
+  test_checkpoint_used();
+  for (uint32_t seed = 1; seed <= 4; seed++) {
+    test_random(iterations, seed * 2654435761U);
+  }
+
+  printf("nvm3 checkpoint: ok\n");
+  return 0;
+}
@@ -0,0 +1,164 @@
+/***************************************************************************//**
+ * @file
+ * @brief The RAM HAL follows the FLASH rules, and NVM3 keeps its data across a reset on it.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "nvm3_host.h"
+
+#define PAGES       4U
+#define OBJECTS     150U
+#define MAX_LEN     120U
+
+static const nvm3_HalHandle_t *hal = &nvm3_halRamHandle;
+
+// A word can only have bits cleared until its page is erased
+static void test_flash_rules(void)
+{
+  uint8_t *page1 = (uint8_t *)nvm3_host_area + NVM3_HAL_RAM_PAGE_SIZE;
+  nvm3_HalRamStats_t stats;
+  uint32_t word;
+
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halOpen(hal, nvm3_host_area, PAGES * NVM3_HAL_RAM_PAGE_SIZE));
+  nvm3_halRamResetStats();
+
+  word = 0xF0F0F0F0U;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halWriteWords(hal, page1, &word, 1));
+  word = 0xF0000000U;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halWriteWords(hal, page1, &word, 1));
+  word = 0;
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halReadWords(hal, page1, &word, 1));
+  TEST_ASSERT_EQUAL(0xF0000000U, word);
+
+  // Setting a cleared bit fails and leaves the bits already cleared
+  word = 0x0F000000U;
+  TEST_ASSERT_EQUAL(SL_STATUS_FLASH_PROGRAM_FAILED, nvm3_halWriteWords(hal, page1, &word, 1));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halReadWords(hal, page1, &word, 1));
+  TEST_ASSERT_EQUAL(0, word);
+
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT_EQUAL(3, stats.wordWriteCnt);
+  TEST_ASSERT_EQUAL(2, stats.wordRewriteCnt);
+  TEST_ASSERT_EQUAL(1, stats.writeFailCnt);
+  TEST_ASSERT_EQUAL(3 * NVM3_HAL_RAM_WORD_WRITE_TIME_US, stats.busyTimeUs);
+
+  // An erase sets the whole page and nothing else
+  TEST_ASSERT_EQUAL(SL_STATUS_NVM3_INVALID_ADDR, nvm3_halPageErase(hal, page1 + 4));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halPageErase(hal, page1));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halPageErase(hal, page1));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_halReadWords(hal, page1, &word, 1));
+  TEST_ASSERT_EQUAL(0xFFFFFFFFU, word);
+  TEST_ASSERT_EQUAL(0, nvm3_halRamGetPageEraseCount(0));
+  TEST_ASSERT_EQUAL(2, nvm3_halRamGetPageEraseCount(1));
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT_EQUAL(2, stats.pageEraseCnt);
+  TEST_ASSERT_EQUAL(2, stats.maxPageEraseCnt);
+
+  // Accesses outside the area are refused
+  TEST_ASSERT_EQUAL(SL_STATUS_NVM3_INVALID_ADDR,
+                    nvm3_halWriteWords(hal, (uint8_t *)nvm3_host_area + PAGES * NVM3_HAL_RAM_PAGE_SIZE - 4, &word, 2));
+  TEST_ASSERT_EQUAL(SL_STATUS_NVM3_INVALID_ADDR,
+                    nvm3_halReadWords(hal, (uint8_t *)nvm3_host_area + PAGES * NVM3_HAL_RAM_PAGE_SIZE, &word, 1));
+  TEST_ASSERT_EQUAL(SL_STATUS_NVM3_INVALID_ADDR,
+                    nvm3_halOpen(hal, nvm3_host_area, NVM3_HAL_RAM_PAGE_SIZE + 4));
+  nvm3_halClose(hal);
+}
+
+static void check_objects(nvm3_Handle_t *h, const uint32_t *gen)
+{
+  uint8_t expected[MAX_LEN];
+  uint8_t data[MAX_LEN];
+  uint32_t type;
+  size_t len;
+
+  TEST_ASSERT_EQUAL(OBJECTS, nvm3_countObjects(h));
+  for (nvm3_ObjectKey_t key = 0; key < OBJECTS; key++) {
+    len = 1 + (key % MAX_LEN);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getObjectInfo(h, key, &type, &len));
+    TEST_ASSERT_EQUAL(NVM3_OBJECTTYPE_DATA, type);
+    TEST_ASSERT_EQUAL(1 + (key % MAX_LEN), len);
+    nvm3_host_fill(expected, len, key, gen[key]);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(h, key, data, len));
+    TEST_ASSERT(memcmp(expected, data, len) == 0);
+  }
+}
+
+// NVM3 running over the RAM HAL: data written before a reset, through several
+// repacks, reads back unchanged after it
+static void test_nvm3_reset(void)
+{
+  static uint32_t gen[OBJECTS];
+  nvm3_HalRamStats_t stats;
+  nvm3_Handle_t h;
+  uint8_t data[MAX_LEN];
+  uint32_t counter;
+  uint32_t state = 1;
+
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, OBJECTS + 10));
+  nvm3_halRamResetStats();
+  for (uint32_t i = 0; i < 20U * OBJECTS; i++) {
+    nvm3_ObjectKey_t key = host_rand(&state) % OBJECTS;
+    size_t len = 1 + (key % MAX_LEN);
+
+    gen[key] = i;
+    nvm3_host_fill(data, len, key, gen[key]);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, key, data, len));
+  }
+  for (nvm3_ObjectKey_t key = 0; key < OBJECTS; key++) {
+    if (gen[key] == 0) {
+      nvm3_host_fill(data, 1 + (key % MAX_LEN), key, 0);
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, key, data, 1 + (key % MAX_LEN)));
+    }
+  }
+  check_objects(&h, gen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeCounter(&h, OBJECTS, 41));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_incrementCounter(&h, OBJECTS, NULL));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+
+  // NVM3 never programs a bit back to one
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT_EQUAL(0, stats.writeFailCnt);
+  TEST_ASSERT(stats.pageEraseCnt > PAGES);
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&h, PAGES, OBJECTS + 10));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readCounter(&h, OBJECTS, &counter));
+  TEST_ASSERT_EQUAL(42, counter);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_deleteObject(&h, OBJECTS));
+  check_objects(&h, gen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+int main(void)
+{
+  test_flash_rules();
+  test_nvm3_reset();
+
+  printf("nvm3 hal ram: ok\n");
+  return 0;
+}
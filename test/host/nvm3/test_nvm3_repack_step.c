@@ -0,0 +1,127 @@
+/***************************************************************************//**
+ * @file
+ * @brief Incremental repack: bounded steps, and NVM3 content across steps and resets.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_model.h"
+#include "nvm3_object.h"
+#include "nvm3_page.h"
+
+#define PAGES       8U
+#define KEYS        200U
+#define CACHE_SIZE  (KEYS + 16U)
+#define HEADROOM    (2U * NVM3_HAL_RAM_PAGE_SIZE)
+
+// The largest object of the model, and the header of a page the copy moves to
+#define MAX_OBJ_BYTES   (NVM3_OBJ_HEADER_SIZE_LARGE + NVM3_MODEL_MAX_LEN + NVM3_PAGE_HEADER_SIZE)
+
+static nvm3_model_t model;
+
+static void open_with_headroom(nvm3_Handle_t *h)
+{
+  nvm3_Init_t init;
+
+  nvm3_host_init(&init, PAGES, CACHE_SIZE);
+  init.repackHeadroom = HEADROOM;
+  memset(h, 0, sizeof(*h));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_open(h, &init));
+}
+
+// A step erases one page, or copies up to its budget plus one object
+static void step(nvm3_Handle_t *h, size_t budget, bool *moreWork)
+{
+  nvm3_HalRamStats_t stats;
+
+  nvm3_halRamResetStats();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repackStep(h, budget, moreWork));
+  nvm3_halRamGetStats(&stats);
+  TEST_ASSERT(stats.pageEraseCnt <= 1U);
+  if (stats.pageEraseCnt == 0U) {
+    TEST_ASSERT((stats.wordWriteCnt * sizeof(uint32_t)) <= (budget + MAX_OBJ_BYTES));
+  }
+  if (!*moreWork) {
+    TEST_ASSERT(!nvm3_repackNeeded(h));
+  }
+}
+
+// Writes with repack steps of random budgets in between, and resets in the
+// middle of a repack. Steps keep the writes from repacking, and the content
+// is the model content throughout.
+static void test_steps(uint32_t iterations, uint32_t seed)
+{
+  nvm3_Handle_t h;
+  uint32_t state = seed;
+  bool moreWork;
+
+  nvm3_host_erase();
+  nvm3_model_clear(&model, KEYS);
+  open_with_headroom(&h);
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint32_t ops = 1U + (host_rand(&state) % 20U);
+
+    for (uint32_t op = 0; op < ops; op++) {
+      nvm3_model_step(&h, &model, &state);
+    }
+    switch (host_rand(&state) % 8U) {
+      case 0:
+        // Reset, maybe in the middle of a repack
+        open_with_headroom(&h);
+        break;
+      case 1:
+        // Nothing to do is not an error
+        while (nvm3_repackNeeded(&h)) {
+          step(&h, 0, &moreWork);
+        }
+        step(&h, 512, &moreWork);
+        TEST_ASSERT(!moreWork);
+        break;
+      default:
+        moreWork = true;
+        for (uint32_t s = 0; (s < 4U) && moreWork && nvm3_repackNeeded(&h); s++) {
+          step(&h, host_rand(&state) % 1024U, &moreWork);
+        }
+        break;
+    }
+    nvm3_model_check(&h, &model);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 2000);
+
+  for (uint32_t seed = 1; seed <= 3; seed++) {
+    test_steps(iterations, seed * 2654435761U);
+  }
+
+  printf("nvm3 repack step: ok\n");
+  return 0;
+}
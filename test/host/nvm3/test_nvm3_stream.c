@@ -0,0 +1,328 @@
+/***************************************************************************//**
+ * @file
+ * @brief Streamed writes: round trip, chunk boundaries, and writes aborted by the source.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include "nvm3_model.h"
+
+#define PAGES         8U
+#define KEYS          100U
+#define CACHE_SIZE    (KEYS + 16U)
+#define BIG_KEY       (KEYS + 1U)
+#define SMALL_KEY     (KEYS + 2U)
+#define FILL_KEY      (KEYS + 3U)
+#define ABORT_STATUS  SL_STATUS_IO
+#define NO_ABORT      SIZE_MAX
+#define WORD_SIZE     sizeof(uint32_t)
+#define MAX_FRAGS     8U
+
+static nvm3_model_t model;
+static uint8_t chunkBuf[NVM3_MAX_OBJECT_SIZE] __attribute__((aligned(4)));
+static uint8_t readBuf[NVM3_MAX_OBJECT_SIZE] __attribute__((aligned(4)));
+
+// The object data, and what the driver asked for
+typedef struct {
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+  size_t len;
+  size_t bufSize;
+  size_t abortOfs;
+  bool aborted;
+  uint32_t calls;
+  uint8_t filled[NVM3_MAX_OBJECT_SIZE];
+} stream_src_t;
+
+// The fragments of an object, as seen by a read with a buffer that holds
+// a whole fragment
+typedef struct {
+  const uint8_t *data;
+  size_t fragCnt;
+  size_t fragLen[MAX_FRAGS];
+  size_t next;
+} stream_sink_t;
+
+static stream_src_t src;
+
+static sl_status_t fill(void *user, size_t ofs, void *buf, size_t len)
+{
+  stream_src_t *s = user;
+
+  TEST_ASSERT(!s->aborted);
+  TEST_ASSERT((len > 0U) && (len <= s->bufSize) && ((ofs + len) <= s->len));
+  TEST_ASSERT((ofs % WORD_SIZE) == 0U);
+  s->calls++;
+  if ((s->abortOfs >= ofs) && (s->abortOfs < (ofs + len))) {
+    s->aborted = true;
+    return ABORT_STATUS;
+  }
+  memcpy(buf, &s->data[ofs], len);
+  for (size_t i = ofs; i < (ofs + len); i++) {
+    s->filled[i]++;
+  }
+  return SL_STATUS_OK;
+}
+
+static bool sink(void *user, size_t ofs, const void *buf, size_t len)
+{
+  stream_sink_t *s = user;
+
+  TEST_ASSERT((ofs == s->next) && (s->fragCnt < MAX_FRAGS));
+  TEST_ASSERT(memcmp(buf, &s->data[ofs], len) == 0);
+  s->fragLen[s->fragCnt++] = len;
+  s->next += len;
+  return true;
+}
+
+static void src_init(nvm3_ObjectKey_t key, uint32_t gen, size_t len, size_t bufSize, size_t abortOfs)
+{
+  memset(&src, 0, sizeof(src));
+  nvm3_host_fill(src.data, len, key, gen);
+  src.len = len;
+  src.bufSize = bufSize;
+  src.abortOfs = abortOfs;
+}
+
+// The object holds the source data, read whole and in fragments. Returns the
+// number of fragments.
+static size_t check_obj(nvm3_Handle_t *h, nvm3_ObjectKey_t key, const uint8_t *data, size_t len)
+{
+  stream_sink_t s = { data, 0, { 0 }, 0 };
+  uint32_t type;
+  size_t objLen;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getObjectInfo(h, key, &type, &objLen));
+  TEST_ASSERT_EQUAL(NVM3_OBJECTTYPE_DATA, type);
+  TEST_ASSERT_EQUAL(len, objLen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(h, key, readBuf, len));
+  TEST_ASSERT(memcmp(readBuf, data, len) == 0);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readDataStream(h, key, readBuf, sizeof(readBuf), sink, &s));
+  TEST_ASSERT_EQUAL(len, s.next);
+  return (len > 0U) ? s.fragCnt : 1U;
+}
+
+static void open_checked(nvm3_Handle_t *h)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(h, PAGES, CACHE_SIZE));
+}
+
+// Every length and chunk size reads back, after a write and after a reset.
+// Each byte is asked for once, in chunks that end at the buffer size or at a
+// fragment end, and some of the objects are fragmented.
+static void test_round_trip(void)
+{
+  static const size_t lens[] = { 0, 1, 3, 4, 5, 63, 64, 65, 119, 120, 121, 122, 500, 1024, NVM3_MAX_OBJECT_SIZE - 1U, NVM3_MAX_OBJECT_SIZE };
+  static const size_t bufSizes[] = { 4, 8, 60, 64, 128, NVM3_MAX_OBJECT_SIZE };
+  static uint8_t lastData[NVM3_MAX_OBJECT_SIZE];
+  nvm3_Handle_t h;
+  uint32_t state = 1;
+  uint32_t gen = 0;
+  uint32_t fragmented = 0;
+
+  nvm3_host_erase();
+  open_checked(&h);
+  for (size_t l = 0; l < (sizeof(lens) / sizeof(lens[0])); l++) {
+    for (size_t b = 0; b < (sizeof(bufSizes) / sizeof(bufSizes[0])); b++) {
+      size_t len = lens[l];
+      size_t bufSize = bufSizes[b];
+      size_t expCalls = 0;
+      size_t fragCnt;
+      stream_sink_t s;
+
+      // Move the FIFO end, so that objects cross pages at different places
+      nvm3_model_write(&h, &model, host_rand(&state) % KEYS);
+
+      src_init(BIG_KEY, ++gen, len, bufSize, NO_ABORT);
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeDataStream(&h, BIG_KEY, len, chunkBuf, bufSize, fill, &src));
+      for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL(1U, src.filled[i]);
+      }
+      fragCnt = check_obj(&h, BIG_KEY, src.data, len);
+      if (fragCnt > 1U) {
+        fragmented++;
+      }
+
+      // One chunk per buffer, a chunk never spans two fragments
+      memset(&s, 0, sizeof(s));
+      s.data = src.data;
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readDataStream(&h, BIG_KEY, readBuf, sizeof(readBuf), sink, &s));
+      for (size_t f = 0; f < s.fragCnt; f++) {
+        expCalls += (s.fragLen[f] + bufSize - 1U) / bufSize;
+      }
+      TEST_ASSERT_EQUAL(expCalls, src.calls);
+      memcpy(lastData, src.data, len);
+
+      open_checked(&h);
+      TEST_ASSERT_EQUAL(fragCnt, check_obj(&h, BIG_KEY, lastData, len));
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_deleteObject(&h, BIG_KEY));
+      nvm3_model_check(&h, &model);
+    }
+  }
+  TEST_ASSERT(fragmented > 0U);
+
+  // Buffers that are not whole words are refused
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_PARAMETER, nvm3_writeDataStream(&h, BIG_KEY, 100, chunkBuf, 6, fill, &src));
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_PARAMETER, nvm3_writeDataStream(&h, BIG_KEY, 100, chunkBuf, 2, fill, &src));
+  TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, nvm3_readData(&h, BIG_KEY, readBuf, 100));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+// A write aborted by the source returns the source status, asks for nothing
+// more, and leaves no new object: the old object, or none, is found before
+// and after a reset. Objects written after the abort survive a reset too.
+static void test_abort(void)
+{
+  static uint8_t oldData[NVM3_MAX_OBJECT_SIZE];
+  nvm3_Handle_t h;
+  uint32_t state = 2;
+  uint32_t gen = 0;
+  size_t oldLen = 0;
+  bool oldPresent = false;
+
+  nvm3_host_erase();
+  open_checked(&h);
+  for (uint32_t i = 0; i < 400U; i++) {
+    size_t len = 1U + (host_rand(&state) % NVM3_MAX_OBJECT_SIZE);
+    size_t bufSize = WORD_SIZE * (1U + (host_rand(&state) % 32U));
+    size_t abortOfs;
+    uint32_t objCnt;
+    uint8_t small[8];
+    uint8_t filler[NVM3_MODEL_MAX_LEN];
+    size_t fillerLen = 1U + (host_rand(&state) % NVM3_MODEL_MAX_LEN);
+
+    switch (host_rand(&state) % 4U) {
+      case 0:
+        abortOfs = 0;
+        break;
+      case 1:
+        abortOfs = len - 1U;
+        break;
+      default:
+        abortOfs = host_rand(&state) % len;
+        break;
+    }
+
+    // Move the FIFO end, so that the writes abort at different places
+    nvm3_host_fill(filler, fillerLen, FILL_KEY, gen);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, FILL_KEY, filler, fillerLen));
+    objCnt = nvm3_countObjects(&h);
+
+    src_init(BIG_KEY, ++gen, len, bufSize, abortOfs);
+    TEST_ASSERT_EQUAL(ABORT_STATUS, nvm3_writeDataStream(&h, BIG_KEY, len, chunkBuf, bufSize, fill, &src));
+    TEST_ASSERT(src.aborted);
+    TEST_ASSERT_EQUAL(objCnt, nvm3_countObjects(&h));
+    if (oldPresent) {
+      check_obj(&h, BIG_KEY, oldData, oldLen);
+    } else {
+      TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, nvm3_readData(&h, BIG_KEY, readBuf, 1));
+    }
+
+    // The next write goes past the partial payload
+    nvm3_host_fill(small, sizeof(small), SMALL_KEY, gen);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&h, SMALL_KEY, small, sizeof(small)));
+
+    open_checked(&h);
+    if (oldPresent) {
+      check_obj(&h, BIG_KEY, oldData, oldLen);
+    } else {
+      TEST_ASSERT_EQUAL(SL_STATUS_NOT_FOUND, nvm3_readData(&h, BIG_KEY, readBuf, 1));
+    }
+    check_obj(&h, SMALL_KEY, small, sizeof(small));
+    check_obj(&h, FILL_KEY, filler, fillerLen);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_deleteObject(&h, SMALL_KEY));
+
+    // Now and then, a write that completes
+    if ((host_rand(&state) % 4U) == 0U) {
+      src_init(BIG_KEY, ++gen, len, bufSize, NO_ABORT);
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeDataStream(&h, BIG_KEY, len, chunkBuf, bufSize, fill, &src));
+      memcpy(oldData, src.data, len);
+      oldLen = len;
+      oldPresent = true;
+      check_obj(&h, BIG_KEY, oldData, oldLen);
+    }
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+// Streamed model objects, some aborted, mixed with ordinary writes, repacks
+// and resets. The content is the model content throughout.
+static void test_model(uint32_t iterations, uint32_t seed)
+{
+  nvm3_Handle_t h;
+  uint32_t state = seed;
+
+  nvm3_host_erase();
+  nvm3_model_clear(&model, KEYS);
+  open_checked(&h);
+  for (uint32_t i = 0; i < iterations; i++) {
+    nvm3_ObjectKey_t key = host_rand(&state) % KEYS;
+    size_t bufSize = WORD_SIZE * (1U + (host_rand(&state) % 16U));
+    uint32_t gen = model.gen + 1U;
+    size_t len = nvm3_model_len(key, gen);
+    bool abort = (host_rand(&state) % 3U) == 0U;
+
+    src_init(key, gen, len, bufSize, abort ? (host_rand(&state) % len) : NO_ABORT);
+    TEST_ASSERT_EQUAL(abort ? ABORT_STATUS : SL_STATUS_OK, nvm3_writeDataStream(&h, key, len, chunkBuf, bufSize, fill, &src));
+    model.gen = gen;
+    if (!abort) {
+      model.present[key] = true;
+      model.len[key] = (uint16_t)len;
+      model.objGen[key] = gen;
+    }
+    nvm3_model_step(&h, &model, &state);
+    switch (host_rand(&state) % 16U) {
+      case 0:
+        open_checked(&h);
+        break;
+      case 1:
+        if (nvm3_repackNeeded(&h)) {
+          TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&h));
+        }
+        break;
+      default:
+        break;
+    }
+    nvm3_model_check(&h, &model);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&h));
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 2000);
+
+  nvm3_model_clear(&model, KEYS);
+  test_round_trip();
+  test_abort();
+  for (uint32_t seed = 1; seed <= 3; seed++) {
+    test_model(iterations, seed * 2654435761U);
+  }
+
+  printf("nvm3 stream: ok\n");
+  return 0;
+}
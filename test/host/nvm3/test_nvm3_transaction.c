@@ -0,0 +1,408 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 transactions: power cut at every write, all or nothing after recovery.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include "nvm3_host.h"
+
+#define PAGES       4U
+#define CACHE_SIZE  32U
+#define KEYS        8U
+#define FILLER_KEY  100U
+#define AREA_WORDS  (PAGES * NVM3_HAL_RAM_PAGE_SIZE / sizeof(uint32_t))
+
+// "TXB1", "TXC1" and "TXA1", the first data word of each transaction marker
+#define MAGIC_BEGIN   0x31425854U
+#define MAGIC_COMMIT  0x31435854U
+#define MAGIC_ABORT   0x31415854U
+
+typedef struct {
+  bool present;
+  uint32_t gen;
+} value_t;
+
+typedef enum {
+  STATE_OLD,
+  STATE_NEW,
+} state_t;
+
+static nvm3_Handle_t handle;
+static jmp_buf powerCutJump;
+static uint32_t beforeTx[AREA_WORDS];
+static uint32_t afterCut[AREA_WORDS];
+
+static value_t oldValues[KEYS];
+static value_t newValues[KEYS];
+static uint8_t txData[KEYS][NVM3_MAX_OBJECT_SIZE];
+static nvm3_TransactionObject_t tx[KEYS];
+static size_t txCount;
+
+// What the power cuts landed after, by the marker last completed
+static uint32_t cutsAfterBegin;
+static uint32_t cutsAfterCommit;
+static uint32_t cutsAfterAbort;
+
+// Key 5 is a large object, the others are small
+static size_t value_len(nvm3_ObjectKey_t key)
+{
+  return (key == 5U) ? 300U : (8U + (key * 4U));
+}
+
+static void power_cut(void)
+{
+  longjmp(powerCutJump, 1);
+}
+
+static void mount(void)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&handle, PAGES, CACHE_SIZE));
+}
+
+static bool holds(const value_t *values)
+{
+  uint8_t expected[NVM3_MAX_OBJECT_SIZE];
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+  uint32_t type;
+  size_t len;
+
+  for (nvm3_ObjectKey_t key = 0; key < KEYS; key++) {
+    sl_status_t sta = nvm3_getObjectInfo(&handle, key, &type, &len);
+
+    if (!values[key].present) {
+      if (sta != SL_STATUS_NOT_FOUND) {
+        return false;
+      }
+      continue;
+    }
+    if ((sta != SL_STATUS_OK) || (len != value_len(key))) {
+      return false;
+    }
+    nvm3_host_fill(expected, len, key, values[key].gen);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(&handle, key, data, len));
+    if (memcmp(expected, data, len) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// All the old values or all the new values, never a mix
+static state_t check_all_or_nothing(void)
+{
+  if (holds(newValues)) {
+    return STATE_NEW;
+  }
+  TEST_ASSERT(holds(oldValues));
+  return STATE_OLD;
+}
+
+// Count the markers written since the transaction started
+static void count_markers(const uint32_t *area)
+{
+  uint32_t begin = 0;
+  uint32_t commit = 0;
+  uint32_t abort = 0;
+
+  for (size_t i = 0; i < AREA_WORDS; i++) {
+    if (area[i] == beforeTx[i]) {
+      continue;
+    }
+    begin += (area[i] == MAGIC_BEGIN) ? 1U : 0U;
+    commit += (area[i] == MAGIC_COMMIT) ? 1U : 0U;
+    abort += (area[i] == MAGIC_ABORT) ? 1U : 0U;
+  }
+  if (abort > 0U) {
+    cutsAfterAbort++;
+  } else if (commit > 0U) {
+    cutsAfterCommit++;
+  } else if (begin > 0U) {
+    cutsAfterBegin++;
+  }
+}
+
+static uint32_t writes_done(void)
+{
+  nvm3_HalRamStats_t stats;
+
+  nvm3_halRamGetStats(&stats);
+  return stats.wordWriteCnt + stats.pageEraseCnt;
+}
+
+static void write_value(nvm3_ObjectKey_t key, uint32_t gen)
+{
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+
+  nvm3_host_fill(data, value_len(key), key, gen);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&handle, key, data, value_len(key)));
+}
+
+static void add_write(nvm3_ObjectKey_t key, uint32_t gen)
+{
+  nvm3_host_fill(txData[key], value_len(key), key, gen);
+  tx[txCount].key = key;
+  tx[txCount].value = txData[key];
+  tx[txCount].len = value_len(key);
+  txCount++;
+  newValues[key].present = true;
+  newValues[key].gen = gen;
+}
+
+static void add_delete(nvm3_ObjectKey_t key)
+{
+  tx[txCount].key = key;
+  tx[txCount].value = NULL;
+  tx[txCount].len = 0;
+  txCount++;
+  newValues[key].present = false;
+}
+
+// Old values for keys 0 to 5, after filler objects that move the FIFO end.
+// The transaction rewrites, adds, deletes, and deletes a key that is not
+// stored, and leaves keys 3 and 4 as they are.
+static void setup(uint32_t fillerCount)
+{
+  nvm3_host_erase();
+  mount();
+  for (uint32_t i = 0; i < fillerCount; i++) {
+    write_value(FILLER_KEY, i);
+  }
+  memset(oldValues, 0, sizeof(oldValues));
+  for (nvm3_ObjectKey_t key = 0; key <= 5U; key++) {
+    write_value(key, 1);
+    oldValues[key].present = true;
+    oldValues[key].gen = 1;
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  memcpy(beforeTx, nvm3_host_area, sizeof(beforeTx));
+
+  memcpy(newValues, oldValues, sizeof(newValues));
+  txCount = 0;
+  add_write(0, 2);
+  add_write(1, 2);
+  add_delete(2);
+  add_write(5, 2);
+  add_write(6, 2);
+  add_delete(7);
+}
+
+// The words written by the whole transaction
+static uint32_t dry_run(void)
+{
+  nvm3_WearStats_t wear;
+  uint32_t writes;
+
+  memcpy(nvm3_host_area, beforeTx, sizeof(beforeTx));
+  mount();
+  nvm3_halRamResetStats();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeTransaction(&handle, tx, txCount));
+  writes = writes_done();
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT(wear.userBytesWritten > 0U);
+  TEST_ASSERT_EQUAL(STATE_NEW, check_all_or_nothing());
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  return writes;
+}
+
+// Mount after a power cut, and cut the power again at every write of the
+// recovery. Each recovery must give the same result as the one that was not
+// interrupted.
+static void check_recovery(state_t expected)
+{
+  nvm3_WearStats_t wear;
+  uint32_t writes;
+  state_t state;
+
+  memcpy(afterCut, nvm3_host_area, sizeof(afterCut));
+  nvm3_halRamResetStats();
+  mount();
+  writes = writes_done();
+  state = check_all_or_nothing();
+  TEST_ASSERT_EQUAL(expected, state);
+  // The rollback is written by the driver, not by the application
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT_EQUAL(0U, wear.userBytesWritten);
+
+  // Stable across a repack and a clean reopen
+  if (nvm3_repackNeeded(&handle)) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&handle));
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  mount();
+  TEST_ASSERT_EQUAL(state, check_all_or_nothing());
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+
+  for (uint32_t cut = 1; cut <= writes; cut++) {
+    memcpy(nvm3_host_area, afterCut, sizeof(afterCut));
+    nvm3_halRamSetPowerCut(cut, power_cut);
+    if (setjmp(powerCutJump) == 0) {
+      (void)nvm3_host_open(&handle, PAGES, CACHE_SIZE);
+      TEST_ASSERT(false);
+    }
+    nvm3_halRamSetPowerCut(0, NULL);
+    count_markers(nvm3_host_area);
+    mount();
+    TEST_ASSERT_EQUAL(state, check_all_or_nothing());
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  }
+}
+
+// Cut the power after every word written by the transaction
+static void test_power_cut(uint32_t fillerCount)
+{
+  uint32_t writes;
+
+  setup(fillerCount);
+  writes = dry_run();
+  TEST_ASSERT(writes > 0U);
+
+  for (uint32_t cut = 1; cut <= writes; cut++) {
+    memcpy(nvm3_host_area, beforeTx, sizeof(beforeTx));
+    mount();
+    nvm3_halRamSetPowerCut(cut, power_cut);
+    if (setjmp(powerCutJump) == 0) {
+      (void)nvm3_writeTransaction(&handle, tx, txCount);
+      TEST_ASSERT(false);
+    }
+    nvm3_halRamSetPowerCut(0, NULL);
+    count_markers(nvm3_host_area);
+    // The commit marker is the last write, the transaction is only seen
+    // once it is complete
+    check_recovery((cut == writes) ? STATE_NEW : STATE_OLD);
+  }
+}
+
+// A HAL over the RAM HAL that counts the writes and erases, and fails all
+// of them once failAfter are done, as a FLASH that can no longer be written
+static nvm3_HalHandle_t failHal;
+static uint32_t failCount;
+static uint32_t failAfter;
+
+static sl_status_t fail_write_words(nvm3_HalPtr_t nvmAdr, void const *src, size_t wordCnt)
+{
+  if (failCount >= failAfter) {
+    return SL_STATUS_FLASH_PROGRAM_FAILED;
+  }
+  failCount++;
+  return nvm3_halRamHandle.writeWords(nvmAdr, src, wordCnt);
+}
+
+static sl_status_t fail_page_erase(nvm3_HalPtr_t nvmAdr)
+{
+  if (failCount >= failAfter) {
+    return SL_STATUS_FLASH_ERASE_FAILED;
+  }
+  failCount++;
+  return nvm3_halRamHandle.pageErase(nvmAdr);
+}
+
+static sl_status_t fail_open(uint32_t after)
+{
+  nvm3_Init_t init;
+
+  failHal = nvm3_halRamHandle;
+  failHal.writeWords = fail_write_words;
+  failHal.pageErase = fail_page_erase;
+  failCount = 0;
+  failAfter = after;
+  nvm3_host_init(&init, PAGES, CACHE_SIZE);
+  init.halHandle = &failHal;
+  memset(&handle, 0, sizeof(handle));
+  return nvm3_open(&handle, &init);
+}
+
+// Make the writes of the recovery fail from each write on. The open must
+// fail, so that nothing is written over the transaction it could not roll
+// back, and the next open must complete the rollback.
+static void test_rollback_fail(void)
+{
+  uint32_t writes;
+  sl_status_t sta;
+
+  setup(0);
+  writes = dry_run();
+
+  // Interrupt the transaction after its begin marker and first objects
+  memcpy(nvm3_host_area, beforeTx, sizeof(beforeTx));
+  mount();
+  nvm3_halRamSetPowerCut(writes / 2U, power_cut);
+  if (setjmp(powerCutJump) == 0) {
+    (void)nvm3_writeTransaction(&handle, tx, txCount);
+    TEST_ASSERT(false);
+  }
+  nvm3_halRamSetPowerCut(0, NULL);
+  memcpy(afterCut, nvm3_host_area, sizeof(afterCut));
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, fail_open(UINT32_MAX));
+  writes = failCount;
+  TEST_ASSERT(writes > 0U);
+  TEST_ASSERT_EQUAL(STATE_OLD, check_all_or_nothing());
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+
+  for (uint32_t after = 0; after < writes; after++) {
+    memcpy(nvm3_host_area, afterCut, sizeof(afterCut));
+    sta = fail_open(after);
+    TEST_ASSERT(sta != SL_STATUS_OK);
+    TEST_ASSERT(!handle.hasBeenOpened);
+
+    mount();
+    TEST_ASSERT_EQUAL(STATE_OLD, check_all_or_nothing());
+    // A later transaction commits, and survives a repack and a reopen
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeTransaction(&handle, tx, txCount));
+    TEST_ASSERT_EQUAL(STATE_NEW, check_all_or_nothing());
+    if (nvm3_repackNeeded(&handle)) {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_repack(&handle));
+    }
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+    mount();
+    TEST_ASSERT_EQUAL(STATE_NEW, check_all_or_nothing());
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  }
+}
+
+int main(void)
+{
+  // The FIFO end in the middle of a page, and positions that make the
+  // transaction cross into the next page
+  static const uint32_t fillers[] = { 0, 60, 68, 76 };
+
+  for (size_t i = 0; i < sizeof(fillers) / sizeof(fillers[0]); i++) {
+    test_power_cut(fillers[i]);
+  }
+
+  test_rollback_fail();
+
+  TEST_ASSERT(cutsAfterBegin > 0U);
+  TEST_ASSERT(cutsAfterCommit > 0U);
+  TEST_ASSERT(cutsAfterAbort > 0U);
+  printf("nvm3 transaction: ok, cuts after begin %u, commit %u, abort %u\n",
+         cutsAfterBegin, cutsAfterCommit, cutsAfterAbort);
+  return 0;
+}
@@ -0,0 +1,201 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 test: wear statistics and page erase counts.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "nvm3_host.h"
+
+#define PAGES       4U
+#define CACHE_SIZE  64U
+#define KEYS        40U
+#define LEN         100U
+#define COUNTER_KEY 1000U
+
+static nvm3_Handle_t handle;
+
+static uint32_t write_unit(void)
+{
+  return (handle.halInfo.writeSize == NVM3_HAL_WRITE_SIZE_16) ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+// The erase counts from the page headers, and from the HAL
+static void get_erase_counts(uint32_t *header, uint32_t *hal)
+{
+  size_t pageCnt = PAGES;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getPageEraseCounts(&handle, header, &pageCnt));
+  TEST_ASSERT_EQUAL(PAGES, pageCnt);
+  for (size_t i = 0; i < PAGES; i++) {
+    hal[i] = nvm3_halRamGetPageEraseCount(i);
+  }
+}
+
+// Each application write is counted by the NVM space it takes
+static void test_user_writes(void)
+{
+  nvm3_WearStats_t wear;
+  uint8_t data[LEN];
+  size_t used = 0;
+
+  nvm3_getWearStats(&handle, &wear, true);
+  for (nvm3_ObjectKey_t key = 0; key < 4U; key++) {
+    size_t unusedPre = handle.unusedNvmSize;
+
+    nvm3_host_fill(data, LEN, key, 1);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&handle, key, data, LEN));
+    used += unusedPre - handle.unusedNvmSize;
+  }
+  // Writing the value an object already holds writes nothing
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&handle, 3, data, LEN));
+
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT(used > 4U * LEN);
+  TEST_ASSERT_EQUAL(used, wear.userBytesWritten);
+  TEST_ASSERT_EQUAL(0, wear.repackBytesCopied);
+  TEST_ASSERT_EQUAL(0, wear.pageEraseCount);
+
+  // A reset read returns the statistics and clears them
+  nvm3_getWearStats(&handle, &wear, true);
+  TEST_ASSERT_EQUAL(used, wear.userBytesWritten);
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT_EQUAL(0, wear.userBytesWritten);
+}
+
+// An increment takes one write unit, a new base takes the base fields, and a
+// counter object with all its fields used is written again
+static void test_counter(void)
+{
+  nvm3_WearStats_t wear;
+  uint32_t value = 0;
+  uint32_t objectWrites = 0;
+  uint32_t increments = 0;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeCounter(&handle, COUNTER_KEY, 0));
+  nvm3_getWearStats(&handle, &wear, true);
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_incrementCounter(&handle, COUNTER_KEY, &value));
+  TEST_ASSERT_EQUAL(1, value);
+  nvm3_getWearStats(&handle, &wear, true);
+  TEST_ASSERT_EQUAL(write_unit(), wear.userBytesWritten);
+  TEST_ASSERT_EQUAL(0, wear.counterBaseRewrites);
+  TEST_ASSERT_EQUAL(0, wear.counterObjectRewrites);
+
+  // A step too large for an increment field writes a new base value
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeCounter(&handle, COUNTER_KEY, 0x01000000U));
+  nvm3_getWearStats(&handle, &wear, true);
+  TEST_ASSERT_EQUAL(1, wear.counterBaseRewrites);
+  TEST_ASSERT_EQUAL(0, wear.counterObjectRewrites);
+  TEST_ASSERT(wear.userBytesWritten > write_unit());
+
+  // Increment until the counter object is written again
+  while (objectWrites == 0U) {
+    TEST_ASSERT(increments < 1000U);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_incrementCounter(&handle, COUNTER_KEY, &value));
+    increments++;
+    nvm3_getWearStats(&handle, &wear, true);
+    objectWrites = wear.counterObjectRewrites;
+    if (objectWrites == 0U) {
+      TEST_ASSERT_EQUAL(write_unit(), wear.userBytesWritten);
+    }
+  }
+  TEST_ASSERT_EQUAL(1, objectWrites);
+  TEST_ASSERT_EQUAL(0x01000000U + increments, value);
+  TEST_ASSERT(increments > 1U);
+}
+
+// Repacks copy the objects they keep and erase pages. The erases counted in
+// the statistics match the page headers and the erases done by the HAL.
+static void test_repack(void)
+{
+  uint32_t headerPre[PAGES];
+  uint32_t halPre[PAGES];
+  uint32_t header[PAGES];
+  uint32_t hal[PAGES];
+  nvm3_WearStats_t wear;
+  uint8_t data[LEN];
+  uint32_t state = 1;
+  uint32_t erases = 0;
+
+  get_erase_counts(headerPre, halPre);
+  nvm3_getWearStats(&handle, &wear, true);
+  for (uint32_t i = 0; i < 2000U; i++) {
+    nvm3_ObjectKey_t key = host_rand(&state) % KEYS;
+
+    nvm3_host_fill(data, LEN, key, i + 2U);
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(&handle, key, data, LEN));
+  }
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT(wear.repackBytesCopied > 0U);
+  TEST_ASSERT(wear.pageEraseCount > PAGES);
+
+  get_erase_counts(header, hal);
+  for (size_t i = 0; i < PAGES; i++) {
+    TEST_ASSERT_EQUAL(hal[i] - halPre[i], header[i] - headerPre[i]);
+    erases += header[i] - headerPre[i];
+  }
+  TEST_ASSERT_EQUAL(erases, wear.pageEraseCount);
+
+  // The erase counts are kept in NVM, the statistics are cleared by an open
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&handle, PAGES, CACHE_SIZE));
+  nvm3_getWearStats(&handle, &wear, false);
+  TEST_ASSERT_EQUAL(0, wear.userBytesWritten);
+  TEST_ASSERT_EQUAL(0, wear.repackBytesCopied);
+  TEST_ASSERT_EQUAL(0, wear.pageEraseCount);
+  get_erase_counts(headerPre, halPre);
+  TEST_ASSERT(memcmp(header, headerPre, sizeof(header)) == 0);
+}
+
+// A short array gets the first pages
+static void test_short_array(void)
+{
+  uint32_t all[PAGES];
+  uint32_t first[2];
+  size_t pageCnt = PAGES;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getPageEraseCounts(&handle, all, &pageCnt));
+  pageCnt = 2;
+  TEST_ASSERT_EQUAL(SL_STATUS_WOULD_OVERFLOW, nvm3_getPageEraseCounts(&handle, first, &pageCnt));
+  TEST_ASSERT_EQUAL(PAGES, pageCnt);
+  TEST_ASSERT_EQUAL(all[0], first[0]);
+  TEST_ASSERT_EQUAL(all[1], first[1]);
+}
+
+int main(void)
+{
+  nvm3_host_erase();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_host_open(&handle, PAGES, CACHE_SIZE));
+  test_user_writes();
+  test_counter();
+  test_repack();
+  test_short_array();
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_close(&handle));
+
+  printf("nvm3 wear: ok\n");
+  return 0;
+}
@@ -0,0 +1,131 @@
+/***************************************************************************//**
+ * @file
+ * @brief PSA ITS look-up benchmark: get_info and get with 32 and 128 files.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "psa_its_host.h"
+#include "nvm3_hal_ram.h"
+
+#define FILE_SIZE   64U
+
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+#define VARIANT_NAME  "index+trust"
+#elif SL_PSA_ITS_UID_INDEX_ENABLE
+#define VARIANT_NAME  "index"
+#else
+#define VARIANT_NAME  "scan"
+#endif
+
+static const uint32_t fileCounts[] = { 32, 128 };
+
+static uint8_t buf[FILE_SIZE];
+
+static psa_storage_uid_t uid_of(uint32_t i)
+{
+  return ((psa_storage_uid_t)(i + 1U) * 0x9E3779B97F4A7C15ULL) >> 1;
+}
+
+typedef struct {
+  uint64_t ns;
+  uint64_t words;
+  uint64_t decrypts;
+} Cost_t;
+
+static void cost_start(uint64_t *start, uint32_t *decrypts)
+{
+  nvm3_halRamResetStats();
+  *decrypts = psa_its_host_decrypt_count;
+  *start = host_time_ns();
+}
+
+static void cost_end(Cost_t *c, uint64_t start, uint32_t decrypts)
+{
+  nvm3_HalRamStats_t stats;
+
+  c->ns += host_time_ns() - start;
+  nvm3_halRamGetStats(&stats);
+  c->words += stats.wordReadCnt;
+  c->decrypts += psa_its_host_decrypt_count - decrypts;
+}
+
+// get_info of every file after a reboot, then get of every file, in reverse
+// order of creation. The look-up tables the driver fills from NVM3 on the
+// first call are filled before the measurement.
+static void bench_lookup(uint32_t count, uint32_t rounds)
+{
+  Cost_t info = { 0 };
+  Cost_t get = { 0 };
+  uint64_t start;
+  uint32_t decrypts;
+  uint64_t calls = (uint64_t)count * rounds;
+
+  psa_its_host_erase();
+  for (uint32_t i = 0; i < count; i++) {
+    memset(buf, (int)i, FILE_SIZE);
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_set(uid_of(i), FILE_SIZE, buf, PSA_STORAGE_FLAG_NONE));
+  }
+
+  for (uint32_t r = 0; r < rounds; r++) {
+    psa_its_host_reboot();
+    TEST_ASSERT_EQUAL(PSA_ERROR_DOES_NOT_EXIST, psa_its_remove(uid_of(count)));
+    for (uint32_t i = count; i-- > 0U;) {
+      struct psa_storage_info_t s;
+
+      cost_start(&start, &decrypts);
+      TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get_info(uid_of(i), &s));
+      cost_end(&info, start, decrypts);
+      TEST_ASSERT_EQUAL(FILE_SIZE, s.size);
+    }
+    for (uint32_t i = count; i-- > 0U;) {
+      size_t len = 0;
+
+      cost_start(&start, &decrypts);
+      TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get(uid_of(i), 0, FILE_SIZE, buf, &len));
+      cost_end(&get, start, decrypts);
+      TEST_ASSERT(len == FILE_SIZE && buf[0] == (uint8_t)i);
+    }
+  }
+
+  printf("%-11s %3u files: get_info %8.1f ns %7.1f words %4.2f decrypts  get %8.1f ns %7.1f words %4.2f decrypts per call\n",
+         VARIANT_NAME, count,
+         (double)info.ns / calls, (double)info.words / calls, (double)info.decrypts / calls,
+         (double)get.ns / calls, (double)get.words / calls, (double)get.decrypts / calls);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t rounds = (uint32_t)host_arg(argc, argv, 1, 20);
+
+  for (size_t i = 0; i < sizeof(fileCounts) / sizeof(fileCounts[0]); i++) {
+    bench_lookup(fileCounts[i], rounds);
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+/***************************************************************************//**
+ * @file
+ * @brief PSA Crypto configuration of the PSA ITS harness.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef PSA_ITS_HOST_CRYPTO_CONFIG_H
+#define PSA_ITS_HOST_CRYPTO_CONFIG_H
+
+// What the encrypted ITS driver uses: AES-GCM, and AES-CMAC to derive keys
+#define PSA_WANT_KEY_TYPE_AES   1
+#define PSA_WANT_ALG_GCM        1
+#define PSA_WANT_ALG_CMAC       1
+
+#endif // PSA_ITS_HOST_CRYPTO_CONFIG_H
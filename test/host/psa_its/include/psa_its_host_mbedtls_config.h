@@ -0,0 +1,53 @@
+/***************************************************************************//**
+ * @file
+ * @brief Mbed TLS configuration of the PSA ITS harness.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef PSA_ITS_HOST_MBEDTLS_CONFIG_H
+#define PSA_ITS_HOST_MBEDTLS_CONFIG_H
+
+// Only the PSA types and the ITS driver are built, the crypto primitives the
+// driver calls are host stand-ins (psa_its_host.c).
+#define MBEDTLS_PSA_CRYPTO_C
+#define MBEDTLS_PSA_CRYPTO_CONFIG
+#define MBEDTLS_PSA_CRYPTO_STORAGE_C
+#define MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG
+
+// The ITS driver of the project, see config/psa_crypto_config.h
+#define SL_PSA_ITS_SUPPORT_V1_DRIVER  0
+#define SL_PSA_ITS_SUPPORT_V2_DRIVER  0
+#define SL_PSA_ITS_SUPPORT_V3_DRIVER  1
+#define SL_PSA_ITS_USER_MAX_FILES     (128)
+#define SL_PSA_ITS_MAX_FILES          (1 + SL_PSA_ITS_USER_MAX_FILES)
+
+// psa_its_get() checks that the output buffer is in RAM, with 32-bit
+// addresses. The harnesses are linked at a low address.
+#define SRAM_BASE                     (0x00000000UL)
+#define SRAM_SIZE                     (0xFFFFFFFFUL)
+
+#endif // PSA_ITS_HOST_MBEDTLS_CONFIG_H
@@ -0,0 +1,241 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-ins for the encrypted PSA ITS driver: default NVM3 instance and crypto primitives.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "psa_its_host.h"
+#include "nvm3_host.h"
+#include "psa_crypto_aead.h"
+#include "psa_crypto_mac.h"
+
+#define PAGES         16U
+#define CACHE_SIZE    (SL_PSA_ITS_MAX_FILES + 16U)
+#define TAG_SIZE      16U
+
+// The look-up tables of the driver, reset by a reboot
+extern bool nvm3_uid_set_cache_initialized;
+extern uint32_t nvm3_uid_set_cache[(SL_PSA_ITS_MAX_FILES + 31) / 32];
+extern uint32_t nvm3_uid_tomb_cache[(SL_PSA_ITS_MAX_FILES + 31) / 32];
+
+uint32_t psa_its_host_decrypt_count;
+
+static nvm3_Handle_t defaultHandle;
+static nvm3_Init_t defaultInit;
+nvm3_Handle_t *nvm3_defaultHandle = &defaultHandle;
+nvm3_Init_t *nvm3_defaultInit = &defaultInit;
+
+static uint32_t randomState = 0x1234567U;
+static bool rootKeySet;
+
+sl_status_t nvm3_initDefault(void)
+{
+  if (defaultHandle.hasBeenOpened) {
+    return SL_STATUS_OK;
+  }
+  nvm3_host_init(&defaultInit, PAGES, CACHE_SIZE);
+  return nvm3_open(&defaultHandle, &defaultInit);
+}
+
+sl_status_t nvm3_deinitDefault(void)
+{
+  return nvm3_close(&defaultHandle);
+}
+
+static void restart(void)
+{
+  static uint8_t rootKey[32] = { 0x52, 0x4f, 0x4f, 0x54 };
+
+  if (defaultHandle.hasBeenOpened) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_deinitDefault());
+  }
+  memset(&defaultHandle, 0, sizeof(defaultHandle));
+  nvm3_uid_set_cache_initialized = false;
+  memset(nvm3_uid_set_cache, 0, sizeof(nvm3_uid_set_cache));
+  memset(nvm3_uid_tomb_cache, 0, sizeof(nvm3_uid_tomb_cache));
+  if (!rootKeySet) {
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, sli_psa_its_set_root_key(rootKey, sizeof(rootKey)));
+    rootKeySet = true;
+  }
+}
+
+void psa_its_host_erase(void)
+{
+  restart();
+  nvm3_host_erase();
+}
+
+void psa_its_host_reboot(void)
+{
+  restart();
+}
+
+void psa_its_host_tamper(psa_storage_uid_t uid, size_t ofs)
+{
+  static uint8_t file[NVM3_MAX_OBJECT_SIZE];
+  nvm3_ObjectKey_t keys[SL_PSA_ITS_MAX_FILES];
+  size_t count;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_initDefault());
+  count = nvm3_enumObjects(nvm3_defaultHandle, keys, SL_PSA_ITS_MAX_FILES,
+                           SLI_PSA_ITS_NVM3_RANGE_START, SLI_PSA_ITS_NVM3_RANGE_END - 1U);
+  for (size_t i = 0; i < count; i++) {
+    sli_its_file_meta_v2_t meta;
+    uint32_t type;
+    size_t len;
+
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_getObjectInfo(nvm3_defaultHandle, keys[i], &type, &len));
+    TEST_ASSERT((len >= sizeof(meta)) && (len <= sizeof(file)) && (ofs < len));
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_readData(nvm3_defaultHandle, keys[i], file, len));
+    memcpy(&meta, file, sizeof(meta));
+    if (meta.uid == uid) {
+      file[ofs] ^= 0x01U;
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, nvm3_writeData(nvm3_defaultHandle, keys[i], file, len));
+      return;
+    }
+  }
+  TEST_ASSERT(false);
+}
+
+// Keyed FNV-1a. It stands in for AES: it keeps keys, nonces and data apart,
+// so that a changed file fails authentication, but it is not a cipher.
+static uint64_t fnv(uint64_t h, const uint8_t *p, size_t len)
+{
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ p[i]) * 0x100000001B3ULL;
+  }
+  return h;
+}
+
+static void tag(const uint8_t *key, size_t keyLen,
+                const uint8_t *nonce, size_t nonceLen,
+                const uint8_t *ad, size_t adLen,
+                const uint8_t *data, size_t dataLen,
+                uint8_t out[TAG_SIZE])
+{
+  for (uint32_t half = 0; half < 2U; half++) {
+    uint64_t h = 0xCBF29CE484222325ULL + half;
+
+    h = fnv(h, key, keyLen);
+    h = fnv(h, nonce, nonceLen);
+    h = fnv(h, ad, adLen);
+    h = fnv(h, data, dataLen);
+    memcpy(&out[half * 8U], &h, 8U);
+  }
+}
+
+static void keystream_xor(const uint8_t *key, size_t keyLen,
+                          const uint8_t *nonce, size_t nonceLen,
+                          const uint8_t *in, uint8_t *out, size_t len)
+{
+  uint64_t state = fnv(fnv(0xCBF29CE484222325ULL, key, keyLen), nonce, nonceLen);
+
+  for (size_t i = 0; i < len; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    out[i] = in[i] ^ (uint8_t)(state >> 56);
+  }
+}
+
+psa_status_t mbedtls_psa_external_get_random(mbedtls_psa_external_random_context_t *context,
+                                             uint8_t *output, size_t output_size, size_t *output_length)
+{
+  (void)context;
+  for (size_t i = 0; i < output_size; i++) {
+    output[i] = (uint8_t)host_rand(&randomState);
+  }
+  *output_length = output_size;
+  return PSA_SUCCESS;
+}
+
+psa_status_t mbedtls_psa_mac_compute(const psa_key_attributes_t *attributes,
+                                     const uint8_t *key_buffer, size_t key_buffer_size,
+                                     psa_algorithm_t alg,
+                                     const uint8_t *input, size_t input_length,
+                                     uint8_t *mac, size_t mac_size, size_t *mac_length)
+{
+  (void)attributes;
+  if ((alg != PSA_ALG_CMAC) || (mac_size < TAG_SIZE)) {
+    return PSA_ERROR_NOT_SUPPORTED;
+  }
+  tag(key_buffer, key_buffer_size, NULL, 0, NULL, 0, input, input_length, mac);
+  *mac_length = TAG_SIZE;
+  return PSA_SUCCESS;
+}
+
+psa_status_t mbedtls_psa_aead_encrypt(const psa_key_attributes_t *attributes,
+                                      const uint8_t *key_buffer, size_t key_buffer_size,
+                                      psa_algorithm_t alg,
+                                      const uint8_t *nonce, size_t nonce_length,
+                                      const uint8_t *additional_data, size_t additional_data_length,
+                                      const uint8_t *plaintext, size_t plaintext_length,
+                                      uint8_t *ciphertext, size_t ciphertext_size, size_t *ciphertext_length)
+{
+  (void)attributes;
+  (void)alg;
+  if (ciphertext_size < (plaintext_length + TAG_SIZE)) {
+    return PSA_ERROR_BUFFER_TOO_SMALL;
+  }
+  keystream_xor(key_buffer, key_buffer_size, nonce, nonce_length, plaintext, ciphertext, plaintext_length);
+  tag(key_buffer, key_buffer_size, nonce, nonce_length, additional_data, additional_data_length,
+      ciphertext, plaintext_length, &ciphertext[plaintext_length]);
+  *ciphertext_length = plaintext_length + TAG_SIZE;
+  return PSA_SUCCESS;
+}
+
+psa_status_t mbedtls_psa_aead_decrypt(const psa_key_attributes_t *attributes,
+                                      const uint8_t *key_buffer, size_t key_buffer_size,
+                                      psa_algorithm_t alg,
+                                      const uint8_t *nonce, size_t nonce_length,
+                                      const uint8_t *additional_data, size_t additional_data_length,
+                                      const uint8_t *ciphertext, size_t ciphertext_length,
+                                      uint8_t *plaintext, size_t plaintext_size, size_t *plaintext_length)
+{
+  uint8_t expected[TAG_SIZE];
+  size_t len;
+
+  (void)attributes;
+  (void)alg;
+  psa_its_host_decrypt_count++;
+  if (ciphertext_length < TAG_SIZE) {
+    return PSA_ERROR_INVALID_SIGNATURE;
+  }
+  len = ciphertext_length - TAG_SIZE;
+  if (plaintext_size < len) {
+    return PSA_ERROR_BUFFER_TOO_SMALL;
+  }
+  tag(key_buffer, key_buffer_size, nonce, nonce_length, additional_data, additional_data_length,
+      ciphertext, len, expected);
+  if (memcmp(expected, &ciphertext[len], TAG_SIZE) != 0) {
+    return PSA_ERROR_INVALID_SIGNATURE;
+  }
+  keystream_xor(key_buffer, key_buffer_size, nonce, nonce_length, ciphertext, plaintext, len);
+  *plaintext_length = len;
+  return PSA_SUCCESS;
+}
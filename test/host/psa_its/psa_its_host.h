@@ -0,0 +1,57 @@
+/***************************************************************************//**
+ * @file
+ * @brief The encrypted PSA ITS driver on the NVM3 RAM HAL, shared by the PSA ITS harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef PSA_ITS_HOST_H
+#define PSA_ITS_HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "host_test.h"
+#include "nvm3_default.h"
+#include "psa/internal_trusted_storage.h"
+#include "psa/sli_internal_trusted_storage.h"
+
+// Authenticated decryptions made by the driver since the last reset of the
+// count. A look-up that authenticates a file makes one.
+extern uint32_t psa_its_host_decrypt_count;
+
+// Erase the NVM3 area and start the driver as on a new device
+void psa_its_host_erase(void);
+
+// Restart the driver on the current NVM3 content, as after a reset
+void psa_its_host_reboot(void);
+
+// Change one byte of the stored file of a UID in NVM3, behind the driver, as
+// tampering with the flash would. ofs counts from the start of the NVM3
+// object, the file header included.
+void psa_its_host_tamper(psa_storage_uid_t uid, size_t ofs);
+
+#endif // PSA_ITS_HOST_H
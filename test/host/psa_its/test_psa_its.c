@@ -0,0 +1,188 @@
+/***************************************************************************//**
+ * @file
+ * @brief PSA ITS driver test: files against a model across reboots, and tampered files.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "psa_its_host.h"
+
+#define UID_COUNT     48U
+#define MAX_LEN       200U
+#define META_SIZE     sizeof(sli_its_file_meta_v2_t)
+#define IV_SIZE       12U
+
+typedef struct {
+  bool exists;
+  size_t len;
+  uint8_t data[MAX_LEN];
+} ModelFile_t;
+
+static ModelFile_t model[UID_COUNT];
+
+// psa_its_get() only writes to RAM it can address with 32 bits
+static uint8_t buf[MAX_LEN];
+
+// UIDs spread over the 64-bit range, so that they do not follow the NVM3 IDs
+static psa_storage_uid_t uid_of(uint32_t i)
+{
+  return ((psa_storage_uid_t)(i + 1U) * 0x9E3779B97F4A7C15ULL) >> 1;
+}
+
+static void check_model(void)
+{
+  for (uint32_t i = 0; i < UID_COUNT; i++) {
+    struct psa_storage_info_t info;
+    psa_status_t sta = psa_its_get_info(uid_of(i), &info);
+    size_t len = 0;
+
+    if (!model[i].exists) {
+      TEST_ASSERT_EQUAL(PSA_ERROR_DOES_NOT_EXIST, sta);
+      continue;
+    }
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, sta);
+    TEST_ASSERT_EQUAL(model[i].len, info.size);
+    TEST_ASSERT_EQUAL(PSA_STORAGE_FLAG_NONE, info.flags);
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get(uid_of(i), 0, model[i].len, buf, &len));
+    TEST_ASSERT_EQUAL(model[i].len, len);
+    TEST_ASSERT(memcmp(buf, model[i].data, len) == 0);
+  }
+}
+
+// Random sets, partial gets and removes, with reboots in between
+static void test_model(uint32_t iterations)
+{
+  uint32_t rnd = 11;
+
+  psa_its_host_erase();
+  memset(model, 0, sizeof(model));
+  for (uint32_t n = 0; n < iterations; n++) {
+    uint32_t i = host_rand(&rnd) % UID_COUNT;
+    uint32_t op = host_rand(&rnd) % 8U;
+    ModelFile_t *f = &model[i];
+
+    if (op < 4U) {
+      f->len = 1U + (host_rand(&rnd) % MAX_LEN);
+      for (size_t k = 0; k < f->len; k++) {
+        f->data[k] = (uint8_t)host_rand(&rnd);
+      }
+      memcpy(buf, f->data, f->len);
+      TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_set(uid_of(i), f->len, buf, PSA_STORAGE_FLAG_NONE));
+      f->exists = true;
+    } else if (op < 6U) {
+      size_t len = 0;
+
+      if (f->exists) {
+        size_t ofs = host_rand(&rnd) % f->len;
+
+        TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get(uid_of(i), ofs, f->len - ofs, buf, &len));
+        TEST_ASSERT_EQUAL(f->len - ofs, len);
+        TEST_ASSERT(memcmp(buf, &f->data[ofs], len) == 0);
+      } else {
+        TEST_ASSERT_EQUAL(PSA_ERROR_DOES_NOT_EXIST, psa_its_get(uid_of(i), 0, 1, buf, &len));
+      }
+    } else if (op < 7U) {
+      TEST_ASSERT_EQUAL(f->exists ? PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST, psa_its_remove(uid_of(i)));
+      f->exists = false;
+    } else if ((host_rand(&rnd) % 8U) == 0U) {
+      psa_its_host_reboot();
+      check_model();
+    }
+  }
+  psa_its_host_reboot();
+  check_model();
+}
+
+// Every look-up authenticates the file it finds, unless the index is
+// trusted, which authenticates a file once after boot.
+static void test_authentication_count(void)
+{
+  struct psa_storage_info_t info;
+  uint32_t before;
+
+  psa_its_host_erase();
+  for (uint32_t i = 0; i < 8U; i++) {
+    memset(buf, (int)i, 32);
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_set(uid_of(i), 32, buf, PSA_STORAGE_FLAG_NONE));
+  }
+  psa_its_host_reboot();
+  for (uint32_t n = 0; n < 3U; n++) {
+    before = psa_its_host_decrypt_count;
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get_info(uid_of(5), &info));
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+    TEST_ASSERT_EQUAL(n == 0U ? 1U : 0U, psa_its_host_decrypt_count - before);
+#else
+    TEST_ASSERT_EQUAL(1U, psa_its_host_decrypt_count - before);
+#endif
+  }
+}
+
+// A file changed in NVM3 behind the driver, after the driver has read it
+static void test_tamper(void)
+{
+  struct psa_storage_info_t info;
+  size_t len = 0;
+
+  psa_its_host_erase();
+  for (uint32_t i = 0; i < 4U; i++) {
+    memset(buf, 0x40 + (int)i, 64);
+    TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_set(uid_of(i), 64, buf, PSA_STORAGE_FLAG_NONE));
+  }
+  TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get_info(uid_of(2), &info));
+
+  // The encrypted data, and then the IV
+  psa_its_host_tamper(uid_of(2), META_SIZE + IV_SIZE + 10U);
+#if SL_PSA_ITS_UID_INDEX_TRUST_ENABLE
+  // Trusted metadata is still returned, the data itself is not
+  TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get_info(uid_of(2), &info));
+  TEST_ASSERT(psa_its_get(uid_of(2), 0, 64, buf, &len) != PSA_SUCCESS);
+#else
+  TEST_ASSERT(psa_its_get_info(uid_of(2), &info) != PSA_SUCCESS);
+  TEST_ASSERT(psa_its_get(uid_of(2), 0, 64, buf, &len) != PSA_SUCCESS);
+#endif
+  psa_its_host_tamper(uid_of(2), META_SIZE + IV_SIZE + 10U);
+  psa_its_host_tamper(uid_of(2), META_SIZE + 1U);
+  TEST_ASSERT(psa_its_get(uid_of(2), 0, 64, buf, &len) != PSA_SUCCESS);
+
+  // Other files are not affected
+  TEST_ASSERT_EQUAL(PSA_SUCCESS, psa_its_get(uid_of(3), 0, 64, buf, &len));
+  TEST_ASSERT_EQUAL(64U, len);
+  TEST_ASSERT(buf[0] == 0x43 && buf[63] == 0x43);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 300);
+
+  test_model(iterations);
+  test_authentication_count();
+  test_tamper();
+  printf("test_psa_its: %u iterations passed\n", (unsigned)iterations);
+  return 0;
+}
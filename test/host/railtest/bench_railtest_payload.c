@@ -0,0 +1,100 @@
+/***************************************************************************//**
+ * @file
+ * @brief Times the RAILtest RX payload encoders against the former per-byte printf loop.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "host_test.h"
+#include "host_railtest.h"
+#include "app_common.h"
+#include "response_print.h"
+
+// Usage: bench_railtest_payload [packets] [length]
+//
+// Prints the same packet without appended info in each payload format, with
+// console output discarded, and reports the host time per packet. "printf"
+// is the loop printPacket() used before the encoders, one RAILTEST_PRINTF()
+// per byte.
+
+static uint8_t payload[SL_RAIL_TEST_MAX_PACKET_LENGTH];
+
+static void printLegacy(uint8_t *data, uint16_t dataLength)
+{
+  responsePrintStart("payloadBench");
+  responsePrintContinue("len:%d", dataLength);
+  RAILTEST_PRINTF("{payload:");
+  for (int i = 0; i < dataLength; i++) {
+    RAILTEST_PRINTF(" 0x%.2x", data[i]);
+  }
+  RAILTEST_PRINTF("}");
+  responsePrintEnd("}");
+}
+
+static double run(int format, uint32_t packets, uint16_t length)
+{
+  uint64_t start = host_time_ns();
+
+  for (uint32_t i = 0; i < packets; i++) {
+    if (format < 0) {
+      printLegacy(payload, length);
+    } else {
+      rxPayloadFormat = (RailPayloadFormat_t)format;
+      printPacket("payloadBench", payload, length, NULL);
+    }
+  }
+  fflush(stdout);
+  return (double)(host_time_ns() - start) / packets;
+}
+
+int main(int argc, char *argv[])
+{
+  static const char *names[PAYLOAD_FORMAT_COUNT] = { "bytes", "hex", "base64" };
+  uint32_t packets = (uint32_t)host_arg(argc, argv, 1, 20000);
+  uint16_t length = (uint16_t)host_arg(argc, argv, 2, 255);
+  uint32_t state = 0x9E3779B9;
+  FILE *report;
+
+  TEST_ASSERT(length <= SL_RAIL_TEST_MAX_PACKET_LENGTH);
+  for (size_t i = 0; i < length; i++) {
+    payload[i] = (uint8_t)host_rand(&state);
+  }
+  host_railtest_init(false);
+  host_railtest_settle();
+  report = host_railtest_report;
+
+  fprintf(report, "%u packets of %u bytes\n", packets, length);
+  double legacy = run(-1, packets, length);
+  fprintf(report, "  %-7s %9.1f ns per packet, %6.2f ns per byte\n",
+          "printf", legacy, legacy / length);
+  for (int format = 0; format < PAYLOAD_FORMAT_COUNT; format++) {
+    double ns = run(format, packets, length);
+    fprintf(report, "  %-7s %9.1f ns per packet, %6.2f ns per byte, %.1fx\n",
+            names[format], ns, ns / length, legacy / ns);
+  }
+  rxPayloadFormat = PAYLOAD_FORMAT_BYTES;
+  return 0;
+}
@@ -0,0 +1,91 @@
+/***************************************************************************//**
+ * @file
+ * @brief Measures RAILtest receive throughput and print latency over the simulated radio.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "host_test.h"
+#include "host_railtest.h"
+#include "fake_rail.h"
+#include "app_common.h"
+
+// Receive packets at a fixed interval with console output discarded, then
+// report the host time each one cost, the packets lost on the way and how
+// long they waited to be printed. Arguments: packet count, interval in us,
+// packet length and 1 for zero copy reception.
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (uint32_t)host_arg(argc, argv, 1, 100000);
+  uint32_t interval = (uint32_t)host_arg(argc, argv, 2, 1000);
+  uint16_t length = (uint16_t)host_arg(argc, argv, 3, 20);
+  bool zeroCopy = host_arg(argc, argv, 4, 0) != 0;
+  host_railtest_traffic_t traffic = {
+    .rx_interval_us = interval,
+    .rx_length = length,
+    .rx_rssi = -40,
+  };
+
+  TEST_ASSERT(length >= 4U);
+  host_railtest_init(false);
+  host_railtest_settle();
+  if (zeroCopy) {
+    host_railtest_input("zeroCopyRx 1\n");
+    host_railtest_settle();
+  }
+  memset(&host_railtest_stats, 0, sizeof(host_railtest_stats));
+
+  uint64_t start = host_time_ns();
+  host_railtest_set_traffic(&traffic);
+  while (host_railtest_stats.rx_injected < packets) {
+    host_railtest_step();
+  }
+  memset(&traffic, 0, sizeof(traffic));
+  host_railtest_set_traffic(&traffic);
+  host_railtest_settle();
+  uint64_t elapsed = host_time_ns() - start;
+
+  const host_railtest_stats_t *stats = &host_railtest_stats;
+  uint32_t printed = (stats->rx_printed > 0U) ? stats->rx_printed : 1U;
+  TEST_ASSERT(stats->rx_printed > 0U);
+  FILE *report = host_railtest_report;
+  fprintf(report, "%u packets of %u bytes every %u us%s: %.1f ns per packet, %u loops\n",
+          stats->rx_injected, length, interval, zeroCopy ? " (zero copy)" : "",
+          (double)elapsed / stats->rx_injected, stats->loops);
+  fprintf(report, "printed %u, no buffer %u, FIFO overflow %u, not receiving %u, "
+          "copies avoided %u\n",
+          stats->rx_printed, counters.noRxBuffer, fake_rail_stats.rx_overflow,
+          fake_rail_stats.rx_not_receiving, counters.rxCopiesAvoided);
+  fprintf(report, "latency: %.1f us average, %u us max (virtual), "
+          "%.1f ns average, %llu ns max (host), %.1f output bytes per packet\n",
+          (double)stats->latency_us_total / printed, stats->latency_us_max,
+          (double)stats->latency_ns_total / printed,
+          (unsigned long long)stats->latency_ns_max,
+          (double)stats->output_bytes / printed);
+  return 0;
+}
@@ -0,0 +1,805 @@
+/***************************************************************************//**
+ * @file
+ * @brief Software stand-in for the RAIL library, driven by a host harness.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "rail.h"
+#include "host_core.h"
+#include "host_test.h"
+#include "fake_rail.h"
+
+// Smallest receive FIFO RAIL accepts, and the one it uses when the
+// application does not provide any
+#define RX_FIFO_MIN_SIZE      64U
+#define RX_FIFO_DEFAULT_SIZE  512U
+
+// Packets the receive FIFO keeps track of at once
+#define RX_PACKETS_MAX        16U
+
+#define TX_PACKET_MAX         4096U
+
+typedef struct {
+  uint16_t start;  // Offset of the first byte in the receive FIFO
+  uint16_t length;
+  RAIL_RxPacketStatus_t status;
+  RAIL_Time_t time;
+  int8_t rssi;
+  bool held;
+} rx_packet_t;
+
+fake_rail_stats_t fake_rail_stats;
+uint32_t fake_rail_bit_rate = 100000UL;
+
+// Handles only need to be distinct and not NULL
+static uint8_t instance;
+#define FAKE_RAIL_HANDLE ((RAIL_Handle_t)&instance)
+
+static RAIL_Time_t now;
+static uint32_t entropy = 0x1234567UL;
+
+static void (*events_callback)(RAIL_Handle_t railHandle, RAIL_Events_t events);
+static RAIL_Events_t enabled_events;
+
+static RAIL_RadioState_t state = RAIL_RF_STATE_INACTIVE;
+static RAIL_StateTransitions_t rx_transitions = { RAIL_RF_STATE_IDLE, RAIL_RF_STATE_IDLE };
+static RAIL_StateTransitions_t tx_transitions = { RAIL_RF_STATE_IDLE, RAIL_RF_STATE_IDLE };
+
+static const RAIL_ChannelConfig_t *channel_config;
+static uint16_t channel;
+
+// Packets are stored back to back in the receive FIFO. Their space is
+// reclaimed in order, once the oldest ones are neither held nor being
+// signalled to the application.
+static uint8_t default_rx_fifo[RX_FIFO_DEFAULT_SIZE];
+static uint8_t *rx_fifo = default_rx_fifo;
+static uint16_t rx_fifo_size = RX_FIFO_DEFAULT_SIZE;
+static uint16_t rx_fifo_head;
+static uint16_t rx_fifo_used;
+static rx_packet_t rx_packets[RX_PACKETS_MAX];
+static uint16_t rx_oldest;
+static uint16_t rx_count;
+static rx_packet_t *rx_newest;
+
+static uint8_t *tx_fifo;
+static uint16_t tx_fifo_size;
+static uint16_t tx_fifo_start;
+static uint16_t tx_fifo_count;
+static bool tx_active;
+static RAIL_Time_t tx_end;
+static RAIL_Time_t tx_time_sent;
+static uint8_t last_tx[TX_PACKET_MAX];
+static uint16_t last_tx_length;
+
+static bool timer_running;
+static bool timer_expired;
+static RAIL_Time_t timer_time;
+static RAIL_TimerCallback_t timer_callback;
+
+/******************************************************************************
+ * Helpers
+ *****************************************************************************/
+static void deliver(RAIL_Events_t events)
+{
+  const bool was_irq = host_core_irq_context;
+
+  events &= enabled_events;
+  if ((events == RAIL_EVENTS_NONE) || (events_callback == NULL)) {
+    return;
+  }
+  host_core_irq_context = true;
+  fake_rail_stats.events++;
+  events_callback(FAKE_RAIL_HANDLE, events);
+  host_core_irq_context = was_irq;
+}
+
+// Radio state reached through a transition
+static void enter(RAIL_RadioState_t next)
+{
+  if ((next & RAIL_RF_STATE_RX) != 0U) {
+    state = RAIL_RF_STATE_RX_ACTIVE;
+  } else if ((next & RAIL_RF_STATE_TX) != 0U) {
+    state = RAIL_RF_STATE_TX_ACTIVE;
+  } else {
+    state = RAIL_RF_STATE_IDLE;
+  }
+}
+
+static RAIL_Time_t airtime(uint16_t bytes)
+{
+  uint64_t us = ((uint64_t)bytes * 8U * 1000000U) / fake_rail_bit_rate;
+
+  return (us == 0U) ? 1U : (RAIL_Time_t)us;
+}
+
+// Whether time falls due no later than limit, both being ahead of now
+static bool due_by(RAIL_Time_t time, RAIL_Time_t limit)
+{
+  return (int32_t)(time - limit) <= 0;
+}
+
+static bool live(const rx_packet_t *packet)
+{
+  return packet->held || (packet == rx_newest);
+}
+
+static rx_packet_t *rx_packet(RAIL_RxPacketHandle_t packetHandle)
+{
+  if (packetHandle == RAIL_RX_PACKET_HANDLE_NEWEST) {
+    return rx_newest;
+  }
+  if ((packetHandle == RAIL_RX_PACKET_HANDLE_OLDEST)
+      || (packetHandle == RAIL_RX_PACKET_HANDLE_OLDEST_COMPLETE)) {
+    for (uint16_t i = 0; i < rx_count; i++) {
+      rx_packet_t *packet = &rx_packets[(rx_oldest + i) % RX_PACKETS_MAX];
+
+      if (live(packet)) {
+        return packet;
+      }
+    }
+    return NULL;
+  }
+  for (uint16_t i = 0; i < rx_count; i++) {
+    rx_packet_t *packet = &rx_packets[(rx_oldest + i) % RX_PACKETS_MAX];
+
+    if (((RAIL_RxPacketHandle_t)packet == packetHandle) && live(packet)) {
+      return packet;
+    }
+  }
+  return NULL;
+}
+
+static void rx_reclaim(void)
+{
+  while ((rx_count > 0U) && !live(&rx_packets[rx_oldest])) {
+    rx_fifo_used -= rx_packets[rx_oldest].length;
+    rx_oldest = (rx_oldest + 1U) % RX_PACKETS_MAX;
+    rx_count--;
+  }
+}
+
+static void rx_reset(void)
+{
+  rx_fifo_head = 0U;
+  rx_fifo_used = 0U;
+  rx_oldest = 0U;
+  rx_count = 0U;
+}
+
+static uint16_t rx_copy(uint8_t *dst, const rx_packet_t *packet, uint16_t offset, uint16_t length)
+{
+  for (uint16_t i = 0; i < length; i++) {
+    dst[i] = rx_fifo[(packet->start + offset + i) % rx_fifo_size];
+  }
+  return length;
+}
+
+static void tx_complete(void)
+{
+  tx_active = false;
+  last_tx_length = (tx_fifo_count < TX_PACKET_MAX) ? tx_fifo_count : TX_PACKET_MAX;
+  for (uint16_t i = 0; i < last_tx_length; i++) {
+    last_tx[i] = tx_fifo[(tx_fifo_start + i) % tx_fifo_size];
+  }
+  tx_fifo_start = 0U;
+  tx_fifo_count = 0U;
+  tx_time_sent = now;
+  enter(tx_transitions.success);
+  if (last_tx_length == 0U) {
+    deliver(RAIL_EVENT_TX_UNDERFLOW);
+  } else {
+    fake_rail_stats.tx_sent++;
+    deliver(RAIL_EVENT_TX_PACKET_SENT);
+  }
+}
+
+static void timer_fire(void)
+{
+  const bool was_irq = host_core_irq_context;
+
+  timer_running = false;
+  timer_expired = true;
+  if (timer_callback != NULL) {
+    host_core_irq_context = true;
+    timer_callback(FAKE_RAIL_HANDLE);
+    host_core_irq_context = was_irq;
+  }
+}
+
+/******************************************************************************
+ * Harness interface
+ *****************************************************************************/
+bool fake_rail_inject_rx(const uint8_t *data, uint16_t length, int8_t rssi, bool crc_passed)
+{
+  rx_packet_t *packet;
+
+  TEST_ASSERT(host_core_mask_depth == 0U);
+  TEST_ASSERT(length > 0U);
+  fake_rail_stats.rx_injected++;
+  if ((state & RAIL_RF_STATE_RX) == 0U) {
+    fake_rail_stats.rx_not_receiving++;
+    return false;
+  }
+  if ((rx_count == RX_PACKETS_MAX) || (length > (rx_fifo_size - rx_fifo_used))) {
+    fake_rail_stats.rx_overflow++;
+    enter(rx_transitions.error);
+    deliver(RAIL_EVENT_RX_FIFO_OVERFLOW);
+    return false;
+  }
+
+  packet = &rx_packets[(rx_oldest + rx_count) % RX_PACKETS_MAX];
+  rx_count++;
+  packet->start = rx_fifo_head;
+  packet->length = length;
+  packet->status = crc_passed ? RAIL_RX_PACKET_READY_SUCCESS : RAIL_RX_PACKET_READY_CRC_ERROR;
+  packet->time = now;
+  packet->rssi = rssi;
+  packet->held = false;
+  for (uint16_t i = 0; i < length; i++) {
+    rx_fifo[(rx_fifo_head + i) % rx_fifo_size] = data[i];
+  }
+  rx_fifo_head = (rx_fifo_head + length) % rx_fifo_size;
+  rx_fifo_used += length;
+
+  fake_rail_stats.rx_delivered++;
+  enter(crc_passed ? rx_transitions.success : rx_transitions.error);
+  rx_newest = packet;
+  deliver(RAIL_EVENT_RX_PACKET_RECEIVED);
+  rx_newest = NULL;
+  rx_reclaim();
+  return true;
+}
+
+void fake_rail_raise_events(RAIL_Events_t events)
+{
+  TEST_ASSERT(host_core_mask_depth == 0U);
+  deliver(events);
+}
+
+void fake_rail_advance_time(RAIL_Time_t microseconds)
+{
+  const RAIL_Time_t end = now + microseconds;
+
+  TEST_ASSERT(host_core_mask_depth == 0U);
+  // Callbacks may start a transmit or the timer again, so take what falls due
+  // one at a time
+  for (;;) {
+    bool tx_due = tx_active && due_by(tx_end, end);
+    bool timer_due = timer_running && due_by(timer_time, end);
+
+    if (tx_due && timer_due) {
+      tx_due = due_by(tx_end, timer_time);
+      timer_due = !tx_due;
+    }
+    if (tx_due) {
+      now = tx_end;
+      tx_complete();
+    } else if (timer_due) {
+      if (due_by(now, timer_time)) {
+        now = timer_time;
+      }
+      timer_fire();
+    } else {
+      break;
+    }
+  }
+  now = end;
+}
+
+const uint8_t *fake_rail_last_tx(uint16_t *length)
+{
+  *length = last_tx_length;
+  return last_tx;
+}
+
+/******************************************************************************
+ * Initialization and events
+ *****************************************************************************/
+// The library's own FIFO, when the application does not set one up
+__attribute__((weak)) RAIL_Status_t RAILCb_SetupRxFifo(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Handle_t RAIL_Init(const RAIL_Config_t *railCfg, RAIL_InitCompleteCallbackPtr_t cb)
+{
+  events_callback = railCfg->eventsCallback;
+  if (RAILCb_SetupRxFifo(FAKE_RAIL_HANDLE) != RAIL_STATUS_NO_ERROR) {
+    return NULL;
+  }
+  state = RAIL_RF_STATE_IDLE;
+  if (cb != NULL) {
+    cb(FAKE_RAIL_HANDLE);
+  }
+  return FAKE_RAIL_HANDLE;
+}
+
+RAIL_Status_t RAIL_ConfigEvents(RAIL_Handle_t railHandle, RAIL_Events_t mask, RAIL_Events_t events)
+{
+  (void)railHandle;
+  enabled_events = (enabled_events & ~mask) | (events & mask);
+  return RAIL_STATUS_NO_ERROR;
+}
+
+/******************************************************************************
+ * Time and timer
+ *****************************************************************************/
+RAIL_Time_t RAIL_GetTime(void)
+{
+  return now;
+}
+
+RAIL_Status_t RAIL_SetTime(RAIL_Time_t time)
+{
+  now = time;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+// Busy waits take the time, but anything falling due meanwhile is left to
+// the next time the harness advances the clock
+RAIL_Status_t RAIL_DelayUs(RAIL_Time_t microseconds)
+{
+  now += microseconds;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetTimer(RAIL_Handle_t railHandle, RAIL_Time_t time, RAIL_TimeMode_t mode, RAIL_TimerCallback_t cb)
+{
+  (void)railHandle;
+  if (mode == RAIL_TIME_DELAY) {
+    timer_time = now + time;
+  } else if (mode == RAIL_TIME_ABSOLUTE) {
+    timer_time = time;
+  } else {
+    timer_running = false;
+    return RAIL_STATUS_NO_ERROR;
+  }
+  timer_running = true;
+  timer_expired = false;
+  timer_callback = cb;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Time_t RAIL_GetTimer(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return timer_time;
+}
+
+RAIL_Status_t RAIL_CancelTimer(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  if (!timer_running) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  timer_running = false;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsTimerExpired(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return timer_expired;
+}
+
+bool RAIL_IsTimerRunning(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return timer_running;
+}
+
+/******************************************************************************
+ * Channels and radio state
+ *****************************************************************************/
+uint16_t RAIL_ConfigChannels(RAIL_Handle_t railHandle, const RAIL_ChannelConfig_t *config, RAIL_RadioConfigChangedCallback_t cb)
+{
+  (void)railHandle;
+  (void)cb;
+  channel_config = config;
+  if ((config == NULL) || (config->length == 0U)) {
+    return 0U;
+  }
+  channel = config->configs[0].channelNumberStart;
+  return channel;
+}
+
+RAIL_Status_t RAIL_ConfigChannelsAlt(RAIL_Handle_t railHandle, const RAIL_ChannelConfig_t *config, RAIL_RadioConfigChangedCallback_t cb)
+{
+  (void)RAIL_ConfigChannels(railHandle, config, cb);
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IsValidChannel(RAIL_Handle_t railHandle, uint16_t channel)
+{
+  (void)railHandle;
+  if (channel_config != NULL) {
+    for (uint32_t i = 0; i < channel_config->length; i++) {
+      if ((channel >= channel_config->configs[i].channelNumberStart)
+          && (channel <= channel_config->configs[i].channelNumberEnd)) {
+        return RAIL_STATUS_NO_ERROR;
+      }
+    }
+  }
+  return RAIL_STATUS_INVALID_PARAMETER;
+}
+
+RAIL_Status_t RAIL_PrepareChannel(RAIL_Handle_t railHandle, uint16_t channel_)
+{
+  if (RAIL_IsValidChannel(railHandle, channel_) != RAIL_STATUS_NO_ERROR) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  channel = channel_;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetChannel(RAIL_Handle_t railHandle, uint16_t *channel_)
+{
+  (void)railHandle;
+  if (channel_config == NULL) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  *channel_ = channel;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint32_t RAIL_GetBitRate(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return fake_rail_bit_rate;
+}
+
+RAIL_RadioState_t RAIL_GetRadioState(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return state;
+}
+
+RAIL_RadioStateDetail_t RAIL_GetRadioStateDetail(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  if (state == RAIL_RF_STATE_RX_ACTIVE) {
+    return RAIL_RF_STATE_DETAIL_RX_STATE;
+  }
+  if (state == RAIL_RF_STATE_TX_ACTIVE) {
+    return RAIL_RF_STATE_DETAIL_TX_STATE | RAIL_RF_STATE_DETAIL_ACTIVE;
+  }
+  return RAIL_RF_STATE_DETAIL_IDLE_STATE;
+}
+
+RAIL_Status_t RAIL_SetRxTransitions(RAIL_Handle_t railHandle, const RAIL_StateTransitions_t *transitions)
+{
+  (void)railHandle;
+  rx_transitions = *transitions;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTransitions(RAIL_Handle_t railHandle, RAIL_StateTransitions_t *transitions)
+{
+  (void)railHandle;
+  *transitions = rx_transitions;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetTxTransitions(RAIL_Handle_t railHandle, const RAIL_StateTransitions_t *transitions)
+{
+  (void)railHandle;
+  tx_transitions = *transitions;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxTransitions(RAIL_Handle_t railHandle, RAIL_StateTransitions_t *transitions)
+{
+  (void)railHandle;
+  *transitions = tx_transitions;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+// Aborting a transmit raises no event here, so that no callback runs from
+// within an application call
+RAIL_Status_t RAIL_Idle(RAIL_Handle_t railHandle, RAIL_IdleMode_t mode, bool wait)
+{
+  (void)railHandle;
+  (void)mode;
+  (void)wait;
+  tx_active = false;
+  state = RAIL_RF_STATE_IDLE;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StartRx(RAIL_Handle_t railHandle, uint16_t channel_, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)schedulerInfo;
+  if (RAIL_PrepareChannel(railHandle, channel_) != RAIL_STATUS_NO_ERROR) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  if (!tx_active) {
+    state = RAIL_RF_STATE_RX_ACTIVE;
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+// The receive window is not modelled, the radio listens from the call
+RAIL_Status_t RAIL_ScheduleRx(RAIL_Handle_t railHandle, uint16_t channel_, const RAIL_ScheduleRxConfig_t *cfg, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)cfg;
+  return RAIL_StartRx(railHandle, channel_, schedulerInfo);
+}
+
+/******************************************************************************
+ * Receive FIFO
+ *****************************************************************************/
+RAIL_Status_t RAIL_SetRxFifo(RAIL_Handle_t railHandle, uint8_t *addr, uint16_t *size)
+{
+  (void)railHandle;
+  if (rx_count != 0U) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  if (*size < RX_FIFO_MIN_SIZE) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  rx_fifo = addr;
+  rx_fifo_size = *size;
+  rx_reset();
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ResetFifo(RAIL_Handle_t railHandle, bool txFifo, bool rxFifo)
+{
+  (void)railHandle;
+  if (txFifo) {
+    tx_fifo_start = 0U;
+    tx_fifo_count = 0U;
+  }
+  if (rxFifo) {
+    rx_reset();
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_RxPacketHandle_t RAIL_GetRxPacketInfo(RAIL_Handle_t railHandle, RAIL_RxPacketHandle_t packetHandle, RAIL_RxPacketInfo_t *pPacketInfo)
+{
+  const rx_packet_t *packet = rx_packet(packetHandle);
+  uint16_t to_end;
+
+  (void)railHandle;
+  if (packet == NULL) {
+    return RAIL_RX_PACKET_HANDLE_INVALID;
+  }
+  to_end = rx_fifo_size - packet->start;
+  pPacketInfo->packetStatus = packet->status;
+  pPacketInfo->packetBytes = packet->length;
+  pPacketInfo->firstPortionBytes = (packet->length < to_end) ? packet->length : to_end;
+  pPacketInfo->firstPortionData = &rx_fifo[packet->start];
+  pPacketInfo->lastPortionData = (packet->length > to_end) ? rx_fifo : NULL;
+  pPacketInfo->filterMask = 0U;
+  return (RAIL_RxPacketHandle_t)packet;
+}
+
+RAIL_Status_t RAIL_GetRxPacketDetailsAlt(RAIL_Handle_t railHandle, RAIL_RxPacketHandle_t packetHandle, RAIL_RxPacketDetails_t *pPacketDetails)
+{
+  const rx_packet_t *packet = rx_packet(packetHandle);
+
+  (void)railHandle;
+  if (packet == NULL) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  memset(pPacketDetails, 0, sizeof(*pPacketDetails));
+  pPacketDetails->timeReceived.packetTime = packet->time;
+  pPacketDetails->timeReceived.totalPacketBytes = packet->length;
+  pPacketDetails->timeReceived.timePosition = RAIL_PACKET_TIME_AT_PACKET_END;
+  pPacketDetails->timeReceived.packetDurationUs = airtime(packet->length);
+  pPacketDetails->crcPassed = (packet->status == RAIL_RX_PACKET_READY_SUCCESS);
+  pPacketDetails->rssi = packet->rssi;
+  pPacketDetails->lqi = 255U;
+  pPacketDetails->channel = channel;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxPacketDetails(RAIL_Handle_t railHandle, RAIL_RxPacketHandle_t packetHandle, RAIL_RxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_GetRxPacketDetailsAlt(railHandle, packetHandle, pPacketDetails);
+}
+
+// Only the packet being signalled can be held, like in the library
+RAIL_RxPacketHandle_t RAIL_HoldRxPacket(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  if (rx_newest == NULL) {
+    return RAIL_RX_PACKET_HANDLE_INVALID;
+  }
+  rx_newest->held = true;
+  return (RAIL_RxPacketHandle_t)rx_newest;
+}
+
+RAIL_Status_t RAIL_ReleaseRxPacket(RAIL_Handle_t railHandle, RAIL_RxPacketHandle_t packetHandle)
+{
+  rx_packet_t *packet = rx_packet(packetHandle);
+
+  (void)railHandle;
+  if ((packet == NULL) || !packet->held) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  packet->held = false;
+  rx_reclaim();
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint16_t RAIL_PeekRxPacket(RAIL_Handle_t railHandle, RAIL_RxPacketHandle_t packetHandle, uint8_t *pDst, uint16_t len, uint16_t offset)
+{
+  const rx_packet_t *packet = rx_packet(packetHandle);
+
+  (void)railHandle;
+  if ((packet == NULL) || (offset >= packet->length)) {
+    return 0U;
+  }
+  if (len > (packet->length - offset)) {
+    len = packet->length - offset;
+  }
+  return rx_copy(pDst, packet, offset, len);
+}
+
+/******************************************************************************
+ * Transmit
+ *****************************************************************************/
+uint16_t RAIL_SetTxFifoAlt(RAIL_Handle_t railHandle, uint8_t *addr, uint16_t startOffset, uint16_t initLength, uint16_t size)
+{
+  (void)railHandle;
+  if ((initLength > size) || (startOffset >= size)) {
+    return 0U;
+  }
+  tx_fifo = addr;
+  tx_fifo_size = size;
+  tx_fifo_start = startOffset;
+  tx_fifo_count = initLength;
+  return size;
+}
+
+uint16_t RAIL_SetTxFifo(RAIL_Handle_t railHandle, uint8_t *addr, uint16_t initLength, uint16_t size)
+{
+  return RAIL_SetTxFifoAlt(railHandle, addr, 0U, initLength, size);
+}
+
+uint16_t RAIL_WriteTxFifo(RAIL_Handle_t railHandle, const uint8_t *dataPtr, uint16_t writeLength, bool reset)
+{
+  (void)railHandle;
+  if (tx_fifo == NULL) {
+    return 0U;
+  }
+  if (reset) {
+    tx_fifo_start = 0U;
+    tx_fifo_count = 0U;
+  }
+  if (writeLength > (tx_fifo_size - tx_fifo_count)) {
+    writeLength = tx_fifo_size - tx_fifo_count;
+  }
+  for (uint16_t i = 0; i < writeLength; i++) {
+    tx_fifo[(tx_fifo_start + tx_fifo_count + i) % tx_fifo_size] = dataPtr[i];
+  }
+  tx_fifo_count += writeLength;
+  return writeLength;
+}
+
+uint16_t RAIL_GetTxFifoSpaceAvailable(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return tx_fifo_size - tx_fifo_count;
+}
+
+RAIL_Status_t RAIL_StartTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)options;
+  (void)schedulerInfo;
+  if (tx_active) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  if (RAIL_PrepareChannel(railHandle, channel_) != RAIL_STATUS_NO_ERROR) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  tx_active = true;
+  tx_end = now + airtime(tx_fifo_count);
+  state = RAIL_RF_STATE_TX_ACTIVE;
+  fake_rail_stats.tx_started++;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+// A scheduled transmit goes on the air at its start time, but the radio is
+// taken for it from the call
+RAIL_Status_t RAIL_StartScheduledTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_ScheduleTxConfig_t *config, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  RAIL_Status_t status = RAIL_StartTx(railHandle, channel_, options, schedulerInfo);
+
+  if ((status == RAIL_STATUS_NO_ERROR) && (config != NULL)) {
+    const RAIL_Time_t start = (config->mode == RAIL_TIME_ABSOLUTE) ? config->when : now + config->when;
+
+    if (!due_by(start, now)) {
+      tx_end = start + airtime(tx_fifo_count);
+    }
+  }
+  return status;
+}
+
+// The channel is always clear
+RAIL_Status_t RAIL_StartCcaCsmaTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_CsmaConfig_t *csmaConfig, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)csmaConfig;
+  return RAIL_StartTx(railHandle, channel_, options, schedulerInfo);
+}
+
+RAIL_Status_t RAIL_StartCcaLbtTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_LbtConfig_t *lbtConfig, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)lbtConfig;
+  return RAIL_StartTx(railHandle, channel_, options, schedulerInfo);
+}
+
+RAIL_Status_t RAIL_StartScheduledCcaCsmaTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_ScheduleTxConfig_t *scheduleTxConfig, const RAIL_CsmaConfig_t *csmaConfig, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)csmaConfig;
+  return RAIL_StartScheduledTx(railHandle, channel_, options, scheduleTxConfig, schedulerInfo);
+}
+
+RAIL_Status_t RAIL_StartScheduledCcaLbtTx(RAIL_Handle_t railHandle, uint16_t channel_, RAIL_TxOptions_t options, const RAIL_ScheduleTxConfig_t *scheduleTxConfig, const RAIL_LbtConfig_t *lbtConfig, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  (void)lbtConfig;
+  return RAIL_StartScheduledTx(railHandle, channel_, options, scheduleTxConfig, schedulerInfo);
+}
+
+RAIL_Status_t RAIL_StopTx(RAIL_Handle_t railHandle, RAIL_StopMode_t mode)
+{
+  (void)railHandle;
+  if (tx_active && (mode != RAIL_STOP_MODES_NONE)) {
+    tx_active = false;
+    tx_fifo_count = 0U;
+    enter(tx_transitions.error);
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxPacketDetailsAlt2(RAIL_Handle_t railHandle, RAIL_TxPacketDetails_t *pPacketDetails)
+{
+  (void)railHandle;
+  pPacketDetails->timeSent.packetTime = tx_time_sent;
+  pPacketDetails->timeSent.totalPacketBytes = last_tx_length;
+  pPacketDetails->timeSent.timePosition = RAIL_PACKET_TIME_AT_PACKET_END;
+  pPacketDetails->timeSent.packetDurationUs = airtime(last_tx_length);
+  pPacketDetails->isAck = false;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+/******************************************************************************
+ * Miscellaneous
+ *****************************************************************************/
+uint16_t RAIL_GetRadioEntropy(RAIL_Handle_t railHandle, uint8_t *buffer, uint16_t bytes)
+{
+  (void)railHandle;
+  for (uint16_t i = 0; i < bytes; i++) {
+    buffer[i] = (uint8_t)host_rand(&entropy);
+  }
+  return bytes;
+}
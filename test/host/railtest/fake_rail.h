@@ -0,0 +1,78 @@
+/***************************************************************************//**
+ * @file
+ * @brief Software stand-in for the RAIL library, driven by a host harness.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef FAKE_RAIL_H
+#define FAKE_RAIL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rail.h"
+
+// The stand-in models what the RAILtest packet paths depend on: the event
+// callback, the receive FIFO with held packets, the transmit FIFO, the radio
+// state with its transitions, the RAIL timer and a virtual microsecond clock.
+// Every other RAIL function is inert (fake_rail_defaults.c).
+//
+// Time only moves when the harness advances it, and events are delivered as
+// interrupts from the harness calls below. They must be made outside of
+// atomic and critical sections, like an interrupt that is not masked.
+
+typedef struct {
+  uint32_t rx_injected;       // Packets offered to the radio
+  uint32_t rx_delivered;      // Packets stored and signalled to the application
+  uint32_t rx_overflow;       // Packets lost for lack of receive FIFO space
+  uint32_t rx_not_receiving;  // Packets lost because the radio was not in RX
+  uint32_t tx_started;
+  uint32_t tx_sent;
+  uint32_t events;            // Event callbacks made
+} fake_rail_stats_t;
+
+extern fake_rail_stats_t fake_rail_stats;
+
+// Bit rate used for the packet airtime, and reported by RAIL_GetBitRate()
+extern uint32_t fake_rail_bit_rate;
+
+// Receive a packet now, as if its last byte had just come off the air. Returns
+// false if the packet was lost (see the statistics for the reason).
+bool fake_rail_inject_rx(const uint8_t *data, uint16_t length, int8_t rssi, bool crc_passed);
+
+// Raise events that are not tied to a packet, filtered by the events the
+// application enabled
+void fake_rail_raise_events(RAIL_Events_t events);
+
+// Move the clock forward, completing transmits and firing the timer when
+// they fall due
+void fake_rail_advance_time(RAIL_Time_t microseconds);
+
+// Payload of the last packet that went on the air
+const uint8_t *fake_rail_last_tx(uint16_t *length);
+
+#endif // FAKE_RAIL_H
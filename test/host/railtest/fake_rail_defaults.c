@@ -0,0 +1,1392 @@
+/***************************************************************************//**
+ * @file
+ * @brief Inert RAIL API functions for the host RAILtest build.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "rail.h"
+#include "rail_ble.h"
+#include "rail_ieee802154.h"
+#include "rail_mfm.h"
+#include "rail_sidewalk.h"
+#include "rail_wmbus.h"
+#include "rail_zwave.h"
+
+// The rest of the RAIL API RAILtest links against. Nothing here is modelled:
+// functions succeed without doing anything, and getters return zero, false or
+// NULL and leave their outputs alone. The definitions follow the order of the
+// RAIL headers, so that this file can be regenerated from them when RAILtest
+// starts using more of the API.
+
+volatile int RAIL_AssertLineNumber;
+
+/******************************************************************************
+ * rail.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_GetVersion(RAIL_Version_t *version, bool verbose)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetPtiConfig(RAIL_Handle_t railHandle, RAIL_PtiConfig_t *ptiConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnablePti(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetPtiProtocol(RAIL_Handle_t railHandle, RAIL_PtiProtocol_t protocol)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_PtiProtocol_t RAIL_GetPtiProtocol(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ConfigAntenna(RAIL_Handle_t railHandle, const RAIL_AntennaConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRfPath(RAIL_Handle_t railHandle, RAIL_AntennaSel_t *rfPath)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint16_t RAIL_SetFixedLength(RAIL_Handle_t railHandle, uint16_t length)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_GetChannelMetadata(RAIL_Handle_t railHandle, RAIL_ChannelMetadata_t *channelMetadata, uint16_t *length, uint16_t minChannel, uint16_t maxChannel)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint32_t RAIL_GetSymbolRate(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetPaCTune(RAIL_Handle_t railHandle, uint8_t txPaCtuneValue, uint8_t rxPaCtuneValue)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetSyncWords(RAIL_Handle_t railHandle, RAIL_SyncWordConfig_t *syncWordConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigSyncWords(RAIL_Handle_t railHandle, const RAIL_SyncWordConfig_t *syncWordConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint16_t RAIL_GetWhiteningInitVal(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+uint32_t RAIL_GetCrcInitVal(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetWhiteningInitVal(RAIL_Handle_t railHandle, uint16_t whiteInit)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetCrcInitVal(RAIL_Handle_t railHandle, uint32_t crcInit)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ResetWhiteningInitVal(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ResetCrcInitVal(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_ConfigMultiTimer(bool enable)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_SetMultiTimer(RAIL_MultiTimer_t *tmr, RAIL_Time_t expirationTime, RAIL_TimeMode_t expirationMode, RAIL_MultiTimerCallback_t callback, void *cbArg)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_CancelMultiTimer(RAIL_MultiTimer_t *tmr)
+{
+  return false;
+}
+
+bool RAIL_IsMultiTimerRunning(RAIL_MultiTimer_t *tmr)
+{
+  return false;
+}
+
+bool RAIL_IsMultiTimerExpired(RAIL_MultiTimer_t *tmr)
+{
+  return false;
+}
+
+RAIL_Time_t RAIL_GetMultiTimer(RAIL_MultiTimer_t *tmr, RAIL_TimeMode_t timeMode)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ConfigData(RAIL_Handle_t railHandle, const RAIL_DataConfig_t *dataConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint16_t RAIL_ReadRxFifo(RAIL_Handle_t railHandle, uint8_t *dataPtr, uint16_t readLength)
+{
+  return 0;
+}
+
+uint16_t RAIL_SetTxFifoThreshold(RAIL_Handle_t railHandle, uint16_t txThreshold)
+{
+  return 0;
+}
+
+uint16_t RAIL_SetRxFifoThreshold(RAIL_Handle_t railHandle, uint16_t rxThreshold)
+{
+  return 0;
+}
+
+uint16_t RAIL_GetTxFifoThreshold(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+uint16_t RAIL_GetRxFifoThreshold(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+uint16_t RAIL_GetRxFifoBytesAvailable(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetNextTxRepeat(RAIL_Handle_t railHandle, const RAIL_TxRepeatConfig_t *repeatConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint16_t RAIL_GetTxPacketsRemaining(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetStateTiming(RAIL_Handle_t railHandle, RAIL_StateTiming_t *timings)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableCacheSynthCal(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigTxPower(RAIL_Handle_t railHandle, const RAIL_TxPowerConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxPowerConfig(RAIL_Handle_t railHandle, RAIL_TxPowerConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetTxPower(RAIL_Handle_t railHandle, RAIL_TxPowerLevel_t powerLevel)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_TxPowerLevel_t RAIL_GetTxPower(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_VerifyTxPowerCurves(const struct RAIL_TxPowerCurvesConfigAlt *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetTxPowerDbm(RAIL_Handle_t railHandle, RAIL_TxPower_t power)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_TxPower_t RAIL_GetTxPowerDbm(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+bool RAIL_IsPaAutoModeEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_GetTxTimePreambleStart(RAIL_Handle_t railHandle, uint16_t totalPacketBytes, RAIL_Time_t *pPacketTime)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxTimePreambleStartAlt(RAIL_Handle_t railHandle, RAIL_TxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxTimeSyncWordEndAlt(RAIL_Handle_t railHandle, RAIL_TxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxTimeFrameEndAlt(RAIL_Handle_t railHandle, RAIL_TxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableTxHoldOff(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsTxHoldOffEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_SetTxAltPreambleLength(RAIL_Handle_t railHandle, uint16_t length)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigRxOptions(RAIL_Handle_t railHandle, RAIL_RxOptions_t mask, RAIL_RxOptions_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IncludeFrameTypeLength(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxIncomingPacketInfo(RAIL_Handle_t railHandle, RAIL_RxPacketInfo_t *pPacketInfo)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimePreambleStart(RAIL_Handle_t railHandle, uint16_t totalPacketBytes, RAIL_Time_t *pPacketTime)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimePreambleStartAlt(RAIL_Handle_t railHandle, RAIL_RxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimeSyncWordEnd(RAIL_Handle_t railHandle, uint16_t totalPacketBytes, RAIL_Time_t *pPacketTime)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimeSyncWordEndAlt(RAIL_Handle_t railHandle, RAIL_RxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimeFrameEnd(RAIL_Handle_t railHandle, uint16_t totalPacketBytes, RAIL_Time_t *pPacketTime)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRxTimeFrameEndAlt(RAIL_Handle_t railHandle, RAIL_RxPacketDetails_t *pPacketDetails)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+int16_t RAIL_GetRssi(RAIL_Handle_t railHandle, bool wait)
+{
+  return 0;
+}
+
+int16_t RAIL_GetRssiAlt(RAIL_Handle_t railHandle, RAIL_Time_t waitTimeout)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_StartAverageRssi(RAIL_Handle_t railHandle, uint16_t channel, RAIL_Time_t averagingTimeUs, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsAverageRssiReady(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+int16_t RAIL_GetAverageRssi(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetRssiOffset(RAIL_Handle_t railHandle, int8_t rssiOffset)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+int8_t RAIL_GetRssiOffset(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetRssiDetectThreshold(RAIL_Handle_t railHandle, int8_t rssiThresholdDbm)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+int8_t RAIL_GetRssiDetectThreshold(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+int8_t RAIL_GetRxIncomingPacketRssi(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ConvertLqi(RAIL_Handle_t railHandle, RAIL_ConvertLqiCallback_t cb)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigAddressFilter(RAIL_Handle_t railHandle, const RAIL_AddrConfig_t *addrConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_EnableAddressFilter(RAIL_Handle_t railHandle, bool enable)
+{
+  return false;
+}
+
+bool RAIL_IsAddressFilterEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_SetAddressFilterAddress(RAIL_Handle_t railHandle, uint8_t field, uint8_t index, const uint8_t *value, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetAddressFilterAddressMask(RAIL_Handle_t railHandle, uint8_t field, const uint8_t *bitMask)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableAddressFilterAddress(RAIL_Handle_t railHandle, bool enable, uint8_t field, uint8_t index)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigAutoAck(RAIL_Handle_t railHandle, const RAIL_AutoAckConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsAutoAckEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_WriteAutoAckFifo(RAIL_Handle_t railHandle, const uint8_t *ackData, uint16_t ackDataLen)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetAutoAckFifo(RAIL_Handle_t railHandle, uint8_t **ackBuffer, uint16_t *ackBufferBytes)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_PauseRxAutoAck(RAIL_Handle_t railHandle, bool pause)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsRxAutoAckPaused(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_PauseTxAutoAck(RAIL_Handle_t railHandle, bool pause)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsTxAutoAckPaused(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_UseTxFifoForAutoAck(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_CancelAutoAck(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigCal(RAIL_Handle_t railHandle, RAIL_CalMask_t calEnable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_CalMask_t RAIL_GetPendingCal(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_CalibrateIrAlt(RAIL_Handle_t railHandle, RAIL_IrCalValues_t *imageRejection, RAIL_AntennaSel_t rfPath)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_CalibrateTemp(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_CalibrateHFXO(RAIL_Handle_t railHandle, int8_t *crystalPPMError)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+void RAIL_EnablePaCal(bool enable)
+{
+}
+
+RAIL_Time_t RAIL_StartRfSense(RAIL_Handle_t railHandle, RAIL_RfSenseBand_t band, RAIL_Time_t senseTime, RAIL_RfSense_CallbackPtr_t cb)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ConfigRfSenseSelectiveOokWakeupPhy(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetRfSenseSelectiveOokWakeupPayload(RAIL_Handle_t railHandle, uint8_t numSyncwordBytes, uint32_t syncword)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IsRfSensed(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_ConfigRxChannelHopping(RAIL_Handle_t railHandle, RAIL_RxChannelHoppingConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableRxChannelHopping(RAIL_Handle_t railHandle, bool enable, bool reset)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_TriggerRxChannelHop(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+int16_t RAIL_GetChannelHoppingRssi(RAIL_Handle_t railHandle, uint8_t channelIndex)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ConfigRxDutyCycle(RAIL_Handle_t railHandle, const RAIL_RxDutyCycleConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableRxDutyCycle(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetDefaultRxDutyCycleConfig(RAIL_Handle_t railHandle, RAIL_RxDutyCycleConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Time_t RAIL_GetTransitionTime(void)
+{
+  return 0;
+}
+
+void RAIL_SetTransitionTime(RAIL_Time_t transitionTime)
+{
+}
+
+RAIL_Status_t RAIL_ConfigDirectMode(RAIL_Handle_t railHandle, const RAIL_DirectModeConfig_t *directModeConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_EnableDirectModeAlt(RAIL_Handle_t railHandle, bool enableDirectTx, bool enableDirectRx)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint32_t RAIL_GetRadioClockFreqHz(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetTune(RAIL_Handle_t railHandle, uint32_t tune)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint32_t RAIL_GetTune(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetTuneDelta(RAIL_Handle_t railHandle, int32_t delta)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+int32_t RAIL_GetTuneDelta(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_FrequencyOffset_t RAIL_GetRxFreqOffset(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_SetFreqOffset(RAIL_Handle_t railHandle, RAIL_FrequencyOffset_t freqOffset)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StartTxStream(RAIL_Handle_t railHandle, uint16_t channel, RAIL_StreamMode_t mode)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StartTxStreamAlt(RAIL_Handle_t railHandle, uint16_t channel, RAIL_StreamMode_t mode, RAIL_TxOptions_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StopTxStream(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StopInfinitePreambleTx(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigVerification(RAIL_Handle_t railHandle, RAIL_VerifyConfig_t *configVerify, RAIL_RadioConfig_t radioConfig, RAIL_VerifyCallbackPtr_t cb)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_Verify(RAIL_VerifyConfig_t *configVerify, uint32_t durationUs, bool restart)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigRetimeOptions(RAIL_Handle_t railHandle, RAIL_RetimeOptions_t mask, RAIL_RetimeOptions_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetRetimeOptions(RAIL_Handle_t railHandle, RAIL_RetimeOptions_t *pOptions)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_SetDebugMode(RAIL_Handle_t railHandle, uint32_t debugMode)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint32_t RAIL_GetDebugMode(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_OverrideDebugFrequency(RAIL_Handle_t railHandle, uint32_t freq)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_StartThermistorMeasurement(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetThermistorImpedance(RAIL_Handle_t railHandle, uint32_t *thermistorImpedance)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConvertThermistorImpedance(RAIL_Handle_t railHandle, uint32_t thermistorImpedance, int16_t *thermistorTemperatureC)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ConfigHFXOThermistor(RAIL_Handle_t railHandle, const RAIL_HFXOThermistorConfig_t *pHfxoThermistorConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_Supports2p4GHzBand(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsSubGHzBand(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsDualBand(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsAddrFilterAddressBitMask(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsAlternateTxPower(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsAntennaDiversity(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsAuxAdc(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsChannelHopping(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsDirectMode(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsDualSyncWords(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsTxRepeatStartToStart(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsVdet(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsExternalThermistor(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsHFXOCompensation(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsMfm(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsOFDMPA(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsPrecisionLFRCO(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsRadioEntropy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsRfSenseEnergyDetection(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsRfSenseSelectiveOok(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsRssiDetectThreshold(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsRxRawData(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsSQPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsTxPowerMode(RAIL_Handle_t railHandle, RAIL_TxPowerMode_t powerMode, RAIL_TxPowerLevel_t *pMaxPowerLevel)
+{
+  return false;
+}
+
+bool RAIL_SupportsTxPowerModeAlt(RAIL_Handle_t railHandle, RAIL_TxPowerMode_t *powerMode, RAIL_TxPowerLevel_t *maxPowerLevel, RAIL_TxPowerLevel_t *minPowerLevel)
+{
+  return false;
+}
+
+bool RAIL_SupportsProtocolBLE(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_Supports1MbpsNonViterbi(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_Supports1MbpsViterbi(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_Supports2MbpsNonViterbi(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_Supports2MbpsViterbi(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsAntennaSwitching(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsCodedPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsCte(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsIQSampling(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsPhySwitchToRx(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_BLE_SupportsQuuppa(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsProtocolIEEE802154(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_Supports2MbpsPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsCoexPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsIEEE802154Band2P4(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsThermalProtection(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsRxChannelSwitching(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsCustom1Phy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsCancelFramePendingLookup(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsEarlyFramePendingLookup(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsDualPaConfig(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsEEnhancedAck(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsEMultipurposeFrames(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsESubsetGB868(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsG4ByteCrc(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsGDynFec(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsGModeSwitch(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsGSubsetGB868(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsGUnwhitenedRx(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_IEEE802154_SupportsGUnwhitenedTx(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_SupportsProtocolZWave(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_ZWAVE_SupportsConcPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_ZWAVE_SupportsEnergyDetectPhy(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+bool RAIL_ZWAVE_SupportsRegionPti(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+/******************************************************************************
+ * rail_mfm.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_SetMfmPingPongFifo(RAIL_Handle_t railHandle, const RAIL_MFM_PingPongBufferConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+/******************************************************************************
+ * rail_ble.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_BLE_Init(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_Deinit(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_BLE_IsEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhyQuuppa(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhy1MbpsViterbi(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhy1Mbps(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhy2MbpsViterbi(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhy2Mbps(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhyCoded(RAIL_Handle_t railHandle, RAIL_BLE_Coding_t bleCoding)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigPhySimulscan(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_ConfigChannelRadioParams(RAIL_Handle_t railHandle, uint32_t crcInit, uint32_t accessAddress, uint16_t channel, bool disableWhitening)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_PhySwitchToRx(RAIL_Handle_t railHandle, RAIL_BLE_Phy_t phy, uint16_t railChannel, RAIL_Time_t startRxTime, uint32_t crcInit, uint32_t accessAddress, uint16_t logicalChannel, bool disableWhitening)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_BLE_SetNextTxRepeat(RAIL_Handle_t railHandle, const RAIL_BLE_TxRepeatConfig_t *repeatConfig)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+/******************************************************************************
+ * rail_ieee802154.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_IEEE802154_AcceptFrames(RAIL_Handle_t railHandle, uint8_t framesMask)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Init(RAIL_Handle_t railHandle, const RAIL_IEEE802154_Config_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadio(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioAntDiv(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioAntDivCoex(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioCoex(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioFem(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioAntDivFem(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioCoexFem(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioAntDivCoexFem(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2MbpsRxTimeout(RAIL_Handle_t railHandle, RAIL_Time_t timeout)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2MbpsRxChannel(RAIL_Handle_t railHandle, uint16_t channel)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Config2p4GHzRadioCustom1(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_ConfigGB863MHzRadio(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_ConfigGB915MHzRadio(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_Deinit(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_IEEE802154_IsEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_IEEE802154_PtiRadioConfig_t RAIL_IEEE802154_GetPtiRadioConfig(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetAddresses(RAIL_Handle_t railHandle, const RAIL_IEEE802154_AddrConfig_t *addresses)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetPanId(RAIL_Handle_t railHandle, uint16_t panId, uint8_t index)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetShortAddress(RAIL_Handle_t railHandle, uint16_t shortAddr, uint8_t index)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetLongAddress(RAIL_Handle_t railHandle, const uint8_t *longAddr, uint8_t index)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetPanCoordinator(RAIL_Handle_t railHandle, bool isPanCoordinator)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetPromiscuousMode(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_ConfigEOptions(RAIL_Handle_t railHandle, RAIL_IEEE802154_EOptions_t mask, RAIL_IEEE802154_EOptions_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_ConfigGOptions(RAIL_Handle_t railHandle, RAIL_IEEE802154_GOptions_t mask, RAIL_IEEE802154_GOptions_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_EnableEarlyFramePending(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_EnableDataFramePending(RAIL_Handle_t railHandle, bool enable)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetFramePending(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_GetAddress(RAIL_Handle_t railHandle, RAIL_IEEE802154_Address_t *pAddress)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_WriteEnhAck(RAIL_Handle_t railHandle, const uint8_t *ackData, uint16_t ackDataLen)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_IEEE802154_SetRxToEnhAckTx(RAIL_Handle_t railHandle, RAIL_TransitionTime_t *pRxToEnhAckTx)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+uint8_t RAIL_IEEE802154_ConvertRssiToLqi(uint8_t origLqi, int8_t rssiDbm)
+{
+  return 0;
+}
+
+uint8_t RAIL_IEEE802154_ConvertRssiToEd(int8_t rssiDbm)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_IEEE802154_ConfigCcaMode(RAIL_Handle_t railHandle, RAIL_IEEE802154_CcaMode_t ccaMode)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+/******************************************************************************
+ * rail_zwave.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_ZWAVE_ConfigRegion(RAIL_Handle_t railHandle, const RAIL_ZWAVE_RegionConfig_t *regionCfg)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_PerformIrcal(RAIL_Handle_t railHandle, RAIL_ZWAVE_IrcalVal_t *pIrCalVals, bool forceIrcal)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_Init(RAIL_Handle_t railHandle, const RAIL_ZWAVE_Config_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_Deinit(RAIL_Handle_t railHandle)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_ZWAVE_IsEnabled(RAIL_Handle_t railHandle)
+{
+  return false;
+}
+
+RAIL_Status_t RAIL_ZWAVE_ConfigOptions(RAIL_Handle_t railHandle, RAIL_ZWAVE_Options_t mask, RAIL_ZWAVE_Options_t options)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_SetNodeId(RAIL_Handle_t railHandle, RAIL_ZWAVE_NodeId_t nodeId)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_SetHomeId(RAIL_Handle_t railHandle, RAIL_ZWAVE_HomeId_t homeId, RAIL_ZWAVE_HomeIdHash_t homeIdHash)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_GetBeamNodeId(RAIL_Handle_t railHandle, RAIL_ZWAVE_NodeId_t *pNodeId)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_GetBeamHomeIdHash(RAIL_Handle_t railHandle, RAIL_ZWAVE_HomeIdHash_t *pBeamHomeIdHash)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_GetBeamChannelIndex(RAIL_Handle_t railHandle, uint8_t *pChannelIndex)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_GetLrBeamTxPower(RAIL_Handle_t railHandle, uint8_t *pLrBeamTxPower)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_GetBeamRssi(RAIL_Handle_t railHandle, int8_t *pBeamRssi)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_SetTxLowPower(RAIL_Handle_t railHandle, uint8_t powerLevel)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_SetTxLowPowerDbm(RAIL_Handle_t railHandle, RAIL_TxPower_t powerLevel)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_TxPowerLevel_t RAIL_ZWAVE_GetTxLowPower(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_TxPower_t RAIL_ZWAVE_GetTxLowPowerDbm(RAIL_Handle_t railHandle)
+{
+  return 0;
+}
+
+RAIL_Status_t RAIL_ZWAVE_ReceiveBeam(RAIL_Handle_t railHandle, uint8_t *beamDetectIndex, const RAIL_SchedulerInfo_t *schedulerInfo)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_ConfigRxChannelHopping(RAIL_Handle_t railHandle, RAIL_RxChannelHoppingConfig_t *config)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_ZWAVE_SetLrAckData(RAIL_Handle_t railHandle, const RAIL_ZWAVE_LrAckData_t *pLrAckData)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_EU = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_US = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_ANZ = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_HK = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_MY = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_IN = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_JP = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_RU = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_IL = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_KR = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_CN = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_US_LR1 = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_US_LR2 = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_US_LR3 = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_EU_LR1 = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_EU_LR2 = { 0 };
+
+const RAIL_ZWAVE_RegionConfig_t RAIL_ZWAVE_REGION_EU_LR3 = { 0 };
+
+/******************************************************************************
+ * rail_wmbus.h
+ *****************************************************************************/
+RAIL_Status_t RAIL_WMBUS_Config(RAIL_Handle_t railHandle, bool enableSimultaneousTCRx)
+{
+  return RAIL_STATUS_NO_ERROR;
+}
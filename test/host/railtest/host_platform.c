@@ -0,0 +1,208 @@
+/***************************************************************************//**
+ * @file
+ * @brief Board, emlib and HAL stand-ins for the host RAILtest build.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "em_device.h"
+#include "em_cmu.h"
+#include "em_emu.h"
+#include "em_gpio.h"
+#include "em_rmu.h"
+#include "em_system.h"
+#include "sl_gpio.h"
+#include "hal_common.h"
+#include "app_common.h"
+
+DEVINFO_TypeDef host_devinfo;
+
+/******************************************************************************
+ * Application HAL (app_hal.c): there is no board, only the console
+ *****************************************************************************/
+volatile bool serEvent = false;
+volatile bool buttonWakeEvent = false;
+
+void appHalInit(void)
+{
+}
+
+void PeripheralDisable(void)
+{
+}
+
+void PeripheralEnable(void)
+{
+}
+
+// Busy waits take virtual time
+void usDelay(uint32_t microseconds)
+{
+  (void)RAIL_DelayUs(microseconds);
+}
+
+void serialWaitForTxIdle(void)
+{
+  fflush(stdout);
+}
+
+void updateGraphics(void)
+{
+}
+
+void LedSet(int led)
+{
+  (void)led;
+}
+
+void LedToggle(int led)
+{
+  (void)led;
+}
+
+/******************************************************************************
+ * Debug signal HAL (hal_efr.c): no signal can be routed
+ *****************************************************************************/
+const debugSignal_t *halGetDebugSignals(uint32_t *size)
+{
+  *size = 0U;
+  return NULL;
+}
+
+void halEnablePrs(uint8_t channel, uint8_t loc, sl_gpio_t portPin, uint8_t source, uint8_t signal)
+{
+  (void)channel;
+  (void)loc;
+  (void)portPin;
+  (void)source;
+  (void)signal;
+}
+
+void halDisablePrs(uint8_t channel)
+{
+  (void)channel;
+}
+
+bool halIsPrsChannelFree(uint8_t channel)
+{
+  (void)channel;
+  return true;
+}
+
+/******************************************************************************
+ * Device
+ *****************************************************************************/
+// The process cannot restart itself, so a reset ends the run
+void NVIC_SystemReset(void)
+{
+  fflush(stdout);
+  fprintf(stderr, "NVIC_SystemReset: the simulation cannot reset\n");
+  exit(1);
+}
+
+void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable)
+{
+  (void)clock;
+  (void)enable;
+}
+
+void EMU_EnterEM1(void)
+{
+}
+
+void EMU_EnterEM2(bool restore)
+{
+  (void)restore;
+}
+
+void EMU_EnterEM3(bool restore)
+{
+  (void)restore;
+}
+
+void EMU_EnterEM4(void)
+{
+}
+
+void EMU_UnlatchPinRetention(void)
+{
+}
+
+uint32_t RMU_ResetCauseGet(void)
+{
+  return 0U;
+}
+
+void RMU_ResetCauseClear(void)
+{
+}
+
+void SYSTEM_ChipRevisionGet(SYSTEM_ChipRevision_TypeDef *rev)
+{
+  memset(rev, 0, sizeof(*rev));
+}
+
+void GPIO_ExtIntConfig(GPIO_Port_TypeDef port,
+                       unsigned int pin,
+                       unsigned int intNo,
+                       bool risingEdge,
+                       bool fallingEdge,
+                       bool enable)
+{
+  (void)port;
+  (void)pin;
+  (void)intNo;
+  (void)risingEdge;
+  (void)fallingEdge;
+  (void)enable;
+}
+
+void GPIO_EM4SetPinRetention(bool enable)
+{
+  (void)enable;
+}
+
+void GPIO_IntDisable(uint32_t flags)
+{
+  (void)flags;
+}
+
+void GPIO_IntClear(uint32_t flags)
+{
+  (void)flags;
+}
+
+sl_status_t sl_gpio_set_pin_mode(const sl_gpio_t *gpio, sl_gpio_mode_t mode, bool output_value)
+{
+  (void)gpio;
+  (void)mode;
+  (void)output_value;
+  return SL_STATUS_OK;
+}
@@ -0,0 +1,323 @@
+/***************************************************************************//**
+ * @file
+ * @brief RAILtest firmware run on the host over the RAIL stand-in.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#include "sl_iostream.h"
+#include "sl_iostream_handles.h"
+#include "sl_cli_instances.h"
+#include "sl_rail_util_init.h"
+#include "app_common.h"
+#include "host_test.h"
+#include "fake_rail.h"
+#include "host_railtest.h"
+
+#define INPUT_SIZE          4096U
+#define CAPTURE_SIZE        (64U * 1024U)
+#define LINE_SIZE           4096U
+#define LATENCY_SLOTS       4096U
+
+// Passes without output after which the application is taken to be idle. It
+// covers a transmit or a timer that completes a little later.
+#define SETTLE_QUIET_LOOPS  1000U
+#define SETTLE_MAX_LOOPS    100000U
+
+host_railtest_stats_t host_railtest_stats;
+uint32_t host_railtest_loop_us = 10U;
+FILE *host_railtest_report;
+
+// The CLI instance reads from the recommended console
+sl_iostream_t *sl_iostream_recommended_console_stream;
+
+static char input[INPUT_SIZE];
+static size_t input_head;
+static size_t input_tail;
+
+static bool capture;
+static char captured[CAPTURE_SIZE];
+static size_t captured_len;
+
+static char line[LINE_SIZE];
+static size_t line_len;
+
+static host_railtest_traffic_t traffic;
+static RAIL_Time_t next_rx;
+static RAIL_Time_t next_event;
+static uint32_t rx_sequence;
+static RAIL_Time_t rx_time[LATENCY_SLOTS];
+static uint64_t rx_time_ns[LATENCY_SLOTS];
+// Output is counted as printed when the main loop pass writing it ends
+static RAIL_Time_t pass_end;
+
+/******************************************************************************
+ * Console
+ *****************************************************************************/
+// The sequence number is the start of the payload, " 0x01 0x00 0x00 0x00"
+static bool line_sequence(const char *text, uint32_t *sequence)
+{
+  const char *payload = strstr(text, "{payload:");
+
+  if (payload == NULL) {
+    return false;
+  }
+  payload += strlen("{payload:");
+  *sequence = 0U;
+  for (unsigned int i = 0; i < 4U; i++) {
+    unsigned int byte;
+
+    if (sscanf(payload, " 0x%2x", &byte) != 1) {
+      return false;
+    }
+    *sequence |= (uint32_t)byte << (8U * i);
+    payload += 5;
+  }
+  return true;
+}
+
+static void line_done(void)
+{
+  uint32_t sequence;
+
+  line[line_len] = '\0';
+  line_len = 0;
+  if ((strstr(line, "(rxPacket)") == NULL) || !line_sequence(line, &sequence)) {
+    return;
+  }
+  host_railtest_stats.rx_printed++;
+  if ((rx_sequence - sequence) <= LATENCY_SLOTS) {
+    const uint32_t slot = sequence % LATENCY_SLOTS;
+    const uint32_t latency_us = pass_end - rx_time[slot];
+    const uint64_t latency_ns = host_time_ns() - rx_time_ns[slot];
+
+    host_railtest_stats.latency_us_total += latency_us;
+    host_railtest_stats.latency_ns_total += latency_ns;
+    if (latency_us > host_railtest_stats.latency_us_max) {
+      host_railtest_stats.latency_us_max = latency_us;
+    }
+    if (latency_ns > host_railtest_stats.latency_ns_max) {
+      host_railtest_stats.latency_ns_max = latency_ns;
+    }
+  }
+}
+
+static void console_output(const char *data, size_t length)
+{
+  host_railtest_stats.output_bytes += length;
+  if (capture) {
+    TEST_ASSERT(captured_len + length < sizeof(captured));
+    memcpy(&captured[captured_len], data, length);
+    captured_len += length;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if (data[i] == '\n') {
+      line_done();
+    } else if (line_len < (LINE_SIZE - 1U)) {
+      line[line_len++] = data[i];
+    }
+  }
+}
+
+static sl_status_t console_write(void *context, const void *buffer, size_t length)
+{
+  (void)context;
+  console_output(buffer, length);
+  return SL_STATUS_OK;
+}
+
+static sl_status_t console_read(void *context, void *buffer, size_t length, size_t *bytes_read)
+{
+  size_t count = 0;
+
+  (void)context;
+  while ((count < length) && (input_tail != input_head)) {
+    ((char *)buffer)[count++] = input[input_tail];
+    input_tail = (input_tail + 1U) % INPUT_SIZE;
+  }
+  if (bytes_read != NULL) {
+    *bytes_read = count;
+  }
+  return (count == 0U) ? SL_STATUS_EMPTY : SL_STATUS_OK;
+}
+
+static sl_iostream_t console = {
+  .write = console_write,
+  .read = console_read,
+};
+
+static ssize_t stdout_write(void *cookie, const char *buffer, size_t length)
+{
+  (void)cookie;
+  console_output(buffer, length);
+  return (ssize_t)length;
+}
+
+/******************************************************************************
+ * Traffic
+ *****************************************************************************/
+static bool due_by(RAIL_Time_t time, RAIL_Time_t limit)
+{
+  return (int32_t)(time - limit) <= 0;
+}
+
+static void move_to(RAIL_Time_t time)
+{
+  const RAIL_Time_t now = RAIL_GetTime();
+
+  if (!due_by(time, now)) {
+    fake_rail_advance_time(time - now);
+  }
+}
+
+static void inject(void)
+{
+  uint8_t packet[SL_RAIL_TEST_MAX_PACKET_LENGTH];
+  const uint32_t slot = rx_sequence % LATENCY_SLOTS;
+
+  for (uint16_t i = 0; i < traffic.rx_length; i++) {
+    packet[i] = (i < 4U) ? (uint8_t)(rx_sequence >> (8U * i)) : (uint8_t)(rx_sequence + i);
+  }
+  rx_time[slot] = RAIL_GetTime();
+  rx_time_ns[slot] = host_time_ns();
+  rx_sequence++;
+  host_railtest_stats.rx_injected++;
+  (void)fake_rail_inject_rx(packet, traffic.rx_length, traffic.rx_rssi, true);
+}
+
+static void advance(uint32_t microseconds)
+{
+  const RAIL_Time_t end = RAIL_GetTime() + microseconds;
+
+  for (;;) {
+    bool rx_due = (traffic.rx_interval_us != 0U) && due_by(next_rx, end);
+    bool event_due = (traffic.event_interval_us != 0U) && due_by(next_event, end);
+
+    if (rx_due && event_due) {
+      rx_due = due_by(next_rx, next_event);
+      event_due = !rx_due;
+    }
+    if (rx_due) {
+      move_to(next_rx);
+      inject();
+      next_rx += traffic.rx_interval_us;
+    } else if (event_due) {
+      move_to(next_event);
+      fake_rail_raise_events(traffic.events);
+      next_event += traffic.event_interval_us;
+    } else {
+      break;
+    }
+  }
+  move_to(end);
+}
+
+/******************************************************************************
+ * Main loop
+ *****************************************************************************/
+void host_railtest_init(bool capture_output)
+{
+  cookie_io_functions_t functions = { .write = stdout_write };
+  FILE *file = fopencookie(NULL, "w", functions);
+
+  // stdout is fully buffered, as it is with newlib on target
+  TEST_ASSERT(file != NULL);
+  setvbuf(file, NULL, _IOFBF, 256);
+  host_railtest_report = stdout;
+  stdout = file;
+  capture = capture_output;
+
+  sl_iostream_recommended_console_stream = &console;
+  sl_iostream_set_default(&console);
+  sl_cli_instances_init();
+  sl_rail_util_init();
+  sl_rail_test_internal_app_init();
+}
+
+void host_railtest_set_traffic(const host_railtest_traffic_t *new_traffic)
+{
+  TEST_ASSERT((new_traffic->rx_interval_us == 0U)
+              || ((new_traffic->rx_length >= 4U)
+                  && (new_traffic->rx_length <= SL_RAIL_TEST_MAX_PACKET_LENGTH)));
+  traffic = *new_traffic;
+  next_rx = RAIL_GetTime() + traffic.rx_interval_us;
+  next_event = RAIL_GetTime() + traffic.event_interval_us;
+}
+
+void host_railtest_input(const char *text)
+{
+  for (; *text != '\0'; text++) {
+    TEST_ASSERT(((input_head + 1U) % INPUT_SIZE) != input_tail);
+    input[input_head] = *text;
+    input_head = (input_head + 1U) % INPUT_SIZE;
+  }
+}
+
+void host_railtest_step(void)
+{
+  pass_end = RAIL_GetTime() + host_railtest_loop_us;
+  sl_cli_instances_tick();
+  sl_rail_test_internal_app_process_action();
+  host_railtest_stats.loops++;
+  advance(host_railtest_loop_us);
+}
+
+void host_railtest_settle(void)
+{
+  uint32_t quiet = 0;
+
+  for (uint32_t i = 0; i < SETTLE_MAX_LOOPS; i++) {
+    const uint64_t before = host_railtest_stats.output_bytes;
+
+    host_railtest_step();
+    fflush(stdout);
+    if ((input_tail == input_head) && (host_railtest_stats.output_bytes == before)) {
+      if (++quiet == SETTLE_QUIET_LOOPS) {
+        return;
+      }
+    } else {
+      quiet = 0;
+    }
+  }
+  TEST_ASSERT(false);
+}
+
+size_t host_railtest_take_output(char *buffer, size_t size)
+{
+  size_t length;
+
+  fflush(stdout);
+  length = captured_len;
+  TEST_ASSERT(length < size);
+  memcpy(buffer, captured, length);
+  buffer[length] = '\0';
+  captured_len = 0;
+  return length;
+}
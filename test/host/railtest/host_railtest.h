@@ -0,0 +1,93 @@
+/***************************************************************************//**
+ * @file
+ * @brief RAILtest firmware run on the host over the RAIL stand-in.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef HOST_RAILTEST_H
+#define HOST_RAILTEST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rail_types.h"
+
+// Synthetic radio traffic, injected while the main loop runs. Packets carry
+// their sequence number in the first four bytes (little endian), followed by
+// a counting pattern, so that the printed payload tells which one it was.
+typedef struct {
+  uint32_t rx_interval_us;     // Time between received packets, 0 for none
+  uint16_t rx_length;          // At least 4
+  int8_t rx_rssi;
+  uint32_t event_interval_us;  // Time between extra events, 0 for none
+  RAIL_Events_t events;        // Events raised at that interval
+} host_railtest_traffic_t;
+
+typedef struct {
+  uint32_t loops;
+  uint32_t rx_injected;
+  uint32_t rx_printed;         // rxPacket responses seen on the console
+  uint64_t latency_us_total;   // Virtual time from reception to the end of
+                               // the main loop pass printing it
+  uint32_t latency_us_max;
+  uint64_t latency_ns_total;   // Host time from injection to print
+  uint64_t latency_ns_max;
+  uint64_t output_bytes;
+} host_railtest_stats_t;
+
+extern host_railtest_stats_t host_railtest_stats;
+
+// Virtual time one pass of the main loop takes
+extern uint32_t host_railtest_loop_us;
+
+// The process stdout, as stdout becomes the console once initialized
+extern FILE *host_railtest_report;
+
+// Run the firmware initialization, like sl_system_init() does for the parts
+// that are simulated. When capture is set, console output is kept for
+// host_railtest_take_output().
+void host_railtest_init(bool capture);
+
+void host_railtest_set_traffic(const host_railtest_traffic_t *traffic);
+
+// Type text on the console
+void host_railtest_input(const char *text);
+
+// One pass of the main loop, then the virtual time it took, with the traffic
+// falling due meanwhile
+void host_railtest_step(void);
+
+// Run main loop passes until the console input has been read and the
+// application has nothing left to print
+void host_railtest_settle(void);
+
+// Take the console output captured since the last call, NUL terminated
+size_t host_railtest_take_output(char *buffer, size_t size);
+
+#endif // HOST_RAILTEST_H
@@ -0,0 +1,133 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the device header of the project part (EFR32ZG28).
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Identity of the project part, which selects the RAIL features
+#define _SILICON_LABS_32B_SERIES_2
+#define _SILICON_LABS_32B_SERIES                           2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG_8
+#define _SILICON_LABS_32B_SERIES_2_CONFIG                  8
+#define _SILICON_LABS_GECKO_INTERNAL_SDID                  235
+#define _SILICON_LABS_GECKO_INTERNAL_SDID_235
+#define _SILICON_LABS_EFR32_RADIO_NONE                     0
+#define _SILICON_LABS_EFR32_RADIO_SUBGHZ                   1
+#define _SILICON_LABS_EFR32_RADIO_2G4HZ                    2
+#define _SILICON_LABS_EFR32_RADIO_DUALBAND                 3
+#define _SILICON_LABS_EFR32_RADIO_TYPE                     _SILICON_LABS_EFR32_RADIO_DUALBAND
+#define _SILICON_LABS_EFR32_SUBGHZ_HP_PA_MAX_OUTPUT_DBM    14
+#define _SILICON_LABS_EFR32_SUBGHZ_HP_PA_PRESENT
+#define _SILICON_LABS_EFR32_2G4HZ_MP_PA_MAX_OUTPUT_DBM     10
+#define _SILICON_LABS_EFR32_2G4HZ_MP_PA_PRESENT
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#endif
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+
+typedef int IRQn_Type;
+
+// GPIO ports and pins of the part
+#define GPIO_PA_INDEX                                      0U
+#define GPIO_PA_MASK                                       (0x7FFFUL)
+#define GPIO_PB_INDEX                                      1U
+#define GPIO_PB_MASK                                       (0x003FUL)
+#define GPIO_PC_INDEX                                      2U
+#define GPIO_PC_MASK                                       (0x0FFFUL)
+#define GPIO_PD_INDEX                                      3U
+#define GPIO_PD_MASK                                       (0xFFFFUL)
+#define GPIO_THMSW_EN_PORT                                 GPIO_PC_INDEX
+#define GPIO_THMSW_EN_PIN                                  11U
+
+// PRS signal numbers come from the device headers, which have no registers
+#define PRS_ASYNC_CH_NUM                                   0xCUL
+#include "efr32zg28_prs_signals.h"
+
+// Device information page, filled in by the simulation
+typedef struct {
+  uint32_t PART;
+  uint32_t MODULEINFO;
+  uint32_t MODULENAME0;
+  uint32_t MODULENAME1;
+  uint32_t MODULENAME2;
+  uint32_t MODULENAME3;
+  uint32_t MODULENAME4;
+  uint32_t MODULENAME5;
+  uint32_t MODULENAME6;
+  uint32_t EUI48L;
+  uint32_t EUI48H;
+  uint32_t EUI64L;
+  uint32_t EUI64H;
+} DEVINFO_TypeDef;
+
+extern DEVINFO_TypeDef host_devinfo;
+#define DEVINFO (&host_devinfo)
+#define _DEVINFO_MODULEINFO_MASK 0xFFFFFFFFUL
+
+void NVIC_SystemReset(void);
+
+__STATIC_INLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+
+  for (unsigned int i = 0U; i < 32U; i++) {
+    result = (result << 1) | ((value >> i) & 1U);
+  }
+  return result;
+}
+
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+  (void)irq;
+}
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the emlib GPIO API used by RAILtest.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "em_device.h"
+#include "sl_core.h"
+#include "sl_device_gpio.h"
+#include "sl_hal_gpio.h"
+
+// The device manager defines these too, as em_gpio.h does they are replaced
+#undef gpioPortA
+#undef gpioPortB
+#undef gpioPortC
+#undef gpioPortD
+
+typedef sl_gpio_port_t GPIO_Port_TypeDef;
+#define gpioPortA SL_GPIO_PORT_A
+#define gpioPortB SL_GPIO_PORT_B
+#define gpioPortC SL_GPIO_PORT_C
+#define gpioPortD SL_GPIO_PORT_D
+
+#define _GPIO_PORT_MASK(port) SL_HAL_GPIO_PORT_MASK(port)
+
+// Interrupt configuration is recorded by the simulation, nothing fires
+void GPIO_ExtIntConfig(GPIO_Port_TypeDef port,
+                       unsigned int pin,
+                       unsigned int intNo,
+                       bool risingEdge,
+                       bool fallingEdge,
+                       bool enable);
+void GPIO_EM4SetPinRetention(bool enable);
+uint32_t GPIO_IntGetEnabled(void);
+void GPIO_IntDisable(uint32_t flags);
+void GPIO_IntClear(uint32_t flags);
+
+#endif // EM_GPIO_H
@@ -0,0 +1,44 @@
+/***************************************************************************//**
+ * @file
+ * @brief Component catalog of the RAILtest host simulation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_COMPONENT_CATALOG_H
+#define SL_COMPONENT_CATALOG_H
+
+// Only the components that the simulation provides. Power management,
+// antenna diversity, PTI, RF path and the Bluetooth stack stay out.
+#define SL_CATALOG_APP_ASSERT_PRESENT
+#define SL_CATALOG_CLI_PRESENT
+#define SL_CATALOG_IOSTREAM_PRESENT
+#define SL_CATALOG_IOSTREAM_USART_PRESENT
+#define SL_CATALOG_RAIL_LIB_PRESENT
+#define SL_CATALOG_RAIL_TEST_CORE_PRESENT
+#define SL_CATALOG_RAIL_UTIL_INIT_PRESENT
+
+#endif // SL_COMPONENT_CATALOG_H
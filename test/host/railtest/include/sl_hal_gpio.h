@@ -0,0 +1,63 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the GPIO HAL header included by RAILtest.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_HAL_GPIO_H
+#define SL_HAL_GPIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "em_device.h"
+#include "sl_device_gpio.h"
+
+#define SL_HAL_GPIO_PORT_A_PIN_MASK (GPIO_PA_MASK)
+#define SL_HAL_GPIO_PORT_B_PIN_MASK (GPIO_PB_MASK)
+#define SL_HAL_GPIO_PORT_C_PIN_MASK (GPIO_PC_MASK)
+#define SL_HAL_GPIO_PORT_D_PIN_MASK (GPIO_PD_MASK)
+#define SL_HAL_GPIO_PORT_E_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_F_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_G_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_H_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_I_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_J_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_K_PIN_MASK 0
+#define SL_HAL_GPIO_PORT_MAX        3
+
+#define SL_HAL_GPIO_PORT_MASK(port) (                      \
+    ((int)(port) == 0) ? SL_HAL_GPIO_PORT_A_PIN_MASK       \
+    : ((int)(port) == 1) ? SL_HAL_GPIO_PORT_B_PIN_MASK     \
+    : ((int)(port) == 2) ? SL_HAL_GPIO_PORT_C_PIN_MASK     \
+    : ((int)(port) == 3) ? SL_HAL_GPIO_PORT_D_PIN_MASK : 0UL)
+#define SL_HAL_GPIO_PORT_IS_VALID(port) (SL_HAL_GPIO_PORT_MASK(port) != 0UL)
+#define SL_HAL_GPIO_PORT_PIN_IS_VALID(port, pin) \
+  ((((uint32_t)SL_HAL_GPIO_PORT_MASK(port)) >> (pin)) & 0x1UL)
+
+void sl_hal_gpio_clear_interrupts(uint32_t flags);
+
+#endif // SL_HAL_GPIO_H
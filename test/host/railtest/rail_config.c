@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host channel configuration, mirroring the generated rail_config.c.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "rail_config.h"
+
+// The radio reads its PHY from the register list. The simulation only needs
+// the list to be terminated.
+static const uint32_t Protocol_Configuration_modemConfigBase[] = {
+  0xFFFFFFFFUL,
+};
+
+static RAIL_ChannelConfigEntryAttr_t channelConfigEntryAttr = { 0 };
+
+static const RAIL_ChannelConfigEntry_t Protocol_Configuration_channels[] = {
+  {
+    .phyConfigDeltaAdd = NULL,
+    .baseFrequency = 868000000,
+    .channelSpacing = 1000000,
+    .physicalChannelOffset = 0,
+    .channelNumberStart = 0,
+    .channelNumberEnd = 20,
+    .maxPower = RAIL_TX_POWER_MAX,
+    .attr = &channelConfigEntryAttr,
+    .alternatePhy = NULL,
+  },
+};
+
+static const RAIL_ChannelConfig_t Protocol_Configuration_channelConfig = {
+  .phyConfigBase = Protocol_Configuration_modemConfigBase,
+  .phyConfigDeltaSubtract = NULL,
+  .configs = Protocol_Configuration_channels,
+  .length = 1U,
+  .signature = 0UL,
+  .xtalFrequencyHz = RADIO_CONFIG_XTAL_FREQUENCY,
+};
+
+const RAIL_ChannelConfig_t *channelConfigs[] = {
+  &Protocol_Configuration_channelConfig,
+  NULL
+};
@@ -0,0 +1,120 @@
+/***************************************************************************//**
+ * @file
+ * @brief Drives RAILtest through its console over the simulated radio.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "host_test.h"
+#include "host_railtest.h"
+#include "fake_rail.h"
+#include "app_common.h"
+
+static char output[65536];
+
+static void command(const char *text)
+{
+  host_railtest_input(text);
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+}
+
+// Receive count packets, one per millisecond, and print them all
+static void receive(uint32_t count, uint16_t length)
+{
+  host_railtest_traffic_t traffic = {
+    .rx_interval_us = 1000,
+    .rx_length = length,
+    .rx_rssi = -40,
+  };
+  uint32_t injected = host_railtest_stats.rx_injected;
+
+  host_railtest_set_traffic(&traffic);
+  while (host_railtest_stats.rx_injected - injected < count) {
+    host_railtest_step();
+  }
+  memset(&traffic, 0, sizeof(traffic));
+  host_railtest_set_traffic(&traffic);
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+}
+
+int main(void)
+{
+  uint32_t printed;
+  uint32_t avoided;
+
+  host_railtest_init(true);
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+  TEST_ASSERT(strstr(output, "(reset)") != NULL);
+
+  command("getChannel\n");
+  TEST_ASSERT(strstr(output, "{channel:0}") != NULL);
+
+  // Packets are printed with their payload
+  receive(1, 6);
+  TEST_ASSERT_EQUAL(1, host_railtest_stats.rx_printed);
+  TEST_ASSERT(strstr(output, "(rxPacket)") != NULL);
+  TEST_ASSERT(strstr(output, "{len:6}") != NULL);
+  TEST_ASSERT(strstr(output, "0x00 0x00 0x00 0x00 0x04 0x05") != NULL);
+
+  // Zero copy reception prints from the FIFO
+  command("zeroCopyRx 1\n");
+  printed = host_railtest_stats.rx_printed;
+  avoided = counters.rxCopiesAvoided;
+  receive(10, 20);
+  TEST_ASSERT_EQUAL(printed + 10, host_railtest_stats.rx_printed);
+  TEST_ASSERT_EQUAL(avoided + 10, counters.rxCopiesAvoided);
+
+  // Held packets are only printed once released
+  command("holdRx 1\n");
+  printed = host_railtest_stats.rx_printed;
+  receive(5, 20);
+  TEST_ASSERT_EQUAL(printed, host_railtest_stats.rx_printed);
+  command("holdRx 0\n");
+  TEST_ASSERT_EQUAL(printed + 5, host_railtest_stats.rx_printed);
+
+  // Packets wrapping around a small FIFO are copied instead
+  command("rx 0\n");
+  command("setRxFifo 64\n");
+  command("rx 1\n");
+  printed = host_railtest_stats.rx_printed;
+  avoided = counters.rxCopiesAvoided;
+  receive(10, 20);
+  TEST_ASSERT_EQUAL(printed + 10, host_railtest_stats.rx_printed);
+  TEST_ASSERT(counters.rxCopiesAvoided - avoided < 10);
+  TEST_ASSERT_EQUAL(0, counters.noRxBuffer);
+  TEST_ASSERT_EQUAL(0, fake_rail_stats.rx_overflow);
+
+  command("setTxDelay 1\n");
+  command("tx 3\n");
+  TEST_ASSERT_EQUAL(3, fake_rail_stats.tx_sent);
+  TEST_ASSERT(strstr(output, "{transmitted:3}") != NULL);
+  return 0;
+}
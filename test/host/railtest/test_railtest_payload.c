@@ -0,0 +1,168 @@
+/***************************************************************************//**
+ * @file
+ * @brief Known-answer checks of the RAILtest RX payload encoders.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "host_test.h"
+#include "host_railtest.h"
+#include "fake_rail.h"
+#include "app_common.h"
+
+#define MAX_LENGTH SL_RAIL_TEST_MAX_PACKET_LENGTH
+
+static char output[65536];
+static char expected[65536];
+static uint8_t payload[MAX_LENGTH];
+
+// Straightforward encoders to check printPacket() against
+static size_t referenceEncode(RailPayloadFormat_t format,
+                              const uint8_t *data,
+                              size_t length,
+                              char *text)
+{
+  static const char base64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t used = 0;
+
+  switch (format) {
+    case PAYLOAD_FORMAT_HEX:
+      used += sprintf(&text[used], "{payloadHex:");
+      for (size_t i = 0; i < length; i++) {
+        used += sprintf(&text[used], "%02x", data[i]);
+      }
+      break;
+    case PAYLOAD_FORMAT_BASE64:
+      used += sprintf(&text[used], "{payloadBase64:");
+      for (size_t i = 0; i < length; i += 3) {
+        uint32_t bits = (uint32_t)data[i] << 16;
+        if (i + 1 < length) {
+          bits |= (uint32_t)data[i + 1] << 8;
+        }
+        if (i + 2 < length) {
+          bits |= data[i + 2];
+        }
+        text[used++] = base64[(bits >> 18) & 0x3F];
+        text[used++] = base64[(bits >> 12) & 0x3F];
+        text[used++] = (i + 1 < length) ? base64[(bits >> 6) & 0x3F] : '=';
+        text[used++] = (i + 2 < length) ? base64[bits & 0x3F] : '=';
+      }
+      break;
+    default:
+      used += sprintf(&text[used], "{payload:");
+      for (size_t i = 0; i < length; i++) {
+        used += sprintf(&text[used], " 0x%.2x", data[i]);
+      }
+      break;
+  }
+  text[used++] = '}';
+  text[used] = '\0';
+  return used;
+}
+
+static const char *print(RailPayloadFormat_t format, const uint8_t *data, uint16_t length)
+{
+  rxPayloadFormat = format;
+  printPacket("payloadTest", (uint8_t *)data, length, NULL);
+  host_railtest_take_output(output, sizeof(output));
+  return output;
+}
+
+static void check(RailPayloadFormat_t format, const uint8_t *data, uint16_t length)
+{
+  size_t used = (size_t)sprintf(expected, "{{(payloadTest)}{len:%u}", length);
+
+  if (length > 0U) {
+    used += referenceEncode(format, data, length, &expected[used]);
+  }
+  sprintf(&expected[used], "}\n");
+  TEST_ASSERT(strcmp(print(format, data, length), expected) == 0);
+}
+
+int main(void)
+{
+  // RFC 4648 test vectors, one for each padding length
+  static const struct {
+    const char *text;
+    const char *base64;
+  } vectors[] = {
+    { "f", "Zg==" },
+    { "fo", "Zm8=" },
+    { "foo", "Zm9v" },
+    { "foob", "Zm9vYg==" },
+    { "fooba", "Zm9vYmE=" },
+    { "foobar", "Zm9vYmFy" },
+  };
+  uint32_t state = 0x1234567;
+
+  host_railtest_init(true);
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+    uint16_t length = (uint16_t)strlen(vectors[i].text);
+    sprintf(expected, "{{(payloadTest)}{len:%u}{payloadBase64:%s}}\n", length, vectors[i].base64);
+    TEST_ASSERT(strcmp(print(PAYLOAD_FORMAT_BASE64, (const uint8_t *)vectors[i].text, length),
+                       expected) == 0);
+  }
+  payload[0] = 0x00;
+  payload[1] = 0xA5;
+  payload[2] = 0xFF;
+  TEST_ASSERT(strcmp(print(PAYLOAD_FORMAT_HEX, payload, 3),
+                     "{{(payloadTest)}{len:3}{payloadHex:00a5ff}}\n") == 0);
+  TEST_ASSERT(strcmp(print(PAYLOAD_FORMAT_BYTES, payload, 3),
+                     "{{(payloadTest)}{len:3}{payload: 0x00 0xa5 0xff}}\n") == 0);
+
+  // Every length across several encoding chunks, and the longest packets,
+  // which end with each padding length
+  for (size_t i = 0; i < MAX_LENGTH; i++) {
+    payload[i] = (uint8_t)host_rand(&state);
+  }
+  for (int format = 0; format < PAYLOAD_FORMAT_COUNT; format++) {
+    for (uint16_t length = 0; length <= 300U; length++) {
+      check((RailPayloadFormat_t)format, payload, length);
+    }
+    for (uint16_t length = MAX_LENGTH - 2U; length <= MAX_LENGTH; length++) {
+      check((RailPayloadFormat_t)format, payload, length);
+    }
+  }
+
+  // The format is selected on the console and applies to received packets
+  host_railtest_input("printRxPayloadFormat 2\n");
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+  TEST_ASSERT(strstr(output, "printRxPayloadFormat:Base64") != NULL);
+  TEST_ASSERT(fake_rail_inject_rx((const uint8_t *)"foobar", 6, -40, true));
+  host_railtest_settle();
+  host_railtest_take_output(output, sizeof(output));
+  TEST_ASSERT(strstr(output, "{payloadBase64:Zm9vYmFy}") != NULL);
+
+  rxPayloadFormat = PAYLOAD_FORMAT_BYTES;
+  return 0;
+}
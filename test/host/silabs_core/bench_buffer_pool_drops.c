@@ -0,0 +1,87 @@
+/***************************************************************************//**
+ * @file
+ * @brief Drop rate of the buffer pool under bursts of RAILtest events and packets.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "host_test.h"
+#include "buffer_pool_allocator.h"
+
+#define INVALID_BUFFER_OBJ ((void*)0xFFFFFFFF)
+
+// Size of RailAppEvent_t on target, which leads every event and packet buffer
+#define APP_EVENT_SIZE 44U
+#define MAX_PENDING    64U
+
+// Buffers handed to the main loop, in the order they were queued
+static void *pending[MAX_PENDING];
+static uint32_t pendingHead;
+static uint32_t pendingCount;
+
+// Every tick an "interrupt" may queue a burst of 1 to 8 events and received
+// packets, and the main loop processes and frees one of them. The pool only
+// runs out during bursts, which is when small events used to take the buffers
+// needed by received packets.
+int main(int argc, char *argv[])
+{
+  uint32_t ticks = (uint32_t)host_arg(argc, argv, 1, 1000000);
+  uint32_t state = 0x2545F491;
+  uint32_t requested[2] = { 0, 0 };
+  uint32_t dropped[2] = { 0, 0 };
+
+  for (uint32_t t = 0; t < ticks; t++) {
+    if ((host_rand(&state) % 8U) == 0U) {
+      uint32_t burst = 1U + (host_rand(&state) % 8U);
+      for (uint32_t i = 0; i < burst; i++) {
+        uint32_t r = host_rand(&state);
+        uint32_t isPacket = r & 1U;
+        uint32_t size = APP_EVENT_SIZE + (isPacket ? (10U + ((r >> 8) % 191U)) : 0U);
+        void *handle = memoryAllocate(size);
+        requested[isPacket]++;
+        if ((handle == INVALID_BUFFER_OBJ) || (pendingCount == MAX_PENDING)) {
+          dropped[isPacket]++;
+          memoryFree(handle);
+          continue;
+        }
+        pending[(pendingHead + pendingCount) % MAX_PENDING] = handle;
+        pendingCount++;
+      }
+    }
+    if (pendingCount > 0U) {
+      memoryFree(pending[pendingHead]);
+      pendingHead = (pendingHead + 1U) % MAX_PENDING;
+      pendingCount--;
+    }
+  }
+
+  TEST_ASSERT(requested[0] > 0U && requested[1] > 0U);
+  printf("%u ticks: events dropped %u/%u (%.2f%%), packets dropped %u/%u (%.2f%%)\n",
+         ticks,
+         dropped[0], requested[0], (100.0 * dropped[0]) / requested[0],
+         dropped[1], requested[1], (100.0 * dropped[1]) / requested[1]);
+  return 0;
+}
@@ -0,0 +1,95 @@
+/***************************************************************************//**
+ * @file
+ * @brief Time to print RAILtest responses with and without the fast formatter.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "response_print_host.h"
+#include "railtest_responses.h"
+
+DEFINE_RAILTEST_RESPONSES()
+DEFINE_RAILTEST_RESPONSES(nofast_)
+DEFINE_RAILTEST_RESPONSES(ref_)
+
+#define ROUNDS 5U
+
+static void best(uint64_t *bestNs, uint64_t ns)
+{
+  if (ns < *bestNs) {
+    *bestNs = ns;
+  }
+}
+
+// Time each build of one response type over several rounds, interleaving
+// the builds and keeping the best round of each, so that warm-up and noise
+// do not favour one of them
+static void bench_type(uint32_t type, uint32_t count)
+{
+  const RailtestResponseType_t *builds[] = {
+    &railtestResponses[type], &nofast_railtestResponses[type], &ref_railtestResponses[type]
+  };
+  uint64_t bestNs[3] = { UINT64_MAX, UINT64_MAX, UINT64_MAX };
+  static char first[2][1024];
+  size_t length[2];
+  uint64_t start;
+
+  // The builds must print the same text
+  capture.discard = false;
+  railtestResponses[type].print(1U);
+  length[0] = capture_take(first[0], sizeof(first[0]));
+  ref_railtestResponses[type].print(1U);
+  length[1] = capture_take(first[1], sizeof(first[1]));
+  TEST_ASSERT((length[0] == length[1]) && (memcmp(first[0], first[1], length[0]) == 0));
+
+  capture.discard = true;
+  for (uint32_t round = 0; round < ROUNDS; round++) {
+    for (uint32_t build = 0; build < 3U; build++) {
+      start = host_time_ns();
+      for (uint32_t i = 0; i < count; i++) {
+        builds[build]->print(i);
+      }
+      fflush(stdout);
+      best(&bestNs[build], host_time_ns() - start);
+    }
+  }
+
+  fprintf(stderr, "%u %s responses, ns per response: fast format %.0f, "
+          "staged vsnprintf %.0f, unstaged vprintf %.0f\n",
+          count, railtestResponses[type].name, (double)bestNs[0] / count,
+          (double)bestNs[1] / count, (double)bestNs[2] / count);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t count = (uint32_t)host_arg(argc, argv, 1, 100000);
+
+  capture_start();
+  for (uint32_t type = 0; type < RAILTEST_RESPONSE_TYPES; type++) {
+    bench_type(type, count);
+  }
+  return 0;
+}
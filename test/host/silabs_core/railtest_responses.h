@@ -0,0 +1,170 @@
+/***************************************************************************//**
+ * @file
+ * @brief The responses RAILtest prints most often, for any build of response_print.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef RAILTEST_RESPONSES_H
+#define RAILTEST_RESPONSES_H
+
+#include <stdint.h>
+
+// The format strings and argument types are copied from RAILtest:
+// printPacket() and printRailAppEvents() in app_main.c and
+// railtest_helpers.c, sendPacketIfPending() and finishTxSequenceIfPending()
+// in app_main.c, and getStatus() in app_ci/info_ci.c. The values vary with i.
+// DEFINE_RAILTEST_RESPONSES(prefix) defines them for the build whose
+// functions carry that prefix.
+
+typedef void (*RailtestResponse_t)(uint32_t i);
+
+typedef struct {
+  const char *name;
+  RailtestResponse_t print;
+} RailtestResponseType_t;
+
+#define RAILTEST_RESPONSE_TYPES 5U
+
+#define DEFINE_RAILTEST_RESPONSES(prefix)                                                   \
+  static void prefix##printRxPacket(uint32_t i)                                             \
+  {                                                                                         \
+    prefix##responsePrintStart("rxPacket");                                                 \
+    prefix##responsePrintContinue(                                                          \
+      "len:%d,timeUs:%u,timePos:%u,durationUs:%u,crc:%s,filterMask:0x%x,rssi:%d,lqi:%d,phy:%d", \
+      20 + (int)(i & 0x7F), 1000000U + i * 977U, 3U, 640U + (i & 0xFFU),                   \
+      (i & 1U) ? "Pass" : "Fail", 1U, -40 - (int)(i & 0x3F), 255 - (int)(i & 0x1F), 0);     \
+    prefix##responsePrintContinue(                                                          \
+      "isAck:%s,syncWordId:%d,antenna:%d,channelHopIdx:%d,channel:%u",                      \
+      "False", 0, 0, 254, i & 0xFU);                                                        \
+    prefix##responsePrintEnd("}");                                                          \
+  }                                                                                         \
+                                                                                            \
+  static void prefix##printEvent(uint32_t i)                                                \
+  {                                                                                         \
+    static char *eventNames[] = { "RX_PACKET_RECEIVED", "TX_PACKET_SENT",                   \
+                                  "RX_FIFO_ALMOST_FULL", "CAL_NEEDED" };                    \
+    prefix##responsePrint("event",                                                          \
+                          "timestamp:%u,eventName:RAIL_EVENT_%s",                           \
+                          2000000U + i * 1291U, eventNames[i & 3U]);                        \
+  }                                                                                         \
+                                                                                            \
+  static void prefix##printTxPacketError(uint32_t i)                                        \
+  {                                                                                         \
+    uint64_t status = (uint64_t)1U << (i & 63U);                                            \
+    prefix##responsePrint("txPacket",                                                       \
+                          "txStatus:Error,"                                                 \
+                          "errorReason:Tx underflow,"                                       \
+                          "errorCode:0x%x%08x",                                             \
+                          (uint32_t)(status >> 32),                                         \
+                          (uint32_t)(status));                                              \
+  }                                                                                         \
+                                                                                            \
+  static void prefix##printTxEnd(uint32_t i)                                                \
+  {                                                                                         \
+    uint64_t status = (uint64_t)(i & 0x3U) << 33;                                           \
+    uint32_t failPackets = i & 1U;                                                          \
+    uint32_t sentPackets = 1U + (i & 0xFFU);                                                \
+    prefix##responsePrint("txEnd",                                                          \
+                          "txStatus:%s,"                                                    \
+                          "transmitted:%u,"                                                 \
+                          "lastTxTime:%u,"                                                  \
+                          "timePos:%u,"                                                     \
+                          "durationUs:%u,"                                                  \
+                          "lastTxStart:%u,"                                                 \
+                          "ccaSuccess:%u,"                                                  \
+                          "failed:%u,"                                                      \
+                          "lastTxStatus:0x%x%08x,"                                          \
+                          "txRemain:%d,"                                                    \
+                          "isAck:False",                                                    \
+                          (failPackets == 0                                                 \
+                           ? "Complete"                                                     \
+                           : (sentPackets == 0 ? "Error" : "Partial")),                     \
+                          sentPackets, 3000000U + i * 1543U, 5U, 1240U + (i & 0x3FU),       \
+                          2999000U + i * 1543U, i & 0x7U, failPackets,                      \
+                          (uint32_t)(status >> 32), (uint32_t)(status), 0);                 \
+  }                                                                                         \
+                                                                                            \
+  static void prefix##printStatus(uint32_t i)                                               \
+  {                                                                                         \
+    prefix##responsePrintStart("status");                                                   \
+    prefix##responsePrintContinue("UserTxCount:%u,"                                         \
+                                  "AckTxCount:%u,"                                          \
+                                  "UserTxAborted:%u,"                                       \
+                                  "AckTxAborted:%u,"                                        \
+                                  "UserTxBlocked:%u,"                                       \
+                                  "AckTxBlocked:%u,"                                        \
+                                  "UserTxUnderflow:%u,"                                     \
+                                  "AckTxUnderflow:%u,"                                      \
+                                  "RxCount:%u,"                                             \
+                                  "RxCrcErrDrop:%u,"                                        \
+                                  "SyncDetect:%u,"                                          \
+                                  "SyncDetect1:%u,"                                         \
+                                  "SyncDetect2:%u,"                                         \
+                                  "NoRxBuffer:%u,"                                          \
+                                  "RxCopiesAvoided:%u",                                     \
+                                  i, 0U, i >> 4, 0U, i >> 6, 0U, i >> 8, 0U, i * 3U,        \
+                                  i >> 3, i * 3U + 5U, i, i * 2U, i >> 5, i * 2U);          \
+    prefix##responsePrintContinue("TxRemainErrs:%u,"                                        \
+                                  "RfSensed:%u,"                                            \
+                                  "ackTimeout:%u,"                                          \
+                                  "ackTxFpSet:%u,"                                          \
+                                  "ackTxFpFail:%u,"                                         \
+                                  "ackTxFpAddrFail:%u",                                     \
+                                  0U, 0U, i >> 7, 0U, 0U, 0U);                              \
+    prefix##responsePrintContinue("RfState:%s", (i & 1U) ? "Rx" : "Idle");                  \
+    prefix##responsePrintContinue("Channel:%u,"                                             \
+                                  "AppMode:%s,"                                             \
+                                  "TimingLost:%u,"                                          \
+                                  "TimingDetect:%u,"                                        \
+                                  "FrameErrors:%u,"                                         \
+                                  "RxFifoFull:%u,"                                          \
+                                  "RxOverflow:%u,"                                          \
+                                  "AddrFilt:%u,"                                            \
+                                  "Aborted:%u,"                                             \
+                                  "RxBeams:%u,"                                             \
+                                  "DataRequests:%u",                                        \
+                                  i & 0xFU, "None", i >> 9, i * 3U, i >> 4, 0U, i >> 10,    \
+                                  0U, i >> 6, 0U, 0U);                                      \
+    prefix##responsePrintEnd("Calibrations:%u,"                                             \
+                             "TxChannelBusy:%u,"                                            \
+                             "TxClear:%u,"                                                  \
+                             "TxCca:%u,"                                                    \
+                             "TxRetry:%u,"                                                  \
+                             "UserTxStarted:%u,"                                            \
+                             "PaProtect:%u",                                                \
+                             i >> 2, i >> 5, i, i, i >> 8, i, 0U);                          \
+  }                                                                                         \
+                                                                                            \
+  static const RailtestResponseType_t prefix##railtestResponses[RAILTEST_RESPONSE_TYPES] = { \
+    { "rxPacket", prefix##printRxPacket },                                                  \
+    { "event", prefix##printEvent },                                                        \
+    { "txPacket", prefix##printTxPacketError },                                             \
+    { "txEnd", prefix##printTxEnd },                                                        \
+    { "status", prefix##printStatus },                                                      \
+  };
+
+#endif // RAILTEST_RESPONSES_H
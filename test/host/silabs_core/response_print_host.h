@@ -0,0 +1,124 @@
+/***************************************************************************//**
+ * @file
+ * @brief Output capture shared by the response print harnesses.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef RESPONSE_PRINT_HOST_H
+#define RESPONSE_PRINT_HOST_H
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "response_print.h"
+#include "sl_iostream.h"
+
+// Build of response_print.c without the staging buffer
+bool ref_responsePrintHeader(char *command, char *formatString, ...);
+bool ref_responsePrintMulti(char *formatString, ...);
+bool ref_responsePrint(char *command, char *formatString, ...);
+bool ref_responsePrintStart(char *command);
+bool ref_responsePrintContinue(char *formatString, ...);
+bool ref_responsePrintEnd(char *formatString, ...);
+bool ref_responsePrintError(char *command, uint8_t code, char *formatString, ...);
+
+// Build of response_print.c with the staging buffer but no fast formatter
+bool nofast_responsePrint(char *command, char *formatString, ...);
+bool nofast_responsePrintStart(char *command);
+bool nofast_responsePrintContinue(char *formatString, ...);
+bool nofast_responsePrintEnd(char *formatString, ...);
+void nofast_responsePrintFlush(void);
+
+// Everything written to stdout or the default iostream, in order
+typedef struct {
+  char data[16384];
+  size_t len;
+  size_t streamWrites;    // Writes to the default iostream
+  bool discard;
+} capture_t;
+
+static capture_t capture;
+
+static void capture_append(const void *buffer, size_t length)
+{
+  if (capture.discard) {
+    return;
+  }
+  TEST_ASSERT(capture.len + length <= sizeof(capture.data));
+  memcpy(&capture.data[capture.len], buffer, length);
+  capture.len += length;
+}
+
+static sl_status_t capture_stream_write(void *context, const void *buffer, size_t length)
+{
+  (void)context;
+  capture.streamWrites++;
+  capture_append(buffer, length);
+  return SL_STATUS_OK;
+}
+
+static ssize_t capture_stdout_write(void *cookie, const char *buffer, size_t length)
+{
+  (void)cookie;
+  capture_append(buffer, length);
+  return (ssize_t)length;
+}
+
+static sl_iostream_t capture_stream = { .write = capture_stream_write };
+
+// Send stdout and the default iostream to the capture buffer. stdout is fully
+// buffered, as it is with newlib on target.
+static void capture_start(void)
+{
+  cookie_io_functions_t functions = { .write = capture_stdout_write };
+  FILE *file = fopencookie(NULL, "w", functions);
+
+  TEST_ASSERT(file != NULL);
+  setvbuf(file, NULL, _IOFBF, 256);
+  stdout = file;
+  sl_iostream_set_default(&capture_stream);
+}
+
+// Take what was written since the last call. A response that failed is left
+// in the staging buffer until the next flush, so flush it here.
+static size_t capture_take(char *buffer, size_t size)
+{
+  size_t length;
+
+  responsePrintFlush();
+  nofast_responsePrintFlush();
+  fflush(stdout);
+  length = capture.len;
+  TEST_ASSERT(length <= size);
+  memcpy(buffer, capture.data, length);
+  capture.len = 0;
+  return length;
+}
+
+#endif // RESPONSE_PRINT_HOST_H
@@ -0,0 +1,173 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks the buffer pool allocator size classes, free lists and reference counts.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "host_test.h"
+#include "host_core.h"
+#include "buffer_pool_allocator.h"
+#include "buffer_pool_allocator_config.h"
+
+#define INVALID_BUFFER_OBJ ((void*)0xFFFFFFFF)
+#define LARGE_COUNT  BUFFER_POOL_ALLOCATOR_POOL_SIZE
+#define SMALL_COUNT  BUFFER_POOL_ALLOCATOR_SMALL_POOL_SIZE
+#define TOTAL_COUNT  (LARGE_COUNT + SMALL_COUNT)
+
+static uint32_t handle_index(void *handle)
+{
+  return (uint32_t)(uintptr_t)handle;
+}
+
+static bool is_small(void *handle)
+{
+  return handle_index(handle) >= LARGE_COUNT;
+}
+
+// Model of each handle: reference count, buffer size and fill pattern
+static uint32_t model_refs[TOTAL_COUNT];
+static uint32_t model_size[TOTAL_COUNT];
+static uint8_t model_fill[TOTAL_COUNT];
+
+static void check_buffers(void)
+{
+  for (uint32_t i = 0; i < TOTAL_COUNT; i++) {
+    uint8_t *ptr = memoryPtrFromHandle((void *)(uintptr_t)i);
+    TEST_ASSERT((ptr != NULL) == (model_refs[i] > 0));
+    for (uint32_t j = 0; (ptr != NULL) && (j < model_size[i]); j++) {
+      TEST_ASSERT_EQUAL(model_fill[i], ptr[j]);
+    }
+  }
+}
+
+int main(void)
+{
+  void *handles[TOTAL_COUNT];
+  uint32_t state = 0x12345678;
+
+  // Oversized requests fail
+  TEST_ASSERT(memoryAllocate(BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX + 1) == INVALID_BUFFER_OBJ);
+
+  // Small requests use small buffers first, then fall back to large ones
+  for (int i = 0; i < TOTAL_COUNT; i++) {
+    handles[i] = memoryAllocate(BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE);
+    TEST_ASSERT(handles[i] != INVALID_BUFFER_OBJ);
+    TEST_ASSERT(is_small(handles[i]) == (i < SMALL_COUNT));
+    TEST_ASSERT(((uintptr_t)memoryPtrFromHandle(handles[i]) % sizeof(uint32_t)) == 0);
+  }
+  TEST_ASSERT(memoryAllocate(1) == INVALID_BUFFER_OBJ);
+  for (int i = 0; i < TOTAL_COUNT; i++) {
+    for (int j = 0; j < i; j++) {
+      TEST_ASSERT(handles[i] != handles[j]);
+    }
+    memoryFree(handles[i]);
+  }
+
+  // Large requests never take small buffers
+  for (int i = 0; i < LARGE_COUNT; i++) {
+    handles[i] = memoryAllocate(BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE + 1);
+    TEST_ASSERT(!is_small(handles[i]));
+  }
+  TEST_ASSERT(memoryAllocate(BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE + 1) == INVALID_BUFFER_OBJ);
+  TEST_ASSERT(is_small(memoryAllocate(1)));
+
+  // A buffer stays allocated until its last reference is freed
+  memoryTakeReference(handles[0]);
+  memoryFree(handles[0]);
+  TEST_ASSERT(memoryPtrFromHandle(handles[0]) != NULL);
+  memoryFree(handles[0]);
+  TEST_ASSERT(memoryPtrFromHandle(handles[0]) == NULL);
+  // Freeing again or freeing invalid handles has no effect
+  memoryFree(handles[0]);
+  memoryFree(INVALID_BUFFER_OBJ);
+  memoryFree((void *)(uintptr_t)TOTAL_COUNT);
+  TEST_ASSERT(memoryPtrFromHandle(INVALID_BUFFER_OBJ) == NULL);
+  TEST_ASSERT(memoryAllocate(BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE + 1) == handles[0]);
+
+  // Release everything, then run random operations against the model. Each
+  // buffer is filled with a pattern that must survive the other operations.
+  for (uint32_t i = 0; i < TOTAL_COUNT; i++) {
+    while (memoryPtrFromHandle((void *)(uintptr_t)i) != NULL) {
+      memoryFree((void *)(uintptr_t)i);
+    }
+  }
+  for (int op = 0; op < 200000; op++) {
+    uint32_t r = host_rand(&state);
+    uint32_t i = (r >> 8) % TOTAL_COUNT;
+    switch (r % 4) {
+      case 0:
+      case 1: {
+        uint32_t size = (r >> 16) % (BUFFER_POOL_ALLOCATOR_BUFFER_SIZE_MAX + 1);
+        void *handle = memoryAllocate(size);
+        bool small_free = false;
+        bool large_free = false;
+        for (uint32_t k = 0; k < TOTAL_COUNT; k++) {
+          if (model_refs[k] == 0) {
+            small_free |= (k >= LARGE_COUNT);
+            large_free |= (k < LARGE_COUNT);
+          }
+        }
+        bool fits_small = size <= BUFFER_POOL_ALLOCATOR_SMALL_BUFFER_SIZE;
+        if (handle == INVALID_BUFFER_OBJ) {
+          TEST_ASSERT(!large_free && !(fits_small && small_free));
+        } else {
+          uint32_t k = handle_index(handle);
+          TEST_ASSERT(k < TOTAL_COUNT);
+          TEST_ASSERT_EQUAL(0, model_refs[k]);
+          TEST_ASSERT(is_small(handle) == (fits_small && small_free));
+          model_refs[k] = 1;
+          model_size[k] = size;
+          model_fill[k] = (uint8_t)(r >> 24);
+          memset(memoryPtrFromHandle(handle), model_fill[k], size);
+        }
+        break;
+      }
+      case 2:
+        memoryTakeReference((void *)(uintptr_t)i);
+        if (model_refs[i] > 0) {
+          model_refs[i]++;
+        }
+        break;
+      default:
+        memoryFree((void *)(uintptr_t)i);
+        if (model_refs[i] > 0) {
+          model_refs[i]--;
+        }
+        break;
+    }
+    if ((op % 64) == 0) {
+      check_buffers();
+    }
+    TEST_ASSERT_EQUAL(0, host_core_mask_depth);
+  }
+  check_buffers();
+
+  printf("%d large and %d small buffers checked\n", LARGE_COUNT, SMALL_COUNT);
+  return 0;
+}
@@ -0,0 +1,199 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks circular queue wrap-around and overflow handling against a model.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "host_test.h"
+#include "host_core.h"
+#include "circular_queue.h"
+
+static uint32_t overflowCalls;
+static void *overflowItem;
+static bool overflowResult;
+
+static bool onOverflow(const Queue_t *queue, void *data)
+{
+  (void)queue;
+  overflowCalls++;
+  overflowItem = data;
+  return overflowResult;
+}
+
+static uint32_t spscOverflowCalls;
+static void *spscOverflowItem;
+
+static bool onSpscOverflow(const SpscQueue_t *queue, void *data)
+{
+  (void)queue;
+  spscOverflowCalls++;
+  spscOverflowItem = data;
+  return overflowResult;
+}
+
+static void *item(uint32_t value)
+{
+  return (void *)(uintptr_t)value;
+}
+
+int main(void)
+{
+  Queue_t queue;
+  SpscQueue_t spsc;
+  // Model of the queue contents, oldest first
+  uint32_t model[CIRCULAR_QUEUE_LEN_MAX];
+  uint32_t modelCount = 0;
+  uint32_t next = 1;
+  uint32_t state = 0x9E3779B9;
+
+  TEST_ASSERT(!queueInit(&queue, CIRCULAR_QUEUE_LEN_MAX + 1));
+  TEST_ASSERT(!queueInit(NULL, 1));
+  TEST_ASSERT(queueInit(&queue, 3));
+  TEST_ASSERT(queueIsEmpty(&queue));
+  TEST_ASSERT(queuePeek(&queue) == NULL);
+  TEST_ASSERT(queueRemove(&queue) == NULL);
+
+  // Without a callback a full queue replaces its oldest item
+  for (uint32_t i = 1; i <= 4; i++) {
+    TEST_ASSERT(queueAdd(&queue, item(i)));
+  }
+  TEST_ASSERT(queueIsFull(&queue));
+  TEST_ASSERT(queueRemove(&queue) == item(2));
+
+  // The callback sees the oldest item and decides whether it is replaced
+  TEST_ASSERT(queueOverflow(&queue, onOverflow));
+  TEST_ASSERT(queueAdd(&queue, item(5)));
+  overflowResult = false;
+  TEST_ASSERT(!queueAdd(&queue, item(6)));
+  TEST_ASSERT_EQUAL(1, overflowCalls);
+  TEST_ASSERT(overflowItem == item(3));
+  overflowResult = true;
+  TEST_ASSERT(queueAdd(&queue, item(7)));
+  TEST_ASSERT_EQUAL(2, overflowCalls);
+  TEST_ASSERT(overflowItem == item(3));
+  TEST_ASSERT(queueRemove(&queue) == item(4));
+  TEST_ASSERT(queueRemove(&queue) == item(5));
+  TEST_ASSERT(queuePeek(&queue) == item(7));
+  TEST_ASSERT(queueRemove(&queue) == item(7));
+  TEST_ASSERT(queueIsEmpty(&queue));
+
+  // The single-producer/single-consumer queue takes power of two sizes only
+  TEST_ASSERT(!spscQueueInit(&spsc, 0));
+  TEST_ASSERT(!spscQueueInit(&spsc, 3));
+  TEST_ASSERT(!spscQueueInit(&spsc, CIRCULAR_QUEUE_LEN_MAX * 2));
+  TEST_ASSERT(!spscQueueInit(NULL, 1));
+  TEST_ASSERT(spscQueueInit(&spsc, 4));
+  TEST_ASSERT(spscQueueIsEmpty(&spsc));
+  TEST_ASSERT(spscQueuePeek(&spsc) == NULL);
+  TEST_ASSERT(spscQueueRemove(&spsc) == NULL);
+
+  // Its indices wrap at 2^31
+  atomic_store(&spsc.head, 0xFFFFFFFCUL);
+  atomic_store(&spsc.tail, 0x7FFFFFFEUL);
+  for (uint32_t i = 1; i <= 6; i++) {
+    TEST_ASSERT(spscQueueAdd(&spsc, item(i)));
+  }
+  TEST_ASSERT(spscQueueIsFull(&spsc));
+  for (uint32_t i = 3; i <= 6; i++) {
+    TEST_ASSERT(spscQueuePeek(&spsc) == item(i));
+    TEST_ASSERT(spscQueueRemove(&spsc) == item(i));
+  }
+  TEST_ASSERT(spscQueueIsEmpty(&spsc));
+
+  // Random adds and removes on every queue size, so that the head and tail
+  // wrap at every position. Power of two sizes also run the same operations
+  // on a single-producer/single-consumer queue, which must give the same
+  // results without entering any critical section.
+  for (uint16_t size = 1; size <= CIRCULAR_QUEUE_LEN_MAX; size++) {
+    bool spscSize = (size & (size - 1U)) == 0U;
+
+    TEST_ASSERT(queueInit(&queue, size));
+    queueOverflow(&queue, onOverflow);
+    TEST_ASSERT(spscQueueInit(&spsc, size) == spscSize);
+    spscQueueOverflow(&spsc, onSpscOverflow);
+    modelCount = 0;
+    for (int op = 0; op < 20000; op++) {
+      uint32_t r = host_rand(&state);
+      if ((r % 3U) != 0U) {
+        overflowCalls = 0;
+        overflowResult = ((r >> 8) & 1U) != 0U;
+        bool added = queueAdd(&queue, item(next));
+        if (spscSize) {
+          uint32_t maskCount = host_core_mask_count;
+          spscOverflowCalls = 0;
+          TEST_ASSERT(spscQueueAdd(&spsc, item(next)) == added);
+          TEST_ASSERT_EQUAL(maskCount, host_core_mask_count);
+          TEST_ASSERT_EQUAL(overflowCalls, spscOverflowCalls);
+          TEST_ASSERT((overflowCalls == 0) || (spscOverflowItem == overflowItem));
+        }
+        if (modelCount < size) {
+          TEST_ASSERT(added);
+          TEST_ASSERT_EQUAL(0, overflowCalls);
+          model[modelCount++] = next;
+        } else {
+          TEST_ASSERT_EQUAL(1, overflowCalls);
+          TEST_ASSERT(overflowItem == item(model[0]));
+          TEST_ASSERT(added == overflowResult);
+          if (added) {
+            for (uint32_t i = 1; i < modelCount; i++) {
+              model[i - 1] = model[i];
+            }
+            model[modelCount - 1] = next;
+          }
+        }
+        next++;
+      } else {
+        void *removed = queueRemove(&queue);
+        if (spscSize) {
+          uint32_t maskCount = host_core_mask_count;
+          TEST_ASSERT(spscQueuePeek(&spsc) == removed);
+          TEST_ASSERT(spscQueueRemove(&spsc) == removed);
+          TEST_ASSERT_EQUAL(maskCount, host_core_mask_count);
+        }
+        if (modelCount == 0) {
+          TEST_ASSERT(removed == NULL);
+        } else {
+          TEST_ASSERT(removed == item(model[0]));
+          for (uint32_t i = 1; i < modelCount; i++) {
+            model[i - 1] = model[i];
+          }
+          modelCount--;
+        }
+      }
+      TEST_ASSERT(queueIsEmpty(&queue) == (modelCount == 0));
+      TEST_ASSERT(queueIsFull(&queue) == (modelCount == size));
+      if (spscSize) {
+        TEST_ASSERT(spscQueueIsEmpty(&spsc) == (modelCount == 0));
+        TEST_ASSERT(spscQueueIsFull(&spsc) == (modelCount == size));
+      }
+      TEST_ASSERT_EQUAL(0, host_core_mask_depth);
+    }
+  }
+
+  printf("queue sizes 1 to %u checked\n", (unsigned)CIRCULAR_QUEUE_LEN_MAX);
+  return 0;
+}
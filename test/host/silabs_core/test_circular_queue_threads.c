@@ -0,0 +1,223 @@
+/***************************************************************************//**
+ * @file
+ * @brief Hammers the circular queues from a producer and a consumer thread.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "host_test.h"
+#include "host_core.h"
+#include "circular_queue.h"
+
+// Usage: test_circular_queue_threads [items]
+//
+// A producer thread adds numbered items and a consumer thread removes them,
+// on the locked queue and then on the single-producer/single-consumer queue.
+// The overflow callback discards or keeps the oldest item at random. Every
+// item must end up exactly once as consumed, discarded by the callback or
+// refused by the add, and items must be consumed in order.
+
+#define QUEUE_SIZE CIRCULAR_QUEUE_LEN_MAX
+
+#define FATE_CONSUMED  1U
+#define FATE_DISCARDED 2U
+#define FATE_REFUSED   4U
+
+typedef struct {
+  const char *name;
+  bool (*add)(void *queue, void *data);
+  void *(*remove)(void *queue);
+  bool (*isEmpty)(void *queue);
+  void *queue;
+} QueueOps_t;
+
+static _Atomic uint8_t *fate;
+static uint32_t itemCount;
+static atomic_bool producerDone;
+static uint32_t producerRand;
+static uint32_t counts[5];
+
+static void setFate(uint32_t value, uint8_t what)
+{
+  TEST_ASSERT((value >= 1U) && (value <= itemCount));
+  TEST_ASSERT_EQUAL(0, atomic_fetch_or(&fate[value], what));
+  counts[what]++;
+}
+
+// Called from the producer thread
+static bool decide(void *data)
+{
+  bool discard = (host_rand(&producerRand) & 1U) != 0U;
+
+  if (discard) {
+    setFate((uint32_t)(uintptr_t)data, FATE_DISCARDED);
+  }
+  return discard;
+}
+
+static bool onOverflow(const Queue_t *queue, void *data)
+{
+  (void)queue;
+  return decide(data);
+}
+
+static bool onSpscOverflow(const SpscQueue_t *queue, void *data)
+{
+  (void)queue;
+  return decide(data);
+}
+
+static bool lockedAdd(void *queue, void *data)
+{
+  return queueAdd(queue, data);
+}
+
+static void *lockedRemove(void *queue)
+{
+  return queueRemove(queue);
+}
+
+static bool lockedIsEmpty(void *queue)
+{
+  return queueIsEmpty(queue);
+}
+
+static bool spscAdd(void *queue, void *data)
+{
+  return spscQueueAdd(queue, data);
+}
+
+static void *spscRemove(void *queue)
+{
+  return spscQueueRemove(queue);
+}
+
+static bool spscIsEmpty(void *queue)
+{
+  return spscQueueIsEmpty(queue);
+}
+
+static void *producer(void *arg)
+{
+  const QueueOps_t *ops = arg;
+
+  for (uint32_t value = 1; value <= itemCount; value++) {
+    if (!ops->add(ops->queue, (void *)(uintptr_t)value)) {
+      setFate(value, FATE_REFUSED);
+    }
+    // Leave the consumer some room now and then, so that the queue is not
+    // always full
+    if ((value % 64U) == 0U) {
+      sched_yield();
+    }
+  }
+  atomic_store(&producerDone, true);
+  return NULL;
+}
+
+static void *consumer(void *arg)
+{
+  const QueueOps_t *ops = arg;
+  uint32_t last = 0;
+
+  for (;;) {
+    bool done = atomic_load(&producerDone);
+    void *data = ops->remove(ops->queue);
+
+    if (data != NULL) {
+      uint32_t value = (uint32_t)(uintptr_t)data;
+      TEST_ASSERT(value > last);
+      last = value;
+      setFate(value, FATE_CONSUMED);
+    } else if (done && ops->isEmpty(ops->queue)) {
+      break;
+    } else {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void run(const QueueOps_t *ops)
+{
+  pthread_t threads[2];
+
+  for (uint32_t i = 0; i <= itemCount; i++) {
+    atomic_store(&fate[i], 0U);
+  }
+  counts[FATE_CONSUMED] = 0;
+  counts[FATE_DISCARDED] = 0;
+  counts[FATE_REFUSED] = 0;
+  atomic_store(&producerDone, false);
+  producerRand = 0x2545F491;
+
+  uint64_t start = host_time_ns();
+  TEST_ASSERT(pthread_create(&threads[0], NULL, consumer, (void *)ops) == 0);
+  TEST_ASSERT(pthread_create(&threads[1], NULL, producer, (void *)ops) == 0);
+  TEST_ASSERT(pthread_join(threads[1], NULL) == 0);
+  TEST_ASSERT(pthread_join(threads[0], NULL) == 0);
+  uint64_t elapsed = host_time_ns() - start;
+
+  for (uint32_t i = 1; i <= itemCount; i++) {
+    TEST_ASSERT(atomic_load(&fate[i]) != 0U);
+  }
+  TEST_ASSERT_EQUAL(itemCount,
+                    counts[FATE_CONSUMED] + counts[FATE_DISCARDED] + counts[FATE_REFUSED]);
+  TEST_ASSERT(counts[FATE_CONSUMED] > 0U);
+  printf("%-6s %u items: %.1f ns per item, consumed %u, discarded %u, refused %u\n",
+         ops->name, itemCount, (double)elapsed / itemCount,
+         counts[FATE_CONSUMED], counts[FATE_DISCARDED], counts[FATE_REFUSED]);
+}
+
+int main(int argc, char *argv[])
+{
+  static Queue_t locked;
+  static SpscQueue_t spsc;
+
+  itemCount = (uint32_t)host_arg(argc, argv, 1, 1000000);
+  fate = calloc(itemCount + 1U, sizeof(fate[0]));
+  TEST_ASSERT(fate != NULL);
+
+  TEST_ASSERT(queueInit(&locked, QUEUE_SIZE));
+  queueOverflow(&locked, onOverflow);
+  QueueOps_t lockedOps = { "locked", lockedAdd, lockedRemove, lockedIsEmpty, &locked };
+  run(&lockedOps);
+
+  // No side of this queue enters a section
+  uint32_t maskCount = host_core_mask_count;
+  TEST_ASSERT(spscQueueInit(&spsc, QUEUE_SIZE));
+  spscQueueOverflow(&spsc, onSpscOverflow);
+  QueueOps_t spscOps = { "spsc", spscAdd, spscRemove, spscIsEmpty, &spsc };
+  run(&spscOps);
+  TEST_ASSERT_EQUAL(maskCount, host_core_mask_count);
+
+  free((void *)fate);
+  return 0;
+}
@@ -0,0 +1,237 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks that fast formatted responses match the vprintf path byte for byte.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "response_print_host.h"
+#include "railtest_responses.h"
+#include "host_core.h"
+
+DEFINE_RAILTEST_RESPONSES()
+DEFINE_RAILTEST_RESPONSES(ref_)
+
+#define ARG_COUNT 8
+
+static const char *strings[] = {
+  "",
+  "Pass",
+  "Fail",
+  "a string long enough to fill a good part of the staging buffer when it "
+  "is printed more than once in one response",
+};
+
+// Conversions and flags the fast formatter handles, followed by some it
+// leaves to vprintf()
+static const char *conversions[] = {
+  "d", "i", "u", "x", "X", "c", "s", "ld", "lu", "lx", "lld", "hd",
+};
+#define FAST_CONVERSIONS 10U
+
+static const char *flags[] = { "", "", "-", "0", "-0", "+", "#", " " };
+#define FAST_FLAGS 5U
+
+static uint32_t seed;
+
+static uint32_t pick(uint32_t count)
+{
+  return host_rand(&seed) % count;
+}
+
+// Build a random "tag:valueFormat,..." string with matching arguments. Most
+// pairs are well formed; some miss or repeat the ':' or are empty.
+static void random_format(char *format, size_t size, long args[ARG_COUNT])
+{
+  size_t length = 0;
+  uint32_t used = 0;
+  uint32_t pairs = 1 + pick(6);
+  // Malformed pairs can shift which argument a conversion reads, so strings
+  // are only printed from well formed formats
+  bool malformed = (pick(4) == 0);
+
+  format[0] = '\0';
+  for (uint32_t p = 0; p < pairs; p++) {
+    char spec[32];
+    bool unsupported = (pick(12) == 0);
+    const char *conversion = conversions[unsupported
+                                         ? pick(sizeof(conversions) / sizeof(conversions[0]))
+                                         : pick(FAST_CONVERSIONS)];
+    uint32_t shape = malformed ? pick(4) : 3;
+
+    if (malformed && (strchr(conversion, 's') != NULL)) {
+      conversion = "d";
+    }
+    if (pick(10) == 0) {
+      snprintf(spec, sizeof(spec), "%%%%");
+    } else {
+      char width[8] = "";
+      char precision[8] = "";
+      if (pick(3) == 0) {
+        snprintf(width, sizeof(width), "%u", (pick(8) == 0) ? 60 + pick(10) : pick(12));
+      }
+      if (pick(4) == 0) {
+        snprintf(precision, sizeof(precision), ".%u", pick(8));
+      }
+      snprintf(spec, sizeof(spec), "%%%s%s%s%s",
+               flags[unsupported ? pick(sizeof(flags) / sizeof(flags[0])) : pick(FAST_FLAGS)],
+               width, precision, conversion);
+      if (used < ARG_COUNT) {
+        if (strchr(conversion, 's') != NULL) {
+          args[used] = (long)(intptr_t)strings[pick(sizeof(strings) / sizeof(strings[0]))];
+        } else if (strchr(conversion, 'c') != NULL) {
+          args[used] = 'A' + pick(26);
+        } else {
+          args[used] = (long)host_rand(&seed) - (long)host_rand(&seed) * (long)pick(3);
+        }
+        used++;
+      } else {
+        snprintf(spec, sizeof(spec), "%%%%");
+      }
+    }
+    length += (size_t)snprintf(&format[length], size - length, "%s%s%s",
+                               (p > 0) ? "," : "",
+                               (pick(25) == 0) ? "\n" : "",
+                               (pick(30) == 0) ? "averyveryveryveryveryverylongtagname" : "tag");
+    if (shape == 0) {
+      // Missing ':'
+      length += (size_t)snprintf(&format[length], size - length, "%u%s", p, spec);
+    } else if (shape == 1) {
+      // Two ':'
+      length += (size_t)snprintf(&format[length], size - length, "%u:x:%s", p, spec);
+    } else if (shape == 2) {
+      // Tag only
+      length += (size_t)snprintf(&format[length], size - length, "%u:", p);
+    } else {
+      length += (size_t)snprintf(&format[length], size - length, "%u:%s", p, spec);
+    }
+  }
+  // Sometimes go over RESPONSE_PRINT_FORMAT_STR_SIZE_MAX
+  while ((pick(40) == 0) && (length + 40 < size)) {
+    length += (size_t)snprintf(&format[length], size - length, ",padding%u:value", (unsigned)length);
+  }
+  for (; used < ARG_COUNT; used++) {
+    args[used] = 0;
+  }
+}
+
+#define CALL_BOTH(result, call, ...)                        \
+  do {                                                      \
+    result[0] = call(__VA_ARGS__);                          \
+    outLength[0] = capture_take(out[0], sizeof(out[0]));    \
+    result[1] = ref_##call(__VA_ARGS__);                    \
+    outLength[1] = capture_take(out[1], sizeof(out[1]));    \
+  } while (0)
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (uint32_t)host_arg(argc, argv, 1, 100000);
+  static char out[2][16384];
+  size_t outLength[2];
+  char format[2][600];
+  long a[ARG_COUNT];
+  long b[ARG_COUNT];
+  bool result[2];
+  ResponsePrintStats_t stats;
+
+  seed = (uint32_t)host_arg(argc, argv, 2, 0x5EED1234);
+  capture_start();
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    random_format(format[0], sizeof(format[0]), a);
+    random_format(format[1], sizeof(format[1]), b);
+    // Output from interrupt context bypasses the staging buffer
+    host_core_irq_context = (pick(10) == 0);
+
+    switch (pick(5)) {
+      case 0:
+        CALL_BOTH(result, responsePrint, "cmd", format[0],
+                  a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+        break;
+      case 1:
+        CALL_BOTH(result, responsePrintMulti, format[0],
+                  a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+        break;
+      case 2:
+        CALL_BOTH(result, responsePrintHeader, "cmd", format[0],
+                  a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+        break;
+      case 3:
+        CALL_BOTH(result, responsePrintError, "cmd", (uint8_t)i, "bad value %d",
+                  (int)a[0]);
+        break;
+      default:
+        // A response built in several parts
+        result[0] = responsePrintStart("cmd")
+                    && responsePrintContinue(format[0], a[0], a[1], a[2], a[3],
+                                             a[4], a[5], a[6], a[7])
+                    && responsePrintEnd(format[1], b[0], b[1], b[2], b[3],
+                                        b[4], b[5], b[6], b[7]);
+        outLength[0] = capture_take(out[0], sizeof(out[0]));
+        result[1] = ref_responsePrintStart("cmd")
+                    && ref_responsePrintContinue(format[0], a[0], a[1], a[2], a[3],
+                                                 a[4], a[5], a[6], a[7])
+                    && ref_responsePrintEnd(format[1], b[0], b[1], b[2], b[3],
+                                            b[4], b[5], b[6], b[7]);
+        outLength[1] = capture_take(out[1], sizeof(out[1]));
+        break;
+    }
+    host_core_irq_context = false;
+
+    if ((result[0] != result[1]) || (outLength[0] != outLength[1])
+        || (memcmp(out[0], out[1], outLength[0]) != 0)) {
+      fprintf(stderr, "mismatch on \"%s\" / \"%s\"\n  fast: %.*s\n  ref:  %.*s\n",
+              format[0], format[1],
+              (int)outLength[0], out[0], (int)outLength[1], out[1]);
+      return 1;
+    }
+  }
+
+  // The responses RAILtest prints most often, over a range of values
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint32_t type = i % RAILTEST_RESPONSE_TYPES;
+    uint32_t value = i * 2654435761U;
+
+    railtestResponses[type].print(value);
+    outLength[0] = capture_take(out[0], sizeof(out[0]));
+    ref_railtestResponses[type].print(value);
+    outLength[1] = capture_take(out[1], sizeof(out[1]));
+    if ((outLength[0] != outLength[1])
+        || (memcmp(out[0], out[1], outLength[0]) != 0)) {
+      fprintf(stderr, "mismatch on %s %u\n  fast: %.*s\n  ref:  %.*s\n",
+              railtestResponses[type].name, value,
+              (int)outLength[0], out[0], (int)outLength[1], out[1]);
+      return 1;
+    }
+  }
+
+  responsePrintGetStats(&stats);
+  TEST_ASSERT(stats.fastFormats > 0);
+  fprintf(stderr, "%u random and %u RAILtest responses identical, %u fast formatted, "
+          "%u overflows\n",
+          iterations, iterations, stats.fastFormats, stats.overflows);
+  return 0;
+}
@@ -0,0 +1,171 @@
+/***************************************************************************//**
+ * @file
+ * @brief Response print test: output staging, one write per response.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "response_print_host.h"
+#include "response_print_config.h"
+#include "host_core.h"
+
+static char out[2][1024];
+
+static ResponsePrintStats_t stats_delta(const ResponsePrintStats_t *before)
+{
+  ResponsePrintStats_t now;
+
+  responsePrintGetStats(&now);
+  now.flushes -= before->flushes;
+  now.overflows -= before->overflows;
+  now.fastFormats -= before->fastFormats;
+  return now;
+}
+
+static void check_output(const char *expected)
+{
+  size_t length = capture_take(out[0], sizeof(out[0]));
+
+  if ((length != strlen(expected)) || (memcmp(out[0], expected, length) != 0)) {
+    fprintf(stderr, "expected \"%s\"\n     got \"%.*s\"\n", expected, (int)length, out[0]);
+    TEST_ASSERT(false);
+  }
+}
+
+// A response goes out in one iostream write, with the same text as the
+// build without the staging buffer
+static void test_single_write(void)
+{
+  ResponsePrintStats_t before;
+  ResponsePrintStats_t delta;
+  size_t length;
+
+  responsePrintGetStats(&before);
+  capture.streamWrites = 0;
+  TEST_ASSERT(responsePrint("rx", "len:%d,rssi:%d,payload:%s", 12, -40, "Pass"));
+  TEST_ASSERT_EQUAL(1, capture.streamWrites);
+  delta = stats_delta(&before);
+  TEST_ASSERT_EQUAL(1, delta.flushes);
+  TEST_ASSERT_EQUAL(0, delta.overflows);
+  length = capture_take(out[0], sizeof(out[0]));
+  TEST_ASSERT(ref_responsePrint("rx", "len:%d,rssi:%d,payload:%s", 12, -40, "Pass"));
+  TEST_ASSERT_EQUAL(length, capture_take(out[1], sizeof(out[1])));
+  TEST_ASSERT(memcmp(out[0], out[1], length) == 0);
+}
+
+// A response built in parts, with raw text inside, is staged until its end
+static void test_parts(void)
+{
+  capture.streamWrites = 0;
+  TEST_ASSERT(responsePrintStart("rxPacket"));
+  TEST_ASSERT(responsePrintContinue("len:%d", 3));
+  TEST_ASSERT(responsePrintRaw("{payload: 0x%02x 0x%02x 0x%02x}", 1, 2, 3));
+  TEST_ASSERT_EQUAL(0, capture.len);
+  TEST_ASSERT(responsePrintEnd("crc:%s", "Pass"));
+  TEST_ASSERT_EQUAL(1, capture.streamWrites);
+  check_output("{{(rxPacket)}{len:3}{payload: 0x01 0x02 0x03}{crc:Pass}}\n");
+
+  // An explicit flush writes what is staged so far
+  TEST_ASSERT(responsePrintStart("rxPacket"));
+  responsePrintFlush();
+  TEST_ASSERT_EQUAL(2, capture.streamWrites);
+  TEST_ASSERT(responsePrintEnd("len:%d", 0));
+  TEST_ASSERT_EQUAL(3, capture.streamWrites);
+  check_output("{{(rxPacket)}{len:0}}\n");
+}
+
+// Text printed with printf() before a response comes out before it
+static void test_stdio_order(void)
+{
+  printf("raw ");
+  TEST_ASSERT(responsePrint("cmd", "a:%d", 1));
+  check_output("raw {{(cmd)}{a:1}}\n");
+}
+
+// A fragment that does not fit flushes what is staged and is staged again.
+// A fragment larger than the buffer is printed directly, after what is
+// staged, and counted as an overflow.
+static void test_overflow(void)
+{
+  static char text[RESPONSE_PRINT_OUTPUT_BUFFER_SIZE + 40];
+  static char expected[3 * sizeof(text)];
+  ResponsePrintStats_t before;
+  ResponsePrintStats_t delta;
+  size_t half = RESPONSE_PRINT_OUTPUT_BUFFER_SIZE / 2U;
+
+  memset(text, 'x', sizeof(text) - 1U);
+  text[sizeof(text) - 1U] = '\0';
+
+  responsePrintGetStats(&before);
+  capture.streamWrites = 0;
+  TEST_ASSERT(responsePrintStart("big"));
+  TEST_ASSERT(responsePrintRaw("%.*s", (int)half, text));
+  TEST_ASSERT(responsePrintRaw("%.*s", (int)half, text));
+  TEST_ASSERT_EQUAL(1, capture.streamWrites);
+  TEST_ASSERT(responsePrintEnd("n:%d", 2));
+  TEST_ASSERT_EQUAL(2, capture.streamWrites);
+  delta = stats_delta(&before);
+  TEST_ASSERT_EQUAL(2, delta.flushes);
+  TEST_ASSERT_EQUAL(0, delta.overflows);
+  snprintf(expected, sizeof(expected), "{{(big)}%.*s%.*s{n:2}}\n", (int)half, text, (int)half, text);
+  check_output(expected);
+
+  responsePrintGetStats(&before);
+  TEST_ASSERT(responsePrintStart("big"));
+  TEST_ASSERT(responsePrintRaw("%s", text));
+  TEST_ASSERT(responsePrintEnd("n:%d", 1));
+  delta = stats_delta(&before);
+  TEST_ASSERT_EQUAL(1, delta.overflows);
+  snprintf(expected, sizeof(expected), "{{(big)}%s{n:1}}\n", text);
+  check_output(expected);
+}
+
+// A response printed from interrupt context goes out directly and leaves the
+// response the main loop is building untouched
+static void test_irq(void)
+{
+  TEST_ASSERT(responsePrintStart("main"));
+  TEST_ASSERT(responsePrintContinue("a:%d", 1));
+  host_core_irq_context = true;
+  TEST_ASSERT(responsePrint("isr", "b:%d", 2));
+  responsePrintFlush();
+  host_core_irq_context = false;
+  TEST_ASSERT(responsePrintEnd("c:%d", 3));
+  check_output("{{(isr)}{b:2}}\n{{(main)}{a:1}{c:3}}\n");
+}
+
+int main(void)
+{
+  capture_start();
+  test_single_write();
+  test_parts();
+  test_stdio_order();
+  test_overflow();
+  test_irq();
+
+  fprintf(stderr, "response print staging: ok\n");
+  return 0;
+}
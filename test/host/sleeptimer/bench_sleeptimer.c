@@ -0,0 +1,167 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer benchmark: start, stop and interrupt cost with 10 to 1000 running timers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "sleeptimer_host.h"
+
+// Usage: bench_sleeptimer [expirations] [repeats] [max timers]
+//
+// Keeps N timers running, one in eight periodic, for N from 10 to 1000. The
+// one-shot timers start again from their callback, and the main loop stops
+// and starts a random timer between interrupts. Reports the cost of a start
+// and a stop from the main loop, and of the interrupt per expiration, which
+// includes the starts from the callbacks. The best of the repeats is kept.
+// The expiration count and tick checksum are the same for every backend.
+
+#define MAX_TIMERS      1000U
+#define PERIODIC_RATIO  8U
+
+typedef struct {
+  uint64_t start_ns;
+  uint64_t stop_ns;
+  uint64_t irq_ns;
+  uint32_t starts;
+  uint32_t stops;
+  uint32_t expirations;
+  uint32_t checksum;
+} Result_t;
+
+static sl_sleeptimer_timer_handle_t timers[MAX_TIMERS];
+static uint32_t timer_count;
+static uint32_t timer_rnd[MAX_TIMERS];
+static uint32_t rnd;
+static Result_t result;
+
+// Each timer draws its own timeouts, so that the order in which the timers
+// expiring on the same tick are processed changes nothing
+static uint32_t random_timeout(uint32_t index)
+{
+  return 1U + (host_rand(&timer_rnd[index]) % (timer_count * 64U));
+}
+
+static bool is_periodic(uint32_t index)
+{
+  return (index % PERIODIC_RATIO) == 0U;
+}
+
+static void callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  uint32_t index = (uint32_t)(uintptr_t)data;
+
+  result.expirations++;
+  result.checksum += sleeptimer_host_counter() * (index + 1U);
+  if (!is_periodic(index)) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(handle, random_timeout(index), callback, data, (uint8_t)(index % 4U), 0));
+  }
+}
+
+static void start(uint32_t index)
+{
+  void *data = (void *)(uintptr_t)index;
+  sl_status_t status;
+
+  if (is_periodic(index)) {
+    status = sl_sleeptimer_start_periodic_timer(&timers[index], random_timeout(index), callback, data, (uint8_t)(index % 4U), 0);
+  } else {
+    status = sl_sleeptimer_start_timer(&timers[index], random_timeout(index), callback, data, (uint8_t)(index % 4U), 0);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, status);
+}
+
+static void run(uint32_t count, uint32_t expirations)
+{
+  timer_count = count;
+  rnd = 7;
+  for (uint32_t i = 0; i < count; i++) {
+    timer_rnd[i] = i + 1U;
+    start(i);
+  }
+  result = (Result_t){ 0 };
+
+  while (result.expirations < expirations) {
+    uint32_t index = host_rand(&rnd) % count;
+    uint64_t t0 = host_time_ns();
+    uint64_t t1;
+    uint64_t t2;
+
+    TEST_ASSERT(sleeptimer_host_run_to_compare());
+    t1 = host_time_ns();
+    result.irq_ns += t1 - t0;
+
+    if ((host_rand(&rnd) & 1U) != 0U) {
+      TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timers[index]));
+      t2 = host_time_ns();
+      start(index);
+      result.stop_ns += t2 - t1;
+      result.start_ns += host_time_ns() - t2;
+      result.stops++;
+      result.starts++;
+    }
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timers[i]));
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  static const uint32_t counts[] = { 10, 30, 100, 300, 1000 };
+  uint32_t expirations = (uint32_t)host_arg(argc, argv, 1, 100000);
+  uint32_t repeats = (uint32_t)host_arg(argc, argv, 2, 3);
+  uint32_t max_timers = (uint32_t)host_arg(argc, argv, 3, MAX_TIMERS);
+
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  printf("sleeptimer min-heap, %u expirations x %u\n", expirations, repeats);
+#else
+  printf("sleeptimer delta list, %u expirations x %u\n", expirations, repeats);
+#endif
+  printf("timers   start ns   stop ns   irq ns/expiration   expirations  checksum\n");
+  sleeptimer_host_init();
+  for (uint32_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && counts[c] <= max_timers; c++) {
+    Result_t best = { UINT64_MAX, UINT64_MAX, UINT64_MAX, 0, 0, 0, 0 };
+
+    for (uint32_t r = 0; r < repeats; r++) {
+      run(counts[c], expirations);
+      best.start_ns = (result.start_ns < best.start_ns) ? result.start_ns : best.start_ns;
+      best.stop_ns = (result.stop_ns < best.stop_ns) ? result.stop_ns : best.stop_ns;
+      best.irq_ns = (result.irq_ns < best.irq_ns) ? result.irq_ns : best.irq_ns;
+      best.starts = result.starts;
+      best.stops = result.stops;
+      best.expirations = result.expirations;
+      best.checksum = result.checksum;
+    }
+    printf("%6u %10.1f %9.1f %19.1f %13u  %08x\n", counts[c],
+           (double)best.start_ns / best.starts, (double)best.stop_ns / best.stops,
+           (double)best.irq_ns / best.expirations, best.expirations, best.checksum);
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer configuration for the host harness.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SLEEPTIMER_CONFIG_H
+#define SL_SLEEPTIMER_CONFIG_H
+
+#define SL_SLEEPTIMER_PERIPHERAL_DEFAULT 0
+#define SL_SLEEPTIMER_PERIPHERAL_RTCC    1
+#define SL_SLEEPTIMER_PERIPHERAL_PRORTC  2
+#define SL_SLEEPTIMER_PERIPHERAL_RTC     3
+#define SL_SLEEPTIMER_PERIPHERAL_SYSRTC  4
+#define SL_SLEEPTIMER_PERIPHERAL_BURTC   5
+#define SL_SLEEPTIMER_PERIPHERAL_WTIMER  6
+#define SL_SLEEPTIMER_PERIPHERAL_TIMER   7
+
+// The project configuration (config/sl_sleeptimer_config.h), with every
+// option overridable by the harness variants. The counter is the harness'.
+#define SL_SLEEPTIMER_PERIPHERAL  SL_SLEEPTIMER_PERIPHERAL_DEFAULT
+#define SL_SLEEPTIMER_TIMER_INSTANCE  0
+
+#ifndef SL_SLEEPTIMER_WALLCLOCK_CONFIG
+#define SL_SLEEPTIMER_WALLCLOCK_CONFIG  0
+#endif
+
+#define SL_SLEEPTIMER_FREQ_DIVIDER  1
+#define SL_SLEEPTIMER_PRORTC_HAL_OWNS_IRQ_HANDLER  0
+#define SL_SLEEPTIMER_DEBUGRUN  0
+
+#ifndef SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+#define SL_SLEEPTIMER_TIMER_HEAP_ENABLE  0
+#endif
+
+#ifndef SL_SLEEPTIMER_TIMER_HEAP_SIZE
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE  32
+#endif
+
+#ifndef SL_SLEEPTIMER_COALESCING_ENABLE
+#define SL_SLEEPTIMER_COALESCING_ENABLE  0
+#endif
+
+#ifndef SL_SLEEPTIMER_COALESCING_TIMER_COUNT
+#define SL_SLEEPTIMER_COALESCING_TIMER_COUNT  8
+#endif
+
+#endif /* SL_SLEEPTIMER_CONFIG_H */
@@ -0,0 +1,181 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer host harness: a simulated counter and its interrupts.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "host_core.h"
+#include "sleeptimer_host.h"
+#include "sli_sleeptimer_hal.h"
+
+uint32_t sleeptimer_host_compare_irq_count;
+
+static uint32_t counter = SLEEPTIMER_HOST_COUNTER_START;
+static uint32_t compare;
+static uint8_t int_enabled;
+static uint8_t int_pending;
+
+void sleeptimer_hal_init_timer(void)
+{
+  int_enabled = 0U;
+  int_pending = 0U;
+}
+
+uint32_t sleeptimer_hal_get_counter(void)
+{
+  return counter;
+}
+
+uint32_t sleeptimer_hal_get_compare(void)
+{
+  return compare;
+}
+
+// A compare set in the past only matches after the counter wraps, as on the
+// device
+void sleeptimer_hal_set_compare(uint32_t value)
+{
+  if ((value - counter) < SLEEPTIMER_HOST_COMPARE_MIN_DIFF) {
+    value = counter + SLEEPTIMER_HOST_COMPARE_MIN_DIFF;
+  }
+  compare = value;
+  int_enabled |= SLEEPTIMER_EVENT_COMP;
+}
+
+void sleeptimer_hal_set_compare_prs_hfxo_startup(int32_t value)
+{
+  (void)value;
+}
+
+uint32_t sleeptimer_hal_get_timer_frequency(void)
+{
+  return SLEEPTIMER_HOST_FREQUENCY;
+}
+
+void sleeptimer_hal_enable_int(uint8_t local_flag)
+{
+  int_enabled |= local_flag;
+}
+
+void sleeptimer_hal_disable_int(uint8_t local_flag)
+{
+  int_enabled &= (uint8_t)~local_flag;
+}
+
+void sleeptimer_hal_set_int(uint8_t local_flag)
+{
+  int_pending |= local_flag;
+}
+
+bool sli_sleeptimer_hal_is_int_status_set(uint8_t local_flag)
+{
+  return (int_pending & local_flag) != 0U;
+}
+
+uint16_t sleeptimer_hal_get_clock_accuracy(void)
+{
+  return 0U;
+}
+
+uint32_t sleeptimer_hal_get_capture(void)
+{
+  return counter;
+}
+
+void sleeptimer_hal_reset_prs_signal(void)
+{
+}
+
+void sleeptimer_hal_disable_prs_compare_and_capture_channel(void)
+{
+}
+
+// The interrupt handler of the HAL: clear the enabled flags and process them
+static void take_interrupts(void)
+{
+  uint8_t flags;
+
+  while ((flags = (int_pending & int_enabled)) != 0U) {
+    int_pending &= (uint8_t)~flags;
+    if ((flags & SLEEPTIMER_EVENT_COMP) != 0U) {
+      sleeptimer_host_compare_irq_count++;
+    }
+    host_core_irq_context = true;
+    process_timer_irq(flags);
+    host_core_irq_context = false;
+  }
+}
+
+void sleeptimer_host_init(void)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_init());
+}
+
+uint32_t sleeptimer_host_counter(void)
+{
+  return counter;
+}
+
+void sleeptimer_host_run(uint32_t ticks)
+{
+  take_interrupts();
+  while (ticks > 0U) {
+    uint32_t step = ticks;
+
+    // Stop at the next compare match and the next overflow
+    if ((int_enabled & SLEEPTIMER_EVENT_COMP) != 0U && (compare - counter) != 0U
+        && (compare - counter) < step) {
+      step = compare - counter;
+    }
+    if (counter != 0U && (0U - counter) < step) {
+      step = 0U - counter;
+    }
+    counter += step;
+    ticks -= step;
+    if ((int_enabled & SLEEPTIMER_EVENT_COMP) != 0U && counter == compare) {
+      int_pending |= SLEEPTIMER_EVENT_COMP;
+    }
+    if (counter == 0U) {
+      int_pending |= SLEEPTIMER_EVENT_OF;
+    }
+    take_interrupts();
+  }
+}
+
+bool sleeptimer_host_run_to_compare(void)
+{
+  uint32_t irq_count = sleeptimer_host_compare_irq_count;
+
+  take_interrupts();
+  while (irq_count == sleeptimer_host_compare_irq_count) {
+    if ((int_enabled & SLEEPTIMER_EVENT_COMP) == 0U) {
+      return false;
+    }
+    sleeptimer_host_run((compare - counter != 0U) ? (compare - counter) : 1U);
+  }
+  return true;
+}
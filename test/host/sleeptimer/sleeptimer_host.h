@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer host harness: a simulated counter and its interrupts.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLEEPTIMER_HOST_H
+#define SLEEPTIMER_HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "host_test.h"
+#include "sl_sleeptimer.h"
+
+#define SLEEPTIMER_HOST_FREQUENCY       32768U
+
+// The counter starts 32 seconds before it wraps, so that harnesses run across
+// the overflow
+#define SLEEPTIMER_HOST_COUNTER_START   0xFFF00000U
+
+// Smallest distance from the counter at which the compare is set, as the
+// SYSRTC HAL does
+#define SLEEPTIMER_HOST_COMPARE_MIN_DIFF  3U
+
+// Compare interrupts taken, that is wakeups from sleep on a device
+extern uint32_t sleeptimer_host_compare_irq_count;
+
+// Start the sleeptimer on the simulated counter. The counter keeps running
+// across calls, so that harnesses can run several cases in one program.
+void sleeptimer_host_init(void);
+
+// Current counter value
+uint32_t sleeptimer_host_counter(void);
+
+// Move the counter forward by the given number of ticks, taking the compare
+// and overflow interrupts on the way
+void sleeptimer_host_run(uint32_t ticks);
+
+// Move the counter forward to the next compare interrupt, and take it.
+// Returns false, without moving, when the compare interrupt is disabled.
+bool sleeptimer_host_run_to_compare(void);
+
+#endif // SLEEPTIMER_HOST_H
@@ -0,0 +1,301 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer test: random timer operations against a model of the expirations.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host_core.h"
+#include "sleeptimer_host.h"
+
+// Usage: test_sleeptimer [steps]
+//
+// One-shot and periodic timers are started, restarted and stopped at random,
+// from the main loop and from the callbacks, while the counter runs. Every
+// expiration must come on its tick, or at most the compare margin later for
+// the shortest timeouts, and the timers that expire in one interrupt must be
+// processed by priority. Running state and remaining time must match the
+// model after every step.
+
+#define TIMER_COUNT     48U
+#define MAX_TIMEOUT     2000U
+#define MIN_PERIOD      8U
+#define MAX_RUN         400U
+
+typedef struct {
+  sl_sleeptimer_timer_handle_t handle;
+  bool running;
+  uint32_t expected;    // Tick of the next expiration
+  uint32_t period;      // 0 for a one-shot timer
+  uint8_t priority;
+} Timer_t;
+
+static Timer_t timers[TIMER_COUNT];
+static uint32_t rnd = 11;
+static uint32_t expiration_count;
+static uint32_t batch_irq_count;
+static uint8_t batch_priority;
+static uint32_t callback_depth;
+
+static void start(Timer_t *timer, bool periodic, bool restart);
+
+static void callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  Timer_t *timer = data;
+  uint32_t now = sleeptimer_host_counter();
+
+  TEST_ASSERT(handle == &timer->handle);
+  TEST_ASSERT(timer->running);
+  TEST_ASSERT((now - timer->expected) <= SLEEPTIMER_HOST_COMPARE_MIN_DIFF);
+  expiration_count++;
+  callback_depth++;
+
+  // Timers that expire in the same interrupt go by priority. A timer started
+  // without timeout from a callback expires within it, out of that order.
+  if (host_core_irq_context && callback_depth == 1U) {
+    if (batch_irq_count == sleeptimer_host_compare_irq_count) {
+      TEST_ASSERT(timer->priority >= batch_priority);
+    }
+    batch_irq_count = sleeptimer_host_compare_irq_count;
+    batch_priority = timer->priority;
+  }
+
+  if (timer->period != 0U) {
+    timer->expected += timer->period;
+  } else {
+    timer->running = false;
+    // Some one-shot timers start again from their callback
+    if (host_core_irq_context && (host_rand(&rnd) % 4U) == 0U) {
+      start(timer, false, false);
+    }
+  }
+  callback_depth--;
+}
+
+static void start(Timer_t *timer, bool periodic, bool restart)
+{
+  uint32_t timeout = host_rand(&rnd) % MAX_TIMEOUT;
+  uint8_t priority = (uint8_t)(host_rand(&rnd) % 4U);
+  sl_status_t status;
+
+  if (periodic) {
+    timeout += MIN_PERIOD;
+  }
+  if (timer->running && !restart) {
+    status = periodic ? sl_sleeptimer_start_periodic_timer(&timer->handle, timeout, callback, timer, priority, 0)
+             : sl_sleeptimer_start_timer(&timer->handle, timeout, callback, timer, priority, 0);
+    TEST_ASSERT_EQUAL(periodic ? SL_STATUS_INVALID_STATE : SL_STATUS_NOT_READY, status);
+    return;
+  }
+
+  // A one-shot timer without timeout expires in the call
+  timer->running = true;
+  timer->expected = sleeptimer_host_counter() + timeout;
+  timer->period = periodic ? timeout : 0U;
+  timer->priority = priority;
+  if (restart) {
+    status = periodic ? sl_sleeptimer_restart_periodic_timer(&timer->handle, timeout, callback, timer, priority, 0)
+             : sl_sleeptimer_restart_timer(&timer->handle, timeout, callback, timer, priority, 0);
+  } else {
+    status = periodic ? sl_sleeptimer_start_periodic_timer(&timer->handle, timeout, callback, timer, priority, 0)
+             : sl_sleeptimer_start_timer(&timer->handle, timeout, callback, timer, priority, 0);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, status);
+}
+
+static void check(const Timer_t *timer)
+{
+  uint32_t now = sleeptimer_host_counter();
+  uint32_t remaining = 0;
+  bool running = false;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_is_timer_running(&timer->handle, &running));
+  TEST_ASSERT_EQUAL(timer->running, running);
+  if (timer->running) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_timer_time_remaining(&timer->handle, &remaining));
+    // A timer due before the compare margin expires late
+    TEST_ASSERT_EQUAL(((int32_t)(timer->expected - now) > 0) ? (timer->expected - now) : 0U, remaining);
+  } else {
+    TEST_ASSERT(sl_sleeptimer_get_timer_time_remaining(&timer->handle, &remaining) != SL_STATUS_OK);
+  }
+}
+
+static void stop_all(void)
+{
+  for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+    TEST_ASSERT_EQUAL(timers[i].running ? SL_STATUS_OK : SL_STATUS_INVALID_STATE,
+                      sl_sleeptimer_stop_timer(&timers[i].handle));
+    timers[i].running = false;
+  }
+}
+
+static void test_random(uint32_t steps)
+{
+  bool wrapped = false;
+
+  for (uint32_t s = 0; s < steps; s++) {
+    Timer_t *timer = &timers[host_rand(&rnd) % TIMER_COUNT];
+    uint32_t before = sleeptimer_host_counter();
+
+    switch (host_rand(&rnd) % 6U) {
+      case 0:
+        start(timer, false, false);
+        break;
+      case 1:
+        start(timer, true, false);
+        break;
+      case 2:
+        start(timer, (host_rand(&rnd) & 1U) != 0U, true);
+        break;
+      case 3:
+        TEST_ASSERT_EQUAL(timer->running ? SL_STATUS_OK : SL_STATUS_INVALID_STATE,
+                          sl_sleeptimer_stop_timer(&timer->handle));
+        timer->running = false;
+        break;
+      default:
+        sleeptimer_host_run(host_rand(&rnd) % MAX_RUN);
+        break;
+    }
+    wrapped |= sleeptimer_host_counter() < before;
+    for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+      check(&timers[i]);
+    }
+  }
+  stop_all();
+  TEST_ASSERT(wrapped);
+  TEST_ASSERT(expiration_count > steps / 4U);
+}
+
+// The first timer to expire goes first among the flags asked for
+static void test_first_timer(void)
+{
+  uint32_t remaining = 0;
+
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_sleeptimer_get_remaining_time_of_first_timer(SL_SLEEPTIMER_ANY_FLAG, &remaining));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&timers[0].handle, 500, callback, &timers[0], 0, 0));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&timers[1].handle, 300, callback, &timers[1], 0, 0x10));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&timers[2].handle, 100, callback, &timers[2], 0, 0x20));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&timers[3].handle, 200, callback, &timers[3], 0, 0x10));
+  timers[0].running = timers[1].running = timers[2].running = timers[3].running = true;
+  sleeptimer_host_run(50);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_remaining_time_of_first_timer(SL_SLEEPTIMER_ANY_FLAG, &remaining));
+  TEST_ASSERT_EQUAL(50U, remaining);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_remaining_time_of_first_timer(0x10, &remaining));
+  TEST_ASSERT_EQUAL(150U, remaining);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_remaining_time_of_first_timer(0, &remaining));
+  TEST_ASSERT_EQUAL(450U, remaining);
+  TEST_ASSERT_EQUAL(SL_STATUS_EMPTY, sl_sleeptimer_get_remaining_time_of_first_timer(0x40, &remaining));
+  stop_all();
+}
+
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+// Starting a timer with the heap full fails, and leaves the others running
+static void test_heap_full(void)
+{
+  static sl_sleeptimer_timer_handle_t handles[SL_SLEEPTIMER_TIMER_HEAP_SIZE + 1U];
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < SL_SLEEPTIMER_TIMER_HEAP_SIZE; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&handles[i], 1000U + i, NULL, NULL, 0, 0));
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_FULL, sl_sleeptimer_start_timer(&handles[SL_SLEEPTIMER_TIMER_HEAP_SIZE], 10, NULL, NULL, 0, 0));
+  for (uint32_t i = 0; i <= SL_SLEEPTIMER_TIMER_HEAP_SIZE; i++) {
+    bool running = false;
+
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_is_timer_running(&handles[i], &running));
+    count += running ? 1U : 0U;
+  }
+  TEST_ASSERT_EQUAL(SL_SLEEPTIMER_TIMER_HEAP_SIZE, count);
+  for (uint32_t i = 0; i < SL_SLEEPTIMER_TIMER_HEAP_SIZE; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&handles[i]));
+  }
+}
+
+static sl_sleeptimer_timer_handle_t isr_handle;
+static sl_status_t isr_status;
+static uint32_t periodic_count;
+
+static void periodic_callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  (void)data;
+  periodic_count++;
+}
+
+// Starts a timer from the first unmask in the sleeptimer interrupt, while
+// the expired periodic timer waits to be re-inserted
+static void start_timer_from_isr(void)
+{
+  if (host_core_irq_context) {
+    host_core_on_unmask = NULL;
+    isr_status = sl_sleeptimer_start_timer(&isr_handle, 50, NULL, NULL, 0, 0);
+  }
+}
+
+// With the heap full, a periodic timer keeps its place across its
+// expirations: a timer started from an interrupt in between gets
+// SL_STATUS_FULL, instead of taking the place and stopping the periodic timer.
+static void test_heap_full_periodic(void)
+{
+  static sl_sleeptimer_timer_handle_t handles[SL_SLEEPTIMER_TIMER_HEAP_SIZE];
+  bool running = false;
+
+  for (uint32_t i = 0; i < SL_SLEEPTIMER_TIMER_HEAP_SIZE - 1U; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&handles[i], 100000U, NULL, NULL, 0, 0));
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_periodic_timer(&handles[SL_SLEEPTIMER_TIMER_HEAP_SIZE - 1U], 100, periodic_callback, NULL, 0, 0));
+  isr_status = SL_STATUS_OK;
+  periodic_count = 0;
+  host_core_on_unmask = start_timer_from_isr;
+  sleeptimer_host_run(1000);
+  TEST_ASSERT(host_core_on_unmask == NULL);
+  TEST_ASSERT_EQUAL(SL_STATUS_FULL, isr_status);
+  TEST_ASSERT_EQUAL(10, periodic_count);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_is_timer_running(&handles[SL_SLEEPTIMER_TIMER_HEAP_SIZE - 1U], &running));
+  TEST_ASSERT(running);
+  for (uint32_t i = 0; i < SL_SLEEPTIMER_TIMER_HEAP_SIZE; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&handles[i]));
+  }
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+  uint32_t steps = (uint32_t)host_arg(argc, argv, 1, 100000);
+
+  sleeptimer_host_init();
+  test_first_timer();
+#if SL_SLEEPTIMER_TIMER_HEAP_ENABLE
+  test_heap_full();
+  test_heap_full_periodic();
+#endif
+  test_random(steps);
+  printf("test_sleeptimer: %u expirations, passed\n", expiration_count);
+  return 0;
+}
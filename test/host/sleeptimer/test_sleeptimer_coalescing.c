@@ -0,0 +1,256 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer test: timer slack and the coalescing of expirations.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sl_sleeptimer_config.h"
+#include "sleeptimer_host.h"
+
+// Usage: test_sleeptimer_coalescing [seconds]
+//
+// Checks the slack table, two timers sharing a wakeup, then periodic timers
+// with a slack for the given simulated time. Every expiration must come
+// within its slack, and the statistics must account for every expiration
+// tick as a wakeup or a wakeup saved.
+
+#define TIMER_COUNT     (SL_SLEEPTIMER_COALESCING_TIMER_COUNT + 2U)
+
+typedef struct {
+  sl_sleeptimer_timer_handle_t handle;
+  uint32_t expected;    // Tick of the next expiration
+  uint32_t period;      // 0 for a one-shot timer
+  uint32_t slack;
+  uint32_t expiration_count;
+  uint32_t last_tick;   // Tick of the last expiration
+} Timer_t;
+
+static Timer_t timers[TIMER_COUNT];
+// Other timers, to count the free entries of the slack table
+static Timer_t probes[TIMER_COUNT];
+
+// Expiration ticks seen in the periodic run, to count the distinct ones
+static uint32_t *expected_ticks;
+static uint32_t expected_tick_count;
+static uint32_t expected_tick_max;
+
+static void callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  Timer_t *timer = data;
+  uint32_t now = sleeptimer_host_counter();
+
+  TEST_ASSERT(handle == &timer->handle);
+  TEST_ASSERT((now - timer->expected) <= timer->slack + SLEEPTIMER_HOST_COMPARE_MIN_DIFF);
+  timer->expiration_count++;
+  timer->last_tick = now;
+  if (expected_tick_count < expected_tick_max) {
+    expected_ticks[expected_tick_count++] = timer->expected;
+  }
+  timer->expected += timer->period;
+}
+
+static void start(Timer_t *timer, uint32_t timeout, uint32_t period)
+{
+  memset(timer, 0, sizeof(*timer));
+  timer->expected = sleeptimer_host_counter() + timeout;
+  timer->period = period;
+  if (period != 0U) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_periodic_timer(&timer->handle, period, callback, timer, 0, 0));
+  } else {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_start_timer(&timer->handle, timeout, callback, timer, 0, 0));
+  }
+}
+
+static void set_slack(Timer_t *timer, uint32_t slack)
+{
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_set_timer_slack(&timer->handle, slack));
+  timer->slack = slack;
+}
+
+// Number of entries of the slack table that other timers can take
+static uint32_t free_slack_entries(void)
+{
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+    start(&probes[i], 100000U, 0U);
+    if (sl_sleeptimer_set_timer_slack(&probes[i].handle, 10) == SL_STATUS_OK) {
+      count++;
+    }
+  }
+  for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&probes[i].handle));
+  }
+  return count;
+}
+
+// Slacks only go to running timers, and leave with them
+static void test_slack_table(void)
+{
+  Timer_t *timer = &timers[0];
+
+  TEST_ASSERT_EQUAL(SL_STATUS_NULL_POINTER, sl_sleeptimer_set_timer_slack(NULL, 10));
+  TEST_ASSERT_EQUAL(SL_STATUS_INVALID_STATE, sl_sleeptimer_set_timer_slack(&timers[0].handle, 10));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_set_timer_slack(&timers[0].handle, 0));
+
+  // The table is full with one running timer per entry
+  for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+    start(&timers[i], 1000U, 0U);
+  }
+  for (uint32_t i = 0; i < SL_SLEEPTIMER_COALESCING_TIMER_COUNT; i++) {
+    set_slack(&timers[i], 10);
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_FULL, sl_sleeptimer_set_timer_slack(&timers[TIMER_COUNT - 1U].handle, 10));
+  // Changing the slack of a timer that has one takes no new entry
+  set_slack(&timers[0], 20);
+  // Removing a slack or stopping a timer frees its entry
+  set_slack(&timers[1], 0);
+  set_slack(&timers[TIMER_COUNT - 1U], 10);
+  TEST_ASSERT_EQUAL(SL_STATUS_FULL, sl_sleeptimer_set_timer_slack(&timers[1].handle, 10));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timers[2].handle));
+  set_slack(&timers[1], 10);
+  for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+    sl_sleeptimer_stop_timer(&timers[i].handle);
+  }
+  TEST_ASSERT_EQUAL(SL_SLEEPTIMER_COALESCING_TIMER_COUNT, free_slack_entries());
+
+  // A one-shot timer frees its entry when it expires, a periodic timer keeps it
+  start(&timers[0], 100U, 0U);
+  set_slack(&timers[0], 10);
+  start(&timers[1], 100U, 100U);
+  set_slack(&timers[1], 10);
+  sleeptimer_host_run(250);
+  TEST_ASSERT_EQUAL(1U, timers[0].expiration_count);
+  TEST_ASSERT_EQUAL(2U, timers[1].expiration_count);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timers[1].handle));
+  TEST_ASSERT_EQUAL(SL_SLEEPTIMER_COALESCING_TIMER_COUNT, free_slack_entries());
+
+  // So does a restart
+  start(timer, 100U, 0U);
+  set_slack(timer, 10);
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_restart_timer(&timer->handle, 100, callback, timer, 0, 0));
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timer->handle));
+  TEST_ASSERT_EQUAL(SL_SLEEPTIMER_COALESCING_TIMER_COUNT, free_slack_entries());
+}
+
+// A timer whose slack covers the next one shares its wakeup
+static void test_shared_wakeup(uint32_t slack, uint32_t wakeups)
+{
+  sl_sleeptimer_coalescing_stats_t stats;
+  uint32_t irq_count;
+  uint32_t now = sleeptimer_host_counter();
+
+  sl_sleeptimer_reset_coalescing_stats();
+  start(&timers[0], 1000U, 0U);
+  start(&timers[1], 1010U, 0U);
+  if (slack != 0U) {
+    set_slack(&timers[0], slack);
+  }
+  irq_count = sleeptimer_host_compare_irq_count;
+  sleeptimer_host_run(2000);
+  TEST_ASSERT_EQUAL(wakeups, sleeptimer_host_compare_irq_count - irq_count);
+  TEST_ASSERT_EQUAL(1U, timers[0].expiration_count);
+  TEST_ASSERT_EQUAL(1U, timers[1].expiration_count);
+  TEST_ASSERT_EQUAL((wakeups == 1U) ? 1010U : 1000U, timers[0].last_tick - now);
+  TEST_ASSERT_EQUAL(1010U, timers[1].last_tick - now);
+
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_coalescing_stats(&stats));
+  TEST_ASSERT_EQUAL(wakeups, stats.wakeup_count);
+  TEST_ASSERT_EQUAL(2U, stats.expiration_count);
+  TEST_ASSERT_EQUAL(2U - wakeups, stats.wakeup_saved_count);
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+// Periodic timers from 100 ms to 60 s, with a slack of a tenth of their
+// period for as many as the table takes
+static void test_periodic(uint32_t seconds)
+{
+  static const uint32_t periods_ms[TIMER_COUNT] = { 100, 250, 330, 1000, 1500, 5000, 7000, 10000, 30000, 60000 };
+  uint32_t run_ticks = seconds * SLEEPTIMER_HOST_FREQUENCY;
+  sl_sleeptimer_coalescing_stats_t stats;
+  uint32_t irq_count = sleeptimer_host_compare_irq_count;
+  uint32_t expirations = 0;
+  uint32_t distinct = 0;
+
+  expected_tick_max = (seconds * 10U * 11U) + 16U;
+  expected_ticks = malloc(expected_tick_max * sizeof(uint32_t));
+  TEST_ASSERT(expected_ticks != NULL);
+  expected_tick_count = 0;
+  sl_sleeptimer_reset_coalescing_stats();
+
+  for (uint32_t i = 0; i < sizeof(periods_ms) / sizeof(periods_ms[0]); i++) {
+    uint32_t period = (periods_ms[i] * SLEEPTIMER_HOST_FREQUENCY) / 1000U;
+
+    start(&timers[i], period, period);
+    if (i < SL_SLEEPTIMER_COALESCING_TIMER_COUNT) {
+      set_slack(&timers[i], period / 10U);
+    }
+  }
+  sleeptimer_host_run(run_ticks);
+  for (uint32_t i = 0; i < sizeof(periods_ms) / sizeof(periods_ms[0]); i++) {
+    TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_stop_timer(&timers[i].handle));
+    expirations += timers[i].expiration_count;
+  }
+
+  // Every distinct expiration tick took a wakeup, or was saved one
+  TEST_ASSERT(expected_tick_count < expected_tick_max);
+  qsort(expected_ticks, expected_tick_count, sizeof(uint32_t), compare_u32);
+  for (uint32_t i = 0; i < expected_tick_count; i++) {
+    distinct += (i == 0U || expected_ticks[i] != expected_ticks[i - 1U]) ? 1U : 0U;
+  }
+  TEST_ASSERT_EQUAL(SL_STATUS_OK, sl_sleeptimer_get_coalescing_stats(&stats));
+  TEST_ASSERT_EQUAL(expirations, stats.expiration_count);
+  TEST_ASSERT_EQUAL(stats.wakeup_count, sleeptimer_host_compare_irq_count - irq_count);
+  TEST_ASSERT_EQUAL(distinct, stats.wakeup_count + stats.wakeup_saved_count);
+  TEST_ASSERT(stats.wakeup_saved_count > distinct / 20U);
+  printf("%u s of periodic timers: %u expirations, %u wakeups, %u saved\n",
+         seconds, stats.expiration_count, stats.wakeup_count, stats.wakeup_saved_count);
+  free(expected_ticks);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t seconds = (uint32_t)host_arg(argc, argv, 1, 600);
+
+  sleeptimer_host_init();
+  test_slack_table();
+  test_shared_wakeup(0, 2);
+  test_shared_wakeup(20, 1);
+  test_periodic(seconds);
+  printf("test_sleeptimer_coalescing: passed\n");
+  return 0;
+}